@@ -0,0 +1,238 @@
+/*	Description
+	-----------
+	This command measures the batch functions of matrix_batch_utils.h against the per-matrix functions of matrix_utils.h which they replace
+	Both paths are evaluated serially over the same set of randomly generated transforms, so that the timings reflect the kernels rather than the threading
+	- Each timing is the fastest of the given number of iterations, measured in milliseconds
+	- The deviation is the largest absolute difference between the matrices produced by each path
+	- Euler rotations are compared by recomposing the batch result, as both paths may return different (but equivalent) solutions
+	The result is an array of strings with one entry per function, each entry is also displayed in the script editor
+
+	MEL Command
+	-----------
+	benchmarkMatrixBatch [-count int] [-iterations int]
+
+	Flags
+	-----
+	-count (-c)
+		This flag specifies the number of matrices processed by each function
+		The default value is 100000
+
+	-iterations (-i)
+		This flag specifies the number of times each function is evaluated
+		The default value is 10    */
+
+#include "benchmarkMatrixBatch_cmd.h"
+
+BenchmarkMatrixBatch::BenchmarkMatrixBatch() {}
+
+BenchmarkMatrixBatch::~BenchmarkMatrixBatch() {}
+
+// ------ Registration ------
+
+const char* BenchmarkMatrixBatch::kCountFlag = "-c";
+const char* BenchmarkMatrixBatch::kCountFlagLong = "-count";
+const char* BenchmarkMatrixBatch::kIterationsFlag = "-i";
+const char* BenchmarkMatrixBatch::kIterationsFlagLong = "-iterations";
+
+MSyntax BenchmarkMatrixBatch::newSyntax()
+{
+	MSyntax syntax;
+
+	// Flags
+	syntax.addFlag(kCountFlag, kCountFlagLong, MSyntax::kLong);
+	syntax.addFlag(kIterationsFlag, kIterationsFlagLong, MSyntax::kLong);
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+}
+
+// ------ Helpers ------
+
+namespace
+{
+	// Returns the fastest time of the given number of evaluations in milliseconds
+	template <typename Function>
+	double timeFunction(unsigned int iterations, const Function& func)
+	{
+		double bestTime = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < iterations; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			bestTime = std::min(bestTime, elapsed.count());
+		}
+
+		return bestTime;
+	}
+
+	double maxDeviation(const std::vector<MMatrix>& a, const std::vector<MMatrix>& b)
+	{
+		double deviation = 0.0;
+		for (size_t i = 0; i < a.size(); ++i)
+			for (unsigned int row = 0; row < 4; ++row)
+				for (unsigned int column = 0; column < 4; ++column)
+					deviation = std::max(deviation, std::abs(a[i](row, column) - b[i](row, column)));
+
+		return deviation;
+	}
+}
+
+void BenchmarkMatrixBatch::appendTiming(const MString& name, double perMatrixTime, double batchTime, double maxDeviation)
+{
+	MString result;
+	result.format("^1s : per-matrix ^2s ms, batch ^3s ms, speedup ^4sx, max deviation ^5s", name, MString() + perMatrixTime, MString() + batchTime,
+		MString() + (batchTime > 0.0 ? perMatrixTime / batchTime : 0.0), MString() + maxDeviation);
+
+	displayInfo(result);
+	appendToResult(result);
+}
+
+// ------ MPxCommand ------
+
+#define kErrorParsingFlag \
+	"Error parsing flag \"^1s\"."
+
+#define kErrorInvalidValue \
+	"The \"^1s\" flag must be given a value greater than 0."
+
+bool BenchmarkMatrixBatch::isUndoable() const
+{
+	return false;
+}
+
+MStatus BenchmarkMatrixBatch::doIt(const MArgList& args)
+{
+	MStatus status;
+
+	// Argument list parser
+	MArgDatabase argParser(syntax(), args, &status);
+	if (!status)
+		return status;
+
+	// Parse command flags
+	int count = 100000;
+	int iterations = 10;
+	const char* flags[2] = { kCountFlagLong, kIterationsFlagLong };
+	int* values[2] = { &count, &iterations };
+	for (unsigned int i = 0; i < 2; ++i)
+	{
+		if (!argParser.isFlagSet(flags[i]))
+			continue;
+
+		MString msg;
+		if (!argParser.getFlagArgument(flags[i], 0, *values[i]))
+		{
+			msg.format(kErrorParsingFlag, flags[i]);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+		if (*values[i] <= 0)
+		{
+			msg.format(kErrorInvalidValue, flags[i]);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+	}
+
+	// Generate transforms with non-uniform (and occasionally negative) scale, a fixed seed gives each run the same inputs
+	unsigned int size = (unsigned)count;
+	std::mt19937 generator(0);
+	std::uniform_real_distribution<double> angleDistribution(-M_PI, M_PI);
+	std::uniform_real_distribution<double> translationDistribution(-100.0, 100.0);
+	std::uniform_real_distribution<double> scaleDistribution(0.1, 10.0);
+	std::uniform_int_distribution<int> orderDistribution(0, 5);
+
+	std::vector<MVector> translation(size);
+	std::vector<MQuaternion> quaternion(size);
+	std::vector<MEulerRotation> euler(size);
+	std::vector<MVector> scale(size);
+	std::vector<MEulerRotation::RotationOrder> rotationOrder(size);
+	for (unsigned int i = 0; i < size; ++i)
+	{
+		translation[i] = MVector{ translationDistribution(generator), translationDistribution(generator), translationDistribution(generator) };
+		rotationOrder[i] = (MEulerRotation::RotationOrder)orderDistribution(generator);
+		euler[i] = MEulerRotation{ angleDistribution(generator), angleDistribution(generator), angleDistribution(generator), rotationOrder[i] };
+		quaternion[i] = euler[i].asQuaternion();
+		scale[i] = MVector{ scaleDistribution(generator), scaleDistribution(generator), scaleDistribution(generator) };
+		if (i % 4 == 0)
+			scale[i].z = -scale[i].z;
+	}
+
+	std::vector<MMatrix> perMatrixResult(size);
+	std::vector<MMatrix> batchResult(size);
+	std::vector<MMatrix> transforms(size);
+	for (unsigned int i = 0; i < size; ++i)
+		transforms[i] = MRS::composeMatrix(translation[i], euler[i], scale[i]);
+
+	MString header;
+	header.format("Matrix batch benchmark : ^1s matrices, ^2s iterations, AVX2 ^3s", MString() + count, MString() + iterations,
+		MRS::getSimdLevel() == MRS::kSimdAVX2 ? "enabled" : "disabled");
+	displayInfo(header);
+
+	// --- Multiply ---
+	std::vector<MMatrix> reversedTransforms(transforms.rbegin(), transforms.rend());
+	double perMatrixTime = timeFunction(iterations, [&]()
+	{
+		for (unsigned int i = 0; i < size; ++i)
+			perMatrixResult[i] = transforms[i] * reversedTransforms[i];
+	});
+	double batchTime = timeFunction(iterations, [&]()
+	{
+		MRS::multiplyMatrixBatch(transforms.data(), reversedTransforms.data(), size, batchResult.data());
+	});
+	appendTiming("multiply", perMatrixTime, batchTime, maxDeviation(perMatrixResult, batchResult));
+
+	// --- Compose ---
+	perMatrixTime = timeFunction(iterations, [&]()
+	{
+		for (unsigned int i = 0; i < size; ++i)
+			perMatrixResult[i] = MRS::composeMatrix(translation[i], quaternion[i], scale[i]);
+	});
+	batchTime = timeFunction(iterations, [&]()
+	{
+		MRS::composeMatrixBatch(translation.data(), quaternion.data(), scale.data(), size, batchResult.data());
+	});
+	appendTiming("composeQuaternion", perMatrixTime, batchTime, maxDeviation(perMatrixResult, batchResult));
+
+	perMatrixTime = timeFunction(iterations, [&]()
+	{
+		for (unsigned int i = 0; i < size; ++i)
+			perMatrixResult[i] = MRS::composeMatrix(translation[i], euler[i], scale[i]);
+	});
+	batchTime = timeFunction(iterations, [&]()
+	{
+		MRS::composeMatrixBatch(translation.data(), euler.data(), scale.data(), size, batchResult.data());
+	});
+	appendTiming("composeEuler", perMatrixTime, batchTime, maxDeviation(perMatrixResult, batchResult));
+
+	// --- Decompose ---
+	std::vector<MVector> outTranslation(size);
+	std::vector<MQuaternion> outQuaternion(size);
+	std::vector<MEulerRotation> outEuler(size);
+	std::vector<MVector> outScale(size);
+
+	perMatrixTime = timeFunction(iterations, [&]()
+	{
+		for (unsigned int i = 0; i < size; ++i)
+			MRS::decomposeMatrix(transforms[i], rotationOrder[i], outTranslation[i], outQuaternion[i], outEuler[i], outScale[i]);
+	});
+	for (unsigned int i = 0; i < size; ++i)
+		perMatrixResult[i] = MRS::composeMatrix(outTranslation[i], outQuaternion[i], outScale[i]);
+
+	batchTime = timeFunction(iterations, [&]()
+	{
+		MRS::decomposeMatrixBatch(transforms.data(), rotationOrder.data(), size, outTranslation.data(), outQuaternion.data(), outEuler.data(), outScale.data());
+	});
+	for (unsigned int i = 0; i < size; ++i)
+		batchResult[i] = MRS::composeMatrix(outTranslation[i], outQuaternion[i], outScale[i]);
+	appendTiming("decomposeQuaternion", perMatrixTime, batchTime, maxDeviation(perMatrixResult, batchResult));
+
+	for (unsigned int i = 0; i < size; ++i)
+		batchResult[i] = MRS::composeMatrix(outTranslation[i], outEuler[i], outScale[i]);
+	appendTiming("decomposeEuler", perMatrixTime, batchTime, maxDeviation(transforms, batchResult));
+
+	return MStatus::kSuccess;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <maya/MArgDataBase.h>
+#include <maya/MArgList.h>
+#include <maya/MEulerRotation.h>
+#include <maya/MMatrix.h>
+#include <maya/MPxCommand.h>
+#include <maya/MQuaternion.h>
+#include <maya/MString.h>
+#include <maya/MSyntax.h>
+#include <maya/MVector.h>
+
+#include "utils/matrix_batch_utils.h"
+#include "utils/matrix_utils.h"
+#include "utils/simd_utils.h"
+
+class BenchmarkMatrixBatch : public MPxCommand
+{
+public:
+	BenchmarkMatrixBatch();
+	~BenchmarkMatrixBatch() override;
+
+	// ------ Registration ------
+	static const MString kCommandName;
+	static MSyntax newSyntax();
+
+	// ------ Const ------
+	static const char* kCountFlag;
+	static const char* kCountFlagLong;
+	static const char* kIterationsFlag;
+	static const char* kIterationsFlagLong;
+
+	// ------ MPxCommand ------
+	bool isUndoable() const override;
+	MStatus doIt(const MArgList&) override;
+
+private:
+	// ------ Helpers ------
+	void appendTiming(const MString& name, double perMatrixTime, double batchTime, double maxDeviation);
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <maya/MFnPlugin.h>
 
+#include "benchmarkMatrixBatch_cmd.h"
 #include "undoModifier_cmd.h"
 
 #include "utils/macros.h"
@@ -7,6 +8,7 @@
 
 // ------ Const ---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+const MString BenchmarkMatrixBatch::kCommandName = "benchmarkMatrixBatch";
 const MString UndoModifier::kCommandName = "undoModifier";
 
 // ------ Exports -------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -25,6 +27,8 @@ MStatus initializePlugin(MObject pluginObj)
 	pluginFn.setName(MRS_XSTR(TARGET_NAME));
 
 	// Register
+	errorMessage.format(kErrorPluginRegistration, BenchmarkMatrixBatch::kCommandName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerCommand<BenchmarkMatrixBatch>(pluginFn, true /* syntax */), errorMessage);
 	errorMessage.format(kErrorPluginRegistration, UndoModifier::kCommandName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerCommand<UndoModifier>(pluginFn, true /* syntax */), errorMessage);
 
@@ -38,6 +42,8 @@ MStatus uninitializePlugin(MObject pluginObj)
 	MFnPlugin pluginFn(pluginObj);
 
 	// Deregister
+	errorMessage.format(kErrorPluginDeregistration, BenchmarkMatrixBatch::kCommandName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterCommand<BenchmarkMatrixBatch>(pluginFn), errorMessage);
 	errorMessage.format(kErrorPluginDeregistration, UndoModifier::kCommandName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterCommand<UndoModifier>(pluginFn), errorMessage);
 
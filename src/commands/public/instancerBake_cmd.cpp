@@ -7,6 +7,8 @@
 	- It relies upon the internal "id" array to determine which instances are visible at each frame, whilst the "position" array is a logical requirement
 	- If the "id" array is not filled with unique ids, this command will fail to bake any instances
 	- If the id of a given instance exists momentarily in the array, the visibility attribute of each hierarchy will be used to reflect this change in state
+	The particle data is evaluated under a context for each sample time, therefore the current time of the scene does not change whilst baking
+	- Rotations are derived directly from the "rotation" or aim data, all samples are buffered and each anim curve is keyed by a single operation
 
 	Limitations
 	-----------
@@ -92,6 +94,7 @@ const char* InstancerBake::kDeleteInstancerFlag = "-di";
 const char* InstancerBake::kDeleteInstancerFlagLong = "-deleteInstancer";
 const char* InstancerBake::kDeleteSourceHierarchiesFlag = "-dsh";
 const char* InstancerBake::kDeleteSourceHierarchiesFlagLong = "-deleteSourceHierarchies";
+const double InstancerBake::kBasisTolerance = 1e-6;
 
 MSyntax InstancerBake::newSyntax()
 {
@@ -156,6 +159,15 @@ MSyntax InstancerBake::newSyntax()
 #define kErrorInvalidParticleObjectIndex \
 	"Invalid object index ^1s, assigned to particle id ^2s. There are ^3s input hierarchies connected to \"^4s.inputHierarchy\""
 
+#define kErrorDuplicateFailed \
+	"Failed to duplicate input hierarchy \"^1s\"."
+
+#define kErrorInvalidRotationOrder \
+	"Unsupported value ^1s assigned to \"^2s.rotationOrder\"."
+
+#define kErrorAnimCurveFailed \
+	"Failed to create anim curve for baked duplicate channel."
+
 bool InstancerBake::isUndoable() const
 {
 	return true;
@@ -376,50 +388,55 @@ MStatus InstancerBake::doIt(const MArgList& args)
 		parentSelList.getDagPath(0, parentPath);
 	}
 
-	// Create aim node for calculating rotation
-	MObject aimConstraintObj = m_dagMod.createNode("aimConstraint");
-	m_dagMod.doIt();
-
-	// Retrieve plugs
-	MFnDependencyNode fnDepAimConstraint{ aimConstraintObj };
-	MPlug targetPlug = fnDepAimConstraint.findPlug("target", false);
-	targetPlug = targetPlug.elementByLogicalIndex(0);
-	MPlug aimDirection = targetPlug.child(fnDepAimConstraint.attribute("targetTranslate"));
-	MPlug aimDirectionXPlug = aimDirection.child(fnDepAimConstraint.attribute("targetTranslateX"));
-	MPlug aimDirectionYPlug = aimDirection.child(fnDepAimConstraint.attribute("targetTranslateY"));
-	MPlug aimDirectionZPlug = aimDirection.child(fnDepAimConstraint.attribute("targetTranslateZ"));
-	MPlug aimAxisXPlug = fnDepAimConstraint.findPlug("aimVectorX", false);
-	MPlug aimAxisYPlug = fnDepAimConstraint.findPlug("aimVectorY", false);
-	MPlug aimAxisZPlug = fnDepAimConstraint.findPlug("aimVectorZ", false);
-	MPlug aimWorldUpDirectionXPlug = fnDepAimConstraint.findPlug("worldUpVectorX", false);
-	MPlug aimWorldUpDirectionYPlug = fnDepAimConstraint.findPlug("worldUpVectorY", false);
-	MPlug aimWorldUpDirectionZPlug = fnDepAimConstraint.findPlug("worldUpVectorZ", false);
-	MPlug aimUpAxisXPlug = fnDepAimConstraint.findPlug("upVectorX", false);
-	MPlug aimUpAxisYPlug = fnDepAimConstraint.findPlug("upVectorY", false);
-	MPlug aimUpAxisZPlug = fnDepAimConstraint.findPlug("upVectorZ", false);
-	MPlug outRotateXPlug = fnDepAimConstraint.findPlug("constraintRotateX", false);
-	MPlug outRotateYPlug = fnDepAimConstraint.findPlug("constraintRotateY", false);
-	MPlug outRotateZPlug = fnDepAimConstraint.findPlug("constraintRotateZ", false);
-
-	// Create/keyframe duplicates using data
-	MTime currentTime = MAnimControl::currentTime();
+	// --- Sampling ---
+	// The particle data is evaluated under a context for each sample time, the global time is never changed
+	// - Changing the global time would evaluate (and potentially redraw) every node in the scene for each sample
+	// Samples are buffered for each channel of each duplicate, every anim curve is then created and keyed by a single call
 	MTime iterTime = startTime;
 	MPlug inputPointsPlug = fnDepInstancer.findPlug("inputPoints", false);
 	MPlug instanceCountPlug = fnDepInstancer.findPlug("instanceCount", false);
+	MPlug rotationOrderPlug = fnDepInstancer.findPlug("rotationOrder", false);
 
 	std::unordered_map<short, short> rotationOrderMap{ {0, 0}, { 1, 3 }, { 2, 4 }, { 3, 1 }, { 4, 2 }, { 5, 5 }};
 	std::unordered_map<int, Duplicate> seenIdMap;
 	std::unordered_set<int> hiddenIds;
+	// Ids are also stored in the order they were first seen so that duplicates are created in a deterministic order
+	std::vector<int> seenIds;
+
+	MPlug parentWorldMatrixPlug;
+	if (parentPath.isValid())
+		parentWorldMatrixPlug = MFnDependencyNode{ parentPath.node() }.findPlug("worldMatrix", false).elementByLogicalIndex(parentPath.instanceNumber());
 
 	while (iterTime <= endTime)
 	{
-		MAnimControl::setCurrentTime(iterTime);
+		MDGContext timeContext{ iterTime };
+		MObject particleDataObj;
+		unsigned int instanceCount;
+		short inputRotationOrder;
+		{
+			MDGContextGuard contextGuard{ timeContext };
+			particleDataObj = inputPointsPlug.asMObject();
+			instanceCount = instanceCountPlug.asInt();
+			inputRotationOrder = rotationOrderPlug.asShort();
+		}
+
+		// The instancer enum does not share the ordering of the transform enum, it must be remapped
+		auto itRotationOrder = rotationOrderMap.find(inputRotationOrder);
+		if (itRotationOrder == rotationOrderMap.end())
+		{
+			MString msg;
+			MString msgFormat = kErrorInvalidRotationOrder;
+			MString rotationOrderString;
+			rotationOrderString += (int)inputRotationOrder;
+			msg.format(msgFormat, rotationOrderString, instancerPath.partialPathName());
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+		short instancerRotationOrder = itRotationOrder->second;
 
 		// Get the particle data from the instancer node's "inputPoints" plug
 		// Ensure each of the required internal arrays exists and contain the same number of elements
-		MObject particleDataObj = inputPointsPlug.asMObject();
 		MFnArrayAttrsData fnParticleData{ particleDataObj };
-		unsigned int instanceCount = instanceCountPlug.asInt();
 
 		// --- Required Data ---
 		// ids
@@ -634,7 +651,7 @@ MStatus InstancerBake::doIt(const MArgList& args)
 
 		for (unsigned int i = 0; i < visibleIds.length(); ++i)
 		{
-			// If the particle id has not been seen, create a new duplicate
+			// If the particle id has not been seen, register a new duplicate (the DAG nodes are created once sampling has completed)
 			if (hiddenIds.erase(visibleIds[i]) == 0)
 			{
 				// We are currently not supporting cycling input hierarchies, therefore the objectIndex used to duplicate the geometry will not change
@@ -652,99 +669,53 @@ MStatus InstancerBake::doIt(const MArgList& args)
 					return MStatus::kFailure;
 				}
 
-				MString duplicateName = instancerName + "_particle" + MRS::getPaddedInt(std::abs(visibleIds[i])) + "_" + inputHierarchyNames[objectIndex];
-				MString duplicateResult;
-				if (instanceState)
-				{
-					MStringArray duplicates;
-					MString duplicateCmd = "instance " + inputHierarchyPathArray[objectIndex].partialPathName();
-					MGlobal::executeCommand(duplicateCmd, duplicates, false, true);
-					duplicateResult = duplicates[0];
-				}
-				else
-				{
-					MStringArray duplicates;
-					MString duplicateCmd = "duplicate " + inputHierarchyPathArray[objectIndex].partialPathName();
-					MGlobal::executeCommand(duplicateCmd, duplicates, false, true);
-					duplicateResult = duplicates[0];
-				}
-
-				if (parentPath.isValid())
-				{
-					MStringArray duplicates;
-					MString parentCmd = "parent -relative " + duplicateResult + " " + parentPath.partialPathName();
-					MGlobal::executeCommand(parentCmd, duplicates, false, true);
-					duplicateResult = duplicates[0];
-				}
-				else if (std::string{ duplicateResult.asChar() }.find("|") != std::string::npos)
-				{
-					MString parentCmd = "parent -world -relative " + duplicateResult;
-					duplicateResult = MGlobal::executeCommandStringResult(parentCmd, false, true);
-				}
-
-				MString renameCmd = "rename -ignoreShape " + duplicateResult + " " + duplicateName;
-				duplicateResult = MGlobal::executeCommandStringResult(renameCmd, false, true);
-
 				// Create a new struct to store duplicate data
 				Duplicate duplicate;
-				MSelectionList duplicateSelList;
-				duplicateSelList.add(duplicateResult);
-				duplicateSelList.getDagPath(0, duplicate.duplicatePath);
-				MFnDependencyNode fnDepDuplicate{ duplicate.duplicatePath.node() };
+				duplicate.objectIndex = objectIndex;
 
-				// Retrieve additional static transforms based on the inputSpace flag before connecting anim curves
+				// Retrieve additional static transforms based on the inputSpace flag
+				// Each duplicate is parented relatively, therefore it inherits the local transforms of its input hierarchy
 				if (inputSpace == 0)
 					duplicate.initialScale = { 1,1,1 };
 				if (inputSpace == 1)
 				{
-					MFnTransform fnTransform{ duplicate.duplicatePath };
+					MFnTransform fnTransform{ inputHierarchyPathArray[objectIndex] };
 					duplicate.initialPosition = fnTransform.getTranslation(MSpace::kTransform);
 					fnTransform.getRotation(duplicate.initialRotation);
 					fnTransform.getScale(&duplicate.initialScale.x);
 				}
 				else if (inputSpace == 2)
 				{
-					MMatrix worldMatrix = duplicate.duplicatePath.inclusiveMatrix();
+					// The world matrix of the parent must be evaluated at the current sample time as it may be animated
+					MMatrix parentMatrix;
+					if (parentPath.isValid())
+					{
+						MObject parentMatrixObj;
+						{
+							MDGContextGuard contextGuard{ timeContext };
+							parentMatrixObj = parentWorldMatrixPlug.asMObject();
+						}
+
+						parentMatrix = MFnMatrixData{ parentMatrixObj }.matrix();
+					}
+
+					MMatrix worldMatrix = MFnTransform{ inputHierarchyPathArray[objectIndex] }.transformationMatrix() * parentMatrix;
 					MTransformationMatrix fnTransWorldMat{ worldMatrix };
 					duplicate.initialPosition = { worldMatrix[3][0], worldMatrix[3][1], worldMatrix[3][2] };
 					duplicate.initialRotation = fnTransWorldMat.eulerRotation();
 					fnTransWorldMat.getScale(&duplicate.initialScale.x, MSpace::kTransform);
 				}
 
-				// Retrieve relevent keyable plugs
-				MPlug translateXPlug = fnDepDuplicate.findPlug("translateX", false);
-				MPlug translateYPlug = fnDepDuplicate.findPlug("translateY", false);
-				MPlug translateZPlug = fnDepDuplicate.findPlug("translateZ", false);
-				MPlug rotateXPlug = fnDepDuplicate.findPlug("rotateX", false);
-				MPlug rotateYPlug = fnDepDuplicate.findPlug("rotateY", false);
-				MPlug rotateZPlug = fnDepDuplicate.findPlug("rotateZ", false);
-				MPlug scaleXPlug = fnDepDuplicate.findPlug("scaleX", false);
-				MPlug scaleYPlug = fnDepDuplicate.findPlug("scaleY", false);
-				MPlug scaleZPlug = fnDepDuplicate.findPlug("scaleZ", false);
-				MPlug rotateOrderPlug = fnDepDuplicate.findPlug("rotateOrder", false);
-				MPlug visibilityPlug = fnDepDuplicate.findPlug("visibility", false);
-
-				// Create a new animCurve for each keyable attribute
-				// MFnAnimCurve::create() will invoke doIt() on the modifier, creating a new anim curve and connecting it to the plug
-				MFnAnimCurve fnAnimCurve;
-				duplicate.translateXAnimCurveObj = fnAnimCurve.create(translateXPlug, MFnAnimCurve::kAnimCurveTL, &m_dagMod, &status);
-				duplicate.translateYAnimCurveObj = fnAnimCurve.create(translateYPlug, MFnAnimCurve::kAnimCurveTL, &m_dagMod, &status);
-				duplicate.translateZAnimCurveObj = fnAnimCurve.create(translateZPlug, MFnAnimCurve::kAnimCurveTL, &m_dagMod, &status);
-				duplicate.rotateXAnimCurveObj = fnAnimCurve.create(rotateXPlug, MFnAnimCurve::kAnimCurveTA, &m_dagMod, &status);
-				duplicate.rotateYAnimCurveObj = fnAnimCurve.create(rotateYPlug, MFnAnimCurve::kAnimCurveTA, &m_dagMod, &status);
-				duplicate.rotateZAnimCurveObj = fnAnimCurve.create(rotateZPlug, MFnAnimCurve::kAnimCurveTA, &m_dagMod, &status);
-				duplicate.scaleXAnimCurveObj = fnAnimCurve.create(scaleXPlug, MFnAnimCurve::kAnimCurveTU, &m_dagMod, &status);
-				duplicate.scaleYAnimCurveObj = fnAnimCurve.create(scaleYPlug, MFnAnimCurve::kAnimCurveTU, &m_dagMod, &status);
-				duplicate.scaleZAnimCurveObj = fnAnimCurve.create(scaleZPlug, MFnAnimCurve::kAnimCurveTU, &m_dagMod, &status);
-				duplicate.rotateOrderAnimCurveObj = fnAnimCurve.create(rotateOrderPlug, MFnAnimCurve::kAnimCurveTU, &m_dagMod, &status);
-				duplicate.visibilityAnimCurveObj = fnAnimCurve.create(visibilityPlug, MFnAnimCurve::kAnimCurveTU, &m_dagMod, &status);
-
 				// If the duplicate is visible when created, we want it to be invisible on all preceeding frames
 				if (iterTime != startTime)
-					fnAnimCurve.addKey(iterTime - timeStep, false, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
+				{
+					duplicate.visibilityKeyTimes.append(iterTime - timeStep);
+					duplicate.visibilityKeyValues.append(0.0);
+				}
 
 				// Cache data
 				seenIdMap.insert(std::pair<int, Duplicate>{ visibleIds[i], duplicate });
+				seenIds.push_back(visibleIds[i]);
 			}
 
 			// Update the transforms of the duplicate
@@ -765,10 +736,9 @@ MStatus InstancerBake::doIt(const MArgList& args)
 				if (rotations.length())
 					rotation = rotations[i];
 
-				rotationOrder = fnDepInstancer.findPlug("rotationOrder", false).asShort();
-				rotationOrder = rotationOrderMap.find(rotationOrder)->second;
 				// We are assuming the input rotation is already ordered in the current order (ie. the x,y,z components will not change)
 				// The output particle data which connects to the instancer should be using the same rotation order
+				rotationOrder = instancerRotationOrder;
 				rotation.order = (MEulerRotation::RotationOrder)rotationOrder;
 			}
 			else
@@ -797,26 +767,8 @@ MStatus InstancerBake::doIt(const MArgList& args)
 				MVector aimUpAxis{ 0,1,0 };
 				if (aimUpAxes.length())
 					aimUpAxis = aimUpAxes[i];
-				
-				aimDirection.normalize();
-				aimAxis.normalize();
-				aimWorldUpDirection.normalize();
-				aimUpAxis.normalize();
-
-				aimDirectionXPlug.setDouble(aimDirection.x);
-				aimDirectionYPlug.setDouble(aimDirection.y);
-				aimDirectionZPlug.setDouble(aimDirection.z);
-				aimAxisXPlug.setDouble(aimAxis.x);
-				aimAxisYPlug.setDouble(aimAxis.y);
-				aimAxisZPlug.setDouble(aimAxis.z);
-				aimWorldUpDirectionXPlug.setDouble(aimWorldUpDirection.x);
-				aimWorldUpDirectionYPlug.setDouble(aimWorldUpDirection.y);
-				aimWorldUpDirectionZPlug.setDouble(aimWorldUpDirection.z);
-				aimUpAxisXPlug.setDouble(aimUpAxis.x);
-				aimUpAxisYPlug.setDouble(aimUpAxis.y);
-				aimUpAxisZPlug.setDouble(aimUpAxis.z);
-
-				rotation = MEulerRotation{ outRotateXPlug.asDouble(), outRotateYPlug.asDouble(), outRotateZPlug.asDouble() };
+
+				rotation = MRS::extractEulerRotation(computeAimMatrix(aimDirection, aimAxis, aimWorldUpDirection, aimUpAxis));
 			}
 
 			MVector scale{ 1,1,1 };
@@ -844,45 +796,107 @@ MStatus InstancerBake::doIt(const MArgList& args)
 			rotation.reorderIt((MEulerRotation::RotationOrder)rotationOrder);
 			compositionMatrix.getScale(&scale.x, MSpace::kPostTransform);
 
-			// Set keyframes
-			MFnAnimCurve fnAnimCurve;
-			fnAnimCurve.setObject(duplicate.translateXAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, position.x, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.translateYAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, position.y, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.translateZAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, position.z, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.rotateXAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, rotation.x, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.rotateYAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, rotation.y, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.rotateZAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, rotation.z, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.scaleXAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, scale.x, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.scaleYAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, scale.y, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.scaleZAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, scale.z, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.rotateOrderAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, rotationOrder, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
-			fnAnimCurve.setObject(duplicate.visibilityAnimCurveObj);
-			fnAnimCurve.addKey(iterTime, visibility, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
+			// Buffer samples
+			duplicate.keyTimes.append(iterTime);
+			duplicate.translateXKeyValues.append(position.x);
+			duplicate.translateYKeyValues.append(position.y);
+			duplicate.translateZKeyValues.append(position.z);
+			duplicate.rotateXKeyValues.append(rotation.x);
+			duplicate.rotateYKeyValues.append(rotation.y);
+			duplicate.rotateZKeyValues.append(rotation.z);
+			duplicate.scaleXKeyValues.append(scale.x);
+			duplicate.scaleYKeyValues.append(scale.y);
+			duplicate.scaleZKeyValues.append(scale.z);
+			duplicate.rotateOrderKeyValues.append(rotationOrder);
+			duplicate.visibilityKeyTimes.append(iterTime);
+			duplicate.visibilityKeyValues.append(visibility);
 		}
 
 		// Hide all of the particles whose ids are contained in the hiddenIds set
 		for (auto itHidden = hiddenIds.cbegin(); itHidden != hiddenIds.cend(); ++itHidden)
 		{
 			Duplicate& duplicate = seenIdMap.find(*itHidden)->second;
-			MFnAnimCurve fnAnimCurve{ duplicate.visibilityAnimCurveObj };
-			fnAnimCurve.addKey(iterTime, false, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &m_animChangeMod, &status);
+			duplicate.visibilityKeyTimes.append(iterTime);
+			duplicate.visibilityKeyValues.append(0.0);
 		}
 
 		iterTime += timeStep;
 	}
 
-	// Restore the previous time
-	MAnimControl::setCurrentTime(currentTime);
+	// --- Duplicates ---
+	// Every visible id is now known, the duplicates of all particles are created before their names and parents are assigned by a single modifier
+	// The new hierarchies are not created by the modifier, therefore their deletion is queued by a separate modifier which is only executed on undo
+	MObject parentObj = parentPath.isValid() ? parentPath.node() : MObject::kNullObj;
+	std::vector<MObject> duplicateObjs;
+	duplicateObjs.reserve(seenIds.size());
+
+	for (int id : seenIds)
+	{
+		Duplicate& duplicate = seenIdMap.find(id)->second;
+
+		// Instancing will instance each child of the new root, matching the behaviour of the instance command
+		MFnDagNode fnInputHierarchy{ inputHierarchyPathArray[duplicate.objectIndex] };
+		MObject duplicateObj = fnInputHierarchy.duplicate(instanceState, false, &status);
+		if (!status)
+		{
+			MString msg;
+			MString msgFormat = kErrorDuplicateFailed;
+			msg.format(msgFormat, inputHierarchyPathArray[duplicate.objectIndex].partialPathName());
+			displayError(msg);
+			// Remove the duplicates which have already been created
+			m_duplicateMod.doIt();
+			return MStatus::kFailure;
+		}
+
+		// Reparenting is relative, the duplicate retains the local transforms of its input hierarchy
+		MObject currentParentObj = MFnDagNode{ duplicateObj }.parent(0);
+		bool isParented = parentObj.isNull() ? currentParentObj.hasFn(MFn::kWorld) : currentParentObj == parentObj;
+		if (!isParented)
+			m_dagMod.reparentNode(duplicateObj, parentObj);
+
+		MString duplicateName = instancerName + "_particle" + MRS::getPaddedInt(std::abs(id)) + "_" + inputHierarchyNames[duplicate.objectIndex];
+		m_dagMod.renameNode(duplicateObj, duplicateName);
+		m_duplicateMod.deleteNode(duplicateObj);
+		duplicateObjs.push_back(duplicateObj);
+	}
+
+	status = m_dagMod.doIt();
+	if (!status)
+		return status;
+
+	for (unsigned int i = 0; i < seenIds.size(); ++i)
+		MDagPath::getAPathTo(duplicateObjs[i], seenIdMap.find(seenIds[i])->second.duplicatePath);
+
+	// --- Keyframes ---
+	// Samples are written to each anim curve as a single operation
+	for (int id : seenIds)
+	{
+		Duplicate& duplicate = seenIdMap.find(id)->second;
+		MFnDependencyNode fnDepDuplicate{ duplicate.duplicatePath.node() };
+
+		status = createAnimCurve(fnDepDuplicate.findPlug("translateX", false), MFnAnimCurve::kAnimCurveTL, duplicate.keyTimes, duplicate.translateXKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("translateY", false), MFnAnimCurve::kAnimCurveTL, duplicate.keyTimes, duplicate.translateYKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("translateZ", false), MFnAnimCurve::kAnimCurveTL, duplicate.keyTimes, duplicate.translateZKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("rotateX", false), MFnAnimCurve::kAnimCurveTA, duplicate.keyTimes, duplicate.rotateXKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("rotateY", false), MFnAnimCurve::kAnimCurveTA, duplicate.keyTimes, duplicate.rotateYKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("rotateZ", false), MFnAnimCurve::kAnimCurveTA, duplicate.keyTimes, duplicate.rotateZKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("scaleX", false), MFnAnimCurve::kAnimCurveTU, duplicate.keyTimes, duplicate.scaleXKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("scaleY", false), MFnAnimCurve::kAnimCurveTU, duplicate.keyTimes, duplicate.scaleYKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("scaleZ", false), MFnAnimCurve::kAnimCurveTU, duplicate.keyTimes, duplicate.scaleZKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("rotateOrder", false), MFnAnimCurve::kAnimCurveTU, duplicate.keyTimes, duplicate.rotateOrderKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+		status = createAnimCurve(fnDepDuplicate.findPlug("visibility", false), MFnAnimCurve::kAnimCurveTU, duplicate.visibilityKeyTimes, duplicate.visibilityKeyValues);
+		MRS_CHECK_ERROR_RETURN_MSTATUS(status, kErrorAnimCurveFailed);
+	}
 
 	// Delete instancer related nodes if specified
 	if (deleteSourceHierarchiesState)
@@ -893,19 +907,21 @@ MStatus InstancerBake::doIt(const MArgList& args)
 	if (deleteInstancerState)
 		m_dagMod.deleteNode(instancerPath.node());
 
-	// Cleanup
-	m_dagMod.deleteNode(aimConstraintObj);
 	m_dagMod.doIt();
 
 	return status;
 }
 
-// Creates animCurve nodes and sets keyframes
+// Restores the duplicates, then creates animCurve nodes and sets keyframes
 MStatus InstancerBake::redoIt()
 {
 	MStatus status;
 
-	status = m_dagMod.doIt();
+	status = m_duplicateMod.undoIt();
+	if (status)
+	{
+		status = m_dagMod.doIt();
+	}
 	if (status)
 	{
 		status = m_animChangeMod.redoIt();
@@ -914,7 +930,7 @@ MStatus InstancerBake::redoIt()
 	return status;
 }
 
-// Deletes keyframes then deletes animCurve nodes
+// Deletes keyframes then deletes animCurve nodes, then deletes the duplicates
 MStatus InstancerBake::undoIt()
 {
 	MStatus status;
@@ -924,10 +940,62 @@ MStatus InstancerBake::undoIt()
 	{
 		status = m_dagMod.undoIt();
 	}
+	if (status)
+	{
+		status = m_duplicateMod.doIt();
+	}
 
 	return status;
 }
 
+// ------ Helpers ------
+
+/*	Description
+	-----------
+	Computes the rotation which aligns the aim axis with the aim direction whilst aligning the up axis as closely as possible with the world up direction
+	This is equivalent to the rotation output by an aimConstraint whose world up type is set to "vector"
+	- Each pair of vectors is used to build an orthonormal basis, the rotation then maps the local (axis) basis onto the world (direction) basis
+	- If a pair of vectors is parallel, an arbitrary perpendicular vector will be used to complete the basis    */
+MMatrix InstancerBake::computeAimMatrix(const MVector& aimDirection, const MVector& aimAxis, const MVector& worldUpDirection, const MVector& upAxis)
+{
+	MMatrix axisBasis = computeBasis(aimAxis, upAxis);
+	MMatrix directionBasis = computeBasis(aimDirection, worldUpDirection);
+
+	// The axis basis is orthonormal, therefore its inverse is its transpose
+	return axisBasis.transpose() * directionBasis;
+}
+
+MMatrix InstancerBake::computeBasis(const MVector& primary, const MVector& secondary)
+{
+	MVector x = primary.isEquivalent(MVector::zero, kBasisTolerance) ? MVector::xAxis : primary.normal();
+	MVector z = x ^ secondary;
+
+	if (z.isEquivalent(MVector::zero, kBasisTolerance))
+		z = x ^ (std::abs(x.x) < 0.9 ? MVector::xAxis : MVector::yAxis);
+
+	z.normalize();
+	MVector y = z ^ x;
+
+	return MRS::matrixFromVectors(x, y, z, MVector::zero);
+}
+
+/*	Description
+	-----------
+	Creates an anim curve which drives the given plug then sets every buffered key as a single operation
+	MFnAnimCurve::create() will invoke doIt() on the modifier, creating a new anim curve and connecting it to the plug
+	The keys are recorded by the anim curve change so that they can be undone before the anim curve is deleted    */
+MStatus InstancerBake::createAnimCurve(const MPlug& plug, MFnAnimCurve::AnimCurveType curveType, MTimeArray& times, MDoubleArray& values)
+{
+	MStatus status;
+
+	MFnAnimCurve fnAnimCurve;
+	fnAnimCurve.create(plug, curveType, &m_dagMod, &status);
+	if (!status)
+		return status;
+
+	return fnAnimCurve.addKeys(&times, &values, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, false, &m_animChangeMod);
+}
+
 // Cleanup
 #undef kErrorFlagNotSet
 #undef kErrorParsingFlag
@@ -939,4 +1007,7 @@ MStatus InstancerBake::undoIt()
 #undef kWarningInvalidConnection
 #undef kErrorParticleDataRequired
 #undef kErrorParticleDataIncorrectSize
-#undef kErrorInvalidParticleObjectIndex
\ No newline at end of file
+#undef kErrorInvalidParticleObjectIndex
+#undef kErrorDuplicateFailed
+#undef kErrorInvalidRotationOrder
+#undef kErrorAnimCurveFailed
\ No newline at end of file
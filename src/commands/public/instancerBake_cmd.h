@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cmath>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <maya/MAnimControl.h>
 #include <maya/MAnimCurveChange.h>
@@ -13,10 +15,15 @@
 #include <maya/MDagPath.h>
 #include <maya/MDagPathArray.h>
 #include <maya/MDataHandle.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MEulerRotation.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnArrayAttrsData.h>
+#include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MFnMatrixData.h>
 #include <maya/MFnTransform.h>
 #include <maya/MGlobal.h>
 #include <maya/MMatrix.h>
@@ -27,29 +34,38 @@
 #include <maya/MStringArray.h>
 #include <maya/MSyntax.h>
 #include <maya/MTime.h>
+#include <maya/MTimeArray.h>
+#include <maya/MTransformationMatrix.h>
 #include <maya/MVectorArray.h>
 
+#include "utils/macros.h"
+#include "utils/matrix_utils.h"
 #include "utils/name_utils.h"
 
 struct Duplicate
 {
 	MDagPath duplicatePath;
+	unsigned int objectIndex;
 
 	MVector initialPosition;
 	MVector initialScale;
 	MEulerRotation initialRotation;
 
-	MObject translateXAnimCurveObj;
-	MObject translateYAnimCurveObj;
-	MObject translateZAnimCurveObj;
-	MObject rotateXAnimCurveObj;
-	MObject rotateYAnimCurveObj;
-	MObject rotateZAnimCurveObj;
-	MObject scaleXAnimCurveObj;
-	MObject scaleYAnimCurveObj;
-	MObject scaleZAnimCurveObj;
-	MObject rotateOrderAnimCurveObj;
-	MObject visibilityAnimCurveObj;
+	// Samples are buffered for each channel until sampling has completed
+	// The transform channels are only keyed whilst the particle is visible, the visibility channel is also keyed whilst it is hidden
+	MTimeArray keyTimes;
+	MDoubleArray translateXKeyValues;
+	MDoubleArray translateYKeyValues;
+	MDoubleArray translateZKeyValues;
+	MDoubleArray rotateXKeyValues;
+	MDoubleArray rotateYKeyValues;
+	MDoubleArray rotateZKeyValues;
+	MDoubleArray scaleXKeyValues;
+	MDoubleArray scaleYKeyValues;
+	MDoubleArray scaleZKeyValues;
+	MDoubleArray rotateOrderKeyValues;
+	MTimeArray visibilityKeyTimes;
+	MDoubleArray visibilityKeyValues;
 };
 
 class InstancerBake : public MPxCommand
@@ -81,6 +97,7 @@ public:
 	static const char* kDeleteInstancerFlagLong;
 	static const char* kDeleteSourceHierarchiesFlag;
 	static const char* kDeleteSourceHierarchiesFlagLong;
+	static const double kBasisTolerance;
 
 	// ------ MPxCommand ------
 	bool isUndoable() const override;
@@ -89,6 +106,13 @@ public:
 	MStatus undoIt() override;
 
 private:
+	// ------ Helpers ------
+	static MMatrix computeAimMatrix(const MVector& aimDirection, const MVector& aimAxis, const MVector& worldUpDirection, const MVector& upAxis);
+	static MMatrix computeBasis(const MVector& primary, const MVector& secondary);
+	MStatus createAnimCurve(const MPlug& plug, MFnAnimCurve::AnimCurveType curveType, MTimeArray& times, MDoubleArray& values);
+
 	MDagModifier m_dagMod;
+	// Duplicates are not created by a modifier, this modifier holds their deletion which is executed on undo and reverted on redo
+	MDagModifier m_duplicateMod;
 	MAnimCurveChange m_animChangeMod;
 };
\ No newline at end of file
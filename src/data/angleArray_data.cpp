@@ -37,19 +37,24 @@ void AngleArrayData::getArray(std::vector<MAngle>& outArray) const
 	unsigned int arrayLength = length();
 	outArray.resize(arrayLength);
 
-	for (unsigned int i = 0; i < arrayLength; i++) {
-		outArray[i] = MAngle(m_data[i]);
-	}
+	const double* values = m_data->data();
+	for (unsigned int i = 0; i < arrayLength; i++)
+		outArray[i] = element(values + i);
 }
 
 // Used by set attribute methods
 void AngleArrayData::setArray(const std::vector<MAngle>& array)
 {
 	size_t arrayLength = array.size();
-	m_data.resize(arrayLength);
+	double* values = overwriteData(arrayLength).data();
 
 	for (unsigned int i = 0; i < arrayLength; i++)
-		m_data[i] = array[i].asRadians();
+		values[i] = array[i].asRadians();
+}
+
+MAngle AngleArrayData::element(const double* values)
+{
+	return MAngle(values[0]);
 }
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -31,6 +31,9 @@ public:
 	unsigned int length() const override;
 	void getArray(std::vector<MAngle>& outArray) const override;
 	void setArray(const std::vector<MAngle>& array) override;
+
+	// Constructs an element from a single value in radians, used by MRS::DataArrayView
+	static MAngle element(const double* values);
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -37,23 +37,28 @@ void EulerArrayData::getArray(std::vector<MEulerRotation>& outArray) const
 	unsigned int arrayLength = length();
 	outArray.resize(arrayLength);
 
-	for (unsigned int i = 0; i < arrayLength; i++) {
-		outArray[i] = MEulerRotation(m_data[(i * 3) + 0], m_data[(i * 3) + 1], m_data[(i * 3) + 2]);
-	}
+	const double* values = m_data->data();
+	for (unsigned int i = 0; i < arrayLength; i++)
+		outArray[i] = element(values + (i * 3));
 }
 
 // Used by set attribute methods
 void EulerArrayData::setArray(const std::vector<MEulerRotation>& array)
 {
 	size_t arrayLength = array.size();
-	m_data.resize(arrayLength * 3);
+	double* values = overwriteData(arrayLength * 3).data();
 
 	for (unsigned int i = 0; i < arrayLength; i++)
 	{
-		m_data[(i * 3) + 0] = array[i].x;
-		m_data[(i * 3) + 1] = array[i].y;
-		m_data[(i * 3) + 2] = array[i].z;
+		values[(i * 3) + 0] = array[i].x;
+		values[(i * 3) + 1] = array[i].y;
+		values[(i * 3) + 2] = array[i].z;
 	}
 }
 
+MEulerRotation EulerArrayData::element(const double* values)
+{
+	return MEulerRotation(values[0], values[1], values[2]);
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
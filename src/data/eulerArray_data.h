@@ -29,6 +29,9 @@ public:
 	unsigned int length() const override;
 	void getArray(std::vector<MEulerRotation>& outArray) const override;
 	void setArray(const std::vector<MEulerRotation>& array) override;
+
+	// Constructs an element from 3 consecutive values, used by MRS::DataArrayView
+	static MEulerRotation element(const double* values);
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -37,24 +37,29 @@ void QuaternionArrayData::getArray(std::vector<MQuaternion>& outArray) const
 	unsigned int arrayLength = length();
 	outArray.resize(arrayLength);
 
-	for (unsigned int i = 0; i < arrayLength; i++) {
-		outArray[i] = MQuaternion(m_data[(i * 4) + 0], m_data[(i * 4) + 1], m_data[(i * 4) + 2], m_data[(i * 4) + 3]);
-	}
+	const double* values = m_data->data();
+	for (unsigned int i = 0; i < arrayLength; i++)
+		outArray[i] = element(values + (i * 4));
 }
 
 // Used by set attribute methods
 void QuaternionArrayData::setArray(const std::vector<MQuaternion>& array)
 {
 	size_t arrayLength = array.size();
-	m_data.resize(arrayLength * 4);
+	double* values = overwriteData(arrayLength * 4).data();
 
 	for (unsigned int i = 0; i < arrayLength; i++)
 	{
-		m_data[(i * 4) + 0] = array[i].x;
-		m_data[(i * 4) + 1] = array[i].y;
-		m_data[(i * 4) + 2] = array[i].z;
-		m_data[(i * 4) + 3] = array[i].w;
+		values[(i * 4) + 0] = array[i].x;
+		values[(i * 4) + 1] = array[i].y;
+		values[(i * 4) + 2] = array[i].z;
+		values[(i * 4) + 3] = array[i].w;
 	}
 }
 
+MQuaternion QuaternionArrayData::element(const double* values)
+{
+	return MQuaternion(values[0], values[1], values[2], values[3]);
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -29,6 +29,9 @@ public:
 	unsigned int length() const override;
 	void getArray(std::vector<MQuaternion>& outArray) const override;
 	void setArray(const std::vector<MQuaternion>& array) override;
+
+	// Constructs an element from 4 consecutive values, used by MRS::DataArrayView
+	static MQuaternion element(const double* values);
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -36,19 +36,15 @@ MStatus UnpackAngleArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	MDataHandle inputDataArrayHandle = dataBlock.inputValue(inputAttr);
-	MObject dataObj = inputDataArrayHandle.data();
-	MFnPluginData fnData(dataObj);
-	AngleArrayData* angleData = (AngleArrayData*)fnData.data();
-	angleData->getArray(m_data);
+	MRS::DataArrayView<AngleArrayData> angles = inputPluginDataArrayView<AngleArrayData>(dataBlock, inputAttr);
 
 	MArrayDataHandle outputArrayHandle = dataBlock.outputArrayValue(outputAttr);
-	MArrayDataBuilder builder(&dataBlock, outputAttr, unsigned(m_data.size()));
+	MArrayDataBuilder builder(&dataBlock, outputAttr, angles.length());
 
-	for (const MAngle& angle : m_data)
+	for (unsigned int i = 0; i < angles.length(); ++i)
 	{
 		MDataHandle outputElementHandle = builder.addLast();
-		outputElementHandle.setMAngle(angle);
+		outputElementHandle.setMAngle(angles[i]);
 	}
 
 	outputArrayHandle.set(builder);
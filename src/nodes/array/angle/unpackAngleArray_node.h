@@ -35,10 +35,6 @@ public:
 	SchedulingType schedulingType() const override;
 	static MStatus initialize();
 	MStatus compute(const MPlug& plug, MDataBlock& dataBlock) override;
-
-private:
-	// ------ Data ------
-	std::vector<MAngle> m_data;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -44,17 +44,14 @@ MStatus UnpackEulerArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 		return MStatus::kUnknownParameter;
 	}
 	
-	MDataHandle inRotateDataArrayHandle = dataBlock.inputValue(inputRotateAttr);
-	MObject rotateDataObj = inRotateDataArrayHandle.data();
-	MFnPluginData fnData(rotateDataObj);
-	EulerArrayData* eulerData = (EulerArrayData*)fnData.data();
-	eulerData->getArray(m_rotations);
+	MRS::DataArrayView<EulerArrayData> rotations = inputPluginDataArrayView<EulerArrayData>(dataBlock, inputRotateAttr);
 
 	MArrayDataHandle outRotateArrayHandle = dataBlock.outputArrayValue(outputRotateAttr);
-	MArrayDataBuilder builder(&dataBlock, outputRotateAttr, unsigned(m_rotations.size()));
+	MArrayDataBuilder builder(&dataBlock, outputRotateAttr, rotations.length());
 
-	for (const MEulerRotation& rotation : m_rotations)
+	for (unsigned int i = 0; i < rotations.length(); ++i)
 	{
+		MEulerRotation rotation = rotations[i];
 		MDataHandle outRotateElementHandle = builder.addLast();
 		MDataHandle outRotateXHandle = outRotateElementHandle.child(outputRotateXAttr);
 		MDataHandle outRotateYHandle = outRotateElementHandle.child(outputRotateYAttr);
@@ -39,10 +39,6 @@ public:
 	SchedulingType schedulingType() const override;
 	static MStatus initialize();
 	MStatus compute(const MPlug& plug, MDataBlock& dataBlock) override;
-
-private:
-	// ------ Data ------
-	std::vector<MEulerRotation> m_rotations;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -67,35 +67,70 @@ MStatus ComposeMatrixArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 
 	unsigned int size = inputIntValue(dataBlock, sizeAttr);
 	bool useEuler = inputBoolValue(dataBlock, useEulerRotationAttr);
-	std::vector<MVector> translation = inputVectorDataArrayValue(dataBlock, translationAttr);
-	std::vector<MVector> scale = inputVectorDataArrayValue(dataBlock, scaleAttr);
-	translation.resize(size);
-	scale.resize(size, MVector::one);
-	m_matrices.resize(size);
+	// The inputs are copied on this thread as the data function sets must not be accessed by the workers
+	inputVectorDataArrayValue(dataBlock, translationAttr, m_translation);
+	inputVectorDataArrayValue(dataBlock, scaleAttr, m_scale);
+	// Missing elements are treated as defaults
+	unsigned int translationCount = std::min(size, (unsigned int)m_translation.size());
+	unsigned int scaleCount = std::min(size, (unsigned int)m_scale.size());
+
+	// Matrices are composed in a single pass over the array and written to the node buffer, which is then given to the output
+	// The inputs of each chunk are staged contiguously (with defaults applied) so that they can be composed by the batch kernels
+	m_output.resize(size);
+	auto stageTransform = [&](unsigned int begin, unsigned int end, MVector* outTranslation, MVector* outScale)
+	{
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			outTranslation[i - begin] = i < translationCount ? m_translation[i] : MVector::zero;
+			outScale[i - begin] = i < scaleCount ? m_scale[i] : MVector::one;
+		}
+	};
 
 	if (useEuler)
 	{
-		std::vector<MEulerRotation> rotation = inputPluginDataArrayValue<EulerArrayData, MEulerRotation>(dataBlock, rotationAttr);
-		std::vector<int> rotationOrder = inputIntDataArrayValue(dataBlock, rotationOrderAttr);
-		rotation.resize(size);
-		rotationOrder.resize(size, 0);
+		MRS::DataArrayView<EulerArrayData> rotation = inputPluginDataArrayView<EulerArrayData>(dataBlock, rotationAttr);
+		inputIntDataArrayValue(dataBlock, rotationOrderAttr, m_rotationOrder);
+		unsigned int rotationCount = std::min(size, rotation.length());
+		unsigned int rotationOrderCount = std::min(size, (unsigned int)m_rotationOrder.size());
 
-		for (unsigned int i = 0; i < size; ++i)
+		MRS::parallelFor(0, size, MRS::kMatrixBatchGrainSize, [&](unsigned int begin, unsigned int end)
 		{
-			rotation[i].order = (MEulerRotation::RotationOrder)MRS::clamp(rotationOrder[i], 0, 5);
-			m_matrices[i] = MRS::composeMatrix(translation[i], rotation[i], scale[i]);
-		}
+			MVector translations[MRS::kMatrixBatchGrainSize];
+			MEulerRotation eulers[MRS::kMatrixBatchGrainSize];
+			MVector scales[MRS::kMatrixBatchGrainSize];
+			stageTransform(begin, end, translations, scales);
+
+			for (unsigned int i = begin; i < end; ++i)
+			{
+				MEulerRotation& euler = eulers[i - begin];
+				euler = i < rotationCount ? rotation[i] : MEulerRotation::identity;
+				int order = i < rotationOrderCount ? m_rotationOrder[i] : 0;
+				euler.order = (MEulerRotation::RotationOrder)MRS::clamp(order, 0, 5);
+			}
+
+			MRS::composeMatrixBatch(translations, eulers, scales, end - begin, &m_output[begin]);
+		});
 	}
 	else
 	{
-		std::vector<MQuaternion> rotation = inputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, quaternionAttr);
-		rotation.resize(size);
+		MRS::DataArrayView<QuaternionArrayData> rotation = inputPluginDataArrayView<QuaternionArrayData>(dataBlock, quaternionAttr);
+		unsigned int rotationCount = std::min(size, rotation.length());
+
+		MRS::parallelFor(0, size, MRS::kMatrixBatchGrainSize, [&](unsigned int begin, unsigned int end)
+		{
+			MVector translations[MRS::kMatrixBatchGrainSize];
+			MQuaternion quaternions[MRS::kMatrixBatchGrainSize];
+			MVector scales[MRS::kMatrixBatchGrainSize];
+			stageTransform(begin, end, translations, scales);
+
+			for (unsigned int i = begin; i < end; ++i)
+				quaternions[i - begin] = i < rotationCount ? rotation[i] : MQuaternion::identity;
 
-		for (unsigned int i = 0; i < size; ++i)
-			m_matrices[i] = MRS::composeMatrix(translation[i], rotation[i], scale[i]);
+			MRS::composeMatrixBatch(translations, quaternions, scales, end - begin, &m_output[begin]);
+		});
 	}
 
-	outputMatrixDataArrayValue(dataBlock, outputMatrixAttr, m_matrices);
+	outputMatrixDataArrayValue(dataBlock, outputMatrixAttr, m_output);
 
 	return MStatus::kSuccess;
 }
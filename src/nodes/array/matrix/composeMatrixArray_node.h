@@ -5,7 +5,9 @@
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MEulerRotation.h>
+#include <maya/MIntArray.h>
 #include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPxNode.h>
@@ -15,11 +17,14 @@
 #include <maya/MTransformationMatrix.h>
 #include <maya/MTypeId.h>
 #include <maya/MVector.h>
+#include <maya/MVectorArray.h>
 
 #include "data/eulerArray_data.h"
 #include "data/quaternionArray_data.h"
+#include "utils/matrix_batch_utils.h"
 #include "utils/matrix_utils.h"
 #include "utils/node_utils.h"
+#include "utils/thread_utils.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -50,7 +55,10 @@ public:
 
 private:
 	// ------ Data ------
-	std::vector<MMatrix> m_matrices;
+	std::vector<MVector> m_translation;
+	std::vector<MVector> m_scale;
+	std::vector<int> m_rotationOrder;
+	std::vector<MMatrix> m_output;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
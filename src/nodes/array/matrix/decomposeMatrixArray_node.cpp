@@ -70,52 +70,45 @@ MStatus DecomposeMatrixArray::initialize()
 
 MStatus DecomposeMatrixArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 {
-	if (plug == outputTranslationXAttr || plug == outputTranslationYAttr || plug == outputTranslationZAttr || plug == outputTranslationAttr)
-	{
-		std::vector<MMatrix> transforms = inputMatrixDataArrayValue(dataBlock, inputMatrixAttr);
-		size_t size = transforms.size();
-		m_translation.resize(size);
-		for (unsigned int i = 0; i < size; ++i)
-			m_translation[i] = MRS::extractTranslation(transforms[i]);
-
-		outputVectorArrayValue(dataBlock, outputTranslationAttr, m_translation);
-	}
-	else if (plug == outputRotationXAttr || plug == outputRotationYAttr || plug == outputRotationZAttr || plug == outputRotationAttr)
-	{
-		std::vector<MMatrix> transforms = inputMatrixDataArrayValue(dataBlock, inputMatrixAttr);
-		size_t size = transforms.size();
-		std::vector<int> rotationOrder = inputIntDataArrayValue(dataBlock, rotationOrderAttr);
-		rotationOrder.resize(size, 0);
-		m_euler.resize(size);
-		for (unsigned int i = 0; i < size; ++i)
-			m_euler[i] = MRS::extractEulerRotation(transforms[i], (MEulerRotation::RotationOrder)MRS::clamp(rotationOrder[i], 0, 5));
-
-		outputEulerArrayValue(dataBlock, outputRotationAttr, outputRotationXAttr, outputRotationYAttr, outputRotationZAttr, m_euler);
-	}
-	else if (plug == outputScaleXAttr || plug == outputScaleYAttr || plug == outputScaleZAttr || plug == outputScaleAttr)
-	{
-		std::vector<MMatrix> transforms = inputMatrixDataArrayValue(dataBlock, inputMatrixAttr);
-		size_t size = transforms.size();
-		m_scale.resize(size);
-		for (unsigned int i = 0; i < size; ++i)
-			m_scale[i] = MRS::extractScale(transforms[i]);
-
-		outputVectorArrayValue(dataBlock, outputScaleAttr, m_scale);
-	}
-	else if (plug == outputQuaternionXAttr || plug == outputQuaternionYAttr || plug == outputQuaternionZAttr || plug == outputQuaternionWAttr || plug == outputQuaternionAttr)
-	{
-		std::vector<MMatrix> transforms = inputMatrixDataArrayValue(dataBlock, inputMatrixAttr);
-		size_t size = transforms.size();
-		m_quaternion.resize(size);
-		for (unsigned int i = 0; i < size; ++i)
-			m_quaternion[i] = MRS::extractQuaternionRotation(transforms[i]);
-
-		outputQuaternionArrayValue(dataBlock, outputQuaternionAttr, outputQuaternionXAttr, 
-			outputQuaternionYAttr, outputQuaternionZAttr, outputQuaternionWAttr, m_quaternion);
-	}
-	else
+	if (plug != outputTranslationXAttr && plug != outputTranslationYAttr && plug != outputTranslationZAttr && plug != outputTranslationAttr &&
+		plug != outputRotationXAttr && plug != outputRotationYAttr && plug != outputRotationZAttr && plug != outputRotationAttr &&
+		plug != outputScaleXAttr && plug != outputScaleYAttr && plug != outputScaleZAttr && plug != outputScaleAttr &&
+		plug != outputQuaternionXAttr && plug != outputQuaternionYAttr && plug != outputQuaternionZAttr && plug != outputQuaternionWAttr && plug != outputQuaternionAttr)
 		return MStatus::kUnknownParameter;
 
+	// Downstream nodes will typically pull every output, therefore a request for any output will decompose each matrix once and set all outputs clean
+	// This avoids reading the input array and normalizing each rotation basis once per output
+	// The inputs are copied on this thread as the data function sets must not be accessed by the workers
+	inputMatrixDataArrayValue(dataBlock, inputMatrixAttr, m_matrices);
+	inputIntDataArrayValue(dataBlock, rotationOrderAttr, m_rotationOrder);
+	unsigned int size = (unsigned int)m_matrices.size();
+	unsigned int rotationOrderCount = std::min(size, (unsigned int)m_rotationOrder.size());
+
+	m_translation.resize(size);
+	m_euler.resize(size);
+	m_scale.resize(size);
+	m_quaternion.resize(size);
+
+	// The matrices are already contiguous, only the rotation orders of each chunk are staged for the batch kernels
+	MRS::parallelFor(0, size, MRS::kMatrixBatchGrainSize, [this, rotationOrderCount](unsigned int begin, unsigned int end)
+	{
+		MEulerRotation::RotationOrder orders[MRS::kMatrixBatchGrainSize];
+
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			int order = i < rotationOrderCount ? m_rotationOrder[i] : 0;
+			orders[i - begin] = (MEulerRotation::RotationOrder)MRS::clamp(order, 0, 5);
+		}
+
+		MRS::decomposeMatrixBatch(&m_matrices[begin], orders, end - begin, &m_translation[begin], &m_quaternion[begin], &m_euler[begin], &m_scale[begin]);
+	});
+
+	outputVectorArrayValue(dataBlock, outputTranslationAttr, m_translation);
+	outputEulerArrayValue(dataBlock, outputRotationAttr, outputRotationXAttr, outputRotationYAttr, outputRotationZAttr, m_euler);
+	outputVectorArrayValue(dataBlock, outputScaleAttr, m_scale);
+	outputQuaternionArrayValue(dataBlock, outputQuaternionAttr, outputQuaternionXAttr, 
+		outputQuaternionYAttr, outputQuaternionZAttr, outputQuaternionWAttr, m_quaternion);
+
 	return MStatus::kSuccess;
 }
 
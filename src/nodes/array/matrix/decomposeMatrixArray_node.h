@@ -6,7 +6,9 @@
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MEulerRotation.h>
+#include <maya/MIntArray.h>
 #include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPxNode.h>
@@ -17,8 +19,10 @@
 #include <maya/MVector.h>
 
 #include "data/eulerArray_data.h"
+#include "utils/matrix_batch_utils.h"
 #include "utils/matrix_utils.h"
 #include "utils/node_utils.h"
+#include "utils/thread_utils.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -60,6 +64,8 @@ public:
 
 private:
 	// ------ Data ------
+	std::vector<MMatrix> m_matrices;
+	std::vector<int> m_rotationOrder;
 	std::vector<MVector> m_translation;
 	std::vector<MEulerRotation> m_euler;
 	std::vector<MVector> m_scale;
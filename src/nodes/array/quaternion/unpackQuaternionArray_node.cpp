@@ -47,17 +47,14 @@ MStatus UnpackQuaternionArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 		return MStatus::kUnknownParameter;
 	}
 
-	MDataHandle inQuaternionDataArrayHandle = dataBlock.inputValue(inputQuaternionAttr);
-	MObject quaternionDataObj = inQuaternionDataArrayHandle.data();
-	MFnPluginData fnData(quaternionDataObj);
-	QuaternionArrayData* quaternionData = (QuaternionArrayData*)fnData.data();
-	quaternionData->getArray(m_quaternions);
+	MRS::DataArrayView<QuaternionArrayData> quaternions = inputPluginDataArrayView<QuaternionArrayData>(dataBlock, inputQuaternionAttr);
 
 	MArrayDataHandle outQuaternionArrayHandle = dataBlock.outputArrayValue(outputQuaternionAttr);
-	MArrayDataBuilder builder(&dataBlock, outputQuaternionAttr, unsigned(m_quaternions.size()));
+	MArrayDataBuilder builder(&dataBlock, outputQuaternionAttr, quaternions.length());
 
-	for (const MQuaternion& quaternion : m_quaternions)
+	for (unsigned int i = 0; i < quaternions.length(); ++i)
 	{
+		MQuaternion quaternion = quaternions[i];
 		MDataHandle outQuaternionlementHandle = builder.addLast();
 		MDataHandle outQuaternionXHandle = outQuaternionlementHandle.child(outputQuaternionXAttr);
 		MDataHandle outQuaternionYHandle = outQuaternionlementHandle.child(outputQuaternionYAttr);
@@ -39,10 +39,6 @@ public:
 	SchedulingType schedulingType() const override;
 	static MStatus initialize();
 	MStatus compute(const MPlug& plug, MDataBlock& dataBlock) override;
-
-private:
-	// ------ Data ------
-	std::vector<MQuaternion> m_quaternions;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
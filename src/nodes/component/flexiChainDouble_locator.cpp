@@ -223,6 +223,7 @@
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 FlexiChainDouble::FlexiChainDouble() :
+	m_drawDirtyCount{ 0 },
 	m_instanceAddedCallbackId{ 0 }
 {}
 
@@ -245,6 +246,8 @@ FlexiChainDouble::FlexiChainDouble_Data::FlexiChainDouble_Data() :
 	isCounterTwistUpVectorOverrideEnabled{ false },
 	isScaleAdjustmentEnabled{ false },
 	isTwistAdjustmentEnabled{ false },
+	isScaleAdjustmentDirty{ true },
+	isTwistAdjustmentDirty{ true },
 	isDrawRibbonEnabled{ true },
 	parameterization{ 1 },
 	counterTwistBlend{ 0.0 },
@@ -883,6 +886,35 @@ MStatus FlexiChainDouble::initialize()
 	ie. A dirty plug does not mean the node will automatically recompute as this only occurs when something downstream is pulling    */
 MStatus FlexiChainDouble::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
 {
+	// Adjustments are only rebuilt once their own inputs are dirtied, otherwise their tables persist between evaluations
+	if (plug == twistAdjustmentCompoundAttr ||
+		plug == twistAdjustmentRampAttr ||
+		plug == twistAdjustmentRampPositionAttr ||
+		plug == twistAdjustmentRampValueAttr ||
+		plug == twistAdjustmentRampInterpolationAttr ||
+		plug == twistAdjustmentValueAttr ||
+		plug == twistAdjustmentOffsetAttr ||
+		plug == twistAdjustmentFalloffModeAttr ||
+		plug == twistAdjustmentFalloffDistanceAttr ||
+		plug == twistAdjustmentRepeatAttr ||
+		plug == computeTwistAdjustmentsAttr)
+		m_data.isTwistAdjustmentDirty = true;
+	else if (plug == scaleAdjustmentCompoundAttr ||
+		plug == scaleAdjustmentRampAttr ||
+		plug == scaleAdjustmentRampPositionAttr ||
+		plug == scaleAdjustmentRampValueAttr ||
+		plug == scaleAdjustmentRampInterpolationAttr ||
+		plug == scaleAdjustmentValueAttr ||
+		plug == scaleAdjustmentValueXAttr ||
+		plug == scaleAdjustmentValueYAttr ||
+		plug == scaleAdjustmentValueZAttr ||
+		plug == scaleAdjustmentOffsetAttr ||
+		plug == scaleAdjustmentFalloffModeAttr ||
+		plug == scaleAdjustmentFalloffDistanceAttr ||
+		plug == scaleAdjustmentRepeatAttr ||
+		plug == computeScaleAdjustmentsAttr)
+		m_data.isScaleAdjustmentDirty = true;
+
 	// Highest priority attributes first
 	if (plug == controlPoint0Attr || plug == controlPoint0XAttr || plug == controlPoint0YAttr || plug == controlPoint0ZAttr ||
 		plug == controlPoint1Attr || plug == controlPoint1XAttr || plug == controlPoint1YAttr || plug == controlPoint1ZAttr ||
@@ -940,7 +972,7 @@ MStatus FlexiChainDouble::setDependentsDirty(const MPlug& plug, MPlugArray& plug
 		MDataBlock dataBlock = forceCache();
 		dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
 
-		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+		setDrawDirty();
 	}
 	else if ( // These attributes do not need to force evaluation
 		plug == customDrawSpaceTransformAttr ||
@@ -949,7 +981,7 @@ MStatus FlexiChainDouble::setDependentsDirty(const MPlug& plug, MPlugArray& plug
 		plug == drawNormalsAttr ||
 		plug == drawHullAttr)
 	{
-		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+		setDrawDirty();
 	}
 
 	return MStatus::kSuccess;
@@ -966,6 +998,34 @@ MStatus FlexiChainDouble::preEvaluation(const MDGContext& context, const MEvalua
 	{
 		MStatus status;
 
+		if ((evaluationNode.dirtyPlugExists(twistAdjustmentCompoundAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampPositionAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampInterpolationAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentOffsetAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentFalloffModeAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentFalloffDistanceAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRepeatAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(computeTwistAdjustmentsAttr, &status) && status))
+			m_data.isTwistAdjustmentDirty = true;
+		if ((evaluationNode.dirtyPlugExists(scaleAdjustmentCompoundAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampPositionAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampInterpolationAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueXAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueYAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueZAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentOffsetAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentFalloffModeAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentFalloffDistanceAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRepeatAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(computeScaleAdjustmentsAttr, &status) && status))
+			m_data.isScaleAdjustmentDirty = true;
+
 		if ((evaluationNode.dirtyPlugExists(controlPoint0Attr, &status) && status) ||
 			(evaluationNode.dirtyPlugExists(controlPoint0XAttr, &status) && status) ||
 			(evaluationNode.dirtyPlugExists(controlPoint0YAttr, &status) && status) ||
@@ -1041,7 +1101,7 @@ MStatus FlexiChainDouble::preEvaluation(const MDGContext& context, const MEvalua
 			MDataBlock dataBlock = forceCache();
 			dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
 
-			MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+			setDrawDirty();
 		}
 		else if (
 			(evaluationNode.dirtyPlugExists(customDrawSpaceTransformAttr, &status) && status) ||
@@ -1050,7 +1110,7 @@ MStatus FlexiChainDouble::preEvaluation(const MDGContext& context, const MEvalua
 			(evaluationNode.dirtyPlugExists(drawNormalsAttr, &status) && status) ||
 			(evaluationNode.dirtyPlugExists(drawHullAttr, &status) && status))
 		{
-			MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+			setDrawDirty();
 		}
 	}
 
@@ -1261,12 +1321,49 @@ MBoundingBox FlexiChainDouble::boundingBox() const
 	Basic state tracking has been implemented so that the draw cycle can query whether the function has already been invoked by MPxNode::compute()    */
 void FlexiChainDouble::computeCurveData(MDataBlock& dataBlock)
 {
-	// --- Counts ---
-	m_data.subdivisions = (unsigned)dataBlock.inputValue(subdivisionsAttr).asInt();
-	m_data.outputCount = (unsigned)dataBlock.inputValue(outputCountAttr).asInt();
-	m_data.parameterCount = m_data.outputCount + (m_data.outputCount - 1) * m_data.subdivisions;
-	assert(m_data.parameterCount >= 2);
+	// --- Curve ---
+	computeCurve(dataBlock);
+	computeCurveSamples(dataBlock);
+
+	// --- Scale Adjustments ---
+	// Scale adjustments will be applied regardless of whether orientation is enabled
+	// The adjustments are only rebuilt once their inputs have been dirtied (see setDependentsDirty)
+	m_data.isScaleAdjustmentEnabled = dataBlock.inputValue(computeScaleAdjustmentsAttr).asBool();
+	if (m_data.isScaleAdjustmentEnabled && m_data.isScaleAdjustmentDirty)
+		computeScaleAdjustments(dataBlock);
+
+	// --- Twist Adjustments ---
+	// Twist adjustments will only be applied when orientation is enabled
+	m_data.isTwistAdjustmentEnabled = dataBlock.inputValue(computeTwistAdjustmentsAttr).asBool();
+	if (m_data.isTwistAdjustmentEnabled && m_data.isOrientEnabled && m_data.isTwistAdjustmentDirty)
+		computeTwistAdjustments(dataBlock);
+
+	// --- Build Frames ---
+	// Always keep frames in local space as this is required by draw
+	// If compute needs world space transforms then it will be responsible for doing the conversions
+	// If the counter-twist cache has been built, any twist generated by the moving RMF will be back-propagated down the curve
+	m_data.isDrawRibbonEnabled = dataBlock.inputValue(drawRibbonAttr).asBool();
+	m_data.counterTwistBlend = dataBlock.inputValue(counterTwistBlendAttr).asDouble();
+	m_data.counterTwist = dataBlock.inputValue(counterTwistAttr).asAngle().asRadians();
+	m_data.startTwist = dataBlock.inputValue(startTwistAttr).asAngle().asRadians();
+	m_data.endTwist = dataBlock.inputValue(endTwistAttr).asAngle().asRadians();
+	m_data.roll = dataBlock.inputValue(rollAttr).asAngle().asRadians();
 
+	computeNormalizedParameters();
+	m_data.frames.resize(m_data.outputCount);
+	buildFlexiFrames(m_data, MRS::kDefaultGrainSize);
+
+	dataBlock.outputValue(evalSinceDirtyAttr).setBool(true);
+	dataBlock.outputValue(drawSinceEvalAttr).setBool(false);
+}
+
+/*	Description
+	-----------
+	Computes the control points which define the curve along with the orientation inputs, the curve is not sampled
+	This allows the curve to be evaluated for a separate context (eg. a specific time) without computing any of the output data
+	Once all contexts have been evaluated, invalidateCurveData() must be called    */
+void FlexiChainDouble::computeCurve(MDataBlock& dataBlock)
+{
 	// --- Shaping Parameters ---
 	m_data.jointVolume0 = dataBlock.inputValue(jointVolume0Attr).asDouble();
 	m_data.jointVolume1 = dataBlock.inputValue(jointVolume1Attr).asDouble();
@@ -1393,12 +1490,34 @@ void FlexiChainDouble::computeCurveData(MDataBlock& dataBlock)
 	m_data.controlPoints1[2] = vVirtualP4;
 	m_data.controlPoints1[3] = vVirtualP5;
 
+	// --- Orientation ---
+	m_data.isOrientEnabled = dataBlock.inputValue(computeOrientationAttr).asBool();
+	m_data.isNormalUpVectorOverrideEnabled = dataBlock.inputValue(normalUpVectorOverrideStateAttr).asBool();
+	m_data.vNormalUp = m_data.isNormalUpVectorOverrideEnabled ? dataBlock.inputValue(normalUpVectorOverrideAttr).asVector()
+		: dataBlock.inputValue(upVectorAttr).asVector();
+	m_data.vNormalUp.normalize();
+	m_data.isCounterTwistUpVectorOverrideEnabled = dataBlock.inputValue(counterTwistUpVectorOverrideStateAttr).asBool();
+	m_data.vCounterTwistUp = m_data.isCounterTwistUpVectorOverrideEnabled ? dataBlock.inputValue(counterTwistUpVectorOverrideAttr).asVector()
+		: dataBlock.inputValue(upVectorAttr).asVector();
+	m_data.vCounterTwistUp.normalize();
+}
+
+/*	Description
+	-----------
+	Computes the parameters of the curve and samples the points, tangents and RMF normals at each parameter, the adjustments and frames are not computed
+	The control points and orientation inputs must have already been computed for the same datablock (see computeCurve)    */
+void FlexiChainDouble::computeCurveSamples(MDataBlock& dataBlock)
+{
+	// --- Counts ---
+	m_data.subdivisions = (unsigned)dataBlock.inputValue(subdivisionsAttr).asInt();
+	m_data.outputCount = (unsigned)dataBlock.inputValue(outputCountAttr).asInt();
+	m_data.parameterCount = m_data.outputCount + (m_data.outputCount - 1) * m_data.subdivisions;
+	assert(m_data.parameterCount >= 2);
+
 	// --- Parameterization ---
 	m_data.parameterization = dataBlock.inputValue(parameterizationAttr).asShort();
 
 	// Could be optimized for when arc-length parameterization is disabled however this is rare, therefore simplify for the general case
-	m_data.naturalPoints.resize(m_data.parameterCount);
-	m_data.lengths.resize(m_data.parameterCount);
 	m_data.naturalParameters.resize(m_data.parameterCount);
 	m_data.arcLengthParameters.resize(m_data.parameterCount);
 	m_data.splitLengthParameters.resize(m_data.parameterCount);
@@ -1406,10 +1525,17 @@ void FlexiChainDouble::computeCurveData(MDataBlock& dataBlock)
 	for (unsigned int i = 0; i < m_data.parameterCount; ++i)
 		m_data.naturalParameters[i] = (i * m_data.parameterRange) / (m_data.parameterCount - 1);
 
-	// Arc-length parameterizations for this curve type are too specific to have a general implementation on the curve class
-	computeLengths();
-	computeArcLengthParameters();
-	computeSplitLengthParameters();
+	// Each span is integrated separately, the table and the parameters it produces are normalized over the entire domain of the chain
+	m_data.arcLengthTable.build({ m_data.jointVolume0, m_data.jointVolume0, m_data.jointVolume1, m_data.jointVolume1 }, { m_data.controlPoints0, m_data.controlPoints1 });
+	computeStableParameters();
+	m_curve.computeArcLengthParameters(m_data.arcLengthTable, m_data.arcLengthParameters);
+	m_curve.computeSplitLengthParameters(m_data.arcLengthTable, m_data.stableParameters, m_data.splitLengthParameters);
+
+	for (unsigned int i = 0; i < m_data.parameterCount; ++i)
+	{
+		m_data.arcLengthParameters[i] *= m_data.parameterRange;
+		m_data.splitLengthParameters[i] *= m_data.parameterRange;
+	}
 
 	if (m_data.parameterization == 0)
 		m_data.currentParameters = &m_data.naturalParameters;
@@ -1419,63 +1545,23 @@ void FlexiChainDouble::computeCurveData(MDataBlock& dataBlock)
 		m_data.currentParameters = &m_data.splitLengthParameters;
 
 	// --- Sample Curve ---
-	m_data.isOrientEnabled = dataBlock.inputValue(computeOrientationAttr).asBool();
 	m_data.sampleCount = m_data.isOrientEnabled ? m_data.parameterCount : m_data.outputCount;
-	m_data.isNormalUpVectorOverrideEnabled = dataBlock.inputValue(normalUpVectorOverrideStateAttr).asBool();
-	m_data.vNormalUp = m_data.isNormalUpVectorOverrideEnabled ? dataBlock.inputValue(normalUpVectorOverrideAttr).asVector()
-		: dataBlock.inputValue(upVectorAttr).asVector();
-	m_data.vNormalUp.normalize();
-	m_data.isCounterTwistUpVectorOverrideEnabled = dataBlock.inputValue(counterTwistUpVectorOverrideStateAttr).asBool();
-	m_data.vCounterTwistUp = m_data.isCounterTwistUpVectorOverrideEnabled ? dataBlock.inputValue(counterTwistUpVectorOverrideAttr).asVector()
-		: dataBlock.inputValue(upVectorAttr).asVector();
-	m_data.vCounterTwistUp.normalize();
 
 	if (m_data.isOrientEnabled)
 	{
 		// RMF computation is iterative so we need to calculate a reflection for each parameter even if the frame count is small
 		m_data.points.resize(m_data.sampleCount);
 		m_data.tangents.resize(m_data.sampleCount);
-		m_data.rmfReflections.resize(m_data.sampleCount);
-
-		m_data.points[0] = sampleCurve((*m_data.currentParameters)[0]);
-		m_data.tangents[0] = sampleFirstDerivative((*m_data.currentParameters)[0]);
-		m_data.tangents[0].normalize();
-		m_data.rmfReflections[0] = MQuaternion::identity;
 
-		MVector vRight = m_data.vNormalUp ^ m_data.tangents[0];
-		vRight.normalize();
-		m_data.vPrincipalNormal = m_data.tangents[0] ^ vRight;
-		MQuaternion qPrincipalNormal{ m_data.vPrincipalNormal.x, m_data.vPrincipalNormal.y, m_data.vPrincipalNormal.z, 0.0 };
-
-		// RMF computation is iterative so we need to calculate an orientation for each parameter even if the frame count is small
-		for (unsigned int i = 1; i < m_data.sampleCount; i++)
+		for (unsigned int i = 0; i < m_data.sampleCount; i++)
 		{
-			m_data.points[i] = sampleCurve((*m_data.currentParameters)[i]);
-			m_data.tangents[i] = sampleFirstDerivative((*m_data.currentParameters)[i]);
-			m_data.tangents[i].normalize();
-			MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[i - 1], m_data.points[i], m_data.tangents[i - 1], m_data.tangents[i]);
-			m_data.rmfReflections[i] = MRS::quaternionMultiply(qReflection, m_data.rmfReflections[i - 1]);
+			m_data.points.set(i, sampleCurve((*m_data.currentParameters)[i]));
+			m_data.tangents.set(i, sampleFirstDerivative((*m_data.currentParameters)[i]).normal());
 		}
 
 		// We are not optimizing the case where drawing of the ribbon is disabled (technically we could calculate normals at the specific output positions)
-		m_data.normals.resize(m_data.sampleCount);
-		m_data.binormals.resize(m_data.sampleCount);
-
-		m_data.normals[0] = m_data.vPrincipalNormal;
-		m_data.binormals[0] = m_data.tangents[0] ^ m_data.vPrincipalNormal;
-
-		for (unsigned int i = 1; i < m_data.sampleCount; ++i)
-		{
-			MQuaternion qReflectionComposition = m_data.rmfReflections[i];
-			MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-			MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-			MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-			MVector vNormal{ qNormal.x, qNormal.y, qNormal.z };
-			vNormal.normalize();
-
-			m_data.normals[i] = vNormal;
-			m_data.binormals[i] = m_data.tangents[i] ^ vNormal;
-		}
+		computeFlexiRMF(m_data.points, m_data.tangents, m_data.vNormalUp, MRS::kDefaultGrainSize, m_data.vPrincipalNormal, m_data.rmfStepReflections,
+			m_data.rmfReflections, m_data.normals, m_data.binormals);
 	}
 	else
 	{
@@ -1484,137 +1570,20 @@ void FlexiChainDouble::computeCurveData(MDataBlock& dataBlock)
 		for (unsigned int i = 0; i < m_data.sampleCount; i++)
 		{
 			unsigned int parameterIndex = i * (m_data.subdivisions + 1);
-			m_data.points[i] = sampleCurve((*m_data.currentParameters)[parameterIndex]);
-		}
-	}
-
-	// --- Scale Adjustments ---
-	// Scale adjustments will be applied regardless of whether orientation is enabled
-	m_data.isScaleAdjustmentEnabled = dataBlock.inputValue(computeScaleAdjustmentsAttr).asBool();
-	if (m_data.isScaleAdjustmentEnabled)
-		computeScaleAdjustments(dataBlock);
-
-	// --- Twist Adjustments ---
-	// Twist adjustments will only be applied when orientation is enabled
-	m_data.isTwistAdjustmentEnabled = dataBlock.inputValue(computeTwistAdjustmentsAttr).asBool();
-	if (m_data.isTwistAdjustmentEnabled && m_data.isOrientEnabled)
-		computeTwistAdjustments(dataBlock);
-
-	// --- Build Frames ---
-	// Always keep frames in local space as this is required by draw
-	// If compute needs world space transforms then it will be responsible for doing the conversions
-	// If the counter-twist cache has been built, any twist generated by the moving RMF will be back-propagated down the curve
-	m_data.frames.resize(m_data.outputCount);
-
-	m_data.isDrawRibbonEnabled = dataBlock.inputValue(drawRibbonAttr).asBool();
-	m_data.counterTwistBlend = dataBlock.inputValue(counterTwistBlendAttr).asDouble();
-	m_data.counterTwist = dataBlock.inputValue(counterTwistAttr).asAngle().asRadians();
-	m_data.startTwist = dataBlock.inputValue(startTwistAttr).asAngle().asRadians();
-	m_data.endTwist = dataBlock.inputValue(endTwistAttr).asAngle().asRadians();
-	m_data.roll = dataBlock.inputValue(rollAttr).asAngle().asRadians();
-
-	if (m_data.isOrientEnabled)
-	{
-		unsigned int increment = m_data.isDrawRibbonEnabled ? 1 : m_data.subdivisions + 1;
-		unsigned int outputIndex = 0;
-
-		for (unsigned int i = 0; i < m_data.sampleCount; i += increment)
-		{
-			bool isOutput = !m_data.isDrawRibbonEnabled || i % (m_data.subdivisions + 1) == 0;
-			double normalizedParam = m_data.naturalParameters[i] / m_data.parameterRange;
-			double totalWeightedTwist = 0.0;
-
-			// End twist
-			double endTwistWeight = normalizedParam;
-			double weightedEndTwist = m_data.endTwist * endTwistWeight;
-			totalWeightedTwist += weightedEndTwist;
-
-			// Start twist
-			double startTwistWeight = 1 - endTwistWeight;
-			double weightedStartTwist = m_data.startTwist * startTwistWeight;
-			totalWeightedTwist += weightedStartTwist;
-
-			// Counter twist
-			double counterTwistWeight = -1 * endTwistWeight * m_data.counterTwistBlend;
-			double weightedCounterTwist = m_data.counterTwist * counterTwistWeight;
-			totalWeightedTwist += weightedCounterTwist;
-
-			// Roll
-			totalWeightedTwist += m_data.roll;
-
-			// Twist adjustment
-			if (m_data.isTwistAdjustmentEnabled)
-			{
-				for (TwistAdjustment& twistAdjustment : m_data.twistAdjustments)
-				{
-					// The falloff curve has a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
-					double twistAdjustmentWeight = twistAdjustment.curve.getValue(normalizedParam);
-					double weightedTwistAdjustment = twistAdjustment.twist.asRadians() * twistAdjustmentWeight;
-					totalWeightedTwist += weightedTwistAdjustment;
-				}
-			}
-
-			// Scale adjustment
-			MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
-			if (m_data.isScaleAdjustmentEnabled)
-			{
-				for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-				{
-					double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(normalizedParam);
-					MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-					vScaleAdjustment += weightedScaleAdjustment;
-				}
-			}
-
-			MRS::Matrix33<double> orientFrame{ m_data.tangents[i], m_data.normals[i], m_data.binormals[i] };
-			orientFrame = orientFrame.preRotateInX(totalWeightedTwist);
-			// Ensure scale is applied relative to all other transformations
-			orientFrame = orientFrame.preScale(&vScaleAdjustment.x);
-
-			// Update the caches so that draw has the current data
-			orientFrame[0].get(m_data.tangents[i]);
-			orientFrame[1].get(m_data.normals[i]);
-			orientFrame[2].get(m_data.binormals[i]);
-
-			if (isOutput)
-			{
-				MMatrix frame;
-				orientFrame.get(frame);
-				frame[3][0] = m_data.points[i].x; frame[3][1] = m_data.points[i].y; frame[3][2] = m_data.points[i].z;
-				m_data.frames[outputIndex++] = frame;
-			}
-		}
-	}
-	else
-	{
-		for (unsigned int i = 0; i < m_data.sampleCount; i++)
-		{
-			MMatrix frame;
-			unsigned int parameterIndex = i * (m_data.subdivisions + 1);
-			double normalizedParam = m_data.naturalParameters[i] / m_data.parameterRange;
-
-			// Scale adjustment
-			if (m_data.isScaleAdjustmentEnabled)
-			{
-				MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
-				for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-				{
-					double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(normalizedParam);
-					MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-					vScaleAdjustment += weightedScaleAdjustment;
-				}
-
-				frame[0][0] = vScaleAdjustment.x; frame[1][1] = vScaleAdjustment.y; frame[2][2] = vScaleAdjustment.z;
-			}
-
-			// Position
-			frame[3][0] = m_data.points[i].x; frame[3][1] = m_data.points[i].y; frame[3][2] = m_data.points[i].z;
-			m_data.frames[i] = frame;
+			m_data.points.set(i, sampleCurve((*m_data.currentParameters)[parameterIndex]));
 		}
 	}
+}
 
-	dataBlock.outputValue(evalSinceDirtyAttr).setBool(true);
-	dataBlock.outputValue(drawSinceEvalAttr).setBool(false);
+/*	Description
+	-----------
+	Invalidates all of the data computed by computeCurveData so that it is rebuilt by the next evaluation from the normal context
+	This must be called after the node has been evaluated under a separate context, as the data no longer corresponds to the current time    */
+void FlexiChainDouble::invalidateCurveData()
+{
+	MDataBlock dataBlock = forceCache();
+	dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
+	setDrawDirty();
 }
 
 /*	Description
@@ -1629,149 +1598,13 @@ void FlexiChainDouble::computeCurveData(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiChainDouble::computeScaleAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle scaleAdjustmentArrayHandle = dataBlock.inputArrayValue(scaleAdjustmentCompoundAttr);
-	unsigned int numScaleAdjustments = scaleAdjustmentArrayHandle.elementCount();
-	m_data.scaleAdjustments.resize(numScaleAdjustments);
+	// The table must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.isScaleAdjustmentDirty = false;
+	m_data.scaleAdjustmentTable.invalidate();
 
-	for (unsigned int i = 0; i < numScaleAdjustments; ++i)
-	{
-		MDataHandle scaleAdjustmentElementHandle = scaleAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentRampAttr);
-		MDataHandle scaleHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentValueAttr);
-		MDataHandle offsetHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		ScaleAdjustment scaleAdjustment;
-		scaleAdjustment.vScale = scaleHandle.asVector();
-		scaleAdjustment.offset = offsetHandle.asDouble();
-		scaleAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		scaleAdjustment.falloffMode = falloffModeHandle.asShort();
-		scaleAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = scaleAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		scaleAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(scaleAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(scaleAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(scaleAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (scaleAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (scaleAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (scaleAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				scaleAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (scaleAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-
-			rampArrayHandle.next();
-		}
-
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		std::sort(scaleAdjustment.controlPoints.begin(), scaleAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-		if (scaleAdjustment.falloffMode == 1 || scaleAdjustment.falloffMode == 2)
-		{
-			auto cvIter = scaleAdjustment.controlPoints.begin();
-			while (cvIter != scaleAdjustment.controlPoints.end() && cvIter->_pos < scaleAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (scaleAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = scaleAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = scaleAdjustment.controlPoints[scaleAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (scaleAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / scaleAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / scaleAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
-
-				scaleAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[k]);
-						scaleAdjustment.controlPoints.back()._pos -= scaleAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[numTotalControlPoints - 1]);
-					scaleAdjustment.controlPoints.back()._pos -= scaleAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[0]);
-					scaleAdjustment.controlPoints.back()._pos += scaleAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[k]);
-						scaleAdjustment.controlPoints.back()._pos += scaleAdjustment.falloffDistance * (j + 1);
-					}
-				}
-
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < scaleAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					scaleAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
-
-		for (SeExpr2::Curve<double>::CV& controlPoint : scaleAdjustment.controlPoints)
-			scaleAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
-
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		scaleAdjustment.curve.preparePoints();
-		m_data.scaleAdjustments[i] = scaleAdjustment;
-
-		scaleAdjustmentArrayHandle.next();
-	}
+	const FlexiAdjustmentAttributes attributes{ scaleAdjustmentCompoundAttr, scaleAdjustmentRampAttr, scaleAdjustmentRampPositionAttr, scaleAdjustmentRampValueAttr, scaleAdjustmentRampInterpolationAttr,
+		scaleAdjustmentValueAttr, scaleAdjustmentOffsetAttr, scaleAdjustmentFalloffDistanceAttr, scaleAdjustmentFalloffModeAttr, scaleAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.scaleAdjustments);
 }
 
 /*	Description
@@ -1786,844 +1619,71 @@ void FlexiChainDouble::computeScaleAdjustments(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiChainDouble::computeTwistAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle twistAdjustmentArrayHandle = dataBlock.inputArrayValue(twistAdjustmentCompoundAttr);
-	unsigned int numTwistAdjustments = twistAdjustmentArrayHandle.elementCount();
-	m_data.twistAdjustments.resize(numTwistAdjustments);
+	// The table must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.isTwistAdjustmentDirty = false;
+	m_data.twistAdjustmentTable.invalidate();
 
-	for (unsigned int i = 0; i < numTwistAdjustments; ++i)
-	{
-		MDataHandle twistAdjustmentElementHandle = twistAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = twistAdjustmentElementHandle.child(twistAdjustmentRampAttr);
-		MDataHandle twistHandle = twistAdjustmentElementHandle.child(twistAdjustmentValueAttr);
-		MDataHandle offsetHandle = twistAdjustmentElementHandle.child(twistAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = twistAdjustmentElementHandle.child(twistAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = twistAdjustmentElementHandle.child(twistAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = twistAdjustmentElementHandle.child(twistAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		TwistAdjustment twistAdjustment;
-		twistAdjustment.twist = twistHandle.asAngle();
-		twistAdjustment.offset = offsetHandle.asDouble();
-		twistAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		twistAdjustment.falloffMode = falloffModeHandle.asShort();
-		twistAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = twistAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		twistAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(twistAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(twistAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(twistAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (twistAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (twistAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (twistAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				twistAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (twistAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-
-			rampArrayHandle.next();
-		}
-
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		if (twistAdjustment.falloffMode == 1 || twistAdjustment.falloffMode == 2)
-		{
-			std::sort(twistAdjustment.controlPoints.begin(), twistAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-			auto cvIter = twistAdjustment.controlPoints.begin();
-			while (cvIter != twistAdjustment.controlPoints.end() && cvIter->_pos < twistAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (twistAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = twistAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = twistAdjustment.controlPoints[twistAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (twistAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / twistAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / twistAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
-
-				twistAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[k]);
-						twistAdjustment.controlPoints.back()._pos -= twistAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[numTotalControlPoints - 1]);
-					twistAdjustment.controlPoints.back()._pos -= twistAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[0]);
-					twistAdjustment.controlPoints.back()._pos += twistAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[k]);
-						twistAdjustment.controlPoints.back()._pos += twistAdjustment.falloffDistance * (j + 1);
-					}
-				}
-
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < twistAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					twistAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
-
-		for (SeExpr2::Curve<double>::CV& controlPoint : twistAdjustment.controlPoints)
-			twistAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
-
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		twistAdjustment.curve.preparePoints();
-		m_data.twistAdjustments[i] = twistAdjustment;
-
-		twistAdjustmentArrayHandle.next();
-	}
+	const FlexiAdjustmentAttributes attributes{ twistAdjustmentCompoundAttr, twistAdjustmentRampAttr, twistAdjustmentRampPositionAttr, twistAdjustmentRampValueAttr, twistAdjustmentRampInterpolationAttr,
+		twistAdjustmentValueAttr, twistAdjustmentOffsetAttr, twistAdjustmentFalloffDistanceAttr, twistAdjustmentFalloffModeAttr, twistAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.twistAdjustments);
 }
 
 /*	Description
 	-----------
-	Produces an array of lengths (of the current size), each corresponding to a uniform increment of the natural parameter
-	Also produces an array of points sampled at each of the natural parameters
-	- These values are used as the basis for approximating the below parameterization functions
-	- Used when a mapping between arc-length values and natural parameters is required    */
-void FlexiChainDouble::computeLengths()
+	Normalizes the natural parameters over the domain of the chain, this is the range which the adjustment falloff curves are defined over
+	The falloff curves have a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
+	The adjustment tables are invalidated if any parameter has changed, moving the control points alone will therefore not trigger a rebuild    */
+void FlexiChainDouble::computeNormalizedParameters()
 {
-	// Cache arc-lengths by uniformly incrementing over the curves natural parameter t
-	// In this case the combined curve P(t) has a domain P:[0,2] as we are incrementing over two continuous curves
-	m_data.naturalPoints[0] = sampleCurve(0.0);
-	m_data.lengths[0] = 0.0;
+	bool isChanged = m_data.normalizedParameters.size() != m_data.parameterCount;
+	m_data.normalizedParameters.resize(m_data.parameterCount);
 
-	for (unsigned int i = 1; i < m_data.parameterCount; i++)
+	for (unsigned int i = 0; i < m_data.parameterCount; i++)
 	{
-		m_data.naturalPoints[i] = sampleCurve(m_data.naturalParameters[i]);
-		m_data.lengths[i] = m_data.lengths[i - 1] + (m_data.naturalPoints[i - 1] - m_data.naturalPoints[i]).length();
+		double normalizedParam = m_data.naturalParameters[i] / m_data.parameterRange;
+
+		isChanged = isChanged || m_data.normalizedParameters[i] != normalizedParam;
+		m_data.normalizedParameters[i] = normalizedParam;
 	}
-}
 
-/*	Description
-	-----------
-	Produces an array of values for the natural parameter t, each corresponding to a uniform increment of the arc-length
-
-	The curve can be parameterized in terms of its arc-length such that it has unit parametric speed (uniform motion)
-	Consider s to be the normalized arc-length of the curve for some value of t
-	There is an increasing relationship between s and t over the curve's domain [0,2]
-	This relationship can be expressed as L(t)=s, L:[0,2]->[0,1]
-	Subsequently the relationship can be expressed as L^-1(s)=t, L^-1:[0,1]->[0,2]
-	The parameterization of the curve P(t) in terms of its arc-length can be expressed as a composite function Q(s) = P(L^-1(s))
-	It is very difficult to find a closed-form solution to L^-1 however it can be approximated numerically    */
-void FlexiChainDouble::computeArcLengthParameters()
-{
-	// Using the total arc-length, iterate over uniform increments and approximate values of t
-	// We are essentially solving the function L^-1(s) described above, however our values for s are not normalized (the concept remains the same)
-	// We don't want to approximate the end parameters of the curve as they should always be 0 and 3
-	m_data.arcLengthParameters[0] = 0.0;
-	double totalLength = m_data.lengths[m_data.parameterCount - 1];
-	double paramMult = 1.0 / m_data.parameterRange;
-
-	// The number of iterations accounts for the two end parameters
-	for (unsigned int i = 1; i < m_data.parameterCount - 1; i++)
+	if (isChanged)
 	{
-		double targetLength = m_data.naturalParameters[i] * totalLength * paramMult;
-
-		// Complete a binary search to find the closest tLength which is smaller than the targetLength
-		// We then just need to retrieve the t value which was used to calulate the tLength
-		unsigned int low = 0;
-		unsigned int high = m_data.parameterCount;
-		unsigned int index;
-		double tLength;
-
-		while (low < high)
-		{
-			index = low + (high - low) / 2;
-			tLength = m_data.lengths[index];
-
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
-		}
-
-		// The last iteration of the search may cause the index to increase due to the low value increasing on the second last iteration
-		// In this case, the tLength at the current index may be larger than the targetLength
-		// We must complete one final check and decrement the index if this was the case
-		if (tLength > targetLength)
-			index -= 1;
-
-		assert(m_data.lengths[index] <= targetLength);
-		assert(m_data.lengths[index + 1] > targetLength);
-
-		// To retrieve the t value for the tLength we can calculate, t = index / ((parameterCount - 1) * paramMult)
-		// However, we can increase the accuracy by determining the skew of the target length in relation to the lengths before and after
-		double tLengthBefore = m_data.lengths[index];
-		double tLengthAfter = m_data.lengths[index + 1];
-		double t = (index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / ((m_data.parameterCount - 1) * paramMult);
-		m_data.arcLengthParameters[i] = t;
+		m_data.twistAdjustmentTable.invalidate();
+		m_data.scaleAdjustmentTable.invalidate();
 	}
-
-	m_data.arcLengthParameters[m_data.parameterCount - 1] = m_data.parameterRange;
 }
 
 /*	Description
 	-----------
-	Produces an array of values for the natural parameter t, designed to stabalize both joints
-	It provides the ability to stretch the chain whilst maintaining the integrity of its initial form
-
-	The calculation splits the curve into three segments determined by two points on the curve
-	- One closest to the point half way between virtual control points P1 and P2 and one closest to the point half way between virtual control points P3 and P4
-	We want to parameterize each segment of the curve in terms of its arc-length, such that each segment has unit parametric speed (uniform motion)
-	- There will be an instantaneous change in velocity at the points where two segments meet
-	- Each segment should be responsible for calculating a third of the parameters    */
-void FlexiChainDouble::computeSplitLengthParameters()
+	Computes the natural parameters at which each joint is held in place by the split-length parameterization, normalized over the domain of the chain
+	Each joint is stabilized at the point on its span which is closest to the point half way between the two virtual control points which surround it
+	- The search is restricted to the span of each joint, therefore the joints can never cross over each other    */
+void FlexiChainDouble::computeStableParameters()
 {
-	double paramMult = 1.0 / m_data.parameterRange;
-
-	// The curve is not well defined if there are less than four samples
-	m_data.splitLengthParameters[0] = 0.0;
-	if (m_data.parameterCount == 2)
-	{
-		m_data.splitLengthParameters[1] = 2.0;
-		return;
-	}
-	else if (m_data.parameterCount == 3)
-	{
-		m_data.splitLengthParameters[1] = 1.0;
-		m_data.splitLengthParameters[2] = 2.0;
-		return;
-	}
-
-	// We can approximate the two stable parameters by minimizing the distance to our target points
-	// We could also minimize the dot product of the displacement vector with the tangent vector: (p - q(t)) . q'(t) = 0
-	// However the latter solution becomes unstable when a small sample count is used and is more compuationally heavy (requires derivative at each point)
-	// We know each of the closest points will occur close to 25% and 75% of the curves natural parameter respectively so we will begin our search from here
-	// This also avoids the possibility of finding a local minimum instead of the global minimum for each point which is what we are looking for
-
-	// --- Closest Point Joint0 ---
-	MPoint targetPoint = m_data.controlPoints0[1] + (m_data.controlPoints0[2] - m_data.controlPoints0[1]) / 2;
-	// This will always be larger than 0 and smaller than parameterCount-1
-	unsigned int closestIndex0 = m_data.parameterCount / 4;
-	MVector vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0];
-	double closestMag = vDisplacement.length();
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 - 1];
-	double earlyMag = vDisplacement.length();
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 + 1];
-	double lateMag = vDisplacement.length();
-
-	char direction = earlyMag < closestMag ? -1 : 0;
-	direction = lateMag < closestMag ? 1 : direction;
-
-	if (direction != 0)
-	{
-		double nextMag = direction == -1 ? earlyMag : lateMag;
-		while (nextMag < closestMag)
-		{
-			closestIndex0 += direction;
-			closestMag = nextMag;
-
-			// Check bounds
-			if (closestIndex0 == 0 && direction == -1)
-				break;
-			if (closestIndex0 == m_data.parameterCount - 1 && direction == 1)
-				break;
-
-			vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 + direction];
-			nextMag = vDisplacement.length();
-		}
-	}
-
-	// We can calculate, tStable0 = closestIndex0 / ((parameterCount - 1) * paramMult)
-	// However, we can increase the accuracy by determining the skew of the current dot product in relation to the dot product before or after
-	// We are determining if the minimum occurs before or after the current index by querying whether the sign of the dot product calculations changes
-	// If the sign does not change then the minimum is not skewed, indicating the closest index is one of the end points
-	double tStable0 = closestIndex0 / ((m_data.parameterCount - 1) * 0.5);
-
-	double earlyProduct;
-	double lateProduct;
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0]; vDisplacement.normalize();
-	MVector vTangent = sampleFirstDerivative(closestIndex0 / ((m_data.parameterCount - 1) * paramMult));
-	double closestProduct = vDisplacement * vTangent;
-
-	if (closestIndex0 == 0)
-		earlyProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 - 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex0 - 1) / ((m_data.parameterCount - 1) * paramMult));
-		earlyProduct = vDisplacement * vTangent;
-	}
-
-	if (closestIndex0 == m_data.parameterCount - 1)
-		lateProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 + 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex0 + 1) / ((m_data.parameterCount - 1) * paramMult));
-		lateProduct = vDisplacement * vTangent;
-	}
-
-	bool isMinimumEarly0 = (earlyProduct < 0 && closestProduct > 0) || (earlyProduct > 0 && closestProduct < 0);
-	bool isMinimumLate0 = (lateProduct < 0 && closestProduct > 0) || (lateProduct > 0 && closestProduct < 0);
-
-	if (isMinimumEarly0)
-	{
-		// The minimum occurs before tStable0
-		double productDelta = std::abs(earlyProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable0 = tStable0 - step * minimumRatio;
-	}
-	else if (isMinimumLate0)
-	{
-		// The minimum occurs after tStable0
-		double productDelta = std::abs(lateProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable0 = tStable0 + step * minimumRatio;
-	}
-
-	// --- Closest Point Joint1 ---
-	targetPoint = m_data.controlPoints1[1] + (m_data.controlPoints1[2] - m_data.controlPoints1[1]) / 2;
-	// This will always be larger than 0 but may be equal to parameterCount-1
-	unsigned int closestIndex1 = (m_data.parameterCount * 3) / 4;
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1];
-	closestMag = vDisplacement.length();
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 - 1];
-	earlyMag = vDisplacement.length();
-
-	if (closestIndex1 == m_data.parameterCount - 1)
-		lateMag = closestMag;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 + 1];
-		lateMag = vDisplacement.length();
-	}
-
-	direction = earlyMag < closestMag ? -1 : 0;
-	direction = lateMag < closestMag ? 1 : direction;
-
-	if (direction != 0)
-	{
-		double nextMag = direction == -1 ? earlyMag : lateMag;
-		while (nextMag < closestMag)
-		{
-			closestIndex1 += direction;
-			closestMag = nextMag;
-
-			// Check bounds
-			if (closestIndex1 == 0 && direction == -1)
-				break;
-			if (closestIndex1 == m_data.parameterCount - 1 && direction == 1)
-				break;
-
-			vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 + direction];
-			nextMag = vDisplacement.length();
-		}
-	}
-
-	// Same as before, determine the skew
-	double tStable1 = closestIndex1 / ((m_data.parameterCount - 1) * paramMult);
-	
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1]; vDisplacement.normalize();
-	vTangent = sampleFirstDerivative(closestIndex1 / ((m_data.parameterCount - 1) * paramMult));
-	closestProduct = vDisplacement * vTangent;
-
-	if (closestIndex1 == 0)
-		earlyProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 - 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex1 - 1) / ((m_data.parameterCount - 1) * paramMult));
-		earlyProduct = vDisplacement * vTangent;
-	}
-
-	if (closestIndex1 == m_data.parameterCount - 1)
-		lateProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 + 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex1 + 1) / ((m_data.parameterCount - 1) * paramMult));
-		lateProduct = vDisplacement * vTangent;
-	}
-
-	bool isMinimumEarly1 = (earlyProduct < 0 && closestProduct > 0) || (earlyProduct > 0 && closestProduct < 0);
-	bool isMinimumLate1 = (lateProduct < 0 && closestProduct > 0) || (lateProduct > 0 && closestProduct < 0);
-	
-	if (isMinimumEarly1)
-	{
-		// The minimum occurs before tStable1
-		double productDelta = std::abs(earlyProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable1 = tStable1 - step * minimumRatio;
-	}
-	else if (isMinimumLate1)
-	{
-		// The minimum occurs after tStable1
-		double productDelta = std::abs(lateProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable1 = tStable1 + step * minimumRatio;
-	}
-
-	// --- Edge Cases ---
-	// When both joints overlap each other, the entire second segment of the curve becomes a minimum
-	// If this occurs we will ensure all of the samples for the second segment are condensed to this single point
-	if (tStable0 > tStable1)
-	{
-		tStable0 = tStable1;
-		closestIndex0 = closestIndex1;
-		isMinimumEarly0 = isMinimumEarly1;
-		isMinimumLate0 = isMinimumLate1;
-	}
-
-	// --- Sample Distribution ---
-	// When parameterizing the curve, we attempt to evenly distribute samples between each segment
-	// In the case where the parameterCount is not evenly divisible by the 3 segments, the first segments will have preference and receive the extra samples
-	// There are four constant points (start, stable0, stable1, end), from this we can determine the distribution:
-	unsigned int remainingCount = m_data.parameterCount - 4;
-	unsigned int segment0SampleCount = (unsigned)std::ceil(remainingCount / 3.0);
-	remainingCount -= segment0SampleCount;
-	unsigned int segment1SampleCount = (unsigned)std::ceil(remainingCount / 2.0);
-	remainingCount -= segment1SampleCount;
-	unsigned int segment2SampleCount = remainingCount;
-
-	unsigned int stable0Index = segment0SampleCount + 1; // +1 for start point
-	unsigned int stable1Index = segment0SampleCount + segment1SampleCount + 2; // +2 for start and stable0 points
-
-	// --- Segment0 ---
-	// Using the total arc-length of segment0, iterate over uniform increments and approximate values of t for (0, tStable0)
-	double segment0ArcLength = m_curve.naturalToArcLengthParameter(tStable0 * paramMult, m_data.lengths) * m_data.lengths[m_data.parameterCount - 1];
-	double segment0Step = 1.0 / (segment0SampleCount + 1);
-	double segment0Percent = 0.0;
-
-	for (unsigned int i = 1; i < stable0Index; ++i)
-	{
-		segment0Percent += segment0Step;
-		double targetLength = segment0Percent * segment0ArcLength;
-
-		// Complete a binary search to find the closest tLength which is smaller than the targetLength
-		// We then just need to retrieve the t value which was used to calulate the tLength
-		unsigned int low = 0;
-		unsigned int high = isMinimumLate0 ? closestIndex0 + 1 : closestIndex0;
-		unsigned int index;
-		double tLength;
-
-		while (low < high)
-		{
-			index = low + (high - low) / 2;
-			tLength = m_data.lengths[index];
-
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
-		}
-
-		// The last iteration of the search may cause the index to increase due to the low value increasing on the second last iteration
-		// In this case, the tLength at the current index may be larger than the targetLength
-		// We must complete one final check and decrement the index if this was the case
-		if (tLength > targetLength)
-			index -= 1;
-
-		assert(m_data.lengths[index] <= targetLength);
-		assert(m_data.lengths[index + 1] > targetLength);
-
-		// To retrieve the t value for the tLength we can calculate, t = index / ((parameterCount - 1) * paramMult)
-		// However, we can increase the accuracy by determining the skew of the target length in relation to the lengths before and after
-		double tLengthBefore = m_data.lengths[index];
-		double tLengthAfter = m_data.lengths[index + 1];
-		double t = (index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / ((m_data.parameterCount - 1) * 0.5);
-		m_data.splitLengthParameters[i] = t;
-	}
-
-	m_data.splitLengthParameters[stable0Index] = tStable0;
-
-	// --- Segment1 ---
-	// Using the total arc-length of segment1, iterate over uniform increments and approximate values of t for (tStable0, tStable1)
-	double segment1ArcLength = m_curve.naturalToArcLengthParameter(tStable1 * paramMult, m_data.lengths) * 
-		m_data.lengths[m_data.parameterCount - 1] - segment0ArcLength;
-	double segment1Step = 1.0 / (segment1SampleCount + 1);
-	double segment1Percent = 0.0;
-
-	for (unsigned int i = stable0Index + 1; i < stable1Index; ++i)
-	{
-		segment1Percent += segment1Step;
-		double targetLength = segment0ArcLength + segment1Percent * segment1ArcLength;
-
-		unsigned int low = isMinimumEarly0 ? closestIndex0 - 1 : closestIndex0;
-		unsigned int high = isMinimumLate1 ? closestIndex1 + 1 : closestIndex1;
-		unsigned int index;
-		double tLength;
-
-		while (low < high)
-		{
-			index = low + (high - low) / 2;
-			tLength = m_data.lengths[index];
-
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
-		}
-
-		if (tLength > targetLength)
-			index -= 1;
-
-		assert(m_data.lengths[index] <= targetLength);
-		assert(m_data.lengths[index + 1] > targetLength);
-
-		double tLengthBefore = m_data.lengths[index];
-		double tLengthAfter = m_data.lengths[index + 1];
-		double t = (index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / ((m_data.parameterCount - 1) * paramMult);
-		m_data.splitLengthParameters[i] = t;
-	}
-
-	m_data.splitLengthParameters[stable1Index] = tStable1;
-
-	// --- Segment2 ---
-	// Using the total arc-length of segment2, iterate over uniform increments and approximate values of t for (tStable1, 2.0)
-	double segment2ArcLength = m_data.lengths[m_data.parameterCount - 1] - segment0ArcLength - segment1ArcLength;
-	double segment2Step = 1.0 / (segment2SampleCount + 1);
-	double segment2Percent = 0.0;
-
-	for (unsigned int i = stable1Index + 1; i < m_data.parameterCount - 1; ++i)
+	// The sampler is clamped as the closest point search may sample slightly beyond the domain of the span
+	auto closestSpanParameter = [this](double shape, const std::vector<MVector>& controlPoints) -> double
 	{
-		segment2Percent += segment2Step;
-		double targetLength = segment0ArcLength + segment1ArcLength + segment2Percent * segment2ArcLength;
-
-		unsigned int low = isMinimumEarly1 ? closestIndex1 - 1 : closestIndex1;
-		unsigned int high = m_data.parameterCount;
-		unsigned int index;
-		double tLength;
-
-		while (low < high)
-		{
-			index = low + (high - low) / 2;
-			tLength = m_data.lengths[index];
-
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
-		}
+		MVector pJointTarget = controlPoints[1] + (controlPoints[2] - controlPoints[1]) / 2;
+		auto sample = [&](double t) { return m_curve.sampleCurve(MRS::clamp(t, 0.0, 1.0), shape, shape, controlPoints); };
+		return m_curve.closestParameterToPoint(sample, 0.0, 1.0, pJointTarget);
+	};
 
-		if (tLength > targetLength)
-			index -= 1;
-
-		assert(m_data.lengths[index] <= targetLength);
-		assert(m_data.lengths[index + 1] > targetLength);
-
-		double tLengthBefore = m_data.lengths[index];
-		double tLengthAfter = m_data.lengths[index + 1];
-		double t = ((double)index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / ((m_data.parameterCount - 1) * paramMult);
-		m_data.splitLengthParameters[i] = t;
-	}
-
-	m_data.splitLengthParameters[m_data.parameterCount - 1] = m_data.parameterRange;
+	m_data.stableParameters.resize(2);
+	m_data.stableParameters[0] = closestSpanParameter(m_data.jointVolume0, m_data.controlPoints0) / m_data.parameterRange;
+	m_data.stableParameters[1] = (1.0 + closestSpanParameter(m_data.jointVolume1, m_data.controlPoints1)) / m_data.parameterRange;
 }
 
 /*	Description
 	-----------
-	Calculates an equivalent natural parameter approximation for the given split-length parameter
-	We will calculate the stable parameters from which we can determine the arc-lengths of each segment
-	We can then determine the arc-length at the given parameter by determining its proportional position within the segment's parameterized range
-	From the arc-length we can determine the natural parameter
+	Calculates an equivalent natural parameter for the given split-length parameter
 
 	Args
 	----
 	splitLengthParameter = The split-length parameter from which to calculate the equivalent natural parameter, range = [0.0, 2.0]    */
 double FlexiChainDouble::splitLengthToNaturalParameter(double splitLengthParameter)
 {
-	if (splitLengthParameter == 0.0 || splitLengthParameter == 2.0)
-		return splitLengthParameter;
-
-	double paramMult = 1.0 / m_data.parameterRange;
-
-	// --- Closest Point Joint0 ---
-	MPoint targetPoint = m_data.controlPoints0[1] + (m_data.controlPoints0[2] - m_data.controlPoints0[1]) / 2;
-	// This may be equal to 0 but will always be smaller than parameterCount-1
-	unsigned int closestIndex0 = m_data.parameterCount / 4;
-	MVector vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0];
-	double closestMag = vDisplacement.length();
-
-	double earlyMag;
-	if (closestIndex0 == 0)
-		earlyMag = closestMag;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 - 1];
-		earlyMag = vDisplacement.length();
-	}
-
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 + 1];
-	double lateMag = vDisplacement.length();
-
-	char direction = earlyMag < closestMag ? -1 : 0;
-	direction = lateMag < closestMag ? 1 : direction;
-
-	if (direction != 0)
-	{
-		double nextMag = direction == -1 ? earlyMag : lateMag;
-		while (nextMag < closestMag)
-		{
-			closestIndex0 += direction;
-			closestMag = nextMag;
-
-			// Check bounds
-			if (closestIndex0 == 0 && direction == -1)
-				break;
-			if (closestIndex0 == m_data.parameterCount - 1 && direction == 1)
-				break;
-
-			vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 + direction];
-			nextMag = vDisplacement.length();
-		}
-	}
-
-	// We can calculate, tStable0 = closestIndex0 / ((parameterCount - 1) * paramMult)
-	// However, we can increase the accuracy by determining the skew of the current dot product in relation to the dot product before or after
-	// We are determining if the minimum occurs before or after the current index by querying whether the sign of the dot product calculations changes
-	// If the sign does not change then the minimum is not skewed, indicating the closest index is one of the end points
-	double tStable0 = closestIndex0 / ((m_data.parameterCount - 1) * paramMult);
-
-	double earlyProduct;
-	double lateProduct;
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0]; vDisplacement.normalize();
-	MVector vTangent = sampleFirstDerivative(closestIndex0 / ((m_data.parameterCount - 1) * paramMult));
-	double closestProduct = vDisplacement * vTangent;
-
-	if (closestIndex0 == 0)
-		earlyProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 - 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex0 - 1) / ((m_data.parameterCount - 1) * paramMult));
-		earlyProduct = vDisplacement * vTangent;
-	}
-
-	if (closestIndex0 == m_data.parameterCount - 1)
-		lateProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex0 + 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex0 + 1) / ((m_data.parameterCount - 1) * paramMult));
-		lateProduct = vDisplacement * vTangent;
-	}
-
-	bool isMinimumEarly0 = (earlyProduct < 0 && closestProduct > 0) || (earlyProduct > 0 && closestProduct < 0);
-	bool isMinimumLate0 = (lateProduct < 0 && closestProduct > 0) || (lateProduct > 0 && closestProduct < 0);
-
-	if (isMinimumEarly0)
-	{
-		// The minimum occurs before tStable0
-		double productDelta = std::abs(earlyProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable0 = tStable0 - step * minimumRatio;
-	}
-	else if (isMinimumLate0)
-	{
-		// The minimum occurs after tStable0
-		double productDelta = std::abs(lateProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable0 = tStable0 + step * minimumRatio;
-	}
-
-	// --- Closest Point Joint1 ---
-	targetPoint = m_data.controlPoints1[1] + (m_data.controlPoints1[2] - m_data.controlPoints1[1]) / 2;
-	// This will always be larger than 0 but may be equal to parameterCount-1
-	unsigned int closestIndex1 = (m_data.parameterCount * 3) / 4;
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1];
-	closestMag = vDisplacement.length();
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 - 1];
-	earlyMag = vDisplacement.length();
-
-	if (closestIndex1 == m_data.parameterCount - 1)
-		lateMag = closestMag;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 + 1];
-		lateMag = vDisplacement.length();
-	}
-
-	direction = earlyMag < closestMag ? -1 : 0;
-	direction = lateMag < closestMag ? 1 : direction;
-
-	if (direction != 0)
-	{
-		double nextMag = direction == -1 ? earlyMag : lateMag;
-		while (nextMag < closestMag)
-		{
-			closestIndex1 += direction;
-			closestMag = nextMag;
-
-			// Check bounds
-			if (closestIndex1 == 0 && direction == -1)
-				break;
-			if (closestIndex1 == m_data.parameterCount - 1 && direction == 1)
-				break;
-
-			vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 + direction];
-			nextMag = vDisplacement.length();
-		}
-	}
-
-	// Same as before, determine the skew
-	double tStable1 = closestIndex1 / ((m_data.parameterCount - 1) * paramMult);
-
-	vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1]; vDisplacement.normalize();
-	vTangent = sampleFirstDerivative(closestIndex1 / ((m_data.parameterCount - 1) * paramMult));
-	closestProduct = vDisplacement * vTangent;
-
-	if (closestIndex1 == 0)
-		earlyProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 - 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex1 - 1) / ((m_data.parameterCount - 1) * paramMult));
-		earlyProduct = vDisplacement * vTangent;
-	}
-
-	if (closestIndex1 == m_data.parameterCount - 1)
-		lateProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - m_data.naturalPoints[closestIndex1 + 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex1 + 1) / ((m_data.parameterCount - 1) * paramMult));
-		lateProduct = vDisplacement * vTangent;
-	}
-
-	bool isMinimumEarly1 = (earlyProduct < 0 && closestProduct > 0) || (earlyProduct > 0 && closestProduct < 0);
-	bool isMinimumLate1 = (lateProduct < 0 && closestProduct > 0) || (lateProduct > 0 && closestProduct < 0);
-
-	if (isMinimumEarly1)
-	{
-		// The minimum occurs before tStable1
-		double productDelta = std::abs(earlyProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable1 = tStable1 - step * minimumRatio;
-	}
-	else if (isMinimumLate1)
-	{
-		// The minimum occurs after tStable1
-		double productDelta = std::abs(lateProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = m_data.parameterRange / (m_data.parameterCount - 1);
-		tStable1 = tStable1 + step * minimumRatio;
-	}
-
-	// --- Edge Cases ---
-	// When both joints overlap each other, the entire second segment of the curve becomes a minimum
-	// If this occurs we will ensure all of the samples for the second segment are condensed to this single point
-	if (tStable0 > tStable1)
-	{
-		tStable0 = tStable1;
-		closestIndex0 = closestIndex1;
-		isMinimumEarly0 = isMinimumEarly1;
-		isMinimumLate0 = isMinimumLate1;
-	}
-
-	double segment0ArcLength = m_curve.naturalToArcLengthParameter(tStable0 * paramMult, m_data.lengths) * m_data.lengths[m_data.parameterCount - 1];
-	double segment1ArcLength = m_curve.naturalToArcLengthParameter(tStable1 * paramMult, m_data.lengths) * m_data.lengths[m_data.parameterCount - 1] - segment0ArcLength;
-	double segment2ArcLength = m_data.lengths[m_data.parameterCount - 1] - segment0ArcLength - segment1ArcLength;
-	double segmentParamSize = 2.0 / 3.0;
-
-	double targetLength;
-	if (splitLengthParameter >= 0.0 && splitLengthParameter < segmentParamSize)
-	{
-		double segmentRatio = splitLengthParameter / segmentParamSize;
-		targetLength = segment0ArcLength * segmentRatio;
-	}
-	else if (splitLengthParameter >= segmentParamSize && splitLengthParameter < 2 * segmentParamSize)
-	{
-		double segmentRatio = (splitLengthParameter - segmentParamSize) / segmentParamSize;
-		targetLength = segment0ArcLength + segment1ArcLength * segmentRatio;
-	}
-	else
-	{
-		double segmentRatio = (splitLengthParameter - 2 * segmentParamSize) / segmentParamSize;
-		targetLength = segment0ArcLength + segment1ArcLength + segment2ArcLength * segmentRatio;
-	}
-
-	double tLength = 0.0;
-
-	unsigned int low = 0;
-	unsigned int high = m_data.parameterCount;
-	unsigned int index;
-
-	while (low < high)
-	{
-		index = low + (high - low) / 2;
-		tLength = m_data.lengths[index];
-
-		if (tLength < targetLength)
-			low = index + 1;
-		else
-			high = index;
-	}
-
-	if (tLength > targetLength)
-		index -= 1;
-
-	assert(m_data.lengths[index] <= targetLength);
-	assert(m_data.lengths[index + 1] > targetLength);
-
-	double tLengthBefore = m_data.lengths[index];
-	double tLengthAfter = m_data.lengths[index + 1];
-	double t = ((double)index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / ((m_data.parameterCount - 1) * 0.5);
-	return t;
+	return m_curve.splitLengthToNaturalParameter(splitLengthParameter / m_data.parameterRange, m_data.arcLengthTable, 
+		m_data.stableParameters) * m_data.parameterRange;
 }
 
 /*	Description
@@ -2667,86 +1727,93 @@ MStatus FlexiChainDouble::computeCounterTwistStability(double& outStability)
 	This function is called exclusively by the FlexiChainDoubleCounterTwist command and is used to calculate the counter twist cache for this node
 	Counter twist is an iterative calculation which is designed to stabalise the end frame of the curve
 	It essentially mitigates any twist deviation induced on the moving frame of the curve over a specified time range
-	This function assumes the command from which it was called has validated all inputs and checked that orientation computation is enabled    */
-MStatus FlexiChainDouble::computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, MObject& animCurveObj, MAnimCurveChange& animMod)
+	This function assumes the command from which it was called has validated all inputs and checked that orientation computation is enabled
+
+	Optimizations
+	-------------
+	The node is evaluated under a separate context for each sample time, the global time is never changed and the scene is not updated per sample
+	- Only the curve inputs are pulled and evaluation stops once the RMF has been sampled, the adjustments and frames are never computed
+	- If an angular tolerance is given, evaluation stops once the curve has been built and the end normal is integrated adaptively instead
+	- Only the end frame of each sample is retained, the angles are then calculated and keyed as a single batch (see keyFlexiCounterTwist)
+	The node data is invalidated once the samples have been computed so that the next evaluation rebuilds it for the current time
+
+	Args
+	----
+	subSteps = Number of samples taken per time step, keyframes are only set at each time step
+		Additional samples help to resolve the direction of large rotations which occur between consecutive keyframes
+	angularTolerance = Maximum angular error in radians of each end normal computed by the adaptive integration (see Spline::propagateNormalRMF)
+		If zero, the end normal is computed from the sampled RMF and will exactly match the drawn frames    */
+MStatus FlexiChainDouble::computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, unsigned int subSteps, double angularTolerance, 
+	MObject& animCurveObj, MAnimCurveChange& animMod)
 {
 	MStatus status;
 
 	MFnAnimCurve fnAnimCurve{ animCurveObj };
-	MTime currentTime = MAnimControl::currentTime();
-	MTime iterTime = startTime;
-	double previousAngle = 0.0;
-	double totalAngle = 0.0;
-
-	// For each frame, calculate a signed angle between the upVector/endUpVectorOverride (projected onto the tangent plane) and the normal vector
-	// Note, if the up-vector is close to parallel with tangent, the projection onto the tangent plane will be close to a zero-vector (angle may experience flipping)
-	while (iterTime <= endTime)
+
+	// Determine the number of keyframes which fit within the time range, then the total number of samples including sub-steps
+	unsigned int keyCount = 0;
+	while (startTime + timeStep * (double)keyCount <= endTime)
+		++keyCount;
+
+	unsigned int sampleCount = (keyCount - 1) * subSteps + 1;
+	std::vector<MVector> upperBoundTangents(sampleCount);
+	std::vector<MVector> upperBoundNormals(sampleCount);
+	std::vector<MVector> counterTwistUpVectors(sampleCount);
+
+	// The adaptive integration samples the curve directly, each span boundary is a breakpoint
+	auto sampleSpans = [this](double t, MVector& outPoint, MVector& outFirstDerivative)
 	{
-		if (!status)
-			return MStatus::kFailure;
+		outPoint = sampleCurve(t);
+		outFirstDerivative = sampleFirstDerivative(t);
+	};
 
+	// --- Sample End Frames ---
+	// Each sample time must be evaluated by the DG on the main thread
+	for (unsigned int i = 0; i < sampleCount; ++i)
+	{
+		MTime sampleTime = startTime + timeStep * ((double)i / subSteps);
+		MDGContext timeContext{ sampleTime };
+		MDGContextGuard contextGuard{ timeContext };
 		MDataBlock dataBlock = forceCache();
 
-		// This call does not cause the viewport loop to refresh
-		MAnimControl::setCurrentTime(iterTime);
-		// We must force a DG update (we can either call the "refresh" command or manually pull data from an output)
-		dataBlock.inputValue(outputWorldFramesAttr);
+		computeCurve(dataBlock);
 
-		// Calculate upper threshold data
-		MVector vUpperBoundTangent = m_data.controlPoints1[3] - m_data.controlPoints1[2];
-		vUpperBoundTangent.normalize();
-		MQuaternion qPrincipalNormal{ m_data.vPrincipalNormal.x, m_data.vPrincipalNormal.y, m_data.vPrincipalNormal.z, 0.0 };
-		MQuaternion qReflectionComposition = m_data.rmfReflections[m_data.sampleCount - 1];
-		MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-		MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-		MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-		MVector vUpperBoundNormal{ qNormal.x, qNormal.y, qNormal.z };
-		vUpperBoundNormal.normalize();
-
-		// Project the up-vector onto the end tangent
-		MVector vProjUpOnTangent = (m_data.vCounterTwistUp * vUpperBoundTangent) * vUpperBoundTangent;
-		// Project the up-vector onto the tangent plane
-		MVector vProjUpOnTangentPlane = m_data.vCounterTwistUp - vProjUpOnTangent;
-		vProjUpOnTangentPlane.normalize();
-
-		// Calculate sign of the angle
-		MVector vCrossProjWithNormal = vProjUpOnTangentPlane ^ vUpperBoundNormal;
-		double dotCrossWithTangent = vCrossProjWithNormal * vUpperBoundTangent;
-		int angularDirection = dotCrossWithTangent < 0.0 ? 1 : -1;
-
-		// Calculate angle
-		double currentAngle = std::acos(vProjUpOnTangentPlane * vUpperBoundNormal);
-		currentAngle *= angularDirection;
-
-		// Calculate delta from previous frame
-		double angularDelta;
-		if (std::abs(currentAngle - previousAngle) > M_PI)
+		if (!m_data.isOrientEnabled)
 		{
-			// The normal is pointing in a similiar direction to the negated projection vector
-			// This causes a large discrepency between the previous and current angles (ie. angle is close to 180 degrees but direction has changed)
-			if (currentAngle > 0.0)
-				angularDelta = (-2 * M_PI) + (currentAngle - previousAngle);
-			else
-				angularDelta = (2 * M_PI) + (currentAngle - previousAngle);
+			status = MStatus::kFailure;
+			break;
 		}
-		else
-			angularDelta = currentAngle - previousAngle;
 
-		// Counter the twist
-		angularDelta *= -1;
+		MVector vUpperBoundTangent = m_data.controlPoints1[3] - m_data.controlPoints1[2];
+		vUpperBoundTangent.normalize();
+		upperBoundTangents[i] = vUpperBoundTangent;
+		counterTwistUpVectors[i] = m_data.vCounterTwistUp;
 
-		// Set a keyframe at the current time using the accumulative angle
-		totalAngle += angularDelta;
-		fnAnimCurve.addKey(iterTime, totalAngle, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &animMod, &status);
+		if (angularTolerance > 0.0)
+		{
+			// The principal normal is calculated in the same way as the RMF
+			MVector vLowerBoundTangent = sampleFirstDerivative(0.0);
+			vLowerBoundTangent.normalize();
+			MVector vLowerBoundNormal = computeFlexiPrincipalNormal(m_data.vNormalUp, vLowerBoundTangent);
 
-		previousAngle = currentAngle;
-		iterTime += timeStep;
+			upperBoundNormals[i] = m_curve.propagateNormalRMF(sampleSpans, { 1.0 }, 0.0, m_data.parameterRange, vLowerBoundNormal, angularTolerance);
+		}
+		else
+		{
+			computeCurveSamples(dataBlock);
+			upperBoundNormals[i] = m_data.normals[m_data.sampleCount - 1];
+		}
 	}
 
-	// Restore the previous time
-	MAnimControl::setCurrentTime(currentTime);
+	// The data held by the node corresponds to the last sample context
+	invalidateCurveData();
 
-	return status;
+	if (!status)
+		return status;
+
+	// --- Key Counter Twist ---
+	return keyFlexiCounterTwist(upperBoundTangents, upperBoundNormals, counterTwistUpVectors, startTime, timeStep, subSteps, MRS::kDefaultGrainSize, 
+		fnAnimCurve, animMod);
 }
 
 /*	Description
@@ -2792,9 +1859,31 @@ void FlexiChainDouble::instancingChangedCallback(MDagPath& child, MDagPath& pare
 	MGlobal::displayWarning("FlexiChainDoubleShape does not support instancing!");
 }
 
+/*	Description
+	-----------
+	Dirties the draw state of the node, the draw dirty count is incremented before notifying the renderer
+	The sub-scene override compares this count against the count it last updated with to determine if an update is required    */
+void FlexiChainDouble::setDrawDirty()
+{
+	++m_drawDirtyCount;
+	MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+}
+
+/*	Description
+	-----------
+	Publishes the index of the active manipulator within the current tool context, an index of -1 signals that no manipulator is active
+	The draw dirty count is not affected, instead the renderer is notified so that the override can compare the version of the published state    */
+void FlexiChainDouble::setActiveManip(int index)
+{
+	if (m_manipState.setActiveIndex(index))
+		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+}
+
 const MRS::CubicTBezier& FlexiChainDouble::getCurve() const { return m_curve; }
 const FlexiChainDouble::FlexiChainDouble_Data& FlexiChainDouble::getCurveData() const { return m_data; }
 MDataBlock FlexiChainDouble::getDataBlock() { return forceCache(); }
+unsigned int FlexiChainDouble::getDrawDirtyCount() const { return m_drawDirtyCount; }
+const FlexiManipState& FlexiChainDouble::getManipState() const { return m_manipState; }
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -2806,7 +1895,7 @@ MDataBlock FlexiChainDouble::getDataBlock() { return forceCache(); }
 
 	MEL Command
 	-----------
-	FlexiChainDoubleCounterTwist [-startTime float] [-endTime float] [-timeStep float] [object]
+	FlexiChainDoubleCounterTwist [-startTime float] [-endTime float] [-timeStep float] [-subSteps int] [-tolerance angle] [object]
 
 	Flags
 	-----
@@ -2824,6 +1913,16 @@ MDataBlock FlexiChainDouble::getDataBlock() { return forceCache(); }
 		A precautionary minimum value of 0.01 is enforced so that extremely small values do not tend towards an infinitely sized cached
 		The default value is 1.0
 
+	-subSteps(-ss)
+		This flag specifies the number of samples taken per time step, keyframes will only be set at each time step
+		Increasing the value allows large rotations of the end frame between keyframes to be resolved in the correct direction
+		The default value is 1
+
+	-tolerance(-tol)
+		This flag specifies the angular tolerance used to adaptively integrate the end frame of the curve
+		The end frame is then computed independently of the output count and subdivisions, which is typically much cheaper
+		If this flag is not set, the end frame is computed from the samples of the curve and will exactly match the drawn frames
+
 	Args
 	----
 	object
@@ -2841,6 +1940,10 @@ const char* FlexiChainDouble_CounterTwistCommand::kEndTimeFlag = "-et";
 const char* FlexiChainDouble_CounterTwistCommand::kEndTimeFlagLong = "-endTime";
 const char* FlexiChainDouble_CounterTwistCommand::kTimeStepFlag = "-ts";
 const char* FlexiChainDouble_CounterTwistCommand::kTimeStepFlagLong = "-timeStep";
+const char* FlexiChainDouble_CounterTwistCommand::kSubStepsFlag = "-ss";
+const char* FlexiChainDouble_CounterTwistCommand::kSubStepsFlagLong = "-subSteps";
+const char* FlexiChainDouble_CounterTwistCommand::kToleranceFlag = "-tol";
+const char* FlexiChainDouble_CounterTwistCommand::kToleranceFlagLong = "-tolerance";
 
 MSyntax FlexiChainDouble_CounterTwistCommand::newSyntax()
 {
@@ -2850,6 +1953,8 @@ MSyntax FlexiChainDouble_CounterTwistCommand::newSyntax()
 	syntax.addFlag(kStartTimeFlag, kStartTimeFlagLong, MSyntax::kTime);
 	syntax.addFlag(kEndTimeFlag, kEndTimeFlagLong, MSyntax::kTime);
 	syntax.addFlag(kTimeStepFlag, kTimeStepFlagLong, MSyntax::kTime);
+	syntax.addFlag(kSubStepsFlag, kSubStepsFlagLong, MSyntax::kUnsigned);
+	syntax.addFlag(kToleranceFlag, kToleranceFlagLong, MSyntax::kAngle);
 
 	// Args
 	syntax.useSelectionAsDefault(true);
@@ -2872,6 +1977,12 @@ MSyntax FlexiChainDouble_CounterTwistCommand::newSyntax()
 #define kErrorInvalidTimeStep \
 	"The \"-timeStep\" flag must be given a value greater or equal to 0.01 ."
 
+#define kErrorInvalidSubSteps \
+	"The \"-subSteps\" flag must be given a value greater or equal to 1 ."
+
+#define kErrorInvalidTolerance \
+	"The \"-tolerance\" flag must be given a value greater than 0 ."
+
 #define kErrorInvalidTimeInterval \
 	"The \"-endTime\" flag must be given a value greater than the \"-startTime\" flag"
 
@@ -2939,6 +2050,36 @@ MStatus FlexiChainDouble_CounterTwistCommand::doIt(const MArgList& args)
 			return MStatus::kFailure;
 		}
 	}
+	unsigned int subSteps = 1;
+	if (argParser.isFlagSet(kSubStepsFlagLong))
+	{
+		if (!argParser.getFlagArgument(kSubStepsFlagLong, 0, subSteps))
+		{
+			MString msg;
+			MString msgFormat = kErrorParsingFlag;
+			msg.format(msgFormat, kSubStepsFlagLong);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+	}
+	MAngle tolerance{ 0.0 };
+	if (argParser.isFlagSet(kToleranceFlagLong))
+	{
+		if (!argParser.getFlagArgument(kToleranceFlagLong, 0, tolerance))
+		{
+			MString msg;
+			MString msgFormat = kErrorParsingFlag;
+			msg.format(msgFormat, kToleranceFlagLong);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+
+		if (tolerance.asRadians() <= 0.0)
+		{
+			displayError(kErrorInvalidTolerance);
+			return MStatus::kFailure;
+		}
+	}
 
 	// Check parsed values are valid
 	if (timeStep < 0.01)
@@ -2947,6 +2088,12 @@ MStatus FlexiChainDouble_CounterTwistCommand::doIt(const MArgList& args)
 		return MStatus::kFailure;
 	}
 
+	if (subSteps < 1)
+	{
+		displayError(kErrorInvalidSubSteps);
+		return MStatus::kFailure;
+	}
+
 	if (endTime < startTime)
 	{
 		displayError(kErrorInvalidTimeInterval);
@@ -3043,7 +2190,7 @@ MStatus FlexiChainDouble_CounterTwistCommand::doIt(const MArgList& args)
 
 	// Add keyframes and store the changes in a cache for undo/redo
 	if (status)
-		status = locator->computeCounterTwist(startTime, endTime, timeStep, animCurveObj, m_animChangeMod);
+		status = locator->computeCounterTwist(startTime, endTime, timeStep, subSteps, tolerance.asRadians(), animCurveObj, m_animChangeMod);
 
 	return status;
 }
@@ -3078,6 +2225,8 @@ MStatus FlexiChainDouble_CounterTwistCommand::undoIt()
 #undef kErrorFlagNotSet
 #undef kErrorParsingFlag
 #undef kErrorInvalidTimeStep
+#undef kErrorInvalidSubSteps
+#undef kErrorInvalidTolerance
 #undef kErrorInvalidTimeInterval
 #undef kErrorNoValidObject
 #undef kErrorInvalidType
@@ -3264,22 +2413,25 @@ MStatus FlexiChainDouble_StabilityCommand::doIt(const MArgList& args)
 		return MStatus::kFailure;
 	}
 
-	MTime currentTime = MAnimControl::currentTime();
-	// This call does not cause the viewport loop to refresh
-	MAnimControl::setCurrentTime(time);
-	// We must force a DG update (we can either call the "refresh" command or manually pull data from an output)
-	dataBlock.inputValue(FlexiChainDouble::outputWorldFramesAttr);
+	// Stability only depends on the control points and up-vectors
+	// Therefore the node is evaluated under a context for the given time and evaluation stops once the curve has been built
+	double stability = 0.0;
+	{
+		MDGContext timeContext{ time };
+		MDGContextGuard contextGuard{ timeContext };
+		MDataBlock timeDataBlock = locator->getDataBlock();
+		locator->computeCurve(timeDataBlock);
 
-	// Calculate the stability of the up-vector
-	double stability;
-	if (isQueryNormal)
-		locator->computeNormalStability(stability);
-	else
-		locator->computeCounterTwistStability(stability);
+		// Calculate the stability of the up-vector
+		if (isQueryNormal)
+			status = locator->computeNormalStability(stability);
+		else
+			status = locator->computeCounterTwistStability(stability);
+	}
 
 	// Set result and cleanup
+	locator->invalidateCurveData();
 	setResult(stability);
-	MAnimControl::setCurrentTime(currentTime);
 	return status;
 }
 
@@ -208,7 +208,7 @@ void FlexiChainDouble_UpVectorManip::drawUI(MHWRender::MUIDrawManager& drawManag
 {
 	const short manipMainColor = mainColor();
 	const short manipLineColor = lineColor();
-	MPoint pCameraWorld = getCameraPosition(frameContext);
+	MPoint pCameraWorld = getFlexiCameraPosition(frameContext);
 
 	// State Icon
 	MPointArray iconPoints;
@@ -229,7 +229,7 @@ void FlexiChainDouble_UpVectorManip::drawUI(MHWRender::MUIDrawManager& drawManag
 	MPoint pIconOffset = m_pLineEnd;
 	MVector vAim = pIconOffset - pCameraWorld;
 	vAim.normalize();
-	MVector vUp = getCameraUpDirection(frameContext);
+	MVector vUp = getFlexiCameraUpDirection(frameContext);
 	MVector vRight = vAim ^ vUp;
 	vRight.normalize();
 	vUp = vRight ^ vAim;
@@ -313,7 +313,7 @@ MStatus FlexiChainDouble_UpVectorManip::doPress(M3dView& view)
 			MGlobal::executeCommand("undoInfo -openChunk");
 			m_isUserInteracting = true;
 
-			MPoint pCameraWorld = getCameraPosition(view);
+			MPoint pCameraWorld = getFlexiCameraPosition(view);
 
 			// We want to calculate the normal of the intersection plane here so that it is not continually updating during a drag
 			// If it were continually updating during a drag, then we would not be dragging along a static plane (ie. the plane would be rotating as we were dragging)
@@ -389,7 +389,7 @@ MStatus FlexiChainDouble_UpVectorManip::doRelease(M3dView& view)
 	The menu allows the user to execute certain operations on the manipulator and its associated plug    */
 MStatus FlexiChainDouble_UpVectorManip::doMove(M3dView& view, bool& refresh)
 {
-	MPoint pCameraWorld = getCameraPosition(view);
+	MPoint pCameraWorld = getFlexiCameraPosition(view);
 
 	MVector vInterPlaneNormalHandle = m_pLineEnd - pCameraWorld;
 	vInterPlaneNormalHandle.normalize();
@@ -402,18 +402,7 @@ MStatus FlexiChainDouble_UpVectorManip::doMove(M3dView& view, bool& refresh)
 	MVector vMouseOffsetHandle = m_pLineEnd - pInterMouseHandle;
 
 	// If the offset is smaller than the handle's radius then the mouse is within the hover region
-	// The MUIDrawManager adds a hover buffer region around items which appears to be proportional to the items' distance from the camera
-	// The below calculation attempts to mimic this hover buffer region with fairly high accuracy (not actually sure how it works internally)
-	MPoint pCamera = getCameraPosition(view);
-	MVector vCameraToHandle = m_pLineEnd - pCamera;
-	// The max multiplier of 4.0 occurs at 10 meters
-	MDistance refDist{ 1000, MDistance::kCentimeters };
-	double hoverRadiusMult = vCameraToHandle.length() / refDist.asUnits(MDistance::uiUnit()) * 4.0;
-	// Clamp the multiplier to the max (ie. past 10 meters the multiplier is always 4.0)
-	hoverRadiusMult = std::min(hoverRadiusMult, 4.0);
-	// Remap the multiplier so the low is always 1.0
-	// Remap = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-	hoverRadiusMult = 1.0 + hoverRadiusMult * 3.0 / 4.0;
+	double hoverRadiusMult = computeFlexiHoverRadiusMultiplier(pCameraWorld, m_pLineEnd);
 
 	if (vMouseOffsetHandle.length() <= m_handleRadius.asUnits(MDistance::uiUnit()) * hoverRadiusMult)
 		m_isMouseHovered = true;
@@ -519,85 +508,6 @@ bool FlexiChainDouble_UpVectorManip::isActive()
 	return m_isActive;
 }
 
-// Legacy implementation
-MPoint FlexiChainDouble_UpVectorManip::getCameraPosition(M3dView& view) const
-{
-	MDagPath cameraPath;
-	view.getCamera(cameraPath);
-	cameraPath.pop();
-	MPoint pCameraWorld = MFnTransform(cameraPath).rotatePivot(MSpace::kWorld);
-	return pCameraWorld;
-}
-
-// VP2 implementation
-MPoint FlexiChainDouble_UpVectorManip::getCameraPosition(const MHWRender::MFrameContext& frameContext) const
-{
-	MDoubleArray viewPosition = frameContext.getTuple(MHWRender::MFrameContext::kViewPosition);
-	MPoint pCameraWorld{ viewPosition[0], viewPosition[1], viewPosition[2] };
-	return pCameraWorld;
-}
-
-// Legacy implementation
-MVector FlexiChainDouble_UpVectorManip::getCameraAimDirection(M3dView& view) const
-{
-	MDagPath cameraPath;
-	view.getCamera(cameraPath);
-	cameraPath.pop();
-	MFnCamera cameraFn{ cameraPath };
-	MVector vAimDirection = cameraFn.viewDirection(MSpace::kWorld);
-	return vAimDirection;
-}
-
-// VP2 implementation
-MVector FlexiChainDouble_UpVectorManip::getCameraAimDirection(const MHWRender::MFrameContext& frameContext) const
-{
-	MDoubleArray aimDirection = frameContext.getTuple(MHWRender::MFrameContext::kViewDirection);
-	MPoint vAimDirection{ aimDirection[0], aimDirection[1], aimDirection[2] };
-	return vAimDirection;
-}
-
-// Legacy implementation
-MVector FlexiChainDouble_UpVectorManip::getCameraUpDirection(M3dView& view) const
-{
-	MDagPath cameraPath;
-	view.getCamera(cameraPath);
-	cameraPath.pop();
-	MFnCamera cameraFn{ cameraPath };
-	MVector vUpDirection = cameraFn.upDirection(MSpace::kWorld);
-	return vUpDirection;
-}
-
-// VP2 implementation
-MVector FlexiChainDouble_UpVectorManip::getCameraUpDirection(const MHWRender::MFrameContext& frameContext) const
-{
-	MDoubleArray upDirection = frameContext.getTuple(MHWRender::MFrameContext::kViewUp);
-	MPoint vUpDirection{ upDirection[0], upDirection[1], upDirection[2] };
-	return vUpDirection;
-}
-
-/*	Description
-	-----------
-	Calculates the intersection of the given mouse position and direction raycast onto the plane determined by the given plane data
-	Returns true if the raycast produces a successful intersection    */
-bool FlexiChainDouble_UpVectorManip::computeMouseIntersection(const MPoint& pMouse, const MVector& vMouseDirection, const MPoint& pPointOnInterPlane, 
-	const MVector& vInterPlaneNormal, MPoint& pIntersection)
-{
-	// Vector from the mouse to a point on the intersection plane
-	MVector vMouseToPointOnInterPlane = pPointOnInterPlane - pMouse;
-
-	// Here we are finding the ratio between two projections
-	// - The above vector projected onto the intersection plane normal
-	// - The mouse direction projected onto the intersection plane normal
-	double projectionRatio = (vMouseToPointOnInterPlane * vInterPlaneNormal) / (vMouseDirection * vInterPlaneNormal);
-
-	// Scale the mouse direction vector by the ratio then add to the mouse position to get the intersection point
-	MVector vMouseToInterPoint = vMouseDirection * projectionRatio;
-	pIntersection = pMouse + vMouseToInterPoint;
-
-	// Return true if both projections are in the same direction
-	return projectionRatio >= 0.0;
-}
-
 /*	Description
 	-----------
 	Calculates the intersection of the current mouse position raycast onto the plane determined by the given plane data
@@ -610,12 +520,7 @@ bool FlexiChainDouble_UpVectorManip::computeCurrentMouseIntersection(const MPoin
 	if (!mouseRay(pMouse, vMouseDirection))
 		return false;
 
-	MVector vMouseToPointOnInterPlane = pPointOnInterPlane - pMouse;
-	double projectionRatio = (vMouseToPointOnInterPlane * vInterPlaneNormal) / (vMouseDirection * vInterPlaneNormal);
-	MVector vMouseToInterPoint = vMouseDirection * projectionRatio;
-	pIntersection = pMouse + vMouseToInterPoint;
-
-	return projectionRatio >= 0.0;
+	return intersectFlexiPlane(pMouse, vMouseDirection, pPointOnInterPlane, vInterPlaneNormal, pIntersection);
 }
 
 void FlexiChainDouble_UpVectorManip::updateManipState()
@@ -789,7 +694,9 @@ void FlexiChainDouble_UpVectorContext::toolOffCleanup()
 	}
 	m_nodePlugChangedCallbackIds.clear();
 
-	// Delete manipulators
+	// Delete manipulators, the published state is reset as no manipulator can remain active
+	for (FlexiChainDouble_UpVectorManipContainer*& manipContainer : m_manipContainers)
+		manipContainer->m_locator->setActiveManip(-1);
 	m_manipContainers.clear();
 	deleteManipulators();
 
@@ -847,7 +754,7 @@ MString FlexiChainDouble_UpVectorContext::getHoverManipPlug()
 
 /*	Description
 	-----------
-	This function is invoked by the associated MPxSubSceneOverride registered to FlexiChainDouble nodes
+	This function is invoked when the context command is queried with the -activeManipPlug flag
 	If a manipulator which belongs to this context is currently active, it will return the partial name of the plug to which the manipulator is associated
 	If no manipulator is active, an empty string will be returned    */
 MString FlexiChainDouble_UpVectorContext::getActiveManipPlug()
@@ -888,9 +795,32 @@ void FlexiChainDouble_UpVectorContext::setActiveManipPlug(MString& activeManipPl
 			else
 				manipContainer->m_manip->m_isActive = false;
 		}
+
+		publishActiveManip();
 	}
 }
 
+/*	Description
+	-----------
+	Publishes the active manipulator to the manipulator state of each locator tied to this context
+	The associated MPxSubSceneOverride reads this state directly instead of querying the context, locators which do not own the active manipulator are reset    */
+void FlexiChainDouble_UpVectorContext::publishActiveManip()
+{
+	FlexiChainDouble* activeLocator = nullptr;
+	int activeIndex = -1;
+	for (FlexiChainDouble_UpVectorManipContainer*& manipContainer : m_manipContainers)
+	{
+		if (manipContainer->m_manip->isActive())
+		{
+			activeLocator = manipContainer->m_locator;
+			activeIndex = (int)manipContainer->m_manip->m_positionIndex;
+		}
+	}
+
+	for (FlexiChainDouble_UpVectorManipContainer*& manipContainer : m_manipContainers)
+		manipContainer->m_locator->setActiveManip(manipContainer->m_locator == activeLocator ? activeIndex : -1);
+}
+
 /*	Description
 	-----------
 	This function is responsible for setting up manipulators and their associated callbacks
@@ -911,7 +841,9 @@ void FlexiChainDouble_UpVectorContext::updateManipulatorsCallback(void* data)
 	}
 	context->m_nodePlugChangedCallbackIds.clear();
 
-	// Delete manipulators
+	// Delete manipulators, the published state is reset as the new manipulators are created inactive
+	for (FlexiChainDouble_UpVectorManipContainer*& manipContainer : context->m_manipContainers)
+		manipContainer->m_locator->setActiveManip(-1);
 	context->m_manipContainers.clear();
 	context->deleteManipulators();
 
@@ -115,15 +115,6 @@ private:
 	// ------ Helpers ------
 	MPoint sampleCurve(double param);
 
-	MPoint getCameraPosition(M3dView& view) const;
-	MPoint getCameraPosition(const MHWRender::MFrameContext& frameContext) const;
-	MVector getCameraAimDirection(M3dView& view) const;
-	MVector getCameraAimDirection(const MHWRender::MFrameContext& frameContext) const;
-	MVector getCameraUpDirection(M3dView& view) const;
-	MVector getCameraUpDirection(const MHWRender::MFrameContext& frameContext) const;
-
-	bool computeMouseIntersection(const MPoint& pMouse, const MVector& vMouseDirection, const MPoint& pPointOnInterPlane,
-		const MVector& vInterPlaneNormal, MPoint& pIntersection);
 	bool computeCurrentMouseIntersection(const MPoint& pPointOnInterPlane, const MVector& vInterPlaneNormal, MPoint& pIntersection);
 
 	MStatus updatePlugDirection(MVector& vDirection);
@@ -182,6 +173,7 @@ public:
 
 private:
 	// ------ Helpers ------
+	void publishActiveManip();
 	static void updateManipulatorsCallback(void* data);
 	static void nodePlugChangedCallback(MNodeMessage::AttributeMessage msg, MPlug& plug, MPlug& otherPlug, void* data);
 
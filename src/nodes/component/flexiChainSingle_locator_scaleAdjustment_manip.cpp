@@ -25,7 +25,7 @@ FlexiChainSingle_ScaleAdjustmentManip::~FlexiChainSingle_ScaleAdjustmentManip()
 // Static
 unsigned int FlexiChainSingle_ScaleAdjustmentManip::physicalIndex = 0;
 const MDistance FlexiChainSingle_ScaleAdjustmentManip::m_offsetHandleRadius{ 1.2, MDistance::kCentimeters };
-const double FlexiChainSingle_ScaleAdjustmentManip::m_offsetHandleDragIncrement = 0.001;
+const unsigned int FlexiChainSingle_ScaleAdjustmentManip::m_offsetHandleSubdivisions = 128;
 
 // ------ MPxNode------
 
@@ -106,11 +106,11 @@ void FlexiChainSingle_ScaleAdjustmentManip::drawUI(MHWRender::MUIDrawManager& dr
 {
 	const short manipMainColor = mainColor();
 	const short manipLineColor = lineColor();
-	MPoint pCameraWorld = getCameraPosition(frameContext);
+	MPoint pCameraWorld = getFlexiCameraPosition(frameContext);
 	
 	MVector vAim = m_pOffsetHandle - pCameraWorld;
 	vAim.normalize();
-	MVector vUp = getCameraUpDirection(frameContext);
+	MVector vUp = getFlexiCameraUpDirection(frameContext);
 	MVector vRight = vAim ^ vUp;
 	vRight.normalize();
 	vUp = vRight ^ vAim;
@@ -194,7 +194,7 @@ MStatus FlexiChainSingle_ScaleAdjustmentManip::doPress(M3dView& view)
 			MGlobal::executeCommand("undoInfo -openChunk");
 			m_isUserInteracting = true;
 
-			MPoint pCameraWorld = getCameraPosition(view);
+			MPoint pCameraWorld = getFlexiCameraPosition(view);
 
 			// Cache values which will be used to calculate selection offsets so that we can maintain the user's original mouse position relative to the selected item
 			// Cache the original normal of the intersection plane for the current start point
@@ -211,11 +211,11 @@ MStatus FlexiChainSingle_ScaleAdjustmentManip::doPress(M3dView& view)
 /*	Description
 	-----------
 	Function finds the end position of the manipulator
-	- The current mouse position is raycast onto three intersection planes all of which are normal to the camera
-	- One intersection plane is centered at the current manipulator start point, the other two are positioned at small increments along the curve in either direction
-	- An offset is calculated relative to each intersection plane by raycasting the original mouse down and manipulator start positions onto each plane
-	- We compare the lengths of three vector going from the intersection on each plane to the respective center of each plane whilst maintaining the relative offset
-	- The smallest vector corresponds to the closest point along the curve relative to the current mouse position and becomes our new start position for the manipulator    */
+	- The current mouse position is raycast onto an intersection plane which is normal to the camera and centered at the current manipulator position
+	- The original mouse down and manipulator positions are also raycast onto the plane, their difference maintains the user's original offset from the manipulator
+	- Removing this offset from the current mouse intersection gives a target point through which the manipulator's line of sight must pass
+	- The point along the curve which is closest to this line of sight becomes our new position for the manipulator
+	The curve parameter is solved directly, therefore the offset plug is written at most once per drag event    */
 MStatus FlexiChainSingle_ScaleAdjustmentManip::doDrag(M3dView& view)
 {
 	MStatus status;
@@ -224,91 +224,36 @@ MStatus FlexiChainSingle_ScaleAdjustmentManip::doDrag(M3dView& view)
 	{
 		if (m_activeName == m_handleName)
 		{
-			MPoint pCameraWorld = getCameraPosition(view);
+			MPoint pCameraWorld = getFlexiCameraPosition(view);
+
+			MPoint pMouse;
+			MVector vMouseDirection;
+			if (!mouseRay(pMouse, vMouseDirection))
+				return status;
+
+			MVector vInterPlaneNormal = m_pOffsetHandle - pCameraWorld;
+			vInterPlaneNormal.normalize();
+
+			// Find the intersection of the current mouse position raycast onto the intersection plane
+			MPoint pInterMouseEnd;
+			computeCurrentMouseIntersection(m_pOffsetHandle, vInterPlaneNormal, pInterMouseEnd);
+			// Find the intersections of the original mouse press position and the original handle position raycast onto the intersection plane
+			MPoint pInterOriginalMousePress;
+			MPoint pInterOriginalHandle;
+			intersectFlexiPlane(m_pMousePressOffsetHandle, m_vMousePressDirectionOffsetHandle, m_pOffsetHandle, vInterPlaneNormal, pInterOriginalMousePress);
+			intersectFlexiPlane(pCameraWorld, m_vInterPlaneNormalOffsetHandle, m_pOffsetHandle, vInterPlaneNormal, pInterOriginalHandle);
+			MPoint pTarget = pInterMouseEnd - (pInterOriginalMousePress - pInterOriginalHandle);
 
-			// Find the normal for each of the three intersection planes
+			// Update the start position if necessary
 			double offsetParam;
 			getDoubleValue(m_offsetHandleIndex, false, offsetParam);
-			MVector vInterPlaneNormalCurrent = m_pOffsetHandle - pCameraWorld;
-			vInterPlaneNormalCurrent.normalize();
-
-			double previousCurveParam = offsetParam - m_offsetHandleDragIncrement;
-			MPoint pCurveSamplePrevious = sampleCurve(previousCurveParam);
-			MVector vInterPlaneNormalPrevious = pCurveSamplePrevious - pCameraWorld;
-			vInterPlaneNormalPrevious.normalize();
-
-			double nextCurveParam = offsetParam + m_offsetHandleDragIncrement;
-			MPoint pCurveSampleNext = sampleCurve(nextCurveParam);
-			MVector vInterPlaneNormalNext = pCurveSampleNext - pCameraWorld;
-			vInterPlaneNormalNext.normalize();
-
-			// Find the intersections of the current mouse position raycast onto each intersection plane
-			MPoint pInterMouseEndCurrent;
-			MPoint pInterMouseEndPrevious;
-			MPoint pInterMouseEndNext;
-			computeCurrentMouseIntersection(m_pOffsetHandle, vInterPlaneNormalCurrent, pInterMouseEndCurrent);
-			computeCurrentMouseIntersection(pCurveSamplePrevious, vInterPlaneNormalPrevious, pInterMouseEndPrevious);
-			computeCurrentMouseIntersection(pCurveSampleNext, vInterPlaneNormalNext, pInterMouseEndNext);
-
-			// Find the intersections of the original mouse press position raycast onto each intersection plane
-			MPoint pInterOriginalMousePressCurrent;
-			MPoint pInterOriginalMousePressPrevious;
-			MPoint pInterOriginalMousePressNext;
-			computeMouseIntersection(m_pMousePressOffsetHandle, m_vMousePressDirectionOffsetHandle, m_pOffsetHandle, vInterPlaneNormalCurrent, pInterOriginalMousePressCurrent);
-			computeMouseIntersection(m_pMousePressOffsetHandle, m_vMousePressDirectionOffsetHandle, pCurveSamplePrevious, vInterPlaneNormalPrevious, pInterOriginalMousePressPrevious);
-			computeMouseIntersection(m_pMousePressOffsetHandle, m_vMousePressDirectionOffsetHandle, pCurveSampleNext, vInterPlaneNormalNext, pInterOriginalMousePressNext);
-			// Find the intersection of the original handle position raycast onto each intersection plane
-			MPoint pInterOriginalHandleCurrent;
-			MPoint pInterOriginalHandlePrevious;
-			MPoint pInterOriginalHandleNext;
-			computeMouseIntersection(pCameraWorld, m_vInterPlaneNormalOffsetHandle, m_pOffsetHandle, vInterPlaneNormalCurrent, pInterOriginalHandleCurrent);
-			computeMouseIntersection(pCameraWorld, m_vInterPlaneNormalOffsetHandle, pCurveSamplePrevious, vInterPlaneNormalPrevious, pInterOriginalHandlePrevious);
-			computeMouseIntersection(pCameraWorld, m_vInterPlaneNormalOffsetHandle, pCurveSampleNext, vInterPlaneNormalNext, pInterOriginalHandleNext);
-			// Find the relative offset between the two intersection points on each intersection plane
-			MVector vMousePressOffsetCurrent = pInterOriginalMousePressCurrent - pInterOriginalHandleCurrent;
-			MVector vMousePressOffsetPrevious = pInterOriginalMousePressPrevious - pInterOriginalHandlePrevious;
-			MVector vMousePressOffsetNext = pInterOriginalMousePressNext - pInterOriginalHandleNext;
-
-			// Calculate an offset for each mouse intersection to the respective sample point (center of intersection plane)
-			// This offset must take into account the inital mouse press offset which has been raycast and calculated relative to each intersection plane
-			MVector vMouseOffsetCurrent = pInterMouseEndCurrent - vMousePressOffsetCurrent - m_pOffsetHandle;
-			MVector vMouseOffsetPrevious = pInterMouseEndPrevious - vMousePressOffsetPrevious - pCurveSamplePrevious;
-			MVector vMouseOffsetNext = pInterMouseEndNext - vMousePressOffsetNext - pCurveSampleNext;
-
-			// Update the start position if necessary
-			double currentOffsetLength = vMouseOffsetCurrent.length();
-			double previousOffsetLength = vMouseOffsetPrevious.length();
-			double nextOffsetLength = vMouseOffsetNext.length();
+			double closestParam = computeClosestCurveParam(pTarget, vMouseDirection);
 
-			if (previousOffsetLength < currentOffsetLength)
+			if (closestParam != offsetParam)
 			{
-				m_pOffsetHandle = pCurveSamplePrevious;
-				status = updateOffsetHandlePlug(previousCurveParam);
-
-				// The refresh rate of this function is not high enough for our increment size (which is small to ensure smooth movement), this creates a lag effect
-				// Recursively call the function until the offset between the mouse and the current sample point is smaller than both the previous and next offset
-				// The offset lengths are affected by the normal of each intersection plane which are continually changing during recursion
-				// Because of this, it is possible that the difference in length between two recursive calls is so small that the direction changes
-				// If this occurs, the result is a recursive loop, therefore we must ensure the direction only propagates in a single direction during recursion
-				if (m_offsetHandleDragDirection == 0 || m_offsetHandleDragDirection == -1)
-				{
-					m_offsetHandleDragDirection = -1;
-					doDrag(view);
-				}
+				m_pOffsetHandle = sampleCurve(closestParam);
+				status = updateOffsetHandlePlug(closestParam);
 			}
-			else if (nextOffsetLength < currentOffsetLength)
-			{
-				m_pOffsetHandle = pCurveSampleNext;
-				status = updateOffsetHandlePlug(nextCurveParam);
-
-				if (m_offsetHandleDragDirection == 0 || m_offsetHandleDragDirection == 1)
-				{
-					m_offsetHandleDragDirection = 1;
-					doDrag(view);
-				}
-			}
-
-			m_offsetHandleDragDirection = 0;
 		}
 	}
 
@@ -334,7 +279,7 @@ MStatus FlexiChainSingle_ScaleAdjustmentManip::doRelease(M3dView& view)
 	The menu allows the user to execute certain operations on the manipulator and its associated plug    */
 MStatus FlexiChainSingle_ScaleAdjustmentManip::doMove(M3dView& view, bool& refresh)
 {
-	MPoint pCameraWorld = getCameraPosition(view);
+	MPoint pCameraWorld = getFlexiCameraPosition(view);
 
 	MVector vInterPlaneNormalHandle = m_pOffsetHandle - pCameraWorld;
 	vInterPlaneNormalHandle.normalize();
@@ -347,18 +292,7 @@ MStatus FlexiChainSingle_ScaleAdjustmentManip::doMove(M3dView& view, bool& refre
 	MVector vMouseOffsetHandle = m_pOffsetHandle - pInterMouseHandle;
 
 	// If the offset is smaller than the handle's radius then the mouse is within the hover region
-	// The MUIDrawManager adds a hover buffer region around items which appears to be proportional to the items' distance from the camera
-	// The below calculation attempts to mimic this hover buffer region with fairly high accuracy (not actually sure how it works internally)
-	MPoint pCamera = getCameraPosition(view);
-	MVector vCameraToHandle = m_pOffsetHandle - pCamera;
-	// The max multiplier of 4.0 occurs at 10 meters
-	MDistance refDist{ 1000, MDistance::kCentimeters };
-	double hoverRadiusMult = vCameraToHandle.length() / refDist.asUnits(MDistance::uiUnit()) * 4.0;
-	// Clamp the multiplier to the max (ie. past 10 meters the multiplier is always 4.0)
-	hoverRadiusMult = std::min(hoverRadiusMult, 4.0);
-	// Remap the multiplier so the low is always 1.0
-	// Remap = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-	hoverRadiusMult = 1.0 + hoverRadiusMult * 3.0 / 4.0;
+	double hoverRadiusMult = computeFlexiHoverRadiusMultiplier(pCameraWorld, m_pOffsetHandle);
 
 	if (vMouseOffsetHandle.length() <= m_offsetHandleRadius.asUnits(MDistance::uiUnit()) * hoverRadiusMult)
 		m_isMouseHovered = true;
@@ -470,7 +404,7 @@ MPoint FlexiChainSingle_ScaleAdjustmentManip::sampleCurve(double param)
 	MPoint pPosition;
 
 	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
-	double arcLength = curveData.lengths[curveData.parameterCount - 1];
+	double arcLength = curveData.arcLengthTable.getLength();
 
 	if (param < 0.0)
 	{
@@ -491,7 +425,7 @@ MPoint FlexiChainSingle_ScaleAdjustmentManip::sampleCurve(double param)
 			currentParam = param;
 		else if (curveData.parameterization == 1)
 			// Calculate the natural parameter at the given normalized arc-length
-			currentParam = m_locator->getCurve().arcLengthToNaturalParameter(param, curveData.lengths);
+			currentParam = m_locator->getCurve().arcLengthToNaturalParameter(param, curveData.arcLengthTable);
 		else
 			// Calculate the natural parameter at the given normalized split-length
 			currentParam = m_locator->splitLengthToNaturalParameter(param);
@@ -503,85 +437,6 @@ MPoint FlexiChainSingle_ScaleAdjustmentManip::sampleCurve(double param)
 	return pPosition;
 }
 
-// Legacy implementation
-MPoint FlexiChainSingle_ScaleAdjustmentManip::getCameraPosition(M3dView& view) const
-{
-	MDagPath cameraPath;
-	view.getCamera(cameraPath);
-	cameraPath.pop();
-	MPoint pCameraWorld = MFnTransform(cameraPath).rotatePivot(MSpace::kWorld);
-	return pCameraWorld;
-}
-
-// VP2 implementation
-MPoint FlexiChainSingle_ScaleAdjustmentManip::getCameraPosition(const MHWRender::MFrameContext& frameContext) const
-{
-	MDoubleArray viewPosition = frameContext.getTuple(MHWRender::MFrameContext::kViewPosition);
-	MPoint pCameraWorld{ viewPosition[0], viewPosition[1], viewPosition[2] };
-	return pCameraWorld;
-}
-
-// Legacy implementation
-MVector FlexiChainSingle_ScaleAdjustmentManip::getCameraAimDirection(M3dView& view) const
-{
-	MDagPath cameraPath;
-	view.getCamera(cameraPath);
-	cameraPath.pop();
-	MFnCamera cameraFn{ cameraPath };
-	MVector vAimDirection = cameraFn.viewDirection(MSpace::kWorld);
-	return vAimDirection;
-}
-
-// VP2 implementation
-MVector FlexiChainSingle_ScaleAdjustmentManip::getCameraAimDirection(const MHWRender::MFrameContext& frameContext) const
-{
-	MDoubleArray aimDirection = frameContext.getTuple(MHWRender::MFrameContext::kViewDirection);
-	MPoint vAimDirection{ aimDirection[0], aimDirection[1], aimDirection[2] };
-	return vAimDirection;
-}
-
-// Legacy implementation
-MVector FlexiChainSingle_ScaleAdjustmentManip::getCameraUpDirection(M3dView& view) const
-{
-	MDagPath cameraPath;
-	view.getCamera(cameraPath);
-	cameraPath.pop();
-	MFnCamera cameraFn{ cameraPath };
-	MVector vUpDirection = cameraFn.upDirection(MSpace::kWorld);
-	return vUpDirection;
-}
-
-// VP2 implementation
-MVector FlexiChainSingle_ScaleAdjustmentManip::getCameraUpDirection(const MHWRender::MFrameContext& frameContext) const
-{
-	MDoubleArray upDirection = frameContext.getTuple(MHWRender::MFrameContext::kViewUp);
-	MPoint vUpDirection{ upDirection[0], upDirection[1], upDirection[2] };
-	return vUpDirection;
-}
-
-/*	Description
-	-----------
-	Calculates the intersection of the given mouse position and direction raycast onto the plane determined by the given plane data
-	Returns true if the raycast produces a successful intersection    */
-bool FlexiChainSingle_ScaleAdjustmentManip::computeMouseIntersection(const MPoint& pMouse, const MVector& vMouseDirection, const MPoint& pPointOnInterPlane,
-	const MVector& vInterPlaneNormal, MPoint& pIntersection)
-{
-	// Vector from the mouse to a point on the intersection plane
-	MVector vMouseToPointOnInterPlane = pPointOnInterPlane - pMouse;
-
-	// Here we are finding the ratio between two projections
-	// - The above vector projected onto the intersection plane normal
-	// - The mouse direction projected onto the intersection plane normal
-	double projectionRatio = (vMouseToPointOnInterPlane * vInterPlaneNormal) / (vMouseDirection * vInterPlaneNormal);
-
-	// Scale the mouse direction vector by the ratio then add to the mouse position to get the intersection point
-	MVector vMouseToInterPoint = vMouseDirection * projectionRatio;
-	pIntersection = pMouse + vMouseToInterPoint;
-
-	// Return true if both projections are in the same direction
-	return projectionRatio >= 0.0;
-}
-
 /*	Description
 	-----------
 	Calculates the intersection of the current mouse position raycast onto the plane determined by the given plane data
@@ -594,12 +449,16 @@ bool FlexiChainSingle_ScaleAdjustmentManip::computeCurrentMouseIntersection(cons
 	if (!mouseRay(pMouse, vMouseDirection))
 		return false;
 
-	MVector vMouseToPointOnInterPlane = pPointOnInterPlane - pMouse;
-	double projectionRatio = (vMouseToPointOnInterPlane * vInterPlaneNormal) / (vMouseDirection * vInterPlaneNormal);
-	MVector vMouseToInterPoint = vMouseDirection * projectionRatio;
-	pIntersection = pMouse + vMouseToInterPoint;
+	return intersectFlexiPlane(pMouse, vMouseDirection, pPointOnInterPlane, vInterPlaneNormal, pIntersection);
+}
 
-	return projectionRatio >= 0.0;
+/*	Description
+	-----------
+	Finds the parameter of the point along the curve which is closest to the given line, the parameter is in the space used by sampleCurve    */
+double FlexiChainSingle_ScaleAdjustmentManip::computeClosestCurveParam(const MPoint& pLineOrigin, const MVector& vLineDirection)
+{
+	auto sampler = [this](double param) -> MPoint { return sampleCurve(param); };
+	return computeFlexiClosestCurveParam(sampler, pLineOrigin, vLineDirection, m_offsetHandleSubdivisions);
 }
 
 /*	Description
@@ -752,7 +611,9 @@ void FlexiChainSingle_ScaleAdjustmentContext::toolOffCleanup()
 	}
 	m_nodePlugChangedCallbackIds.clear();
 
-	// Delete manipulators
+	// Delete manipulators, the published state is reset as no manipulator can remain active
+	for (FlexiChainSingle_ScaleAdjustmentManipContainer*& manipContainer : m_manipContainers)
+		manipContainer->m_locator->setActiveManip(-1);
 	m_manipContainers.clear();
 	deleteManipulators();
 
@@ -810,7 +671,7 @@ MString FlexiChainSingle_ScaleAdjustmentContext::getHoverManipPlug()
 
 /*	Description
 	-----------
-	This function is invoked by the associated MPxSubSceneOverride registered to FlexiChainSingle nodes
+	This function is invoked when the context command is queried with the -activeManipPlug flag
 	If a manipulator which belongs to this context is currently active, it will return the partial name of the plug to which the manipulator is associated
 	If no manipulator is active, an empty string will be returned    */
 MString FlexiChainSingle_ScaleAdjustmentContext::getActiveManipPlug()
@@ -851,7 +712,30 @@ void FlexiChainSingle_ScaleAdjustmentContext::setActiveManipPlug(MString& active
 			else
 				manipContainer->m_manip->m_isActive = false;
 		}
+
+		publishActiveManip();
+	}
+}
+
+/*	Description
+	-----------
+	Publishes the active manipulator to the manipulator state of each locator tied to this context
+	The associated MPxSubSceneOverride reads this state directly instead of querying the context, locators which do not own the active manipulator are reset    */
+void FlexiChainSingle_ScaleAdjustmentContext::publishActiveManip()
+{
+	FlexiChainSingle* activeLocator = nullptr;
+	int activeIndex = -1;
+	for (FlexiChainSingle_ScaleAdjustmentManipContainer*& manipContainer : m_manipContainers)
+	{
+		if (manipContainer->m_manip->isActive())
+		{
+			activeLocator = manipContainer->m_locator;
+			activeIndex = (int)manipContainer->m_manip->m_physicalIndex;
+		}
 	}
+
+	for (FlexiChainSingle_ScaleAdjustmentManipContainer*& manipContainer : m_manipContainers)
+		manipContainer->m_locator->setActiveManip(manipContainer->m_locator == activeLocator ? activeIndex : -1);
 }
 
 /*	Description
@@ -874,7 +758,9 @@ void FlexiChainSingle_ScaleAdjustmentContext::updateManipulatorsCallback(void* d
 	}
 	context->m_nodePlugChangedCallbackIds.clear();
 
-	// Delete manipulators
+	// Delete manipulators, the published state is reset as the new manipulators are created inactive
+	for (FlexiChainSingle_ScaleAdjustmentManipContainer*& manipContainer : context->m_manipContainers)
+		manipContainer->m_locator->setActiveManip(-1);
 	context->m_manipContainers.clear();
 	context->deleteManipulators();
 
@@ -20,9 +20,6 @@ FlexiChainSingle_SubSceneOverride::FlexiChainSingle_SubSceneOverride(const MObje
 	MHWRender::MPxSubSceneOverride{ obj },
 	m_locatorObj{ obj },
 	m_displayStatus{ MHWRender::DisplayStatus::kNoStatus },
-	m_surfaceVertexCount{ -1 },
-	m_curveVertexCount{ -1 },
-	m_normalsVertexCount{ -1 },
 	m_surfaceRenderItem{ nullptr },
 	m_borderActiveRenderItem{ nullptr },
 	m_borderDormantRenderItem{ nullptr },
@@ -41,19 +38,16 @@ FlexiChainSingle_SubSceneOverride::FlexiChainSingle_SubSceneOverride(const MObje
 	m_samplerState{ nullptr },
 	m_rampTexture{ nullptr },
 	m_diffuseTexture{ nullptr },
-	m_surfacePositionBuffer{ nullptr },
-	m_surfaceNormalBuffer{ nullptr },
-	m_surfaceTextureBuffer{ nullptr },
-	m_curvePositionBuffer{ nullptr },
-	m_normalsPositionBuffer{ nullptr },
-	m_hullPositionBuffer{ nullptr },
-	m_boundingBoxPositionBuffer{ nullptr },
-	m_surfaceIndexBuffer{ nullptr },
-	m_borderIndexBuffer{ nullptr },
-	m_curveIndexBuffer{ nullptr },
-	m_normalsIndexBuffer{ nullptr },
-	m_hullIndexBuffer{ nullptr },
-	m_boundingBoxIndexBuffer{ nullptr }
+	m_surfacePositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_surfaceNormalBuffer{ MHWRender::MGeometry::kNormal, 3 },
+	m_surfaceTextureBuffer{ MHWRender::MGeometry::kTexture, 2 },
+	m_curvePositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_normalsPositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_hullPositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_boundingBoxPositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_drawSpaceTransformation{ 0 },
+	m_drawDirtyCount{ 0 },
+	m_manipStateVersion{ 0 }
 {
 	MStatus status;
 	MFnDependencyNode fnNode{ obj, &status };
@@ -84,8 +78,6 @@ FlexiChainSingle_SubSceneOverride::~FlexiChainSingle_SubSceneOverride()
 	m_hullRenderItem = nullptr;
 	m_boundingBoxRenderItem = nullptr;
 
-	deleteGeometryBuffers();
-
 	MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
 	if (!renderer)
 	{
@@ -157,10 +149,40 @@ MHWRender::DrawAPI FlexiChainSingle_SubSceneOverride::supportedDrawAPIs() const
 /*	Description
 	-----------
 	If this function returns false then update() will not be called for the draw-preparation phase
-	This would only be the case if the vertex buffers and render items did not need to be updated    */
+	Draw cycles occur far more frequently than evaluation (eg. when tumbling the viewport), so an update is only requested if one of the following has changed:
+	- The draw state of the locator has been dirtied since the last update (tracked by its draw dirty count)
+	- The active manipulator published by a tool context has changed (tracked by the version of the locator's manipulator state)
+	- A state which does not propagate dirtiness to the locator (eg. selection, visibility, parent transforms, the active tool context)    */
 bool FlexiChainSingle_SubSceneOverride::requiresUpdate(const MSubSceneContainer& container, const MFrameContext& frameContext) const
 {
-	return true;
+	// Render items and their shading resources are created by the first successful update
+	if (!m_boundingBoxRenderItem || !m_hullShader || !m_rampTexture || !m_diffuseTexture || !m_samplerState)
+		return true;
+
+	if (m_locator->getDrawDirtyCount() != m_drawDirtyCount)
+		return true;
+
+	// Ramp textures reflect the active manipulator which is not part of the DG, the tool contexts publish it through the manipulator state of the locator
+	if (m_locator->getManipState().getVersion() != m_manipStateVersion)
+		return true;
+
+	MDagPath path;
+	MDagPath::getAPathTo(m_locatorObj, path);
+	if (!path.isValid())
+		return false;
+
+	if (path.isVisible() != m_isVisible ||
+		MHWRender::MGeometryUtilities::displayStatus(path) != m_displayStatus ||
+		MHWRender::MGeometryUtilities::wireframeColor(path) != m_wireframeColor ||
+		(bool)m_overrideLevelOfDetailPlug.asShort() != m_boundingBoxEnabled ||
+		m_castsShadowsPlug.asBool() != m_castsShadows ||
+		m_receiveShadowsPlug.asBool() != m_receiveShadows)
+		return true;
+
+	if (m_drawSpaceTransformation == 1 && !m_drawTransform.isEquivalent(path.inclusiveMatrix()))
+		return true;
+
+	return MFnToolContext(MGlobal::currentToolContext()).name() != m_toolContextName;
 }
 
 /*	Description
@@ -178,6 +200,10 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 		return;
 	}
 
+	// The draw state is considered clean from this point, any dirtiness arising during the update will request another update
+	m_drawDirtyCount = m_locator->getDrawDirtyCount();
+	m_manipStateVersion = m_locator->getManipState().getVersion();
+
 	// Check if any locator input is dirty and evaluate if needed
 	// Otherwise check if drawing has already occurred since the last evaluation and if so signal to exit early
 	bool updateBuffers = true;
@@ -372,6 +398,9 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 		image.setPixels(m_diffusePixel, 1, 1);
 		m_diffuseTexture->update(image, false);
 
+		// The ramp texture holds no valid data until it is first generated
+		m_rampKey = FlexiRampKey();
+
 		itemsChanged = true;
 	}
 
@@ -394,6 +423,7 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 	bool castsShadows = m_castsShadowsPlug.asBool();
 	bool receiveShadows = m_receiveShadowsPlug.asBool();
 	MString context = MFnToolContext(MGlobal::currentToolContext()).name();
+	m_toolContextName = context;
 	bool upVectorContextEnabled = context == "FlexiChainSingleUpVectorContext1" ? true : false;
 	bool scaleAdjustmentContextEnabled = context == "FlexiChainSingleScaleAdjustmentContext1" && scaleAdjustmentsEnabled ? true : false;
 	bool twistAdjustmentContextEnabled = context == "FlexiChainSingleTwistAdjustmentContext1" && twistAdjustmentsEnabled ? true : false;
@@ -459,11 +489,11 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 		m_boundingBoxRenderItem->enable(boundingBoxItemEnabled);
 
 		// Update line shaders
-		updateLineShader(m_wireframeShader, "lineWidth", 1.1f, "solidColor", m_wireframeColor);
-		updateLineShader(m_borderDormantShader, "lineWidth", 1.1f, "solidColor", m_borderDormantColor);
-		updateLineShader(m_curveDormantShader, "lineWidth", 1.1f, "solidColor", m_curveDormantColor);
-		updateLineShader(m_normalsDormantShader, "lineWidth", 1.8f, "solidColor", m_normalsDormantColor);
-		updateLineShader(m_hullShader, "lineWidth", 0.6f, "solidColor", m_curveDormantColor);
+		updateFlexiLineShader(m_wireframeShader, "lineWidth", 1.1f, "solidColor", m_wireframeColor);
+		updateFlexiLineShader(m_borderDormantShader, "lineWidth", 1.1f, "solidColor", m_borderDormantColor);
+		updateFlexiLineShader(m_curveDormantShader, "lineWidth", 1.1f, "solidColor", m_curveDormantColor);
+		updateFlexiLineShader(m_normalsDormantShader, "lineWidth", 1.8f, "solidColor", m_normalsDormantColor);
+		updateFlexiLineShader(m_hullShader, "lineWidth", 0.6f, "solidColor", m_curveDormantColor);
 
 		// Update surface shader
 		MHWRender::MTextureAssignment textureAssignment;
@@ -479,6 +509,7 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 	// This can be tested by calling MRenderItem::sourceDagPath()
 	MMatrix drawTransform;
 	short drawSpaceTransformation = dataBlock.inputValue(FlexiChainSingle::drawSpaceTransformationAttr).asShort();
+	m_drawSpaceTransformation = drawSpaceTransformation;
 
 	if (drawSpaceTransformation == 1)
 		drawTransform = path.inclusiveMatrix();
@@ -504,18 +535,10 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 	// Unless an item has changed, as items to not update whilst disabled therefore their buffers may be stale when reenabled
 	if (!updateBuffers && !itemsChanged)
 	{
-		// Selecting manipulators within the up-vector context does not cause any dirty propagation in the DG however it should affect how the ramp texture is drawn
-		// Therefore, if the up-vector context is active we must force the texture to update before returning (this must be done on all draw cycles)
-		// Performance is not a major concern whilst the context is active (ie. heavy animation work is not done inside the context)
+		// Selecting manipulators within a context does not cause any dirty propagation in the DG however it should affect how the ramp texture is drawn
+		// The ramp is keyed on the manipulator state published by the context so it will only be regenerated if the active manipulator has changed
 		if (m_isVisible && !m_boundingBoxEnabled && m_ribbonDrawEnabled && m_computeOrientation)
-		{
-			if (m_upVectorContextEnabled)
-				updateRampTextureUpVectorContext();
-			else if (m_scaleAdjustmentContextEnabled)
-				updateRampTextureScaleAdjustmentContext();
-			else if (m_twistAdjustmentContextEnabled)
-				updateRampTextureTwistAdjustmentContext();
-		}
+			updateRampTexture();
 
 		return;
 	}
@@ -530,8 +553,8 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 			updateBoundingBoxGeometryBuffers(bounds);
 
 			MHWRender::MVertexBufferArray boundingBoxVertexBuffers;
-			boundingBoxVertexBuffers.addBuffer("positions", m_boundingBoxPositionBuffer);
-			setGeometryForRenderItem(*m_boundingBoxRenderItem, boundingBoxVertexBuffers, *m_boundingBoxIndexBuffer, &bounds);
+			boundingBoxVertexBuffers.addBuffer("positions", m_boundingBoxPositionBuffer.buffer());
+			setGeometryForRenderItem(*m_boundingBoxRenderItem, boundingBoxVertexBuffers, *m_boundingBoxIndexBuffer.buffer(), &bounds);
 		}
 		else
 		{
@@ -539,23 +562,18 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 			if (m_ribbonDrawEnabled && m_computeOrientation)
 			{
 				updateRibbonGeometryBuffers();
-				if (m_upVectorContextEnabled)
-					updateRampTextureUpVectorContext();
-				else if (m_scaleAdjustmentContextEnabled)
-					updateRampTextureScaleAdjustmentContext();
-				else if (m_twistAdjustmentContextEnabled)
-					updateRampTextureTwistAdjustmentContext();
+				updateRampTexture();
 
 				MHWRender::MVertexBufferArray surfaceVertexBuffers;
-				surfaceVertexBuffers.addBuffer("positions", m_surfacePositionBuffer);
-				surfaceVertexBuffers.addBuffer("normals", m_surfaceNormalBuffer);
-				surfaceVertexBuffers.addBuffer("uvs", m_surfaceTextureBuffer);
-				setGeometryForRenderItem(*m_surfaceRenderItem, surfaceVertexBuffers, *m_surfaceIndexBuffer, &bounds);
+				surfaceVertexBuffers.addBuffer("positions", m_surfacePositionBuffer.buffer());
+				surfaceVertexBuffers.addBuffer("normals", m_surfaceNormalBuffer.buffer());
+				surfaceVertexBuffers.addBuffer("uvs", m_surfaceTextureBuffer.buffer());
+				setGeometryForRenderItem(*m_surfaceRenderItem, surfaceVertexBuffers, *m_surfaceIndexBuffer.buffer(), &bounds);
 
 				MHWRender::MVertexBufferArray borderVertexBuffers;
-				borderVertexBuffers.addBuffer("positions", m_surfacePositionBuffer);
-				setGeometryForRenderItem(*m_borderActiveRenderItem, borderVertexBuffers, *m_borderIndexBuffer, &bounds);
-				setGeometryForRenderItem(*m_borderDormantRenderItem, borderVertexBuffers, *m_borderIndexBuffer, &bounds);
+				borderVertexBuffers.addBuffer("positions", m_surfacePositionBuffer.buffer());
+				setGeometryForRenderItem(*m_borderActiveRenderItem, borderVertexBuffers, *m_borderIndexBuffer.buffer(), &bounds);
+				setGeometryForRenderItem(*m_borderDormantRenderItem, borderVertexBuffers, *m_borderIndexBuffer.buffer(), &bounds);
 			}
 
 			// Curve buffers
@@ -564,9 +582,9 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 				updateCurveGeometryBuffers();
 
 				MHWRender::MVertexBufferArray curveVertexBuffers;
-				curveVertexBuffers.addBuffer("positions", m_curvePositionBuffer);
-				setGeometryForRenderItem(*m_curveActiveRenderItem, curveVertexBuffers, *m_curveIndexBuffer, &bounds);
-				setGeometryForRenderItem(*m_curveDormantRenderItem, curveVertexBuffers, *m_curveIndexBuffer, &bounds);
+				curveVertexBuffers.addBuffer("positions", m_curvePositionBuffer.buffer());
+				setGeometryForRenderItem(*m_curveActiveRenderItem, curveVertexBuffers, *m_curveIndexBuffer.buffer(), &bounds);
+				setGeometryForRenderItem(*m_curveDormantRenderItem, curveVertexBuffers, *m_curveIndexBuffer.buffer(), &bounds);
 			}
 
 			// Normals buffers
@@ -575,9 +593,9 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 				updateNormalsGeometryBuffers();
 
 				MHWRender::MVertexBufferArray normalsVertexBuffers;
-				normalsVertexBuffers.addBuffer("positions", m_normalsPositionBuffer);
-				setGeometryForRenderItem(*m_normalsActiveRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer, &bounds);
-				setGeometryForRenderItem(*m_normalsDormantRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer, &bounds);
+				normalsVertexBuffers.addBuffer("positions", m_normalsPositionBuffer.buffer());
+				setGeometryForRenderItem(*m_normalsActiveRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer.buffer(), &bounds);
+				setGeometryForRenderItem(*m_normalsDormantRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer.buffer(), &bounds);
 			}
 
 			// Hull buffers
@@ -586,8 +604,8 @@ void FlexiChainSingle_SubSceneOverride::update(MSubSceneContainer& container, co
 				updateHullGeometryBuffers();
 
 				MHWRender::MVertexBufferArray hullVertexBuffers;
-				hullVertexBuffers.addBuffer("positions", m_hullPositionBuffer);
-				setGeometryForRenderItem(*m_hullRenderItem, hullVertexBuffers, *m_hullIndexBuffer, &bounds);
+				hullVertexBuffers.addBuffer("positions", m_hullPositionBuffer.buffer());
+				setGeometryForRenderItem(*m_hullRenderItem, hullVertexBuffers, *m_hullIndexBuffer.buffer(), &bounds);
 			}
 		}
 	}
@@ -636,18 +654,37 @@ void FlexiChainSingle_SubSceneOverride::createShaderInstance(const MShaderManage
 	Usually called in case of an error during the texture update process or when no texturing is required    */
 void FlexiChainSingle_SubSceneOverride::setDefaultRamp()
 {
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		m_texturedPixels[pointerOffset++] = 128;
-		m_texturedPixels[pointerOffset++] = 128;
-		m_texturedPixels[pointerOffset++] = 128;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
+	writeFlexiDefaultRamp(m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
+}
 
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+/*	Description
+	-----------
+	Regenerates the ramp texture for the active context, the texture is keyed on the following inputs:
+	- The active context, each context is identified by its order in the below expression
+	- The version of the manipulator state which the active context publishes to the locator
+	- The draw dirty count of the locator, as the ramp data is derived from the evaluated adjustments and curve stability
+	If none of these inputs have changed since the last upload, the existing texture is reused    */
+void FlexiChainSingle_SubSceneOverride::updateRampTexture()
+{
+	short context = m_upVectorContextEnabled ? 0 : m_scaleAdjustmentContextEnabled ? 1 : m_twistAdjustmentContextEnabled ? 2 : -1;
+	if (context == -1)
+		return;
+
+	const FlexiManipState& manipState = m_locator->getManipState();
+	FlexiRampKey rampKey{ context, manipState.getVersion(), m_drawDirtyCount };
+	if (rampKey == m_rampKey)
+		return;
+	m_rampKey = rampKey;
+
+	// The version must be read before the index, see FlexiManipState
+	int activeIndex = manipState.getActiveIndex();
+	if (m_upVectorContextEnabled)
+		updateRampTextureUpVectorContext(activeIndex);
+	else if (m_scaleAdjustmentContextEnabled)
+		updateRampTextureScaleAdjustmentContext(activeIndex);
+	else if (m_twistAdjustmentContextEnabled)
+		updateRampTextureTwistAdjustmentContext(activeIndex);
 }
 
 /*	Description
@@ -658,837 +695,331 @@ void FlexiChainSingle_SubSceneOverride::setDefaultRamp()
 	The ramp will only be displayed if one of the two manipulators belonging to the locator are active
 	- If the start manipulator is active, the ramp will represent the stability of the curves principal normal in relation to its respective up-vector
 	- If the end manipulator is active, the ramp will represent the stability of the curves counter-twist data in relation to its respective up-vector    */
-void FlexiChainSingle_SubSceneOverride::updateRampTextureUpVectorContext()
+void FlexiChainSingle_SubSceneOverride::updateRampTextureUpVectorContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiChainSingleUpVectorContext -q -activeManipPlug FlexiChainSingleUpVectorContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
+	if (activeIndex == -1)
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	// Constants
-	double lowThreshold = 0.8;
-	double maxIntensity = 0.9;
-	double influenceRatio = 0.25;
-	unsigned int influencedPixelCount = (int)(m_texturedPixelCount * influenceRatio);
-
-	// Calculate pixel data
-	if (activeManipPlug == FlexiChainSingle::normalUpVectorOverrideCompoundAttr)
-	{
-		double stability;
+	// The start manipulator (position index 0) overrides the up-vector of the principal normal
+	// The end manipulator overrides the up-vector of the counter-twist data
+	double stability;
+	if (activeIndex == 0)
 		m_locator->computeNormalStability(stability);
-		stability = std::abs(stability);
-		unsigned int pointerOffset = 0;
-		
-		if (stability > lowThreshold)
-		{
-			// Remap = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-			double weightedStability = (stability - 0.8) / 0.2;
-
-			for (unsigned int pixelIndex = 0; pixelIndex < influencedPixelCount; ++pixelIndex)
-			{
-				// Initial pixels receive highest weight
-				double pixelWeight = (double)(influencedPixelCount - 1 - pixelIndex) / (influencedPixelCount - 1) * weightedStability;
-				pixelWeight = pixelWeight * pixelWeight * (3 - 2 * pixelWeight);
-
-				char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-				// Max intensity simply reduces the intensity of the red color
-				char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-				m_texturedPixels[pointerOffset++] = rChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-
-			for (unsigned int pixelIndex = influencedPixelCount; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-		else
-		{
-			for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-	}
 	else
-	{
-		double stability;
 		m_locator->computeCounterTwistStability(stability);
-		stability = std::abs(stability);
-		unsigned int pointerOffset = 0;
-
-		if (stability > lowThreshold)
-		{
-			double weightedStability = (stability - 0.8) / 0.2;
-
-			for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount - influencedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-
-			for (unsigned int pixelIndex = m_texturedPixelCount - influencedPixelCount; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				// End pixels receive highest weight
-				double pixelWeight = (double)(pixelIndex - m_texturedPixelCount + influencedPixelCount) / (influencedPixelCount - 1) * weightedStability;
-				pixelWeight = pixelWeight * pixelWeight * (3 - 2 * pixelWeight);
-
-				char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-				char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-				m_texturedPixels[pointerOffset++] = rChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-		else
-		{
-			for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-	}
 
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+	writeFlexiStabilityRamp(stability, activeIndex != 0, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
-void FlexiChainSingle_SubSceneOverride::updateRampTextureScaleAdjustmentContext()
+void FlexiChainSingle_SubSceneOverride::updateRampTextureScaleAdjustmentContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiChainSingleScaleAdjustmentContext -q -activeManipPlug FlexiChainSingleScaleAdjustmentContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
+	// Retrieve the correct falloff ramp, the active index is the physical index of the adjustment
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
-	{
-		setDefaultRamp();
-		return;
-	}
-
-	// Retrieve the correct falloff ramp
-	MIntArray logicalIndices;
-	activeManipPlug.array().getExistingArrayAttributeIndices(logicalIndices);
-	unsigned int logicalIndex = activeManipPlug.logicalIndex();
-
-	int physicalIndex = -1;
-	for (unsigned int i = 0; i < logicalIndices.length(); ++i)
-	{
-		if (logicalIndices[i] == logicalIndex)
-			physicalIndex = i;
-	}
-	if (physicalIndex == -1)
+	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
+	if (activeIndex == -1 || (unsigned int)activeIndex >= curveData.scaleAdjustments.size())
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
-	assert(physicalIndex < curveData.scaleAdjustments.size());
-	ScaleAdjustment scaleAdjustmentRamp = curveData.scaleAdjustments[physicalIndex];
-
-	// Constants
-	double maxIntensity = 0.9;
-
-	// Calculate pixel data
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		double falloffParam = (double)pixelIndex / (m_texturedPixelCount - 1);
-		double pixelWeight = scaleAdjustmentRamp.curve.getValue(falloffParam);
-
-		char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-		// Max intensity simply reduces the intensity of the red color
-		char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-		m_texturedPixels[pointerOffset++] = rChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
+	const ScaleAdjustment& scaleAdjustmentRamp = curveData.scaleAdjustments[activeIndex];
 
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+	writeFlexiFalloffRamp(scaleAdjustmentRamp.curve, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
-void FlexiChainSingle_SubSceneOverride::updateRampTextureTwistAdjustmentContext()
+void FlexiChainSingle_SubSceneOverride::updateRampTextureTwistAdjustmentContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiChainSingleTwistAdjustmentContext -q -activeManipPlug FlexiChainSingleTwistAdjustmentContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
+	// Retrieve the correct falloff ramp, the active index is the physical index of the adjustment
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
-	{
-		setDefaultRamp();
-		return;
-	}
-
-	// Retrieve the correct falloff ramp
-	MIntArray logicalIndices;
-	activeManipPlug.array().getExistingArrayAttributeIndices(logicalIndices);
-	unsigned int logicalIndex = activeManipPlug.logicalIndex();
-	int physicalIndex = -1;
-	for (unsigned int i = 0; i < logicalIndices.length(); ++i)
-	{
-		if (logicalIndices[i] == logicalIndex)
-			physicalIndex = i;
-	}
-	if (physicalIndex == -1)
+	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
+	if (activeIndex == -1 || (unsigned int)activeIndex >= curveData.twistAdjustments.size())
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
-	assert(physicalIndex < curveData.twistAdjustments.size());
-	TwistAdjustment twistAdjustmentRamp = curveData.twistAdjustments[physicalIndex];
-
-	// Constants
-	double maxIntensity = 0.9;
-
-	// Calculate pixel data
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		double falloffParam = (double)pixelIndex / (m_texturedPixelCount - 1);
-		double pixelWeight = twistAdjustmentRamp.curve.getValue(falloffParam);
-
-		char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-		// Max intensity simply reduces the intensity of the red color
-		char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-		m_texturedPixels[pointerOffset++] = rChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
-
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
-}
-
-void FlexiChainSingle_SubSceneOverride::updateSurfaceShader(MShaderInstance* shader, const char* colorParameter, MColor color)
-{
-	shader->setParameter(colorParameter, &color.r);
-}
+	const TwistAdjustment& twistAdjustmentRamp = curveData.twistAdjustments[activeIndex];
 
-void FlexiChainSingle_SubSceneOverride::updateLineShader(MShaderInstance* shader, const char* lineWidthParameter, float lineWidth, const char* colorParameter, MColor color)
-{
-	shader->setParameter(colorParameter, &color.r);
-	// Not sure what first number does
-	float lineWidthArray[2] = { lineWidth, lineWidth };
-	shader->setParameter(lineWidthParameter, lineWidthArray);
+	writeFlexiFalloffRamp(twistAdjustmentRamp.curve, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
 // Ribbon buffers
 void FlexiChainSingle_SubSceneOverride::updateRibbonGeometryBuffers()
 {
-	deleteRibbonVertexBuffers();
-
 	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
 	unsigned int curveVertexCount = curveData.sampleCount;
 	unsigned int surfaceVertexCount = curveVertexCount * 2;
 	unsigned int surfaceIndicesCount = (curveVertexCount - 1) * 6;
 	unsigned int borderIndicesCount = curveVertexCount * 4;
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor surfacePositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	const MVertexBufferDescriptor surfaceNormalDesc("", MGeometry::kNormal, MGeometry::kFloat, 3);
-	const MVertexBufferDescriptor surfaceTextureDesc("", MGeometry::kTexture, MGeometry::kFloat, 2);
-	m_surfacePositionBuffer = new MVertexBuffer(surfacePositionDesc);
-	m_surfaceNormalBuffer = new MVertexBuffer(surfaceNormalDesc);
-	m_surfaceTextureBuffer = new MVertexBuffer(surfaceTextureDesc);
-
 	// VB for surface positions
-	if (m_surfacePositionBuffer)
+	// Return a block of memory to fill with our position data (the buffer is only reallocated if the vertex count has grown)
+	float* surfacePositions = m_surfacePositionBuffer.acquire(surfaceVertexCount);
+	if (surfacePositions)
 	{
-		// Return a block of memory to fill with our position data (bytes = size * desc.dataTypeSize() * desc.dimension())
-		float* surfacePositions = (float*)m_surfacePositionBuffer->acquire(surfaceVertexCount, true /*writeOnly*/);
-		if (surfacePositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveVertexCount; i++)
-			{
-				MFloatVector vert = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale;
-				MFloatVector vertOpposite = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale * -1;
-
-				surfacePositions[pointerOffset++] = vert[0];
-				surfacePositions[pointerOffset++] = vert[1];
-				surfacePositions[pointerOffset++] = vert[2];
-				surfacePositions[pointerOffset++] = vertOpposite[0];
-				surfacePositions[pointerOffset++] = vertOpposite[1];
-				surfacePositions[pointerOffset++] = vertOpposite[2];
-			}
+		pointerOffset += streamFlexiOffsetPairs(curveData.points.lanes(), curveData.binormals.lanes(), m_ribbonWidthScale, curveVertexCount, surfacePositions + pointerOffset);
 
-			// Transfer from CPU to GPU memory
-			m_surfacePositionBuffer->commit(surfacePositions);
-		}
+		// Transfer from CPU to GPU memory
+		m_surfacePositionBuffer.commit(surfacePositions);
 	}
 
 	// VB for surface normals
-	if (m_surfaceNormalBuffer)
+	float* surfaceNormals = m_surfaceNormalBuffer.acquire(surfaceVertexCount);
+	if (surfaceNormals)
 	{
-		float* surfaceNormals = (float*)m_surfaceNormalBuffer->acquire(surfaceVertexCount, true /*writeOnly*/);
-		if (surfaceNormals)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveVertexCount; i++)
-			{
-				surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-				surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-				surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-				surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-				surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-				surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-			}
+		pointerOffset += streamFlexiVectorPairs(curveData.normals.lanes(), curveVertexCount, surfaceNormals + pointerOffset);
 
-			m_surfaceNormalBuffer->commit(surfaceNormals);
-		}
+		m_surfaceNormalBuffer.commit(surfaceNormals);
 	}
 
 	// VB for surface textures
-	if (m_surfaceTextureBuffer)
+	float* surfaceTextures = m_surfaceTextureBuffer.acquire(surfaceVertexCount);
+	if (surfaceTextures)
 	{
-		float* surfaceTextures = (float*)m_surfaceTextureBuffer->acquire(surfaceVertexCount, true /*writeOnly*/);
-		if (surfaceTextures)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveVertexCount; i++)
-			{
-				float xCoord = (float)i / (curveVertexCount - 1);
-				surfaceTextures[pointerOffset++] = xCoord;
-				surfaceTextures[pointerOffset++] = 1.0f;
-				surfaceTextures[pointerOffset++] = xCoord;
-				surfaceTextures[pointerOffset++] = 0.0f;
-			}
-			
-			// The texture will fill a 1*1 UV patch
-			// Ensure our UVs do not reach all the way to the edge of this patch as this was causing a bleeding effect on the first and last pixels
-			surfaceTextures[0] = 0.001f;
-			surfaceTextures[2] = 0.001f;
-			surfaceTextures[pointerOffset - 4] = 0.999f;
-			surfaceTextures[pointerOffset - 2] = 0.999f;
-
-			m_surfaceTextureBuffer->commit(surfaceTextures);
+		for (unsigned int i = 0; i < curveVertexCount; i++)
+		{
+			float xCoord = (float)i / (curveVertexCount - 1);
+			surfaceTextures[pointerOffset++] = xCoord;
+			surfaceTextures[pointerOffset++] = 1.0f;
+			surfaceTextures[pointerOffset++] = xCoord;
+			surfaceTextures[pointerOffset++] = 0.0f;
 		}
+		
+		// The texture will fill a 1*1 UV patch
+		// Ensure our UVs do not reach all the way to the edge of this patch as this was causing a bleeding effect on the first and last pixels
+		surfaceTextures[0] = 0.001f;
+		surfaceTextures[2] = 0.001f;
+		surfaceTextures[pointerOffset - 4] = 0.999f;
+		surfaceTextures[pointerOffset - 2] = 0.999f;
+
+		m_surfaceTextureBuffer.commit(surfaceTextures);
 	}
 
-	// Index buffers only need to be updated if the sampleCount attribute changes
-	if (surfaceVertexCount == m_surfaceVertexCount)
+	// Index buffers only need to be regenerated if the topology changes
+	const FlexiTopology topology{ surfaceVertexCount };
+	if (m_surfaceIndexBuffer.isValid(topology) && m_borderIndexBuffer.isValid(topology))
 		return;
 
-	m_surfaceVertexCount = surfaceVertexCount;
-
-	deleteRibbonIndexBuffers();
-	m_surfaceIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-	m_borderIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for surface item
-	if (m_surfaceIndexBuffer)
+	unsigned int* surfaceIndices = m_surfaceIndexBuffer.acquire(surfaceIndicesCount);
+	if (surfaceIndices)
 	{
-		unsigned int* surfaceIndices = (unsigned int*)m_surfaceIndexBuffer->acquire(surfaceIndicesCount, true /*writeOnly*/);
-		if (surfaceIndices)
-		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < curveVertexCount - 1; i++)
-			{
-				// First triangle
-				surfaceIndices[pointerOffset++] = i * 2;
-				surfaceIndices[pointerOffset++] = i * 2 + 1;
-				surfaceIndices[pointerOffset++] = i * 2 + 2;
-
-				// Second triangle
-				surfaceIndices[pointerOffset++] = i * 2 + 3;
-				surfaceIndices[pointerOffset++] = i * 2 + 2;
-				surfaceIndices[pointerOffset++] = i * 2 + 1;
-			}
-
-			m_surfaceIndexBuffer->commit(surfaceIndices);
-		}
-	}
+		int pointerOffset = 0;
 
-	// IB for border item
-	if (m_borderIndexBuffer)
-	{
-		unsigned int* borderIndices = (unsigned int*)m_borderIndexBuffer->acquire(borderIndicesCount, true /*writeOnly*/);
-		if (borderIndices)
+		for (unsigned int i = 0; i < curveVertexCount - 1; i++)
 		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < curveVertexCount - 1; i++)
-			{
-				// Top
-				borderIndices[pointerOffset++] = i * 2;
-				borderIndices[pointerOffset++] = i * 2 + 2;
-				// Bottom
-				borderIndices[pointerOffset++] = i * 2 + 1;
-				borderIndices[pointerOffset++] = i * 2 + 3;
-			}
-			// Left
-			borderIndices[pointerOffset++] = 0;
-			borderIndices[pointerOffset++] = 1;
-			// Right
-			borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2;
-			borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2 + 1;
-
-			m_borderIndexBuffer->commit(borderIndices);
+			// First triangle
+			surfaceIndices[pointerOffset++] = i * 2;
+			surfaceIndices[pointerOffset++] = i * 2 + 1;
+			surfaceIndices[pointerOffset++] = i * 2 + 2;
+
+			// Second triangle
+			surfaceIndices[pointerOffset++] = i * 2 + 3;
+			surfaceIndices[pointerOffset++] = i * 2 + 2;
+			surfaceIndices[pointerOffset++] = i * 2 + 1;
 		}
-	}
-}
 
-void FlexiChainSingle_SubSceneOverride::deleteRibbonVertexBuffers()
-{
-	if (m_surfacePositionBuffer)
-	{
-		delete m_surfacePositionBuffer;
-		m_surfacePositionBuffer = nullptr;
-	}
-
-	if (m_surfaceNormalBuffer)
-	{
-		delete m_surfaceNormalBuffer;
-		m_surfaceNormalBuffer = nullptr;
+		m_surfaceIndexBuffer.commit(surfaceIndices, topology);
 	}
 
-	if (m_surfaceTextureBuffer)
-	{
-		delete m_surfaceTextureBuffer;
-		m_surfaceTextureBuffer = nullptr;
-	}
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteRibbonIndexBuffers()
-{
-	if (m_surfaceIndexBuffer)
+	// IB for border item
+	unsigned int* borderIndices = m_borderIndexBuffer.acquire(borderIndicesCount);
+	if (borderIndices)
 	{
-		delete m_surfaceIndexBuffer;
-		m_surfaceIndexBuffer = nullptr;
-	}
+		int pointerOffset = 0;
 
-	if (m_borderIndexBuffer)
-	{
-		delete m_borderIndexBuffer;
-		m_borderIndexBuffer = nullptr;
+		for (unsigned int i = 0; i < curveVertexCount - 1; i++)
+		{
+			// Top
+			borderIndices[pointerOffset++] = i * 2;
+			borderIndices[pointerOffset++] = i * 2 + 2;
+			// Bottom
+			borderIndices[pointerOffset++] = i * 2 + 1;
+			borderIndices[pointerOffset++] = i * 2 + 3;
+		}
+		// Left
+		borderIndices[pointerOffset++] = 0;
+		borderIndices[pointerOffset++] = 1;
+		// Right
+		borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2;
+		borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2 + 1;
+
+		m_borderIndexBuffer.commit(borderIndices, topology);
 	}
 }
 
-void FlexiChainSingle_SubSceneOverride::deleteRibbonGeometryBuffers()
-{
-	deleteRibbonVertexBuffers();
-	deleteRibbonIndexBuffers();
-}
-
 // Curve buffers
 void FlexiChainSingle_SubSceneOverride::updateCurveGeometryBuffers()
 {
-	deleteCurveVertexBuffers();
-
 	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
 	unsigned int curveVertexCount = curveData.sampleCount;
 	unsigned int curveIndicesCount = (curveVertexCount % 2) ? curveVertexCount - 1 : curveVertexCount;
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor curvePositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_curvePositionBuffer = new MVertexBuffer(curvePositionDesc);
-
 	// VB for curve positions
-	if (m_curvePositionBuffer)
+	float* curvePositions = m_curvePositionBuffer.acquire(curveVertexCount);
+	if (curvePositions)
 	{
-		float* curvePositions = (float*)m_curvePositionBuffer->acquire(curveVertexCount, true /*writeOnly*/);
-		if (curvePositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveVertexCount; i++)
-			{
-				curvePositions[pointerOffset++] = (float)curveData.points[i][0];
-				curvePositions[pointerOffset++] = (float)curveData.points[i][1];
-				curvePositions[pointerOffset++] = (float)curveData.points[i][2];
-			}
+		pointerOffset += streamFlexiVectors(curveData.points.lanes(), curveVertexCount, curvePositions + pointerOffset);
 
-			m_curvePositionBuffer->commit(curvePositions);
-		}
+		m_curvePositionBuffer.commit(curvePositions);
 	}
 
-	// Index buffers only need to be updated if the sampleCount attribute changes
-	if (curveVertexCount == m_curveVertexCount)
+	// Index buffers only need to be regenerated if the topology changes
+	const FlexiTopology topology{ curveVertexCount };
+	if (m_curveIndexBuffer.isValid(topology))
 		return;
 
-	m_curveVertexCount = curveVertexCount;
-
-	deleteCurveIndexBuffers();
-	m_curveIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for curve item
-	if (m_curveIndexBuffer)
+	unsigned int* curveIndices = m_curveIndexBuffer.acquire(curveIndicesCount);
+	if (curveIndices)
 	{
-		unsigned int* curveIndices = (unsigned int*)m_curveIndexBuffer->acquire(curveIndicesCount, true /*writeOnly*/);
-		if (curveIndices)
-		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < curveIndicesCount; i++)
-				curveIndices[pointerOffset++] = i;
-
-			m_curveIndexBuffer->commit(curveIndices);
-		}
-	}
-}
+		int pointerOffset = 0;
 
-void FlexiChainSingle_SubSceneOverride::deleteCurveVertexBuffers()
-{
-	if (m_curvePositionBuffer)
-	{
-		delete m_curvePositionBuffer;
-		m_curvePositionBuffer = nullptr;
-	}
-}
+		for (unsigned int i = 0; i < curveIndicesCount; i++)
+			curveIndices[pointerOffset++] = i;
 
-void FlexiChainSingle_SubSceneOverride::deleteCurveIndexBuffers()
-{
-	if (m_curveIndexBuffer)
-	{
-		delete m_curveIndexBuffer;
-		m_curveIndexBuffer = nullptr;
+		m_curveIndexBuffer.commit(curveIndices, topology);
 	}
 }
 
-void FlexiChainSingle_SubSceneOverride::deleteCurveGeometryBuffers()
-{
-	deleteCurveVertexBuffers();
-	deleteCurveIndexBuffers();
-}
-
 // Normals buffers
 void FlexiChainSingle_SubSceneOverride::updateNormalsGeometryBuffers()
 {
-	deleteNormalsVertexBuffers();
-
 	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
 	unsigned int normalsVertexCount = curveData.outputCount * 2;
 	unsigned int skipCount = (curveData.sampleCount - 1) / (curveData.outputCount - 1);
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor normalsPositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_normalsPositionBuffer = new MVertexBuffer(normalsPositionDesc);
-
 	// VB for normals positions
-	if (m_normalsPositionBuffer)
+	float* normalsPositions = m_normalsPositionBuffer.acquire(normalsVertexCount);
+	if (normalsPositions)
 	{
-		float* normalsPositions = (float*)m_normalsPositionBuffer->acquire(normalsVertexCount, true /*writeOnly*/);
-		if (normalsPositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveData.outputCount; i++)
-			{
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][0];
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][1];
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][2];
-
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][0] + (float)curveData.normals[i * skipCount][0] * m_normalsLengthScale;
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][1] + (float)curveData.normals[i * skipCount][1] * m_normalsLengthScale;
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][2] + (float)curveData.normals[i * skipCount][2] * m_normalsLengthScale;
-			}
+		pointerOffset += streamFlexiSegments(curveData.points.lanes(), curveData.normals.lanes(), m_normalsLengthScale, skipCount, curveData.outputCount, normalsPositions + pointerOffset);
 
-			m_normalsPositionBuffer->commit(normalsPositions);
-		}
+		m_normalsPositionBuffer.commit(normalsPositions);
 	}
 
-	// Index buffers only need to be updated if the sampleCount attribute changes
-	if (normalsVertexCount == m_normalsVertexCount)
+	// Index buffers only need to be regenerated if the topology changes
+	const FlexiTopology topology{ normalsVertexCount };
+	if (m_normalsIndexBuffer.isValid(topology))
 		return;
 
-	m_normalsVertexCount = normalsVertexCount;
-
-	deleteNormalsIndexBuffers();
-	m_normalsIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for normals item
-	if (m_normalsIndexBuffer)
+	unsigned int* normalsIndices = m_normalsIndexBuffer.acquire(normalsVertexCount);
+	if (normalsIndices)
 	{
-		unsigned int* normalsIndices = (unsigned int*)m_normalsIndexBuffer->acquire(normalsVertexCount, true /*writeOnly*/);
-		if (normalsIndices)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < normalsVertexCount; i++)
-				normalsIndices[pointerOffset++] = i;
+		for (unsigned int i = 0; i < normalsVertexCount; i++)
+			normalsIndices[pointerOffset++] = i;
 
-			m_normalsIndexBuffer->commit(normalsIndices);
-		}
+		m_normalsIndexBuffer.commit(normalsIndices, topology);
 	}
 }
 
-void FlexiChainSingle_SubSceneOverride::deleteNormalsVertexBuffers()
-{
-	if (m_normalsPositionBuffer)
-	{
-		delete m_normalsPositionBuffer;
-		m_normalsPositionBuffer = nullptr;
-	}
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteNormalsIndexBuffers()
-{
-	if (m_normalsIndexBuffer)
-	{
-		delete m_normalsIndexBuffer;
-		m_normalsIndexBuffer = nullptr;
-	}
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteNormalsGeometryBuffers()
-{
-	deleteNormalsVertexBuffers();
-	deleteNormalsIndexBuffers();
-}
-
 // Hull buffers
 void FlexiChainSingle_SubSceneOverride::updateHullGeometryBuffers()
 {
-	deleteHullVertexBuffers();
-
 	const FlexiChainSingle::FlexiChainSingle_Data& curveData = m_locator->getCurveData();
 	unsigned int hullVertexCount = 4;
 	unsigned int hullIndicesCount = 6;
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor hullPositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_hullPositionBuffer = new MVertexBuffer(hullPositionDesc);
-
 	// VB for hull positions
-	if (m_hullPositionBuffer)
+	float* hullPositions = m_hullPositionBuffer.acquire(hullVertexCount);
+	if (hullPositions)
 	{
-		float* hullPositions = (float*)m_hullPositionBuffer->acquire(hullVertexCount, true /*writeOnly*/);
-		if (hullPositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < hullVertexCount; i++)
-			{
-				hullPositions[pointerOffset++] = (float)curveData.controlPoints[i][0];
-				hullPositions[pointerOffset++] = (float)curveData.controlPoints[i][1];
-				hullPositions[pointerOffset++] = (float)curveData.controlPoints[i][2];
-			}
+		pointerOffset += streamFlexiVectors(curveData.controlPoints.data(), hullVertexCount, hullPositions + pointerOffset);
 
-			m_hullPositionBuffer->commit(hullPositions);
-		}
+		m_hullPositionBuffer.commit(hullPositions);
 	}
 
 	// Index buffer is static once created
-	if (m_hullIndexBuffer)
+	const FlexiTopology topology{ hullVertexCount };
+	if (m_hullIndexBuffer.isValid(topology))
 		return;
 
-	m_hullIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for hull item
-	if (m_hullIndexBuffer)
+	unsigned int* hullIndices = m_hullIndexBuffer.acquire(hullIndicesCount);
+	if (hullIndices)
 	{
-		unsigned int* hullIndices = (unsigned int*)m_hullIndexBuffer->acquire(hullIndicesCount, true /*writeOnly*/);
-		if (hullIndices)
-		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < hullVertexCount - 1; i++)
-			{
-				hullIndices[pointerOffset++] = i;
-				hullIndices[pointerOffset++] = i + 1;
-			}
+		int pointerOffset = 0;
 
-			m_hullIndexBuffer->commit(hullIndices);
+		for (unsigned int i = 0; i < hullVertexCount - 1; i++)
+		{
+			hullIndices[pointerOffset++] = i;
+			hullIndices[pointerOffset++] = i + 1;
 		}
-	}
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteHullVertexBuffers()
-{
-	if (m_hullPositionBuffer)
-	{
-		delete m_hullPositionBuffer;
-		m_hullPositionBuffer = nullptr;
-	}
-}
 
-void FlexiChainSingle_SubSceneOverride::deleteHullIndexBuffers()
-{
-	if (m_hullIndexBuffer)
-	{
-		delete m_hullIndexBuffer;
-		m_hullIndexBuffer = nullptr;
+		m_hullIndexBuffer.commit(hullIndices, topology);
 	}
 }
 
-void FlexiChainSingle_SubSceneOverride::deleteHullGeometryBuffers()
-{
-	deleteHullVertexBuffers();
-	deleteHullIndexBuffers();
-}
-
 // Bounding box buffers
 void FlexiChainSingle_SubSceneOverride::updateBoundingBoxGeometryBuffers(const MBoundingBox& bounds)
 {
-	deleteBoundingBoxVertexBuffers();
-
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor boundingBoxPositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_boundingBoxPositionBuffer = new MVertexBuffer(boundingBoxPositionDesc);
-
 	// VB for bounding box positions
-	if (m_boundingBoxPositionBuffer)
+	float* boundingBoxPositions = m_boundingBoxPositionBuffer.acquire(8);
+	if (boundingBoxPositions)
 	{
-		float* boundingBoxPositions = (float*)m_boundingBoxPositionBuffer->acquire(8, true /*writeOnly*/);
-		if (boundingBoxPositions)
-		{
-			MPoint pMin = bounds.min();
-			MPoint pMax = bounds.max();
-			
-			boundingBoxPositions[0] = (float)pMin.x; boundingBoxPositions[1] = (float)pMin.y; boundingBoxPositions[2] = (float)pMin.z;
-			boundingBoxPositions[3] = (float)pMin.x; boundingBoxPositions[4] = (float)pMin.y; boundingBoxPositions[5] = (float)pMax.z;
-			boundingBoxPositions[6] = (float)pMax.x; boundingBoxPositions[7] = (float)pMin.y; boundingBoxPositions[8] = (float)pMax.z;
-			boundingBoxPositions[9] = (float)pMax.x; boundingBoxPositions[10] = (float)pMin.y; boundingBoxPositions[11] = (float)pMin.z;
-			boundingBoxPositions[12] = (float)pMin.x; boundingBoxPositions[13] = (float)pMax.y; boundingBoxPositions[14] = (float)pMin.z;
-			boundingBoxPositions[15] = (float)pMin.x; boundingBoxPositions[16] = (float)pMax.y; boundingBoxPositions[17] = (float)pMax.z;
-			boundingBoxPositions[18] = (float)pMax.x; boundingBoxPositions[19] = (float)pMax.y; boundingBoxPositions[20] = (float)pMax.z;
-			boundingBoxPositions[21] = (float)pMax.x; boundingBoxPositions[22] = (float)pMax.y; boundingBoxPositions[23] = (float)pMin.z;
-			
-			m_boundingBoxPositionBuffer->commit(boundingBoxPositions);
-		}
+		MPoint pMin = bounds.min();
+		MPoint pMax = bounds.max();
+		
+		boundingBoxPositions[0] = (float)pMin.x; boundingBoxPositions[1] = (float)pMin.y; boundingBoxPositions[2] = (float)pMin.z;
+		boundingBoxPositions[3] = (float)pMin.x; boundingBoxPositions[4] = (float)pMin.y; boundingBoxPositions[5] = (float)pMax.z;
+		boundingBoxPositions[6] = (float)pMax.x; boundingBoxPositions[7] = (float)pMin.y; boundingBoxPositions[8] = (float)pMax.z;
+		boundingBoxPositions[9] = (float)pMax.x; boundingBoxPositions[10] = (float)pMin.y; boundingBoxPositions[11] = (float)pMin.z;
+		boundingBoxPositions[12] = (float)pMin.x; boundingBoxPositions[13] = (float)pMax.y; boundingBoxPositions[14] = (float)pMin.z;
+		boundingBoxPositions[15] = (float)pMin.x; boundingBoxPositions[16] = (float)pMax.y; boundingBoxPositions[17] = (float)pMax.z;
+		boundingBoxPositions[18] = (float)pMax.x; boundingBoxPositions[19] = (float)pMax.y; boundingBoxPositions[20] = (float)pMax.z;
+		boundingBoxPositions[21] = (float)pMax.x; boundingBoxPositions[22] = (float)pMax.y; boundingBoxPositions[23] = (float)pMin.z;
+		
+		m_boundingBoxPositionBuffer.commit(boundingBoxPositions);
 	}
 
 	// Index buffer is static once created
-	if (m_boundingBoxIndexBuffer)
+	const FlexiTopology topology{ 8 };
+	if (m_boundingBoxIndexBuffer.isValid(topology))
 		return;
 
-	m_boundingBoxIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for bounding box item
-	if (m_boundingBoxIndexBuffer)
-	{
-		unsigned int* boundingBoxIndices = (unsigned int*)m_boundingBoxIndexBuffer->acquire(24, true /*writeOnly*/);
-		if (boundingBoxIndices)
-		{
-			boundingBoxIndices[0] = 0; boundingBoxIndices[1] = 1;
-			boundingBoxIndices[2] = 1; boundingBoxIndices[3] = 2;
-			boundingBoxIndices[4] = 2; boundingBoxIndices[5] = 3;
-			boundingBoxIndices[6] = 3; boundingBoxIndices[7] = 0;
-			boundingBoxIndices[8] = 4; boundingBoxIndices[9] = 5;
-			boundingBoxIndices[10] = 5; boundingBoxIndices[11] = 6;
-			boundingBoxIndices[12] = 6; boundingBoxIndices[13] = 7;
-			boundingBoxIndices[14] = 7; boundingBoxIndices[15] = 4;
-			boundingBoxIndices[16] = 0; boundingBoxIndices[17] = 4;
-			boundingBoxIndices[18] = 1; boundingBoxIndices[19] = 5;
-			boundingBoxIndices[20] = 2; boundingBoxIndices[21] = 6;
-			boundingBoxIndices[22] = 3; boundingBoxIndices[23] = 7;
-
-			m_boundingBoxIndexBuffer->commit(boundingBoxIndices);
-		}
-	}
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteBoundingBoxVertexBuffers()
-{
-	if (m_boundingBoxPositionBuffer)
-	{
-		delete m_boundingBoxPositionBuffer;
-		m_boundingBoxPositionBuffer = nullptr;
-	}
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteBoundingBoxIndexBuffers()
-{
-	if (m_boundingBoxIndexBuffer)
+	unsigned int* boundingBoxIndices = m_boundingBoxIndexBuffer.acquire(24);
+	if (boundingBoxIndices)
 	{
-		delete m_boundingBoxIndexBuffer;
-		m_boundingBoxIndexBuffer = nullptr;
+		boundingBoxIndices[0] = 0; boundingBoxIndices[1] = 1;
+		boundingBoxIndices[2] = 1; boundingBoxIndices[3] = 2;
+		boundingBoxIndices[4] = 2; boundingBoxIndices[5] = 3;
+		boundingBoxIndices[6] = 3; boundingBoxIndices[7] = 0;
+		boundingBoxIndices[8] = 4; boundingBoxIndices[9] = 5;
+		boundingBoxIndices[10] = 5; boundingBoxIndices[11] = 6;
+		boundingBoxIndices[12] = 6; boundingBoxIndices[13] = 7;
+		boundingBoxIndices[14] = 7; boundingBoxIndices[15] = 4;
+		boundingBoxIndices[16] = 0; boundingBoxIndices[17] = 4;
+		boundingBoxIndices[18] = 1; boundingBoxIndices[19] = 5;
+		boundingBoxIndices[20] = 2; boundingBoxIndices[21] = 6;
+		boundingBoxIndices[22] = 3; boundingBoxIndices[23] = 7;
+
+		m_boundingBoxIndexBuffer.commit(boundingBoxIndices, topology);
 	}
 }
 
-void FlexiChainSingle_SubSceneOverride::deleteBoundingBoxGeometryBuffers()
-{
-	deleteBoundingBoxVertexBuffers();
-	deleteBoundingBoxIndexBuffers();
-}
-
-// All buffers
-void FlexiChainSingle_SubSceneOverride::deleteVertexBuffers()
-{
-	deleteRibbonVertexBuffers();
-	deleteCurveVertexBuffers();
-	deleteNormalsVertexBuffers();
-	deleteHullVertexBuffers();
-	deleteBoundingBoxVertexBuffers();
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteIndexBuffers()
-{
-	deleteRibbonIndexBuffers();
-	deleteCurveIndexBuffers();
-	deleteNormalsIndexBuffers();
-	deleteHullIndexBuffers();
-	deleteBoundingBoxIndexBuffers();
-}
-
-void FlexiChainSingle_SubSceneOverride::deleteGeometryBuffers()
-{
-	deleteVertexBuffers();
-	deleteIndexBuffers();
-}
-
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 static void printShaderParameters(MShaderInstance* shader)
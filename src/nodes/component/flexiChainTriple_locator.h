@@ -11,6 +11,7 @@
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDGModifier.h>
 #include <maya/MEvaluationNode.h>
 #include <maya/MFnDependencyNode.h>
@@ -38,6 +39,8 @@
 #include <SeExpr2/Curve.h>
 #include <SeExpr2/Vec.h>
 
+#include "flexiCore.h"
+#include "flexiDrawHelpers.h"
 #include "flexiHelpers.h"
 #include "data/eulerArray_data.h"
 #include "utils/math_utils.h"
@@ -45,6 +48,7 @@
 #include "utils/node_utils.h"
 #include "utils/quaternion_utils.h"
 #include "utils/spline_utils.h"
+#include "utils/vector_array_utils.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -81,6 +85,8 @@ public:
 		bool isCounterTwistUpVectorOverrideEnabled;
 		bool isScaleAdjustmentEnabled;
 		bool isTwistAdjustmentEnabled;
+		bool isScaleAdjustmentDirty;
+		bool isTwistAdjustmentDirty;
 		bool isDrawRibbonEnabled;
 		short parameterization;
 
@@ -100,17 +106,18 @@ public:
 		std::vector<double> splitLengthParameters;
 		std::vector<double>* currentParameters;
 
-		// lengths (natural parameter increments)
-		std::vector<double> lengths;
+		// lengths (integrated per span, independent of the parameter count)
+		MRS::ArcLengthTable arcLengthTable;
+		std::vector<double> stableParameters;
 
 		// sample xforms
 		MVector vPrincipalNormal;
-		std::vector<MVector> naturalPoints;
-		std::vector<MVector> points;
-		std::vector<MVector> tangents;
-		std::vector<MVector> binormals;
-		std::vector<MVector> normals;
+		MRS::VectorArray points;
+		MRS::VectorArray tangents;
+		MRS::VectorArray binormals;
+		MRS::VectorArray normals;
 		std::vector<MQuaternion> rmfReflections;
+		std::vector<MQuaternion> rmfStepReflections;
 
 		// input xforms
 		MVector vNormalUp;
@@ -125,6 +132,10 @@ public:
 		// adjustments
 		std::vector<TwistAdjustment> twistAdjustments;
 		std::vector<ScaleAdjustment> scaleAdjustments;
+		// summed adjustment values at the normalized parameters, persisting until an adjustment or the parameterization changes
+		std::vector<double> normalizedParameters;
+		FlexiAdjustmentTable<TwistAdjustment> twistAdjustmentTable;
+		FlexiAdjustmentTable<ScaleAdjustment> scaleAdjustmentTable;
 	};
 
 public:
@@ -150,15 +161,18 @@ public:
 
 	// ------ Helpers ------
 	void computeCurveData(MDataBlock& dataBlock);
+	void computeCurve(MDataBlock& dataBlock);
+	void computeCurveSamples(MDataBlock& dataBlock);
+	void invalidateCurveData();
 	void computeScaleAdjustments(MDataBlock& dataBlock);
 	void computeTwistAdjustments(MDataBlock& dataBlock);
-	void computeLengths();
-	void computeArcLengthParameters();
-	void computeSplitLengthParameters();
+	void computeNormalizedParameters();
+	void computeStableParameters();
 	double splitLengthToNaturalParameter(double splitLengthParameter);
 	MStatus computeNormalStability(double& outStability);
 	MStatus computeCounterTwistStability(double& outStability);
-	MStatus computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, MObject& animCurveObj, MAnimCurveChange& animMod);
+	MStatus computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, unsigned int subSteps, double angularTolerance, 
+		MObject& animCurveObj, MAnimCurveChange& animMod);
 	MVector sampleCurve(double t) const;
 	MVector sampleFirstDerivative(double t) const;
 	static void instancingChangedCallback(MDagPath& child, MDagPath& parent, void* clientData);
@@ -166,6 +180,10 @@ public:
 	const MRS::CubicTBezier& getCurve() const;
 	const FlexiChainTriple_Data& getCurveData() const;
 	MDataBlock getDataBlock();
+	unsigned int getDrawDirtyCount() const;
+	void setDrawDirty();
+	const FlexiManipState& getManipState() const;
+	void setActiveManip(int index);
 
 	// ------ Attr ------
 	// inputs
@@ -273,6 +291,12 @@ private:
 	MRS::CubicTBezier m_curve;
 	FlexiChainTriple_Data m_data;
 
+	// ------ Draw ------
+	// Incremented whenever the draw state is dirtied, the draw override uses this to skip draw cycles in which nothing has changed
+	unsigned int m_drawDirtyCount;
+	// Published by the tool contexts, the draw override uses this to display the falloff of the active manipulator
+	FlexiManipState m_manipState;
+
 	// ------ Callbacks ------
 	MCallbackId m_instanceAddedCallbackId;
 };
@@ -297,6 +321,10 @@ public:
 	static const char* kEndTimeFlagLong;
 	static const char* kTimeStepFlag;
 	static const char* kTimeStepFlagLong;
+	static const char* kSubStepsFlag;
+	static const char* kSubStepsFlagLong;
+	static const char* kToleranceFlag;
+	static const char* kToleranceFlagLong;
 
 	// ------ MPxCommand ------
 	bool isUndoable() const override;
@@ -0,0 +1,458 @@
+#include "flexiCore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include <maya/MDagPath.h>
+#include <maya/MDistance.h>
+#include <maya/MFnCamera.h>
+#include <maya/MFnTransform.h>
+
+#include "utils/quaternion_utils.h"
+#include "utils/spline_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Function forms the falloff curve of an adjustment from its ramp control points
+	The control points are positioned relative to the offset and falloff distance according to the falloff mode
+	If repeat is enabled, the control points are duplicated so that the adjustment has full coverage over the curve's domain    */
+void buildFlexiAdjustment(MDataHandle& elementHandle, const FlexiAdjustmentAttributes& attributes, Adjustment& adjustment)
+{
+	MArrayDataHandle rampArrayHandle = elementHandle.child(attributes.ramp);
+	adjustment.offset = elementHandle.child(attributes.offset).asDouble();
+	adjustment.falloffDistance = elementHandle.child(attributes.falloffDistance).asDouble();
+	adjustment.falloffMode = elementHandle.child(attributes.falloffMode).asShort();
+	adjustment.repeat = elementHandle.child(attributes.repeat).asBool();
+
+	// Curve will be formed by ramp control points
+	unsigned int numRampControlPoints = rampArrayHandle.elementCount();
+	unsigned int numTotalControlPoints = adjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
+	// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
+	adjustment.controlPoints.clear();
+	adjustment.controlPoints.reserve(numTotalControlPoints);
+
+	for (unsigned int j = 0; j < numRampControlPoints; ++j)
+	{
+		MDataHandle controlPointHandle = rampArrayHandle.inputValue();
+		float position = controlPointHandle.child(attributes.rampPosition).asFloat();
+		position = std::max(std::min(position, 1.0f), 0.0f);
+		float value = controlPointHandle.child(attributes.rampValue).asFloat();
+		value = std::max(std::min(value, 1.0f), 0.0f);
+		short interp = controlPointHandle.child(attributes.rampInterpolation).asShort();
+
+		// Forward
+		if (adjustment.falloffMode == 0)
+		{
+			double adjustedPosition = (double)position * adjustment.falloffDistance + adjustment.offset;
+			adjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
+		}
+		// Backward
+		else if (adjustment.falloffMode == 1)
+		{
+			double adjustedPosition = (double)position * -1 * adjustment.falloffDistance + adjustment.offset;
+			adjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
+		}
+		// Mirror
+		else if (adjustment.falloffMode == 2)
+		{
+			// The entire mirrored curve has a total default falloff distance of 1.0
+			double forwardPosition = (double)position * 0.5 * adjustment.falloffDistance + adjustment.offset;
+			double backwardPosition = (double)position * -0.5 * adjustment.falloffDistance + adjustment.offset;
+			adjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
+			adjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
+		}
+		// Center
+		else if (adjustment.falloffMode == 3)
+		{
+			// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
+			double remappedPosition = -0.5 + (double)position;
+			double adjustedPosition = remappedPosition * adjustment.falloffDistance + adjustment.offset;
+			adjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
+		}
+
+		rampArrayHandle.next();
+	}
+
+	// The repeat bounds below rely on the control points being sorted, regardless of the falloff mode
+	std::sort(adjustment.controlPoints.begin(), adjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
+
+	// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
+	// This is because the interpolation type of an entire segment is defined by its lower bound control point
+	// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
+	if (adjustment.falloffMode == 1 || adjustment.falloffMode == 2)
+	{
+		auto cvIter = adjustment.controlPoints.begin();
+		while (cvIter != adjustment.controlPoints.end() && cvIter->_pos < adjustment.offset)
+		{
+			cvIter->_interp = std::next(cvIter)->_interp;
+			cvIter++;
+		}
+	}
+
+	// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
+	if (adjustment.repeat && numRampControlPoints >= 2)
+	{
+		double lowerBoundPos = adjustment.controlPoints[0]._pos;
+		double upperBoundPos = adjustment.controlPoints[adjustment.controlPoints.size() - 1]._pos;
+
+		// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
+		if (adjustment.falloffDistance > 0.01)
+		{
+			unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / adjustment.falloffDistance));
+			unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / adjustment.falloffDistance));
+			unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
+
+			adjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
+
+			for (unsigned int j = 0; j < lowerRepititionCount; ++j)
+			{
+				for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
+				{
+					adjustment.controlPoints.push_back(adjustment.controlPoints[k]);
+					adjustment.controlPoints.back()._pos -= adjustment.falloffDistance * (j + 1);
+				}
+
+				// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
+				adjustment.controlPoints.push_back(adjustment.controlPoints[numTotalControlPoints - 1]);
+				adjustment.controlPoints.back()._pos -= adjustment.falloffDistance * (j + 1) + 0.00001;
+			}
+
+			for (unsigned int j = 0; j < upperRepititionCount; ++j)
+			{
+				// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
+				adjustment.controlPoints.push_back(adjustment.controlPoints[0]);
+				adjustment.controlPoints.back()._pos += adjustment.falloffDistance * (j + 1) + 0.00001;
+
+				for (unsigned int k = 1; k < numTotalControlPoints; ++k)
+				{
+					adjustment.controlPoints.push_back(adjustment.controlPoints[k]);
+					adjustment.controlPoints.back()._pos += adjustment.falloffDistance * (j + 1);
+				}
+			}
+
+			// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
+			for (unsigned int j = numTotalControlPoints - 1; j < adjustment.controlPoints.size(); j += numTotalControlPoints)
+				adjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
+		}
+	}
+
+	for (SeExpr2::Curve<double>::CV& controlPoint : adjustment.controlPoints)
+		adjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
+
+	// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
+	// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
+	adjustment.curve.preparePoints();
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+void adjustFlexiFrames(const double* twists, const double (*scales)[MRS::kVectorArrayGrainSize], unsigned int count,
+	MRS::VectorLanes tangents, MRS::VectorLanes normals, MRS::VectorLanes binormals)
+{
+	assert(count <= MRS::kVectorArrayGrainSize);
+
+	// The tangent is the axis of the twist, therefore only the normal and binormal are rotated
+	MRS::rotateVectorPairs(twists, count, normals, binormals);
+
+	if (scales)
+	{
+		MRS::scaleVectors(scales[0], count, tangents);
+		MRS::scaleVectors(scales[1], count, normals);
+		MRS::scaleVectors(scales[2], count, binormals);
+	}
+}
+
+void adjustFlexiFrames(const double* twists, const double (*positions)[MRS::kVectorArrayGrainSize], const double (*scales)[MRS::kVectorArrayGrainSize],
+	unsigned int count, MRS::VectorLanes tangents, MRS::VectorLanes normals, MRS::VectorLanes binormals, MRS::VectorLanes points)
+{
+	assert(count <= MRS::kVectorArrayGrainSize);
+
+	// Position adjustments are relative to the twisted axes but precede the scale, see adjustFlexiFrame
+	MRS::rotateVectorPairs(twists, count, normals, binormals);
+
+	MRS::addScaledVectors(positions[0], tangents, count, points);
+	MRS::addScaledVectors(positions[1], normals, count, points);
+	MRS::addScaledVectors(positions[2], binormals, count, points);
+
+	if (scales)
+	{
+		MRS::scaleVectors(scales[0], count, tangents);
+		MRS::scaleVectors(scales[1], count, normals);
+		MRS::scaleVectors(scales[2], count, binormals);
+	}
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Computes the rotation minimizing frames of a sequence of samples using the double reflection method
+	The RMF begins from the principal normal of the first sample, the reflection of the first sample is therefore the identity
+
+	Considerations
+	--------------
+	The reflection between each pair of adjacent samples is independent of all other reflections, only their composition is sequential
+	- The composition is an ordered scan which is kept serial, a parallel scan would reassociate the quaternion products and change the result
+	- The step reflections and the normals are distributed over Maya's thread pool, each chunk writes to its own elements so the results match the serial path exactly
+
+	Args
+	----
+	points = Sample points of the curve
+	tangents = Normalized tangents of the curve at each sample point
+	vNormalUp = Normalized up-vector from which the principal normal is computed    */
+void computeFlexiRMF(const MRS::VectorArray& points, const MRS::VectorArray& tangents, const MVector& vNormalUp, unsigned int grainSize,
+	MVector& outPrincipalNormal, std::vector<MQuaternion>& outStepReflections, std::vector<MQuaternion>& outReflections,
+	MRS::VectorArray& outNormals, MRS::VectorArray& outBinormals)
+{
+	assert(!points.empty() && points.size() == tangents.size());
+	unsigned int sampleCount = points.size();
+
+	outPrincipalNormal = computeFlexiPrincipalNormal(vNormalUp, tangents[0]);
+
+	computeFlexiStepReflections(points, tangents, grainSize, outStepReflections);
+
+	// Each sequential reflection is stored as a composition of all previous reflections
+	outReflections.resize(sampleCount);
+	outReflections[0] = MQuaternion::identity;
+	for (unsigned int i = 1; i < sampleCount; ++i)
+		outReflections[i] = MRS::quaternionMultiply(outStepReflections[i], outReflections[i - 1]);
+
+	computeFlexiRmfNormals(outPrincipalNormal, outReflections, tangents, grainSize, outNormals, outBinormals);
+}
+
+MVector computeFlexiPrincipalNormal(const MVector& vNormalUp, const MVector& vTangent)
+{
+	MVector vRight = vNormalUp ^ vTangent;
+	vRight.normalize();
+	return vTangent ^ vRight;
+}
+
+MVector reflectFlexiNormal(const MQuaternion& qReflectionComposition, const MVector& vPrincipalNormal)
+{
+	MQuaternion qPrincipalNormal{ vPrincipalNormal.x, vPrincipalNormal.y, vPrincipalNormal.z, 0.0 };
+	MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
+	MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
+	MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
+	MVector vNormal{ qNormal.x, qNormal.y, qNormal.z };
+	vNormal.normalize();
+
+	return vNormal;
+}
+
+void computeFlexiStepReflections(const MRS::VectorArray& points, const MRS::VectorArray& tangents, unsigned int grainSize,
+	std::vector<MQuaternion>& outStepReflections)
+{
+	unsigned int sampleCount = points.size();
+	outStepReflections.resize(sampleCount);
+
+	MRS::parallelFor(1, sampleCount, grainSize, [&](unsigned int begin, unsigned int end)
+	{
+		for (unsigned int i = begin; i < end; ++i)
+			outStepReflections[i] = MRS::Spline::computeDoubleReflectionRMF(points[i - 1], points[i], tangents[i - 1], tangents[i]);
+	});
+}
+
+void computeFlexiRmfNormals(const MVector& vPrincipalNormal, const std::vector<MQuaternion>& reflections, const MRS::VectorArray& tangents,
+	unsigned int grainSize, MRS::VectorArray& outNormals, MRS::VectorArray& outBinormals)
+{
+	unsigned int sampleCount = (unsigned)reflections.size();
+	outNormals.resize(sampleCount);
+	outBinormals.resize(sampleCount);
+
+	MRS::parallelFor(0, sampleCount, grainSize, [&](unsigned int begin, unsigned int end)
+	{
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			MVector vNormal = reflectFlexiNormal(reflections[i], vPrincipalNormal);
+			outNormals.set(i, vNormal);
+			outBinormals.set(i, tangents[i] ^ vNormal);
+		}
+	});
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Function keys the counter twist of a locator from the end frames which it has sampled over a time range
+	For each sample, a signed angle is calculated between the counter-twist up-vector (projected onto the tangent plane) and the end normal
+	The angles are independent and are distributed over Maya's thread pool, whereas their accumulation is sequential and is kept as a single serial pass
+	The keyframes are then set on the anim curve as a single batch
+
+	Args
+	----
+	upperBoundTangents = Normalized end tangent of each sample
+	upperBoundNormals = Normalized end normal of each sample, computed from the RMF of the curve
+	counterTwistUpVectors = Normalized counter-twist up-vector of each sample
+	subSteps = Number of samples taken per time step, a keyframe is only set at each time step    */
+MStatus keyFlexiCounterTwist(const std::vector<MVector>& upperBoundTangents, const std::vector<MVector>& upperBoundNormals,
+	const std::vector<MVector>& counterTwistUpVectors, MTime startTime, MTime timeStep, unsigned int subSteps, unsigned int grainSize,
+	MFnAnimCurve& fnAnimCurve, MAnimCurveChange& animMod)
+{
+	assert(upperBoundTangents.size() == upperBoundNormals.size() && upperBoundTangents.size() == counterTwistUpVectors.size());
+	assert(subSteps > 0);
+
+	unsigned int sampleCount = (unsigned)upperBoundTangents.size();
+	unsigned int keyCount = sampleCount == 0 ? 0 : (sampleCount - 1) / subSteps + 1;
+
+	// --- Compute Angles ---
+	// Note, if the up-vector is close to parallel with tangent, the projection onto the tangent plane will be close to a zero-vector (angle may experience flipping)
+	std::vector<double> angles(sampleCount);
+
+	MRS::parallelFor(0, sampleCount, grainSize, [&](unsigned int begin, unsigned int end)
+	{
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			const MVector& vUpperBoundTangent = upperBoundTangents[i];
+			const MVector& vUpperBoundNormal = upperBoundNormals[i];
+			const MVector& vCounterTwistUp = counterTwistUpVectors[i];
+
+			// Project the up-vector onto the end tangent
+			MVector vProjUpOnTangent = (vCounterTwistUp * vUpperBoundTangent) * vUpperBoundTangent;
+			// Project the up-vector onto the tangent plane
+			MVector vProjUpOnTangentPlane = vCounterTwistUp - vProjUpOnTangent;
+			vProjUpOnTangentPlane.normalize();
+
+			// Calculate sign of the angle
+			MVector vCrossProjWithNormal = vProjUpOnTangentPlane ^ vUpperBoundNormal;
+			double dotCrossWithTangent = vCrossProjWithNormal * vUpperBoundTangent;
+			int angularDirection = dotCrossWithTangent < 0.0 ? 1 : -1;
+
+			// Calculate angle
+			double currentAngle = std::acos(std::max(-1.0, std::min(1.0, vProjUpOnTangentPlane * vUpperBoundNormal)));
+			angles[i] = currentAngle * angularDirection;
+		}
+	});
+
+	// --- Accumulate Angles ---
+	MTimeArray keyTimes;
+	MDoubleArray keyValues;
+	keyTimes.setSizeIncrement(keyCount);
+	keyValues.setSizeIncrement(keyCount);
+	double previousAngle = 0.0;
+	double totalAngle = 0.0;
+
+	for (unsigned int i = 0; i < sampleCount; ++i)
+	{
+		double currentAngle = angles[i];
+
+		// Calculate delta from previous sample
+		double angularDelta;
+		if (std::abs(currentAngle - previousAngle) > M_PI)
+		{
+			// The normal is pointing in a similiar direction to the negated projection vector
+			// This causes a large discrepency between the previous and current angles (ie. angle is close to 180 degrees but direction has changed)
+			if (currentAngle > 0.0)
+				angularDelta = (-2 * M_PI) + (currentAngle - previousAngle);
+			else
+				angularDelta = (2 * M_PI) + (currentAngle - previousAngle);
+		}
+		else
+			angularDelta = currentAngle - previousAngle;
+
+		// Counter the twist
+		totalAngle -= angularDelta;
+		previousAngle = currentAngle;
+
+		// Sub-steps only contribute to the accumulated angle
+		if (i % subSteps == 0)
+		{
+			keyTimes.append(startTime + timeStep * (double)(i / subSteps));
+			keyValues.append(totalAngle);
+		}
+	}
+
+	// Set the keyframes as a single batch
+	return fnAnimCurve.addKeys(&keyTimes, &keyValues, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, false, &animMod);
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Legacy implementation
+MPoint getFlexiCameraPosition(M3dView& view)
+{
+	MDagPath cameraPath;
+	view.getCamera(cameraPath);
+	cameraPath.pop();
+	return MFnTransform(cameraPath).rotatePivot(MSpace::kWorld);
+}
+
+// VP2 implementation
+MPoint getFlexiCameraPosition(const MHWRender::MFrameContext& frameContext)
+{
+	MDoubleArray viewPosition = frameContext.getTuple(MHWRender::MFrameContext::kViewPosition);
+	return MPoint{ viewPosition[0], viewPosition[1], viewPosition[2] };
+}
+
+// Legacy implementation
+MVector getFlexiCameraAimDirection(M3dView& view)
+{
+	MDagPath cameraPath;
+	view.getCamera(cameraPath);
+	cameraPath.pop();
+	return MFnCamera{ cameraPath }.viewDirection(MSpace::kWorld);
+}
+
+// VP2 implementation
+MVector getFlexiCameraAimDirection(const MHWRender::MFrameContext& frameContext)
+{
+	MDoubleArray aimDirection = frameContext.getTuple(MHWRender::MFrameContext::kViewDirection);
+	return MVector{ aimDirection[0], aimDirection[1], aimDirection[2] };
+}
+
+// Legacy implementation
+MVector getFlexiCameraUpDirection(M3dView& view)
+{
+	MDagPath cameraPath;
+	view.getCamera(cameraPath);
+	cameraPath.pop();
+	return MFnCamera{ cameraPath }.upDirection(MSpace::kWorld);
+}
+
+// VP2 implementation
+MVector getFlexiCameraUpDirection(const MHWRender::MFrameContext& frameContext)
+{
+	MDoubleArray upDirection = frameContext.getTuple(MHWRender::MFrameContext::kViewUp);
+	return MVector{ upDirection[0], upDirection[1], upDirection[2] };
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+bool intersectFlexiPlane(const MPoint& pRayOrigin, const MVector& vRayDirection, const MPoint& pPointOnPlane, const MVector& vPlaneNormal, MPoint& outIntersection)
+{
+	// Vector from the ray origin to a point on the plane
+	MVector vOriginToPointOnPlane = pPointOnPlane - pRayOrigin;
+
+	// Here we are finding the ratio between two projections
+	// - The above vector projected onto the plane normal
+	// - The ray direction projected onto the plane normal
+	double projectionRatio = (vOriginToPointOnPlane * vPlaneNormal) / (vRayDirection * vPlaneNormal);
+
+	// Scale the ray direction by the ratio then add to the ray origin to get the intersection point
+	outIntersection = pRayOrigin + vRayDirection * projectionRatio;
+
+	// Return true if both projections are in the same direction
+	return projectionRatio >= 0.0;
+}
+
+/*	Description
+	-----------
+	The MUIDrawManager adds a hover buffer region around items which appears to be proportional to the items' distance from the camera
+	The below calculation attempts to mimic this hover buffer region with fairly high accuracy (not actually sure how it works internally)    */
+double computeFlexiHoverRadiusMultiplier(const MPoint& pCamera, const MPoint& pHandle)
+{
+	MVector vCameraToHandle = pHandle - pCamera;
+	// The max multiplier of 4.0 occurs at 10 meters
+	MDistance refDist{ 1000, MDistance::kCentimeters };
+	double hoverRadiusMult = vCameraToHandle.length() / refDist.asUnits(MDistance::uiUnit()) * 4.0;
+	// Clamp the multiplier to the max (ie. past 10 meters the multiplier is always 4.0)
+	hoverRadiusMult = std::min(hoverRadiusMult, 4.0);
+	// Remap the multiplier so the low is always 1.0
+	// Remap = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
+	return 1.0 + hoverRadiusMult * 3.0 / 4.0;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,508 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <maya/M3dView.h>
+#include <maya/MAnimCurveChange.h>
+#include <maya/MArrayDataHandle.h>
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFnAnimCurve.h>
+#include <maya/MFrameContext.h>
+#include <maya/MMatrix.h>
+#include <maya/MObject.h>
+#include <maya/MPoint.h>
+#include <maya/MQuaternion.h>
+#include <maya/MStatus.h>
+#include <maya/MTime.h>
+#include <maya/MTimeArray.h>
+#include <maya/MVector.h>
+
+#include "flexiHelpers.h"
+#include "utils/matrix_utils.h"
+#include "utils/spline_utils.h"
+#include "utils/thread_utils.h"
+#include "utils/vector_array_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Shared evaluation core for the flexi locators
+	Each locator owns its curve type, parameterization and sampling, every stage which follows the samples is evaluated identically by every locator
+	- The adjustments and their tables, the base twist, the rotation minimizing frames, the output frames and the counter twist keys are provided below
+	- The camera, raycast and curve queries which every manipulator uses to interact with the locator's curve are also provided
+	The adjustment functions are parameterized on the adjustment type, FlexiAdjustmentTraits provides the behaviour which is specific to the adjusted value
+	The frame functions are parameterized on the locator's data type, which only needs to provide the members named by each function    */
+
+// Attributes which define a compound array of adjustments, every flexi locator declares the same set of children for each adjustment type
+struct FlexiAdjustmentAttributes
+{
+	const MObject& compound;
+	const MObject& ramp;
+	const MObject& rampPosition;
+	const MObject& rampValue;
+	const MObject& rampInterpolation;
+	const MObject& value;
+	const MObject& offset;
+	const MObject& falloffDistance;
+	const MObject& falloffMode;
+	const MObject& repeat;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TAdjustment>
+struct FlexiAdjustmentTraits;
+
+template <>
+struct FlexiAdjustmentTraits<ScaleAdjustment>
+{
+	typedef MVector ValueType;
+
+	static ValueType zero() { return MVector::zero; }
+	static void read(MDataHandle& valueHandle, ScaleAdjustment& adjustment) { adjustment.vScale = valueHandle.asVector(); }
+	static ValueType weighted(const ScaleAdjustment& adjustment, double weight) { return adjustment.vScale * weight; }
+};
+
+template <>
+struct FlexiAdjustmentTraits<TwistAdjustment>
+{
+	// Twist is accumulated in radians
+	typedef double ValueType;
+
+	static ValueType zero() { return 0.0; }
+	static void read(MDataHandle& valueHandle, TwistAdjustment& adjustment) { adjustment.twist = valueHandle.asAngle(); }
+	static ValueType weighted(const TwistAdjustment& adjustment, double weight) { return adjustment.twist.asRadians() * weight; }
+};
+
+template <>
+struct FlexiAdjustmentTraits<PositionAdjustment>
+{
+	typedef MVector ValueType;
+
+	static ValueType zero() { return MVector::zero; }
+	static void read(MDataHandle& valueHandle, PositionAdjustment& adjustment) { adjustment.vPosition = valueHandle.asVector(); }
+	static ValueType weighted(const PositionAdjustment& adjustment, double weight) { return adjustment.vPosition * weight; }
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Builds the falloff curve of an adjustment from the ramp, offset, falloff and repeat children of the given element
+void buildFlexiAdjustment(MDataHandle& elementHandle, const FlexiAdjustmentAttributes& attributes, Adjustment& adjustment);
+
+/*	Description
+	-----------
+	Reads every element of an adjustment compound array into the given vector
+
+	Considerations
+	--------------
+	Locators call this from their compute<X>Adjustments functions, which the manipulators also use to trigger an update
+	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
+template <typename TAdjustment>
+void computeFlexiAdjustments(MDataBlock& dataBlock, const FlexiAdjustmentAttributes& attributes, std::vector<TAdjustment>& adjustments)
+{
+	MArrayDataHandle adjustmentArrayHandle = dataBlock.inputArrayValue(attributes.compound);
+	unsigned int numAdjustments = adjustmentArrayHandle.elementCount();
+	adjustments.resize(numAdjustments);
+
+	for (unsigned int i = 0; i < numAdjustments; ++i)
+	{
+		MDataHandle adjustmentElementHandle = adjustmentArrayHandle.inputValue();
+		MDataHandle valueHandle = adjustmentElementHandle.child(attributes.value);
+
+		// The curve is rebuilt from scratch so the adjustment is reset rather than updated in place
+		TAdjustment adjustment;
+		FlexiAdjustmentTraits<TAdjustment>::read(valueHandle, adjustment);
+		buildFlexiAdjustment(adjustmentElementHandle, attributes, adjustment);
+		adjustments[i] = std::move(adjustment);
+
+		adjustmentArrayHandle.next();
+	}
+}
+
+// Returns the sum of the adjustment values, each weighted by its falloff curve at the given parameter
+// The falloff curve has a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
+template <typename TAdjustment>
+typename FlexiAdjustmentTraits<TAdjustment>::ValueType sumFlexiAdjustments(const std::vector<TAdjustment>& adjustments, double param)
+{
+	typedef FlexiAdjustmentTraits<TAdjustment> Traits;
+
+	typename Traits::ValueType total = Traits::zero();
+	for (const TAdjustment& adjustment : adjustments)
+		total += Traits::weighted(adjustment, adjustment.curve.getValue(param));
+
+	return total;
+}
+
+/*	Description
+	-----------
+	Caches the summed adjustment values at every stride'th parameter of a curve
+	Once built, applying any number of stacked adjustments to a sample is a single lookup rather than one falloff curve evaluation per adjustment
+	The owner is responsible for invalidating the table when the adjustments or the parameters it was built from change    */
+template <typename TAdjustment>
+class FlexiAdjustmentTable
+{
+public:
+	typedef typename FlexiAdjustmentTraits<TAdjustment>::ValueType ValueType;
+
+	FlexiAdjustmentTable() :
+		m_stride{ 1 },
+		m_isValid{ false }
+	{}
+
+	void invalidate() { m_isValid = false; }
+
+	// A table built at a given stride also holds every parameter required by a multiple of that stride
+	bool isValid(unsigned int stride) const { return m_isValid && stride % m_stride == 0; }
+
+	void build(const std::vector<TAdjustment>& adjustments, const std::vector<double>& parameters, unsigned int stride, unsigned int grainSize)
+	{
+		assert(stride > 0);
+		m_stride = stride;
+		m_values.resize(parameters.empty() ? 0 : (unsigned)(parameters.size() - 1) / stride + 1);
+
+		MRS::parallelFor(0, (unsigned)m_values.size(), grainSize, [this, &adjustments, &parameters](unsigned int begin, unsigned int end)
+		{
+			for (unsigned int i = begin; i < end; ++i)
+				m_values[i] = sumFlexiAdjustments(adjustments, parameters[i * m_stride]);
+		});
+
+		m_isValid = true;
+	}
+
+	// The parameter index must be a multiple of the stride which the table was built at
+	const ValueType& operator[](unsigned int parameterIndex) const { return m_values[parameterIndex / m_stride]; }
+
+private:
+	std::vector<ValueType> m_values;
+	unsigned int m_stride;
+	bool m_isValid;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Applies a twist about the tangent followed by a scale to the axes of a frame
+	This is equivalent to Matrix33::preRotateInX followed by Matrix33::preScale but writes the adjusted axes directly instead of assembling each intermediate matrix
+	The output axes may alias the input axes, allowing the caches to be updated in place    */
+inline void adjustFlexiFrame(const MVector& tangent, const MVector& normal, const MVector& binormal, double twist, const MVector& vScale,
+	MVector& outTangent, MVector& outNormal, MVector& outBinormal)
+{
+	double cosTwist = std::cos(twist);
+	double sinTwist = std::sin(twist);
+	MVector vTwistedNormal = normal * cosTwist + binormal * sinTwist;
+	MVector vTwistedBinormal = binormal * cosTwist - normal * sinTwist;
+
+	outTangent = tangent * vScale.x;
+	outNormal = vTwistedNormal * vScale.y;
+	outBinormal = vTwistedBinormal * vScale.z;
+}
+
+// Additionally applies a position adjustment relative to the twisted axes (ie. Matrix44::preTranslate), the scale is still applied relative to all other transformations
+inline void adjustFlexiFrame(const MVector& tangent, const MVector& normal, const MVector& binormal, const MVector& point, double twist, const MVector& vPosition,
+	const MVector& vScale, MVector& outTangent, MVector& outNormal, MVector& outBinormal, MVector& outPoint)
+{
+	double cosTwist = std::cos(twist);
+	double sinTwist = std::sin(twist);
+	MVector vTwistedNormal = normal * cosTwist + binormal * sinTwist;
+	MVector vTwistedBinormal = binormal * cosTwist - normal * sinTwist;
+
+	outPoint = tangent * vPosition.x + vTwistedNormal * vPosition.y + vTwistedBinormal * vPosition.z + point;
+	outTangent = tangent * vScale.x;
+	outNormal = vTwistedNormal * vScale.y;
+	outBinormal = vTwistedBinormal * vScale.z;
+}
+
+/*	Applies adjustFlexiFrame to a block of frames held in structure of arrays lanes, the axes are adjusted in place by the vectorized kernels of vector_array_utils.h
+	The scale factors of each axis are given as separate arrays, if scales is nullptr the axes are only twisted    */
+void adjustFlexiFrames(const double* twists, const double (*scales)[MRS::kVectorArrayGrainSize], unsigned int count,
+	MRS::VectorLanes tangents, MRS::VectorLanes normals, MRS::VectorLanes binormals);
+
+// Additionally applies a position adjustment to each point relative to its twisted axes, the points are adjusted in place
+void adjustFlexiFrames(const double* twists, const double (*positions)[MRS::kVectorArrayGrainSize], const double (*scales)[MRS::kVectorArrayGrainSize],
+	unsigned int count, MRS::VectorLanes tangents, MRS::VectorLanes normals, MRS::VectorLanes binormals, MRS::VectorLanes points);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Returns the normal of the first frame of the RMF, this is the up-vector made perpendicular to the given normalized tangent
+MVector computeFlexiPrincipalNormal(const MVector& vNormalUp, const MVector& vTangent);
+
+// Returns the principal normal transported by the given composition of reflections
+MVector reflectFlexiNormal(const MQuaternion& qReflectionComposition, const MVector& vPrincipalNormal);
+
+// Computes the double reflection between each pair of adjacent samples, the first element is not written as it has no predecessor
+void computeFlexiStepReflections(const MRS::VectorArray& points, const MRS::VectorArray& tangents, unsigned int grainSize,
+	std::vector<MQuaternion>& outStepReflections);
+
+// Computes the normal and binormal of every sample from the composed reflections of the RMF
+void computeFlexiRmfNormals(const MVector& vPrincipalNormal, const std::vector<MQuaternion>& reflections, const MRS::VectorArray& tangents,
+	unsigned int grainSize, MRS::VectorArray& outNormals, MRS::VectorArray& outBinormals);
+
+// Computes the RMF of an open sequence of samples, beginning from the principal normal of the first sample
+void computeFlexiRMF(const MRS::VectorArray& points, const MRS::VectorArray& tangents, const MVector& vNormalUp, unsigned int grainSize,
+	MVector& outPrincipalNormal, std::vector<MQuaternion>& outStepReflections, std::vector<MQuaternion>& outReflections,
+	MRS::VectorArray& outNormals, MRS::VectorArray& outBinormals);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Returns the twist in radians at the given normalized parameter before any twist adjustments are applied
+	Start and end twist are interpolated along the curve, counter twist is blended towards the end and roll is applied uniformly
+	The data type only needs to provide the startTwist, endTwist, counterTwist, counterTwistBlend and roll members    */
+template <typename TData>
+double computeFlexiBaseTwist(const TData& data, double normalizedParam)
+{
+	double totalWeightedTwist = 0.0;
+
+	// End twist
+	double endTwistWeight = normalizedParam;
+	totalWeightedTwist += data.endTwist * endTwistWeight;
+
+	// Start twist
+	double startTwistWeight = 1 - endTwistWeight;
+	totalWeightedTwist += data.startTwist * startTwistWeight;
+
+	// Counter twist
+	double counterTwistWeight = -1 * endTwistWeight * data.counterTwistBlend;
+	totalWeightedTwist += data.counterTwist * counterTwistWeight;
+
+	// Roll
+	totalWeightedTwist += data.roll;
+
+	return totalWeightedTwist;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Policies which determine whether buildFlexiFrames applies a position adjustment to each frame
+	Only the instancer supports position adjustments, its data type must additionally provide the isPositionAdjustmentEnabled state, the position adjustments and their table    */
+struct FlexiNoPositionAdjustment
+{
+	template <typename TData>
+	static bool isEnabled(const TData&) { return false; }
+
+	template <typename TData>
+	static void buildTable(TData&, unsigned int, unsigned int) {}
+
+	template <typename TData>
+	static MVector value(const TData&, unsigned int) { return MVector::zero; }
+};
+
+struct FlexiPositionAdjustment
+{
+	template <typename TData>
+	static bool isEnabled(const TData& data) { return data.isPositionAdjustmentEnabled; }
+
+	template <typename TData>
+	static void buildTable(TData& data, unsigned int tableStride, unsigned int grainSize)
+	{
+		if (data.isPositionAdjustmentEnabled && !data.positionAdjustmentTable.isValid(tableStride))
+			data.positionAdjustmentTable.build(data.positionAdjustments, data.normalizedParameters, tableStride, grainSize);
+	}
+
+	template <typename TData>
+	static MVector value(const TData& data, unsigned int parameterIndex) { return data.positionAdjustmentTable[parameterIndex]; }
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Builds the output frames of a locator from its sampled RMF, the adjustment tables are rebuilt first if they are no longer valid
+	If orientation is enabled, the sample caches are adjusted in place so that draw has the current data, otherwise the frames only hold a position and scale
+	Position adjustments are only applied to the frames, the point cache is never updated as changing the positions would need to affect the orient data drawn by the ribbon
+	Each iteration only writes to its own sample and output, the iterations are therefore distributed over Maya's thread pool
+	The data type must provide the counts, states, base twist values, normalized parameters, adjustments and their tables, sample caches (MRS::VectorArray) and frames
+	The frames must already be sized to the output count and the normalized parameters must be current, see the computeNormalizedParameters function of each locator    */
+template <typename TPositionPolicy = FlexiNoPositionAdjustment, typename TData>
+void buildFlexiFrames(TData& data, unsigned int grainSize)
+{
+	// Frames are only built at every (subdivisions + 1)th parameter unless the ribbon requires every sample to be adjusted
+	// A table is only rebuilt if its adjustments or the parameters have changed since it was last built
+	unsigned int tableStride = data.isOrientEnabled && data.isDrawRibbonEnabled ? 1 : data.subdivisions + 1;
+	bool isPositionAdjusted = TPositionPolicy::isEnabled(data);
+	TPositionPolicy::buildTable(data, tableStride, grainSize);
+	if (data.isScaleAdjustmentEnabled && !data.scaleAdjustmentTable.isValid(tableStride))
+		data.scaleAdjustmentTable.build(data.scaleAdjustments, data.normalizedParameters, tableStride, grainSize);
+	if (data.isTwistAdjustmentEnabled && data.isOrientEnabled && !data.twistAdjustmentTable.isValid(tableStride))
+		data.twistAdjustmentTable.build(data.twistAdjustments, data.normalizedParameters, tableStride, grainSize);
+
+	if (data.isOrientEnabled)
+	{
+		unsigned int increment = data.isDrawRibbonEnabled ? 1 : data.subdivisions + 1;
+		unsigned int iterationCount = (data.sampleCount - 1) / increment + 1;
+
+		// The iterations of each chunk are adjusted in blocks by the vectorized kernels (see adjustFlexiFrames)
+		// If the ribbon is not drawn the iterations are strided, their axes are then staged contiguously and written back once adjusted
+		MRS::parallelFor(0, iterationCount, grainSize, [&data, increment, isPositionAdjusted](unsigned int begin, unsigned int end)
+		{
+			const unsigned int blockSize = MRS::kVectorArrayGrainSize;
+			double twists[blockSize];
+			double scales[3][blockSize];
+			double positions[3][blockSize];
+			double stage[12][blockSize];
+			MRS::VectorLanes points{ stage[9], stage[10], stage[11] };
+
+			for (unsigned int first = begin; first < end; first += blockSize)
+			{
+				unsigned int count = std::min(end - first, blockSize);
+
+				for (unsigned int k = 0; k < count; ++k)
+				{
+					unsigned int i = (first + k) * increment;
+					twists[k] = computeFlexiBaseTwist(data, data.normalizedParameters[i]);
+
+					// Twist adjustment
+					if (data.isTwistAdjustmentEnabled)
+						twists[k] += data.twistAdjustmentTable[i];
+
+					// Scale adjustment
+					if (data.isScaleAdjustmentEnabled)
+					{
+						const MVector& vScaleAdjustment = data.scaleAdjustmentTable[i];
+						scales[0][k] = 1.0 + vScaleAdjustment.x;
+						scales[1][k] = 1.0 + vScaleAdjustment.y;
+						scales[2][k] = 1.0 + vScaleAdjustment.z;
+					}
+
+					// Position adjustment
+					if (isPositionAdjusted)
+					{
+						MVector vPositionAdjustment = TPositionPolicy::value(data, i);
+						positions[0][k] = vPositionAdjustment.x;
+						positions[1][k] = vPositionAdjustment.y;
+						positions[2][k] = vPositionAdjustment.z;
+					}
+				}
+
+				MRS::VectorLanes tangents = data.tangents.lanes().offset(first);
+				MRS::VectorLanes normals = data.normals.lanes().offset(first);
+				MRS::VectorLanes binormals = data.binormals.lanes().offset(first);
+				if (increment != 1)
+				{
+					tangents = MRS::VectorLanes{ stage[0], stage[1], stage[2] };
+					normals = MRS::VectorLanes{ stage[3], stage[4], stage[5] };
+					binormals = MRS::VectorLanes{ stage[6], stage[7], stage[8] };
+					data.tangents.gather(first * increment, increment, count, tangents);
+					data.normals.gather(first * increment, increment, count, normals);
+					data.binormals.gather(first * increment, increment, count, binormals);
+				}
+
+				// Scale is applied relative to all other transformations, the caches are updated in place so that draw has the current data
+				// Adjusted points are staged separately as the point cache must remain unadjusted
+				if (isPositionAdjusted)
+				{
+					data.points.gather(first * increment, increment, count, points);
+					adjustFlexiFrames(twists, positions, data.isScaleAdjustmentEnabled ? scales : nullptr, count, tangents, normals, binormals, points);
+				}
+				else
+					adjustFlexiFrames(twists, data.isScaleAdjustmentEnabled ? scales : nullptr, count, tangents, normals, binormals);
+
+				if (increment != 1)
+				{
+					data.tangents.scatter(tangents, first * increment, increment, count);
+					data.normals.scatter(normals, first * increment, increment, count);
+					data.binormals.scatter(binormals, first * increment, increment, count);
+				}
+
+				// Outputs occur at every (subdivisions + 1)th sample regardless of whether the ribbon is drawn
+				for (unsigned int k = 0; k < count; ++k)
+				{
+					unsigned int i = (first + k) * increment;
+					if (i % (data.subdivisions + 1) == 0)
+						data.frames[i / (data.subdivisions + 1)] = MRS::matrixFromVectors(data.tangents[i], data.normals[i], data.binormals[i],
+							isPositionAdjusted ? MVector{ points.x[k], points.y[k], points.z[k] } : data.points[i]);
+				}
+			}
+		});
+	}
+	else
+	{
+		MRS::parallelFor(0, data.sampleCount, grainSize, [&data, isPositionAdjusted](unsigned int begin, unsigned int end)
+		{
+			for (unsigned int i = begin; i < end; i++)
+			{
+				MMatrix frame;
+				unsigned int parameterIndex = i * (data.subdivisions + 1);
+
+				// Scale adjustment
+				if (data.isScaleAdjustmentEnabled)
+				{
+					MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
+					vScaleAdjustment += data.scaleAdjustmentTable[parameterIndex];
+
+					frame[0][0] = vScaleAdjustment.x; frame[1][1] = vScaleAdjustment.y; frame[2][2] = vScaleAdjustment.z;
+				}
+
+				// Position
+				MVector point = data.points[i];
+				if (isPositionAdjusted)
+					point += TPositionPolicy::value(data, parameterIndex);
+				frame[3][0] = point.x; frame[3][1] = point.y; frame[3][2] = point.z;
+				data.frames[i] = frame;
+			}
+		});
+	}
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Keys the counter twist from the end frames which a locator has sampled over a time range, the keys are added to the anim curve as a single batch
+MStatus keyFlexiCounterTwist(const std::vector<MVector>& upperBoundTangents, const std::vector<MVector>& upperBoundNormals,
+	const std::vector<MVector>& counterTwistUpVectors, MTime startTime, MTime timeStep, unsigned int subSteps, unsigned int grainSize,
+	MFnAnimCurve& fnAnimCurve, MAnimCurveChange& animMod);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Returns the world space position, aim direction or up direction of the camera, both the legacy viewport and VP2 are supported
+MPoint getFlexiCameraPosition(M3dView& view);
+MPoint getFlexiCameraPosition(const MHWRender::MFrameContext& frameContext);
+MVector getFlexiCameraAimDirection(M3dView& view);
+MVector getFlexiCameraAimDirection(const MHWRender::MFrameContext& frameContext);
+MVector getFlexiCameraUpDirection(M3dView& view);
+MVector getFlexiCameraUpDirection(const MHWRender::MFrameContext& frameContext);
+
+// Calculates the intersection of a ray with the plane determined by the given plane data, returns true if the plane lies in front of the ray
+bool intersectFlexiPlane(const MPoint& pRayOrigin, const MVector& vRayDirection, const MPoint& pPointOnPlane, const MVector& vPlaneNormal, MPoint& outIntersection);
+
+// Returns the multiplier which mimics the hover buffer region that the MUIDrawManager adds around a handle at the given position
+double computeFlexiHoverRadiusMultiplier(const MPoint& pCamera, const MPoint& pHandle);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Finds the parameter of the point along a manipulator's curve which is closest to the given line
+	The sampler must return the world space point at a parameter and must extend the curve linearly along its end tangents beyond the range [0-1]
+	Within this range the curve is subdivided and refined numerically, if the closest point lies at either end of the curve, the closest point along the tangent is found directly    */
+template <typename TSampler>
+double computeFlexiClosestCurveParam(const TSampler& sampleCurve, const MPoint& pLineOrigin, const MVector& vLineDirection, unsigned int subdivisions)
+{
+	double param = MRS::Spline::closestParameterToLine(sampleCurve, 0.0, 1.0, MVector(pLineOrigin), vLineDirection, subdivisions);
+
+	if (param <= 0.0 || param >= 1.0)
+	{
+		double direction = param <= 0.0 ? -1.0 : 1.0;
+		MPoint pBound = sampleCurve(param);
+		// Change in position per unit of the parameter along the tangent
+		MVector vTangent = sampleCurve(param + direction) - pBound;
+
+		double tangentParam;
+		if (MRS::Spline::closestParameterOnLineToLine(MVector(pBound), vTangent, MVector(pLineOrigin), vLineDirection, tangentParam) && tangentParam > 0.0)
+			param += direction * tangentParam;
+	}
+
+	return param;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,283 @@
+#include "flexiDrawHelpers.h"
+
+#include <cmath>
+
+#include <maya/MImage.h>
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+FlexiVertexBuffer::FlexiVertexBuffer(MHWRender::MGeometry::Semantic semantic, unsigned int dimension) :
+	m_semantic{ semantic },
+	m_dimension{ dimension },
+	m_capacity{ 0 },
+	m_buffer{ nullptr }
+{}
+
+FlexiVertexBuffer::~FlexiVertexBuffer()
+{
+	release();
+}
+
+/*	Description
+	-----------
+	Returns a block of memory to fill with at least vertexCount vertices (floats = capacity * dimension)
+	The buffer is always acquired at its full capacity so that the existing device allocation is reused    */
+float* FlexiVertexBuffer::acquire(unsigned int vertexCount)
+{
+	if (!m_buffer)
+	{
+		const MHWRender::MVertexBufferDescriptor descriptor{ "", m_semantic, MHWRender::MGeometry::kFloat, (int)m_dimension };
+		m_buffer = new MHWRender::MVertexBuffer(descriptor);
+		m_capacity = 0;
+	}
+
+	m_capacity = std::max(m_capacity, vertexCount);
+	return (float*)m_buffer->acquire(m_capacity, true /*writeOnly*/);
+}
+
+// Transfer from CPU to GPU memory
+void FlexiVertexBuffer::commit(float* data)
+{
+	m_buffer->commit(data);
+}
+
+void FlexiVertexBuffer::release()
+{
+	if (m_buffer)
+	{
+		delete m_buffer;
+		m_buffer = nullptr;
+	}
+
+	m_capacity = 0;
+}
+
+MHWRender::MVertexBuffer* FlexiVertexBuffer::buffer() const { return m_buffer; }
+unsigned int FlexiVertexBuffer::capacity() const { return m_capacity; }
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+FlexiIndexBuffer::FlexiIndexBuffer() :
+	m_isValid{ false },
+	m_buffer{ nullptr }
+{}
+
+FlexiIndexBuffer::~FlexiIndexBuffer()
+{
+	release();
+}
+
+bool FlexiIndexBuffer::isValid(const FlexiTopology& topology) const
+{
+	return m_buffer && m_isValid && m_topology == topology;
+}
+
+// The buffer is invalidated until the next call to commit() in case the acquired memory is never filled
+unsigned int* FlexiIndexBuffer::acquire(unsigned int indexCount)
+{
+	if (!m_buffer)
+		m_buffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
+
+	m_isValid = false;
+	return (unsigned int*)m_buffer->acquire(indexCount, true /*writeOnly*/);
+}
+
+void FlexiIndexBuffer::commit(unsigned int* data, const FlexiTopology& topology)
+{
+	m_buffer->commit(data);
+	m_topology = topology;
+	m_isValid = true;
+}
+
+void FlexiIndexBuffer::release()
+{
+	if (m_buffer)
+	{
+		delete m_buffer;
+		m_buffer = nullptr;
+	}
+
+	m_isValid = false;
+}
+
+MHWRender::MIndexBuffer* FlexiIndexBuffer::buffer() const { return m_buffer; }
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+FlexiManipState::FlexiManipState() :
+	m_activeIndex{ -1 },
+	m_version{ 0 }
+{}
+
+// Returns true if the active index has changed, the version is only incremented in this case
+bool FlexiManipState::setActiveIndex(int activeIndex)
+{
+	if (m_activeIndex.load(std::memory_order_relaxed) == activeIndex)
+		return false;
+
+	m_activeIndex.store(activeIndex, std::memory_order_relaxed);
+	m_version.fetch_add(1, std::memory_order_release);
+	return true;
+}
+
+int FlexiManipState::getActiveIndex() const { return m_activeIndex.load(std::memory_order_relaxed); }
+unsigned int FlexiManipState::getVersion() const { return m_version.load(std::memory_order_acquire); }
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int streamFlexiVectors(MRS::ConstVectorLanes source, unsigned int count, float* dest)
+{
+	return MRS::convertVectorsToFloat(source, count, dest);
+}
+
+static_assert(sizeof(MVector) == 3 * sizeof(double), "MVector is expected to hold three contiguous doubles");
+
+unsigned int streamFlexiVectors(const MVector* source, unsigned int count, float* dest)
+{
+	const double* values = &source->x;
+	unsigned int valueCount = count * 3;
+
+	for (unsigned int i = 0; i < valueCount; ++i)
+		dest[i] = (float)values[i];
+
+	return valueCount;
+}
+
+unsigned int streamFlexiVectorPairs(MRS::ConstVectorLanes source, unsigned int count, float* dest)
+{
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		float* pair = dest + i * 6;
+		pair[0] = pair[3] = (float)source.x[i];
+		pair[1] = pair[4] = (float)source.y[i];
+		pair[2] = pair[5] = (float)source.z[i];
+	}
+
+	return count * 6;
+}
+
+unsigned int streamFlexiOffsetPairs(MRS::ConstVectorLanes points, MRS::ConstVectorLanes offsets, double scale, unsigned int count, float* dest)
+{
+	const double* pointLanes[3] = { points.x, points.y, points.z };
+	const double* offsetLanes[3] = { offsets.x, offsets.y, offsets.z };
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		float* pair = dest + i * 6;
+
+		for (unsigned int j = 0; j < 3; ++j)
+		{
+			double scaledOffset = offsetLanes[j][i] * scale;
+			pair[j] = (float)(pointLanes[j][i] + scaledOffset);
+			pair[j + 3] = (float)(pointLanes[j][i] - scaledOffset);
+		}
+	}
+
+	return count * 6;
+}
+
+unsigned int streamFlexiSegments(MRS::ConstVectorLanes points, MRS::ConstVectorLanes directions, float scale, unsigned int stride, unsigned int count, float* dest)
+{
+	const double* pointLanes[3] = { points.x, points.y, points.z };
+	const double* directionLanes[3] = { directions.x, directions.y, directions.z };
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		unsigned int index = i * stride;
+		float* segment = dest + i * 6;
+
+		for (unsigned int j = 0; j < 3; ++j)
+		{
+			segment[j] = (float)pointLanes[j][index];
+			segment[j + 3] = (float)pointLanes[j][index] + (float)directionLanes[j][index] * scale;
+		}
+	}
+
+	return count * 6;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+	// Blends a pixel from mid grey towards red by the given weight, max intensity simply reduces the intensity of the red color
+	inline void writeRampPixel(double pixelWeight, unsigned char* pixel)
+	{
+		const double maxIntensity = 0.9;
+		pixel[0] = (unsigned char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
+		pixel[1] = (unsigned char)((1.0 - pixelWeight * maxIntensity) * 128);
+		pixel[2] = pixel[1];
+		pixel[3] = 255;
+	}
+}
+
+void writeFlexiDefaultRamp(unsigned int pixelCount, unsigned char* pixels)
+{
+	for (unsigned int pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex)
+	{
+		unsigned char* pixel = pixels + pixelIndex * 4;
+		pixel[0] = 128;
+		pixel[1] = 128;
+		pixel[2] = 128;
+		pixel[3] = 255;
+	}
+}
+
+void writeFlexiStabilityRamp(double stability, bool isUpperBound, unsigned int pixelCount, unsigned char* pixels)
+{
+	// Constants
+	double lowThreshold = 0.8;
+	double influenceRatio = 0.25;
+	unsigned int influencedPixelCount = (int)(pixelCount * influenceRatio);
+
+	stability = std::abs(stability);
+	if (stability <= lowThreshold)
+	{
+		writeFlexiDefaultRamp(pixelCount, pixels);
+		return;
+	}
+
+	// Remap = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
+	double weightedStability = (stability - 0.8) / 0.2;
+
+	for (unsigned int pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex)
+	{
+		// Pixels nearest the bound receive the highest weight, pixels beyond the influenced region are mid grey
+		unsigned int boundOffset = isUpperBound ? pixelCount - 1 - pixelIndex : pixelIndex;
+		double pixelWeight = 0.0;
+		if (boundOffset < influencedPixelCount)
+		{
+			pixelWeight = (double)(influencedPixelCount - 1 - boundOffset) / (influencedPixelCount - 1) * weightedStability;
+			pixelWeight = pixelWeight * pixelWeight * (3 - 2 * pixelWeight);
+		}
+
+		writeRampPixel(pixelWeight, pixels + pixelIndex * 4);
+	}
+}
+
+void writeFlexiFalloffRamp(const SeExpr2::Curve<double>& falloff, unsigned int pixelCount, unsigned char* pixels)
+{
+	for (unsigned int pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex)
+	{
+		double falloffParam = (double)pixelIndex / (pixelCount - 1);
+		writeRampPixel(falloff.getValue(falloffParam), pixels + pixelIndex * 4);
+	}
+}
+
+void uploadFlexiRamp(unsigned char* pixels, unsigned int pixelCount, MHWRender::MTexture* texture)
+{
+	MImage image;
+	image.setPixels(pixels, pixelCount, 1);
+	texture->update(image, false);
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+void updateFlexiLineShader(MHWRender::MShaderInstance* shader, const char* lineWidthParameter, float lineWidth, const char* colorParameter, MColor color)
+{
+	shader->setParameter(colorParameter, &color.r);
+	// Not sure what first number does
+	float lineWidthArray[2] = { lineWidth, lineWidth };
+	shader->setParameter(lineWidthParameter, lineWidthArray);
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+#include <maya/MColor.h>
+#include <maya/MHWGeometry.h>
+#include <maya/MShaderManager.h>
+#include <maya/MTextureManager.h>
+#include <maya/MVector.h>
+
+#include <SeExpr2/Curve.h>
+
+#include "utils/vector_array_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Describes the connectivity of a draw item, an index buffer only needs to be regenerated when its topology changes
+// The wrap index and closed state only apply to curves which begin drawing from an offset sample
+struct FlexiTopology
+{
+	FlexiTopology(unsigned int vertexCount = 0, unsigned int wrapIndex = 0, bool isClosed = false) :
+		vertexCount{ vertexCount },
+		wrapIndex{ wrapIndex },
+		isClosed{ isClosed }
+	{}
+
+	bool operator==(const FlexiTopology& other) const { return vertexCount == other.vertexCount && wrapIndex == other.wrapIndex && isClosed == other.isClosed; }
+	bool operator!=(const FlexiTopology& other) const { return !(*this == other); }
+
+	unsigned int vertexCount;
+	unsigned int wrapIndex;
+	bool isClosed;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Owns a vertex buffer which persists between draw cycles of a sub-scene override
+	The underlying MVertexBuffer is only reallocated when the requested vertex count exceeds the current capacity
+	Otherwise its memory is reacquired and overwritten in place, vertices beyond the requested count are never indexed    */
+class FlexiVertexBuffer
+{
+public:
+	FlexiVertexBuffer(MHWRender::MGeometry::Semantic semantic, unsigned int dimension);
+	~FlexiVertexBuffer();
+
+	FlexiVertexBuffer(const FlexiVertexBuffer&) = delete;
+	FlexiVertexBuffer& operator=(const FlexiVertexBuffer&) = delete;
+
+	float* acquire(unsigned int vertexCount);
+	void commit(float* data);
+	void release();
+
+	MHWRender::MVertexBuffer* buffer() const;
+	unsigned int capacity() const;
+
+private:
+	MHWRender::MGeometry::Semantic m_semantic;
+	unsigned int m_dimension;
+	unsigned int m_capacity;
+	MHWRender::MVertexBuffer* m_buffer;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Owns an index buffer which persists between draw cycles of a sub-scene override
+	The index count of a buffer determines how many primitives are drawn, therefore it is always acquired at its exact size
+	The topology used to generate the indices is recorded on commit, allowing callers to skip regeneration until it changes    */
+class FlexiIndexBuffer
+{
+public:
+	FlexiIndexBuffer();
+	~FlexiIndexBuffer();
+
+	FlexiIndexBuffer(const FlexiIndexBuffer&) = delete;
+	FlexiIndexBuffer& operator=(const FlexiIndexBuffer&) = delete;
+
+	bool isValid(const FlexiTopology& topology) const;
+	unsigned int* acquire(unsigned int indexCount);
+	void commit(unsigned int* data, const FlexiTopology& topology);
+	void release();
+
+	MHWRender::MIndexBuffer* buffer() const;
+
+private:
+	FlexiTopology m_topology;
+	bool m_isValid;
+	MHWRender::MIndexBuffer* m_buffer;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+/*	Description
+	-----------
+	Holds the manipulator state which a tool context publishes for a single locator
+	Contexts write the state from the main thread when a manipulator is pressed or when their manipulators are rebuilt
+	The sub-scene override reads the state during its update, allowing it to draw feedback without querying the context through the command engine
+	The index identifies the active manipulator within the context (ie. the physical index of an adjustment or the position index of an up-vector), -1 if none is active
+
+	Considerations
+	--------------
+	The index is stored before the version is incremented, a reader which observes a new version is therefore guaranteed to observe the matching index
+	A reader may observe a newer index than its version, in which case the following update will observe the new version and read the index again    */
+class FlexiManipState
+{
+public:
+	FlexiManipState();
+
+	FlexiManipState(const FlexiManipState&) = delete;
+	FlexiManipState& operator=(const FlexiManipState&) = delete;
+
+	bool setActiveIndex(int activeIndex);
+
+	int getActiveIndex() const;
+	unsigned int getVersion() const;
+
+private:
+	std::atomic<int> m_activeIndex;
+	std::atomic<unsigned int> m_version;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Describes the inputs of a ramp texture, the texture only needs to be regenerated and uploaded when one of them changes
+// The context identifies which tool context the ramp was generated for, -1 signals that the texture holds no valid data
+struct FlexiRampKey
+{
+	FlexiRampKey(short context = -1, unsigned int manipStateVersion = 0, unsigned int drawDirtyCount = 0) :
+		context{ context },
+		manipStateVersion{ manipStateVersion },
+		drawDirtyCount{ drawDirtyCount }
+	{}
+
+	bool operator==(const FlexiRampKey& other) const { return context == other.context && manipStateVersion == other.manipStateVersion && drawDirtyCount == other.drawDirtyCount; }
+	bool operator!=(const FlexiRampKey& other) const { return !(*this == other); }
+
+	short context;
+	unsigned int manipStateVersion;
+	unsigned int drawDirtyCount;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Kernels which stream sample data from the curve caches into the float vertex buffers
+	The caches hold each component in its own lane (see MRS::VectorArray), therefore every component of a range of samples is read contiguously and converted in a single pass
+	This avoids constructing an intermediate MFloatVector for each vertex and allows the compiler to vectorize the conversion
+
+	Considerations
+	--------------
+	Each kernel writes to the given destination and returns the number of floats written, allowing callers to advance their pointer offset
+	Ranges are given as the lanes of the first sample and a sample count, a count of one can be used to write a single vector    */
+
+// Writes each vector once (ie. curve positions)
+unsigned int streamFlexiVectors(MRS::ConstVectorLanes source, unsigned int count, float* dest);
+// Writes each vector of an array of MVectors once (ie. hull positions), the components of each MVector are contiguous and are read as a flat array of doubles
+unsigned int streamFlexiVectors(const MVector* source, unsigned int count, float* dest);
+// Writes each vector twice (ie. normals which are shared by both vertices of a ribbon sample)
+unsigned int streamFlexiVectorPairs(MRS::ConstVectorLanes source, unsigned int count, float* dest);
+// Writes the pair (point + offset * scale, point - offset * scale) for each sample (ie. the vertices of a ribbon sample)
+unsigned int streamFlexiOffsetPairs(MRS::ConstVectorLanes points, MRS::ConstVectorLanes offsets, double scale, unsigned int count, float* dest);
+// Writes the pair (point, point + direction * scale) for every stride'th sample (ie. normal indicators), the sum is evaluated in single precision
+unsigned int streamFlexiSegments(MRS::ConstVectorLanes points, MRS::ConstVectorLanes directions, float scale, unsigned int stride, unsigned int count, float* dest);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Kernels which write the RGBA pixels of the ramp texture that is displayed along the ribbon whilst a tool context is active
+	Each pixel blends from a linear space mid grey towards red by its weight, the mid grey will be lighter in a color managed viewport
+
+	Considerations
+	--------------
+	The pixels are written as a single row of four channels per pixel, the caller is responsible for uploading the row once it has been written    */
+
+// Writes a mid grey to every pixel, used when there is no active manipulator or no texturing is required
+void writeFlexiDefaultRamp(unsigned int pixelCount, unsigned char* pixels);
+// Writes the stability of an up-vector, the pixels nearest the start or end of the curve are weighted by the stability once it exceeds a low threshold
+void writeFlexiStabilityRamp(double stability, bool isUpperBound, unsigned int pixelCount, unsigned char* pixels);
+// Writes the falloff of an adjustment, each pixel is weighted by the value of the falloff curve at its normalized position
+void writeFlexiFalloffRamp(const SeExpr2::Curve<double>& falloff, unsigned int pixelCount, unsigned char* pixels);
+// Uploads a row of pixels to the ramp texture
+void uploadFlexiRamp(unsigned char* pixels, unsigned int pixelCount, MHWRender::MTexture* texture);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+void updateFlexiLineShader(MHWRender::MShaderInstance* shader, const char* lineWidthParameter, float lineWidth, const char* colorParameter, MColor color);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
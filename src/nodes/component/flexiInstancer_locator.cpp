@@ -186,9 +186,18 @@
 	positionAdjustmentRepeat, twistAdjustmentRepeat, scaleAdjustmentRepeat - bool
 		Specifies whether to repeat the adjustment ramp so that it covers the curve's entire domain
 
+	forceSerialEvaluation - bool
+		Specifies whether to run every per-sample loop on the evaluating thread, designed to be used for debugging and profiling
+		The outputs are identical regardless of this setting
+
+	parallelGrainSize - int [1, inf)
+		Specifies the number of samples processed by each task when per-sample loops are distributed over Maya's thread pool
+		Smaller values improve load balancing for large instance counts, larger values reduce the scheduling overhead
+
 	outputLocalParticleArrayAttr - genericArray
 		Array of arrays containing local space data sampled along the curve
 		Attribute is designed to interface directly with the inputPoints attribute of Maya's instancer node type
+		The data object is updated in place, the constant channels are only rewritten when the instance count changes (see FlexiInstancer::writeParticleData)
 
 	outputWorldParticleArrayAttr - genericArray[]
 		Array of arrays containing world space data sampled along the curve
@@ -199,6 +208,7 @@
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 FlexiInstancer::FlexiInstancer() :
+	m_drawDirtyCount{ 0 },
 	m_instanceAddedCallbackId{ 0 }
 {}
 
@@ -225,6 +235,8 @@ FlexiInstancer::FlexiInstancer_Data::FlexiInstancer_Data() :
 	isScaleAdjustmentEnabled{ false },
 	isTwistAdjustmentEnabled{ false },
 	isDrawRibbonEnabled{ true },
+	dirtyStages{ kAllStages },
+	grainSize{ MRS::kDefaultGrainSize },
 	offset{ 0.0 },
 	parameterizationBlend{ 1.0 },
 	counterTwistBlend{ 0.0 },
@@ -319,6 +331,8 @@ MObject FlexiInstancer::scaleAdjustmentOffsetAttr;
 MObject FlexiInstancer::scaleAdjustmentFalloffModeAttr;
 MObject FlexiInstancer::scaleAdjustmentFalloffDistanceAttr;
 MObject FlexiInstancer::scaleAdjustmentRepeatAttr;
+MObject FlexiInstancer::forceSerialEvaluationAttr;
+MObject FlexiInstancer::parallelGrainSizeAttr;
 MObject FlexiInstancer::evalSinceDirtyAttr;
 MObject FlexiInstancer::drawSinceEvalAttr;
 MObject FlexiInstancer::outputLocalParticleArrayAttr;
@@ -483,6 +497,11 @@ MStatus FlexiInstancer::initialize()
 		scaleAdjustmentOffsetAttr, scaleAdjustmentFalloffModeAttr, scaleAdjustmentFalloffDistanceAttr, scaleAdjustmentRepeatAttr };
 	createCompoundAttribute(scaleAdjustmentCompoundAttr, scaleAdjustmentCompoundChildren, "scaleAdjustment", "scaleAdjustment", kArrayPreset);
 
+	// Evaluation attributes must not have any affects relation (ie. the results are identical whether or not evaluation is parallel)
+	createBoolAttribute(forceSerialEvaluationAttr, "forceSerialEvaluation", "forceSerialEvaluation", false, kDefaultPreset);
+	createIntAttribute(parallelGrainSizeAttr, "parallelGrainSize", "parallelGrainSize", MRS::kDefaultGrainSize, kDefaultPreset);
+	setMin<int>(parallelGrainSizeAttr, 1);
+
 	// State trackers are also internal only attributes
 	createBoolAttribute(evalSinceDirtyAttr, "evalSinceDirty", "evalSinceDirty", false, kReadable | kWritable | kCached | kHidden);
 	createBoolAttribute(drawSinceEvalAttr, "drawSinceEval", "drawSinceEval", false, kReadable | kWritable | kCached | kHidden);
@@ -529,6 +548,8 @@ MStatus FlexiInstancer::initialize()
 	addAttribute(twistAdjustmentCompoundAttr);
 	addAttribute(computeScaleAdjustmentsAttr);
 	addAttribute(scaleAdjustmentCompoundAttr);
+	addAttribute(forceSerialEvaluationAttr);
+	addAttribute(parallelGrainSizeAttr);
 	addAttribute(evalSinceDirtyAttr);
 	addAttribute(drawSinceEvalAttr);
 	addAttribute(outputLocalParticleArrayAttr);
@@ -613,74 +634,22 @@ MStatus FlexiInstancer::initialize()
 	-----------
 	Ensure the draw state of the node is dirtied when an input becomes dirty
 	It is then up to the draw override to ensure data is pulled from the graph and is up to date
-	ie. A dirty plug does not mean the node will automatically recompute as this only occurs when something downstream is pulling    */
+	ie. A dirty plug does not mean the node will automatically recompute as this only occurs when something downstream is pulling
+
+	The stages of the curve data which are invalidated by the plug are accumulated until the next evaluation    */
 MStatus FlexiInstancer::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
 {
-	// Highest priority attributes first
-	if (plug == controlPointsAttr ||
-		plug == upVectorAttr || plug == upVectorXAttr || plug == upVectorYAttr || plug == upVectorZAttr ||
-		plug == startTwistAttr ||
-		plug == endTwistAttr ||
-		plug == counterTwistAttr ||
-		plug == rollAttr ||
-		plug == offsetAttr ||
-		plug == normalUpVectorOverrideAttr || plug == normalUpVectorOverrideXAttr ||
-		plug == normalUpVectorOverrideYAttr || plug == normalUpVectorOverrideZAttr ||
-		plug == counterTwistUpVectorOverrideAttr || plug == counterTwistUpVectorOverrideXAttr ||
-		plug == counterTwistUpVectorOverrideYAttr || plug == counterTwistUpVectorOverrideZAttr ||
-		plug == normalUpVectorOverrideStateAttr ||
-		plug == counterTwistUpVectorOverrideStateAttr ||
-		plug == positionAdjustmentCompoundAttr ||
-		plug == positionAdjustmentRampAttr ||
-		plug == positionAdjustmentRampPositionAttr ||
-		plug == positionAdjustmentRampValueAttr ||
-		plug == positionAdjustmentRampInterpolationAttr ||
-		plug == positionAdjustmentValueAttr ||
-		plug == positionAdjustmentValueXAttr || plug == positionAdjustmentValueYAttr ||
-		plug == positionAdjustmentValueZAttr || plug == positionAdjustmentOffsetAttr ||
-		plug == positionAdjustmentFalloffModeAttr ||
-		plug == positionAdjustmentFalloffDistanceAttr ||
-		plug == positionAdjustmentRepeatAttr ||
-		plug == twistAdjustmentCompoundAttr ||
-		plug == twistAdjustmentRampAttr ||
-		plug == twistAdjustmentRampPositionAttr ||
-		plug == twistAdjustmentRampValueAttr ||
-		plug == twistAdjustmentRampInterpolationAttr ||
-		plug == twistAdjustmentValueAttr ||
-		plug == twistAdjustmentOffsetAttr ||
-		plug == twistAdjustmentFalloffModeAttr ||
-		plug == twistAdjustmentFalloffDistanceAttr ||
-		plug == twistAdjustmentRepeatAttr ||
-		plug == scaleAdjustmentCompoundAttr ||
-		plug == scaleAdjustmentRampAttr ||
-		plug == scaleAdjustmentRampPositionAttr ||
-		plug == scaleAdjustmentRampValueAttr ||
-		plug == scaleAdjustmentRampInterpolationAttr ||
-		plug == scaleAdjustmentValueAttr ||
-		plug == scaleAdjustmentValueXAttr || plug == scaleAdjustmentValueYAttr ||
-		plug == scaleAdjustmentValueZAttr || plug == scaleAdjustmentOffsetAttr ||
-		plug == scaleAdjustmentFalloffModeAttr ||
-		plug == scaleAdjustmentFalloffDistanceAttr ||
-		plug == scaleAdjustmentRepeatAttr ||
-		plug == computePositionAdjustmentsAttr ||
-		plug == computeTwistAdjustmentsAttr ||
-		plug == computeScaleAdjustmentsAttr ||
-		plug == counterTwistBlendAttr ||
-		plug == computeOrientationAttr ||
-		plug == closeCurveAttr ||
-		plug == discardLastInstanceAttr ||
-		plug == subdivisionsAttr ||
-		plug == parameterizationBlendAttr ||
-		plug == orientationModeAttr ||
-		plug == instanceCountAttr ||
-		// This is the only draw attribute which effects the resulting computation data as we are optimizing its disabled state
-		plug == drawRibbonAttr)
+	int32_t dirtyStages = 0;
+
+	if (getDirtyStages(plug.attribute(), dirtyStages))
 	{
+		m_data.dirtyStages |= dirtyStages;
+
 		// Attribute has no affects relationship
 		MDataBlock dataBlock = forceCache();
 		dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
 
-		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+		setDrawDirty();
 	}
 	else if ( // These attributes do not need to force evaluation
 		plug == customDrawSpaceTransformAttr ||
@@ -689,7 +658,7 @@ MStatus FlexiInstancer::setDependentsDirty(const MPlug& plug, MPlugArray& plugAr
 		plug == drawNormalsAttr ||
 		plug == drawHullAttr)
 	{
-		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+		setDrawDirty();
 	}
 
 	return MStatus::kSuccess;
@@ -699,95 +668,48 @@ MStatus FlexiInstancer::setDependentsDirty(const MPlug& plug, MPlugArray& plugAr
 	-----------
 	When the evaluation manager is in use, the draw state of the node is no longer dirtied
 	Maya does not propagate dirtiness when using an evaluation manager
-	We can use this callback to prepare the node for evaluation so that drawing will occur after compute has been run    */
+	We can use this callback to prepare the node for evaluation so that drawing will occur after compute has been run
+
+	Iterating the dirty plugs of the evaluation node is considerably cheaper than querying the existence of each input plug individually    */
 MStatus FlexiInstancer::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
 {
 	if (context.isNormal())
 	{
 		MStatus status;
+		bool isEvaluationRequired = false;
+		bool isDrawRequired = false;
+
+		for (MEvaluationNodeIterator iter = evaluationNode.iterator(&status); status && !iter.isDone(); iter.next())
+		{
+			MPlug plug = iter.plug();
+			int32_t dirtyStages = 0;
+
+			if (getDirtyStages(plug.attribute(), dirtyStages))
+			{
+				m_data.dirtyStages |= dirtyStages;
+				isEvaluationRequired = true;
+			}
+			else if (
+				plug == customDrawSpaceTransformAttr ||
+				plug == drawSpaceTransformationAttr ||
+				plug == drawCurveAttr ||
+				plug == drawNormalsAttr ||
+				plug == drawHullAttr)
+			{
+				isDrawRequired = true;
+			}
+		}
 
-		if ((evaluationNode.dirtyPlugExists(controlPointsAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(upVectorAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(upVectorXAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(upVectorYAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(upVectorZAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(startTwistAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(endTwistAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(rollAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(offsetAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(normalUpVectorOverrideAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(normalUpVectorOverrideXAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(normalUpVectorOverrideYAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(normalUpVectorOverrideZAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistUpVectorOverrideAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistUpVectorOverrideXAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistUpVectorOverrideYAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistUpVectorOverrideZAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(normalUpVectorOverrideStateAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistUpVectorOverrideStateAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentCompoundAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentRampAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentRampPositionAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentRampValueAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentRampInterpolationAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentValueAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentValueXAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentValueYAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentValueZAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentOffsetAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentFalloffModeAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentFalloffDistanceAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(positionAdjustmentRepeatAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentCompoundAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentRampAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentRampPositionAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentRampValueAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentRampInterpolationAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentValueAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentOffsetAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentFalloffModeAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentFalloffDistanceAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(twistAdjustmentRepeatAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentCompoundAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampPositionAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampValueAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampInterpolationAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueXAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueYAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueZAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentOffsetAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentFalloffModeAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentFalloffDistanceAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(scaleAdjustmentRepeatAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(computePositionAdjustmentsAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(computeTwistAdjustmentsAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(computeScaleAdjustmentsAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(counterTwistBlendAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(computeOrientationAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(closeCurveAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(discardLastInstanceAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(subdivisionsAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(parameterizationBlendAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(orientationModeAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(instanceCountAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(drawRibbonAttr, &status) && status))
+		if (isEvaluationRequired)
 		{
 			MDataBlock dataBlock = forceCache();
 			dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
 
-			MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+			setDrawDirty();
 		}
-		else if (
-			(evaluationNode.dirtyPlugExists(customDrawSpaceTransformAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(drawSpaceTransformationAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(drawCurveAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(drawNormalsAttr, &status) && status) ||
-			(evaluationNode.dirtyPlugExists(drawHullAttr, &status) && status))
+		else if (isDrawRequired)
 		{
-			MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+			setDrawDirty();
 		}
 	}
 
@@ -806,6 +728,16 @@ MStatus FlexiInstancer::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (!dataBlock.outputValue(evalSinceDirtyAttr).asBool())
 		computeCurveData(dataBlock);
 
+	// The local particle frames are shared by both outputs, they are only rebuilt if the frames or orientation mode have changed
+	if (m_data.dirtyStages & FlexiInstancer_Data::kParticlesStage)
+	{
+		computeParticleFrames(dataBlock);
+		m_data.dirtyStages &= ~FlexiInstancer_Data::kParticlesStage;
+	}
+
+	unsigned int instanceCount = m_data.instanceCount;
+	instanceCount = m_data.isDiscardLastEnabled ? instanceCount - 1 : instanceCount;
+
 	if (plug == outputWorldParticleArrayAttr)
 	{
 		// Frames must be transformed from local to world space
@@ -813,152 +745,25 @@ MStatus FlexiInstancer::compute(const MPlug& plug, MDataBlock& dataBlock)
 		MDagPath::getAPathTo(thisMObject(), path);
 		MMatrix worldTransform = path.inclusiveMatrix();
 
-		MArrayDataHandle outParticleArrayHandle = dataBlock.outputArrayValue(outputWorldParticleArrayAttr);
 		// Connection functions should prevent multiple elements
+		// The data object of each existing element is updated in place, the cached local particle frames are reused
+		MArrayDataHandle outParticleArrayHandle = dataBlock.outputArrayValue(outputWorldParticleArrayAttr);
 		unsigned int elementCount = outParticleArrayHandle.elementCount();
 		assert(elementCount <= 1);
-		MArrayDataBuilder builder(&dataBlock, outputWorldParticleArrayAttr, elementCount);
-		unsigned int instanceCount = m_data.instanceCount;
-		instanceCount = m_data.isDiscardLastEnabled ? instanceCount - 1 : instanceCount;
-		short orientationMode = dataBlock.inputValue(orientationModeAttr).asShort();
 
 		for (unsigned int i = 0; i < elementCount; i++)
 		{
-			MDataHandle outElementHandle = builder.addLast();
-			MFnArrayAttrsData fnData;
-			MObject outObj = fnData.create();
-
-			MIntArray intArray = fnData.intArray("id");
-			intArray.setLength(instanceCount);
-			MVectorArray positionArray = fnData.vectorArray("position");
-			positionArray.setLength(instanceCount);
-			MIntArray rotationTypeArray = fnData.intArray("rotationType");
-			rotationTypeArray.setLength(instanceCount);
-			MVectorArray aimDirectionArray = fnData.vectorArray("aimDirection");
-			aimDirectionArray.setLength(instanceCount);
-			MVectorArray aimWorldUpArray = fnData.vectorArray("aimWorldUp");
-			aimWorldUpArray.setLength(instanceCount);
-			MVectorArray scaleArray = fnData.vectorArray("scale");
-			scaleArray.setLength(instanceCount);
-
-			// Apply additional rotation based on the current orientation mode (values are not cached as they do not contribute to draw)
-			for (unsigned int j = 0; j < instanceCount; j++)
-			{	
-				MMatrix worldFrame = m_data.frames[j];
-				// The current matrix may be composed of non-uniform scaling which will skew any additional rotation we attempt to apply
-				// The scaling factor normalizes any existing scale on the pre-transposed value then applies the current scale to the transposed value
-				MVector scale = MRS::extractScale(worldFrame);
-				// Division by zero guard
-				double scaleFactor0 = scale.z == 0.0 ? 0.0 : scale.y / scale.z;
-				double scaleFactor1 = scale.y == 0.0 ? 0.0 : scale.z / scale.y;
-
-				if (orientationMode == 1 && j % 2 == 1)
-				{
-					// -90 degrees (clockwise)
-					worldFrame = m_data.frames[j];
-					worldFrame[1][0] = m_data.frames[j][2][0] * scaleFactor0 * -1;
-					worldFrame[1][1] = m_data.frames[j][2][1] * scaleFactor0 * -1;
-					worldFrame[1][2] = m_data.frames[j][2][2] * scaleFactor0 * -1;
-					worldFrame[2][0] = m_data.frames[j][1][0] * scaleFactor1;
-					worldFrame[2][1] = m_data.frames[j][1][1] * scaleFactor1;
-					worldFrame[2][2] = m_data.frames[j][1][2] * scaleFactor1;
-				}
-				else if (orientationMode == 2 && j % 2 == 1)
-				{
-					// +90 degrees (counter-clockwise)
-					worldFrame = m_data.frames[j];
-					worldFrame[1][0] = m_data.frames[j][2][0] * scaleFactor0;
-					worldFrame[1][1] = m_data.frames[j][2][1] * scaleFactor0;
-					worldFrame[1][2] = m_data.frames[j][2][2] * scaleFactor0;
-					worldFrame[2][0] = m_data.frames[j][1][0] * scaleFactor1 * -1;
-					worldFrame[2][1] = m_data.frames[j][1][1] * scaleFactor1 * -1;
-					worldFrame[2][2] = m_data.frames[j][1][2] * scaleFactor1 * -1;
-				}
-				worldFrame *= worldTransform;
-
-				intArray[j] = j;
-				positionArray[j] = worldFrame[3];
-				rotationTypeArray[j] = 1;
-				// MFnArrayAttrsData will normalize the vectors for us
-				aimDirectionArray[j] = worldFrame[0];
-				aimWorldUpArray[j] = worldFrame[1];
-				scaleArray[j] = MRS::extractScale(worldFrame);
-			}
-
-			outElementHandle.setMObject(outObj);
+			outParticleArrayHandle.jumpToArrayElement(i);
+			MDataHandle outElementHandle = outParticleArrayHandle.outputValue();
+			writeParticleData(outElementHandle, instanceCount, &worldTransform);
 		}
 
-		outParticleArrayHandle.set(builder);
 		outParticleArrayHandle.setAllClean();
 	}
 	else if (plug == outputLocalParticleArrayAttr)
 	{
 		MDataHandle outParticleDataArrayHandle = dataBlock.outputValue(outputLocalParticleArrayAttr);
-
-		MFnArrayAttrsData fnData;
-		MObject outObj = fnData.create();
-		unsigned int instanceCount = m_data.instanceCount;
-		instanceCount = m_data.isDiscardLastEnabled ? instanceCount - 1 : instanceCount;
-		short orientationMode = dataBlock.inputValue(orientationModeAttr).asShort();
-
-		MIntArray intArray = fnData.intArray("id");
-		intArray.setLength(instanceCount);
-		MVectorArray positionArray = fnData.vectorArray("position");
-		positionArray.setLength(instanceCount);
-		MIntArray rotationTypeArray = fnData.intArray("rotationType");
-		rotationTypeArray.setLength(instanceCount);
-		MVectorArray aimDirectionArray = fnData.vectorArray("aimDirection");
-		aimDirectionArray.setLength(instanceCount);
-		MVectorArray aimWorldUpArray = fnData.vectorArray("aimWorldUp");
-		aimWorldUpArray.setLength(instanceCount);
-		MVectorArray scaleArray = fnData.vectorArray("scale");
-		scaleArray.setLength(instanceCount);
-
-		// Apply additional rotation based on the current orientation mode (values are not cached as they do not contribute to draw)
-		for (unsigned int i = 0; i < instanceCount; i++)
-		{
-			MMatrix localFrame = m_data.frames[i];
-			// The current matrix may be composed of non-uniform scaling which will skew any additional rotation we attempt to apply
-			// The scaling factor normalizes any existing scale on the pre-transposed value then applies the current scale to the transposed value
-			MVector scale = MRS::extractScale(localFrame);
-			// Division by zero guard
-			double scaleFactor0 = scale.z == 0.0 ? 0.0 : scale.y / scale.z;
-			double scaleFactor1 = scale.y == 0.0 ? 0.0 : scale.z / scale.y;
-
-			if (orientationMode == 1 && i % 2 == 1)
-			{
-				// -90 degrees (clockwise)
-				localFrame = m_data.frames[i];
-				localFrame[1][0] = m_data.frames[i][2][0] * scaleFactor0 * -1;
-				localFrame[1][1] = m_data.frames[i][2][1] * scaleFactor0 * -1;
-				localFrame[1][2] = m_data.frames[i][2][2] * scaleFactor0 * -1;
-				localFrame[2][0] = m_data.frames[i][1][0] * scaleFactor1;
-				localFrame[2][1] = m_data.frames[i][1][1] * scaleFactor1;
-				localFrame[2][2] = m_data.frames[i][1][2] * scaleFactor1;
-			}
-			else if (orientationMode == 2 && i % 2 == 1)
-			{
-				// +90 degrees (counter-clockwise)
-				localFrame = m_data.frames[i];
-				localFrame[1][0] = m_data.frames[i][2][0] * scaleFactor0;
-				localFrame[1][1] = m_data.frames[i][2][1] * scaleFactor0;
-				localFrame[1][2] = m_data.frames[i][2][2] * scaleFactor0;
-				localFrame[2][0] = m_data.frames[i][1][0] * scaleFactor1 * -1;
-				localFrame[2][1] = m_data.frames[i][1][1] * scaleFactor1 * -1;
-				localFrame[2][2] = m_data.frames[i][1][2] * scaleFactor1 * -1;
-			}
-
-			intArray[i] = i;
-			positionArray[i] = localFrame[3];
-			rotationTypeArray[i] = 1;
-			// MFnArrayAttrsData will normalize the vectors for us
-			aimDirectionArray[i] = localFrame[0];
-			aimWorldUpArray[i] = localFrame[1];
-			scaleArray[i] = MRS::extractScale(localFrame);
-		}
-
-		outParticleDataArrayHandle.setMObject(outObj);
-		outParticleDataArrayHandle.setClean();
+		writeParticleData(outParticleDataArrayHandle, instanceCount, nullptr);
 	}
 
 	return MStatus::kSuccess;
@@ -990,473 +795,576 @@ MBoundingBox FlexiInstancer::boundingBox() const
 
 // ------ Helpers ------
 
+/*	Description
+	-----------
+	Determines which stages of the curve data are invalidated when the given input attribute becomes dirty
+	Returns false if the attribute does not contribute to the curve data or its outputs
+
+	Considerations
+	--------------
+	Attributes which are only read by the commands (eg. the counter-twist up-vector) will return true with no stages, ensuring compute is still triggered
+	The orientation mode only contributes to the particle outputs, it is therefore the only input which invalidates the particle stage alone
+	The counter-twist up-vector is only used by the stability and counter-twist calculations, it is read during every evaluation    */
+bool FlexiInstancer::getDirtyStages(const MObject& attr, int32_t& outStages) const
+{
+	outStages = 0;
+
+	if (attr == controlPointsAttr)
+		outStages = FlexiInstancer_Data::kControlPointsStage;
+	else if (attr == closeCurveAttr)
+		outStages = FlexiInstancer_Data::kControlPointsStage | FlexiInstancer_Data::kKnotsStage;
+	else if (attr == instanceCountAttr || attr == subdivisionsAttr)
+		outStages = FlexiInstancer_Data::kCountsStage;
+	else if (attr == offsetAttr || attr == parameterizationBlendAttr)
+		outStages = FlexiInstancer_Data::kParametersStage;
+	else if (attr == computeOrientationAttr)
+		outStages = FlexiInstancer_Data::kSamplesStage | FlexiInstancer_Data::kTwistAdjustmentsStage;
+	else if (
+		attr == upVectorAttr || attr == upVectorXAttr || attr == upVectorYAttr || attr == upVectorZAttr ||
+		attr == normalUpVectorOverrideCompoundAttr || attr == normalUpVectorOverrideAttr || attr == normalUpVectorOverrideXAttr ||
+		attr == normalUpVectorOverrideYAttr || attr == normalUpVectorOverrideZAttr ||
+		attr == normalUpVectorOverrideStateAttr)
+		outStages = FlexiInstancer_Data::kRmfStage;
+	else if (
+		attr == startTwistAttr ||
+		attr == endTwistAttr ||
+		attr == counterTwistAttr ||
+		attr == counterTwistBlendAttr ||
+		attr == rollAttr ||
+		attr == discardLastInstanceAttr ||
+		// This is the only draw attribute which effects the resulting computation data as we are optimizing its disabled state
+		attr == drawRibbonAttr)
+		outStages = FlexiInstancer_Data::kFramesStage;
+	else if (
+		attr == computePositionAdjustmentsAttr ||
+		attr == positionAdjustmentCompoundAttr ||
+		attr == positionAdjustmentRampAttr ||
+		attr == positionAdjustmentRampPositionAttr ||
+		attr == positionAdjustmentRampValueAttr ||
+		attr == positionAdjustmentRampInterpolationAttr ||
+		attr == positionAdjustmentValueAttr ||
+		attr == positionAdjustmentValueXAttr || attr == positionAdjustmentValueYAttr || attr == positionAdjustmentValueZAttr ||
+		attr == positionAdjustmentOffsetAttr ||
+		attr == positionAdjustmentFalloffModeAttr ||
+		attr == positionAdjustmentFalloffDistanceAttr ||
+		attr == positionAdjustmentRepeatAttr)
+		outStages = FlexiInstancer_Data::kPositionAdjustmentsStage;
+	else if (
+		attr == computeTwistAdjustmentsAttr ||
+		attr == twistAdjustmentCompoundAttr ||
+		attr == twistAdjustmentRampAttr ||
+		attr == twistAdjustmentRampPositionAttr ||
+		attr == twistAdjustmentRampValueAttr ||
+		attr == twistAdjustmentRampInterpolationAttr ||
+		attr == twistAdjustmentValueAttr ||
+		attr == twistAdjustmentOffsetAttr ||
+		attr == twistAdjustmentFalloffModeAttr ||
+		attr == twistAdjustmentFalloffDistanceAttr ||
+		attr == twistAdjustmentRepeatAttr)
+		outStages = FlexiInstancer_Data::kTwistAdjustmentsStage;
+	else if (
+		attr == computeScaleAdjustmentsAttr ||
+		attr == scaleAdjustmentCompoundAttr ||
+		attr == scaleAdjustmentRampAttr ||
+		attr == scaleAdjustmentRampPositionAttr ||
+		attr == scaleAdjustmentRampValueAttr ||
+		attr == scaleAdjustmentRampInterpolationAttr ||
+		attr == scaleAdjustmentValueAttr ||
+		attr == scaleAdjustmentValueXAttr || attr == scaleAdjustmentValueYAttr || attr == scaleAdjustmentValueZAttr ||
+		attr == scaleAdjustmentOffsetAttr ||
+		attr == scaleAdjustmentFalloffModeAttr ||
+		attr == scaleAdjustmentFalloffDistanceAttr ||
+		attr == scaleAdjustmentRepeatAttr)
+		outStages = FlexiInstancer_Data::kScaleAdjustmentsStage;
+	else if (
+		attr == counterTwistUpVectorOverrideCompoundAttr || attr == counterTwistUpVectorOverrideAttr || attr == counterTwistUpVectorOverrideXAttr ||
+		attr == counterTwistUpVectorOverrideYAttr || attr == counterTwistUpVectorOverrideZAttr ||
+		attr == counterTwistUpVectorOverrideStateAttr)
+		outStages = 0;
+	else if (attr == orientationModeAttr)
+		outStages = FlexiInstancer_Data::kParticlesStage;
+	else
+		return false;
+
+	return true;
+}
+
 /*	Description
 	------------
 	This function is responsible for computing curve data based on the current input values
 	The method is seperate from compute as our draw override needs to be able request updated data without cleaning the output attributes
-	Basic state tracking has been implemented so that the draw cycle can query whether the function has already been invoked by MPxNode::compute()    */
-void FlexiInstancer::computeCurveData(MDataBlock& dataBlock)
+	Basic state tracking has been implemented so that the draw cycle can query whether the function has already been invoked by MPxNode::compute()
+
+	Optimizations
+	-------------
+	The computation is split into stages, each of which is only rerun if it has been dirtied by an input or by a stage it depends on
+	- Knots > Lengths > Parameters > Samples > RMF > Frames
+	- Counts > Parameters
+	- Adjustments > Frames
+	eg. Changing the roll will only rerun the frame assembly, changing the up-vector will only rerun the RMF propagation and frame assembly
+
+	When only the positions of the control points have changed, the modified range is determined by comparing against the previous control points
+	- Only the arc-length table segments within the support of the modified control points are reintegrated
+	- Only the samples whose parameter has changed or whose parameter lies within the support of the modified control points are resampled
+	- If the curve is parameterized by its natural parameter, moving a single control point will therefore only resample its local spans
+	RMF propagation is inherently sequential, therefore it will always rerun in its entirety once any sample has changed
+
+	Sampling, arc-length lookups, the reflections between adjacent samples, normal reconstruction and frame assembly are independent per sample
+	- These loops are split into chunks which are distributed over Maya's thread pool (see MRS::parallelFor)
+	- Only the composition of the RMF reflections remains serial, each chunk writes to its own elements so the results match the serial path exactly
+
+	Args
+	----
+	requiredStages = Stages which must be computed, evaluation stops early if only the curve or orient stages are required (see DirtyStage)
+		Partial evaluations are used by the counter-twist and stability queries which evaluate the node under their own contexts
+		The skipped stages remain dirty and the state trackers are not updated as the data does not correspond to the draw or particle outputs    */
+void FlexiInstancer::computeCurveData(MDataBlock& dataBlock, int32_t requiredStages)
 {
-	bool previouslyClosed = m_data.isClosed;
-	unsigned int previousNumOfPoints = (int)m_data.controlPoints.size();
+	// Stages will propagate their dirty state to the stages which depend on them
+	int32_t dirtyStages = m_data.dirtyStages;
+
+	// --- Threading ---
+	// Independent per-sample loops are split into chunks of this size, the results do not depend on whether the chunks are run in parallel
+	m_data.grainSize = dataBlock.inputValue(forceSerialEvaluationAttr).asBool() ? MRS::kSerialGrainSize
+		: (unsigned)dataBlock.inputValue(parallelGrainSizeAttr).asInt();
 
 	// --- Counts ---
-	m_data.subdivisions = (unsigned)dataBlock.inputValue(subdivisionsAttr).asInt();
-	m_data.instanceCount = (unsigned)dataBlock.inputValue(instanceCountAttr).asInt();
-	m_data.parameterCount = m_data.instanceCount + (m_data.instanceCount - 1) * m_data.subdivisions;
-	assert(m_data.parameterCount >= 2);
+	if (dirtyStages & FlexiInstancer_Data::kCountsStage)
+	{
+		unsigned int previousSubdivisions = m_data.subdivisions;
+		unsigned int previousInstanceCount = m_data.instanceCount;
+		m_data.subdivisions = (unsigned)dataBlock.inputValue(subdivisionsAttr).asInt();
+		m_data.instanceCount = (unsigned)dataBlock.inputValue(instanceCountAttr).asInt();
+		m_data.parameterCount = m_data.instanceCount + (m_data.instanceCount - 1) * m_data.subdivisions;
+		assert(m_data.parameterCount >= 2);
+
+		// The arc-length table does not depend on the number of samples, only the parameters need to be recomputed
+		// The counter-twist solver dirties this stage for every sample, the samples are only invalidated if the counts have actually changed
+		if (m_data.subdivisions != previousSubdivisions || m_data.instanceCount != previousInstanceCount)
+			dirtyStages |= FlexiInstancer_Data::kParametersStage | FlexiInstancer_Data::kSamplesStage;
+	}
 
-	// --- Settings ---
-	m_data.isClosed = dataBlock.inputValue(closeCurveAttr).asBool();
-	m_data.offset = dataBlock.inputValue(offsetAttr).asDouble();
-	m_data.offset -= std::floor(m_data.offset);
-	// We will still calculate data for the last output, discarding will only occur in the main compute function
-	m_data.isDiscardLastEnabled = dataBlock.inputValue(discardLastInstanceAttr).asBool();
+	// --- Up-Vectors ---
+	// The orientation state is also required by the partial evaluations which do not reach the sample stage
+	m_data.isOrientEnabled = dataBlock.inputValue(computeOrientationAttr).asBool();
+	m_data.isNormalUpVectorOverrideEnabled = dataBlock.inputValue(normalUpVectorOverrideStateAttr).asBool();
+	m_data.vNormalUp = m_data.isNormalUpVectorOverrideEnabled ? dataBlock.inputValue(normalUpVectorOverrideAttr).asVector()
+		: dataBlock.inputValue(upVectorAttr).asVector();
+	m_data.vNormalUp.normalize();
+	m_data.isCounterTwistUpVectorOverrideEnabled = dataBlock.inputValue(counterTwistUpVectorOverrideStateAttr).asBool();
+	m_data.vCounterTwistUp = m_data.isCounterTwistUpVectorOverrideEnabled ? dataBlock.inputValue(counterTwistUpVectorOverrideAttr).asVector()
+		: dataBlock.inputValue(upVectorAttr).asVector();
+	m_data.vCounterTwistUp.normalize();
 
 	// --- Control Points ---
-	MDataHandle controlPointsHandle = dataBlock.inputValue(controlPointsAttr);
-	MObject controlPointsObj = controlPointsHandle.data();
-	MFnVectorArrayData fnVectorData(controlPointsObj);
-
-	// There must be at least 4 control points for an order=4 curve to have at least 1 segment
-	unsigned int numPoints = m_data.isClosed ? fnVectorData.length() + m_data.degree : fnVectorData.length();
-	numPoints = numPoints >= m_data.order ? numPoints : m_data.order;
-	m_data.controlPoints.resize(numPoints);
-	for (unsigned int i = 0; i < fnVectorData.length(); i++)
-		m_data.controlPoints[i] = fnVectorData[i];
-
-	// For the curve to be closed, the first and last degree number of control points must be wrapped (overlapping)
-	// Because the curve is cubic, there must be three overlapping points (the curve will close at the second of these overlapping points)
-	// It would make more sense for the curve to close at the first control point, therefore we will reorder the control points before we wrap them
-	if (m_data.isClosed)
+	// The inclusive range of control points which have been modified since the previous evaluation
+	bool isControlPointRangeDirty = false;
+	unsigned int lowerDirtyPointIndex = 0;
+	unsigned int upperDirtyPointIndex = 0;
+
+	if (dirtyStages & FlexiInstancer_Data::kControlPointsStage)
 	{
-		unsigned int numNonWrappedPoints = numPoints - m_data.degree;
+		bool previouslyClosed = m_data.isClosed;
+		unsigned int previousNumOfPoints = (unsigned)m_data.controlPoints.size();
+		m_data.isClosed = dataBlock.inputValue(closeCurveAttr).asBool();
+		m_data.previousControlPoints = m_data.controlPoints;
+
+		MDataHandle controlPointsHandle = dataBlock.inputValue(controlPointsAttr);
+		MObject controlPointsObj = controlPointsHandle.data();
+		MFnVectorArrayData fnVectorData(controlPointsObj);
+
+		// There must be at least 4 control points for an order=4 curve to have at least 1 segment
+		unsigned int numPoints = m_data.isClosed ? fnVectorData.length() + m_data.degree : fnVectorData.length();
+		numPoints = numPoints >= m_data.order ? numPoints : m_data.order;
+		m_data.controlPoints.resize(numPoints);
+		for (unsigned int i = 0; i < fnVectorData.length(); i++)
+			m_data.controlPoints[i] = fnVectorData[i];
+
+		// For the curve to be closed, the first and last degree number of control points must be wrapped (overlapping)
+		// Because the curve is cubic, there must be three overlapping points (the curve will close at the second of these overlapping points)
+		// It would make more sense for the curve to close at the first control point, therefore we will reorder the control points before we wrap them
+		if (m_data.isClosed)
+		{
+			unsigned int numNonWrappedPoints = numPoints - m_data.degree;
 
-		// Reorder
-		MVector vLastControlPoint = m_data.controlPoints[numNonWrappedPoints - 1];
-		for (auto it = m_data.controlPoints.rbegin() + m_data.degree; it != m_data.controlPoints.rend() - 1; ++it)
-			*it = *std::next(it);
-		m_data.controlPoints[0] = vLastControlPoint;
+			// Reorder
+			MVector vLastControlPoint = m_data.controlPoints[numNonWrappedPoints - 1];
+			for (auto it = m_data.controlPoints.rbegin() + m_data.degree; it != m_data.controlPoints.rend() - 1; ++it)
+				*it = *std::next(it);
+			m_data.controlPoints[0] = vLastControlPoint;
 
-		// Wrap
-		for (unsigned int i = 0; i < m_data.degree; i++)
-			m_data.controlPoints[numPoints - m_data.degree + i] = m_data.controlPoints[i];
-	}
+			// Wrap
+			for (unsigned int i = 0; i < m_data.degree; i++)
+				m_data.controlPoints[numPoints - m_data.degree + i] = m_data.controlPoints[i];
+		}
 
-	// --- Curve Constants ---
-	unsigned int n = numPoints - 1;
-	unsigned int numOfKnots = n + m_data.order + 1;
-	unsigned int numOfSpans = n - m_data.order + 2;
-	assert(numOfSpans > 0);
+		if (previousNumOfPoints != numPoints || previouslyClosed != m_data.isClosed)
+			dirtyStages |= FlexiInstancer_Data::kKnotsStage;
+		else
+		{
+			for (unsigned int i = 0; i < numPoints; i++)
+			{
+				if (m_data.controlPoints[i] != m_data.previousControlPoints[i])
+				{
+					lowerDirtyPointIndex = isControlPointRangeDirty ? lowerDirtyPointIndex : i;
+					upperDirtyPointIndex = i;
+					isControlPointRangeDirty = true;
+				}
+			}
+		}
+	}
 
 	// --- Knot Vector ---
-	if (previousNumOfPoints != numPoints || previouslyClosed != m_data.isClosed)
+	unsigned int n = (unsigned)m_data.controlPoints.size() - 1;
+
+	if (dirtyStages & FlexiInstancer_Data::kKnotsStage)
 	{
+		unsigned int numOfSpans = n - m_data.order + 2;
+		assert(numOfSpans > 0);
+
 		if (m_data.isClosed)
 			m_data.knots = m_curve.computeUnclampedKnotVector(n, m_data.degree);
 		else
 			m_data.knots = m_curve.computeClampedKnotVector(n, m_data.degree);
+
+		// When the curve is closed, its knot vector will be unclamped and its domain will be restricted
+		m_data.lowerBoundKnot = m_data.knots[m_data.degree];
+		m_data.upperBoundKnot = m_data.knots[n + 1];
+
+		dirtyStages |= FlexiInstancer_Data::kLengthsStage;
 	}
 
-	// When the curve is closed, its knot vector will be unclamped and its domain will be restricted
-	m_data.lowerBoundKnot = m_data.knots[m_data.degree];
-	m_data.upperBoundKnot = m_data.knots[n + 1];
+	// The remaining stages are deferred if only the curve is required
+	if (!(requiredStages & ~FlexiInstancer_Data::kCurveStages))
+	{
+		// The arc-length table can no longer be updated incrementally as the previous control points have been replaced
+		if (isControlPointRangeDirty)
+			dirtyStages |= FlexiInstancer_Data::kLengthsStage;
 
-	// --- Parameterization ---
-	m_data.parameterizationBlend = dataBlock.inputValue(parameterizationBlendAttr).asDouble();
+		m_data.dirtyStages = dirtyStages & ~FlexiInstancer_Data::kCurveStages;
+		return;
+	}
 
+	// --- Lengths ---
 	// Could be optimized for when arc-length parameterization is disabled however this is rare, therefore simplify for the general case
-	m_data.lengths.resize(m_data.parameterCount);
-	m_data.naturalParameters.resize(m_data.parameterCount);
-	m_data.arcLengthParameters.resize(m_data.parameterCount);
-	m_data.blendedParameters.resize(m_data.parameterCount);
+	if (dirtyStages & FlexiInstancer_Data::kLengthsStage)
+	{
+		m_data.arcLengthTable.build(m_data.degree, m_data.knots, m_data.controlPoints);
 
-	m_curve.computeLengths(m_data.degree, m_data.knots, m_data.controlPoints, m_data.lengths);
-	computeNaturalParameters();
-	computeArcLengthParameters();
+		dirtyStages |= FlexiInstancer_Data::kParametersStage | FlexiInstancer_Data::kSamplesStage;
+	}
+	else if (isControlPointRangeDirty)
+	{
+		m_data.arcLengthTable.update(m_data.controlPoints, lowerDirtyPointIndex, upperDirtyPointIndex);
 
-	double weightNatural = 1.0 - m_data.parameterizationBlend;
-	double weightArcLength = m_data.parameterizationBlend;
+		dirtyStages |= FlexiInstancer_Data::kParametersStage;
+	}
 
-	// If there is no offset, we have ensured the boundary conditions will be maintained
-	// If an offset is present, we have ensured the first and last sample parameters are equal (position/tangent will be equal)
-	for (unsigned int i = 0; i < m_data.parameterCount; ++i)
+	// --- Parameterization ---
+	if (dirtyStages & (FlexiInstancer_Data::kParametersStage | FlexiInstancer_Data::kSamplesStage))
 	{
-		m_data.blendedParameters[i] = m_data.naturalParameters[i] * weightNatural + m_data.arcLengthParameters[i] * weightArcLength;
-		// The above calculation causes a precision bug at the thresholds (results in the wrong knot interval being chosen)
-		// Because the offset changes the position of threshold data within the array, we must clamp all parameters
-		m_data.blendedParameters[i] = std::max(m_data.lowerBoundKnot, m_data.blendedParameters[i]);
-		m_data.blendedParameters[i] = std::min(m_data.upperBoundKnot, m_data.blendedParameters[i]);
-	}
+		m_data.offset = dataBlock.inputValue(offsetAttr).asDouble();
+		m_data.offset -= std::floor(m_data.offset);
+		m_data.parameterizationBlend = dataBlock.inputValue(parameterizationBlendAttr).asDouble();
+
+		m_data.naturalParameters.resize(m_data.parameterCount);
+		m_data.arcLengthParameters.resize(m_data.parameterCount);
+		// Retain the previous parameters so that we can determine which samples need to be recomputed
+		m_data.previousBlendedParameters.swap(m_data.blendedParameters);
+		m_data.blendedParameters.resize(m_data.parameterCount);
+
+		computeNaturalParameters();
+		computeArcLengthParameters();
+		computeNormalizedParameters();
+
+		double weightNatural = 1.0 - m_data.parameterizationBlend;
+		double weightArcLength = m_data.parameterizationBlend;
+
+		// If there is no offset, we have ensured the boundary conditions will be maintained
+		// If an offset is present, we have ensured the first and last sample parameters are equal (position/tangent will be equal)
+		for (unsigned int i = 0; i < m_data.parameterCount; ++i)
+		{
+			m_data.blendedParameters[i] = m_data.naturalParameters[i] * weightNatural + m_data.arcLengthParameters[i] * weightArcLength;
+			// The above calculation causes a precision bug at the thresholds (results in the wrong knot interval being chosen)
+			// Because the offset changes the position of threshold data within the array, we must clamp all parameters
+			m_data.blendedParameters[i] = std::max(m_data.lowerBoundKnot, m_data.blendedParameters[i]);
+			m_data.blendedParameters[i] = std::min(m_data.upperBoundKnot, m_data.blendedParameters[i]);
+		}
 
-	// The index at which the minimum parameter occurs will be used by the draw routine and the RMF calculation
-	auto minParamIter = std::min_element(m_data.blendedParameters.begin(), m_data.blendedParameters.end());
-	m_data.minParamIndex = (unsigned)std::distance(m_data.blendedParameters.begin(), minParamIter);
+		// The index at which the minimum parameter occurs will be used by the draw routine and the RMF calculation
+		auto minParamIter = std::min_element(m_data.blendedParameters.begin(), m_data.blendedParameters.end());
+		m_data.minParamIndex = (unsigned)std::distance(m_data.blendedParameters.begin(), minParamIter);
 
-	// --- Sample Curve ---
-	m_data.isOrientEnabled = dataBlock.inputValue(computeOrientationAttr).asBool();
-	m_data.sampleCount = m_data.isOrientEnabled ? m_data.parameterCount : m_data.instanceCount;
-	m_data.isNormalUpVectorOverrideEnabled = dataBlock.inputValue(normalUpVectorOverrideStateAttr).asBool();
-	m_data.vNormalUp = m_data.isNormalUpVectorOverrideEnabled ? dataBlock.inputValue(normalUpVectorOverrideAttr).asVector()
-		: dataBlock.inputValue(upVectorAttr).asVector();
-	m_data.vNormalUp.normalize();
-	m_data.isCounterTwistUpVectorOverrideEnabled = dataBlock.inputValue(counterTwistUpVectorOverrideStateAttr).asBool();
-	m_data.vCounterTwistUp = m_data.isCounterTwistUpVectorOverrideEnabled ? dataBlock.inputValue(counterTwistUpVectorOverrideAttr).asVector()
-		: dataBlock.inputValue(upVectorAttr).asVector();
-	m_data.vCounterTwistUp.normalize();
+		// --- Sample Curve ---
+		m_data.sampleCount = m_data.isOrientEnabled ? m_data.parameterCount : m_data.instanceCount;
 
-	if (m_data.isOrientEnabled)
-	{
-		// In order to draw the curve, the thresholds always need to be sampled at the bounds of the curve's parameter range
-		// We will store the data for these two extra samples separately as they will not contribute to the outputs
-		// RMF computation is iterative so we need to calculate a reflection for each parameter even if the frame count is small
-		// Arc-length parameterization also prevents optimizing for the local modification property of B-splines
-		m_data.points.resize(m_data.sampleCount);
-		m_data.tangents.resize(m_data.sampleCount);
-		m_data.rmfReflections.resize(m_data.sampleCount);
+		// A sample only needs to be recomputed if its parameter has changed or if it lies within the support of the modified control points
+		// If the range of control points is not dirty, the lower bound will exceed the upper bound and no parameter will lie within the support
+		bool isFullResample = (dirtyStages & FlexiInstancer_Data::kSamplesStage) || m_data.previousBlendedParameters.size() != m_data.parameterCount;
+		double lowerDirtyKnot = isControlPointRangeDirty ? m_data.knots[lowerDirtyPointIndex] : 1.0;
+		double upperDirtyKnot = isControlPointRangeDirty ? m_data.knots[upperDirtyPointIndex + m_data.order] : 0.0;
+
+		if (m_data.isOrientEnabled)
+		{
+			// In order to draw the curve, the thresholds always need to be sampled at the bounds of the curve's parameter range
+			// We will store the data for these two extra samples separately as they will not contribute to the outputs
+			// RMF computation is iterative so we need to calculate a reflection for each parameter even if the frame count is small
+			// Arc-length parameterization also prevents optimizing for the local modification property of B-splines
+			m_data.points.resize(m_data.sampleCount);
+			m_data.rmfTangents.resize(m_data.sampleCount);
+
+			m_data.vLowerBoundPoint = sampleCurve(m_data.lowerBoundKnot);
+			m_data.vRmfLowerBoundTangent = sampleFirstDerivative(m_data.lowerBoundKnot);
+			m_data.vRmfLowerBoundTangent.normalize();
+			m_data.vUpperBoundPoint = sampleCurve(m_data.upperBoundKnot);
+			m_data.vRmfUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
+			m_data.vRmfUpperBoundTangent.normalize();
+
+			// Gather the samples which need to be recomputed so that they can be evaluated as a single batch
+			m_data.resampleIndices.clear();
+			m_data.resampleParameters.clear();
+
+			for (unsigned int i = 0; i < m_data.sampleCount; ++i)
+			{
+				// The first sample will be resolved from the last sample if it does not contain the minimum parameter
+				if (i == 0 && m_data.minParamIndex != 0)
+					continue;
+
+				double t = m_data.blendedParameters[i];
+				if (isFullResample || t != m_data.previousBlendedParameters[i] || (t >= lowerDirtyKnot && t <= upperDirtyKnot))
+				{
+					m_data.resampleIndices.push_back(i);
+					m_data.resampleParameters.push_back(t);
+				}
+			}
+
+			// Each chunk of the gathered samples is evaluated as an independent batch
+			unsigned int resampleCount = (unsigned)m_data.resampleIndices.size();
+			m_data.resamplePoints.resize(resampleCount);
+			m_data.resampleTangents.resize(resampleCount);
+
+			MRS::parallelFor(0, resampleCount, m_data.grainSize, [this](unsigned int begin, unsigned int end)
+			{
+				sampleCurveBatch(&m_data.resampleParameters[begin], end - begin, &m_data.resamplePoints[begin], &m_data.resampleTangents[begin]);
+
+				for (unsigned int i = begin; i < end; ++i)
+				{
+					unsigned int sampleIndex = m_data.resampleIndices[i];
+					m_data.points.set(sampleIndex, m_data.resamplePoints[i]);
+					m_data.rmfTangents.set(sampleIndex, m_data.resampleTangents[i].normal());
+				}
+			});
+
+			// Resolve continuity between the last and first sample parameters
+			if (m_data.minParamIndex != 0)
+			{
+				m_data.points.copy(m_data.points, m_data.sampleCount - 1, 0, 1);
+				m_data.rmfTangents.copy(m_data.rmfTangents, m_data.sampleCount - 1, 0, 1);
+			}
+
+			dirtyStages |= FlexiInstancer_Data::kRmfStage;
+		}
+		else
+		{
+			m_data.points.resize(m_data.sampleCount);
+
+			m_data.resampleIndices.clear();
+			m_data.resampleParameters.clear();
+
+			for (unsigned int i = 0; i < m_data.sampleCount; i++)
+			{
+				unsigned int parameterIndex = i * (m_data.subdivisions + 1);
+				double t = m_data.blendedParameters[parameterIndex];
+				if (isFullResample || t != m_data.previousBlendedParameters[parameterIndex] || (t >= lowerDirtyKnot && t <= upperDirtyKnot))
+				{
+					m_data.resampleIndices.push_back(i);
+					m_data.resampleParameters.push_back(t);
+				}
+			}
+
+			unsigned int resampleCount = (unsigned)m_data.resampleIndices.size();
+			m_data.resamplePoints.resize(resampleCount);
 
+			MRS::parallelFor(0, resampleCount, m_data.grainSize, [this](unsigned int begin, unsigned int end)
+			{
+				sampleCurveBatch(&m_data.resampleParameters[begin], end - begin, &m_data.resamplePoints[begin]);
+
+				for (unsigned int i = begin; i < end; ++i)
+					m_data.points.set(m_data.resampleIndices[i], m_data.resamplePoints[i]);
+			});
+
+			// Determine the correct min index so that the draw override knows where to begin accessing data
+			// The largest index at which the minimum index can occur is parameterCount - 2, this will remap to sampleCount - 2
+			// This is because the last parameter overlaps the first and the first will always be found before the last
+			if (m_data.parameterCount - m_data.minParamIndex <= m_data.subdivisions + 1)
+				m_data.minParamIndex = 0;
+			else
+				m_data.minParamIndex = (int)std::ceil((double)m_data.minParamIndex / (m_data.subdivisions + 1));
+
+			// Compute additional draw data
+			m_data.vLowerBoundPoint = sampleCurve(m_data.lowerBoundKnot);
+			m_data.vLowerBoundTangent = sampleFirstDerivative(m_data.lowerBoundKnot);
+			m_data.vLowerBoundTangent.normalize();
+			m_data.vUpperBoundPoint = sampleCurve(m_data.upperBoundKnot);
+			m_data.vUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
+			m_data.vUpperBoundTangent.normalize();
+		}
+
+		dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	}
+
+	// --- Rotation Minimizing Frames ---
+	if (m_data.isOrientEnabled && (dirtyStages & FlexiInstancer_Data::kRmfStage))
+	{
 		// We want the principle normal to remain constant regardless of the offset
 		// Therefore we always begin the rotation minimization from the lower bound threshold of the curve
-		m_data.vLowerBoundPoint = sampleCurve(m_data.lowerBoundKnot);
-		m_data.vLowerBoundTangent = sampleFirstDerivative(m_data.lowerBoundKnot);
-		m_data.vLowerBoundTangent.normalize();
-		MVector vRight = m_data.vNormalUp ^ m_data.vLowerBoundTangent;
-		vRight.normalize();
-		m_data.vLowerBoundNormal = m_data.vLowerBoundTangent ^ vRight;
+		m_data.vRmfLowerBoundNormal = computeFlexiPrincipalNormal(m_data.vNormalUp, m_data.vRmfLowerBoundTangent);
 		// We cache a separate copy which will remain unaffected by adjustment data
-		m_data.vPrincipalNormal = m_data.vLowerBoundNormal;
-		m_data.vLowerBoundBinormal = m_data.vLowerBoundTangent ^ m_data.vLowerBoundNormal;
-		MQuaternion qPrincipalNormal{ m_data.vLowerBoundNormal.x, m_data.vLowerBoundNormal.y, m_data.vLowerBoundNormal.z, 0.0 };
+		m_data.vPrincipalNormal = m_data.vRmfLowerBoundNormal;
+		m_data.vRmfLowerBoundBinormal = m_data.vRmfLowerBoundTangent ^ m_data.vRmfLowerBoundNormal;
 
 		// Calculate the initial reflection quaternion that can be used to determine the normal at the minimum sample parameter
-		m_data.points[m_data.minParamIndex] = sampleCurve(m_data.blendedParameters[m_data.minParamIndex]);
-		m_data.tangents[m_data.minParamIndex] = sampleFirstDerivative(m_data.blendedParameters[m_data.minParamIndex]);
-		m_data.tangents[m_data.minParamIndex].normalize();
+		m_data.rmfReflections.resize(m_data.sampleCount);
 		m_data.rmfReflections[m_data.minParamIndex] = m_curve.computeDoubleReflectionRMF(m_data.vLowerBoundPoint, m_data.points[m_data.minParamIndex],
-			m_data.vLowerBoundTangent, m_data.tangents[m_data.minParamIndex]);
+			m_data.vRmfLowerBoundTangent, m_data.rmfTangents[m_data.minParamIndex]);
 		// If the offset is zero then the initial parameter will be equal to the principal parameter resulting in a zero quaternion (math unstable, must normalize)
 		m_data.rmfReflections[m_data.minParamIndex].normalizeIt();
 
+		// The reflection between each pair of adjacent samples is independent of all other reflections, only their composition is sequential
+		// The composition is an ordered scan which is kept serial, a parallel scan would reassociate the quaternion products and change the result
+		computeFlexiStepReflections(m_data.points, m_data.rmfTangents, m_data.grainSize, m_data.rmfStepReflections);
+
 		// Each sequential reflection is a composition of all previous reflections
 		for (unsigned int i = m_data.minParamIndex + 1; i < m_data.sampleCount; ++i)
-		{
-			m_data.points[i] = sampleCurve(m_data.blendedParameters[i]);
-			m_data.tangents[i] = sampleFirstDerivative(m_data.blendedParameters[i]);
-			m_data.tangents[i].normalize();
-
-			MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[i - 1], m_data.points[i], m_data.tangents[i - 1], m_data.tangents[i]);
-			m_data.rmfReflections[i] = MRS::quaternionMultiply(qReflection, m_data.rmfReflections[i - 1]);
-		}
+			m_data.rmfReflections[i] = MRS::quaternionMultiply(m_data.rmfStepReflections[i], m_data.rmfReflections[i - 1]);
 
 		// Resolve continuity between the last and first sample parameters
 		if (m_data.minParamIndex != 0)
-		{
-			m_data.points[0] = m_data.points[m_data.sampleCount - 1];
-			m_data.tangents[0] = m_data.tangents[m_data.sampleCount - 1];
 			m_data.rmfReflections[0] = m_data.rmfReflections[m_data.sampleCount - 1];
-		}
 
 		for (unsigned int i = 1; i < m_data.minParamIndex; ++i)
-		{
-			m_data.points[i] = sampleCurve(m_data.blendedParameters[i]);
-			m_data.tangents[i] = sampleFirstDerivative(m_data.blendedParameters[i]);
-			m_data.tangents[i].normalize();
-
-			MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[i - 1], m_data.points[i], m_data.tangents[i - 1], m_data.tangents[i]);
-			m_data.rmfReflections[i] = MRS::quaternionMultiply(qReflection, m_data.rmfReflections[i - 1]);
-		}
+			m_data.rmfReflections[i] = MRS::quaternionMultiply(m_data.rmfStepReflections[i], m_data.rmfReflections[i - 1]);
 		
 		// We are not optimizing the case where drawing of the ribbon is disabled (technically we could calculate normals at the specific output positions)
-		m_data.normals.resize(m_data.sampleCount);
-		m_data.binormals.resize(m_data.sampleCount);
-
-		for (unsigned int i = 0; i < m_data.sampleCount; ++i)
-		{
-			MQuaternion qReflectionComposition = m_data.rmfReflections[i];
-			MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-			MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-			MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-			MVector vNormal{ qNormal.x, qNormal.y, qNormal.z };
-			vNormal.normalize();
-
-			m_data.normals[i] = vNormal;
-			m_data.binormals[i] = m_data.tangents[i] ^ vNormal;
-		}
+		computeFlexiRmfNormals(m_data.vPrincipalNormal, m_data.rmfReflections, m_data.rmfTangents, m_data.grainSize, m_data.rmfNormals, m_data.rmfBinormals);
 
 		// Determine the upper bound data used for drawing the curve
-		m_data.vUpperBoundPoint = sampleCurve(m_data.upperBoundKnot);
-		m_data.vUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
-		m_data.vUpperBoundTangent.normalize();
 		unsigned int maxParamIndex = m_data.minParamIndex == 0 ? m_data.sampleCount - 1 : m_data.minParamIndex - 1;
-		MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[maxParamIndex], m_data.vUpperBoundPoint, m_data.tangents[maxParamIndex], m_data.vUpperBoundTangent);
+		MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[maxParamIndex], m_data.vUpperBoundPoint, 
+			m_data.rmfTangents[maxParamIndex], m_data.vRmfUpperBoundTangent);
 		// Again normalize in case there is no offset
 		qReflection.normalizeIt();
 		MQuaternion qReflectionComposition = MRS::quaternionMultiply(qReflection, m_data.rmfReflections[maxParamIndex]);
-		MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-		MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-		MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-		m_data.vUpperBoundNormal = MVector{ qNormal.x, qNormal.y, qNormal.z };
-		m_data.vUpperBoundNormal.normalize();
-		m_data.vUpperBoundBinormal = m_data.vUpperBoundTangent ^ m_data.vUpperBoundNormal;
-	}
-	else
-	{
-		m_data.points.resize(m_data.sampleCount);
+		m_data.vRmfUpperBoundNormal = reflectFlexiNormal(qReflectionComposition, m_data.vPrincipalNormal);
+		m_data.vRmfUpperBoundBinormal = m_data.vRmfUpperBoundTangent ^ m_data.vRmfUpperBoundNormal;
 
-		for (unsigned int i = 0; i < m_data.sampleCount; i++)
-		{
-			unsigned int parameterIndex = i * (m_data.subdivisions + 1);
-			m_data.points[i] = sampleCurve(m_data.blendedParameters[parameterIndex]);
-		}
+		dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	}
 
-		// Determine the correct min index so that the draw override knows where to begin accessing data
-		// The largest index at which the minimum index can occur is parameterCount - 2, this will remap to sampleCount - 2
-		// This is because the last parameter overlaps the first and the first will always be found before the last
-		if (m_data.parameterCount - m_data.minParamIndex <= m_data.subdivisions + 1)
-			m_data.minParamIndex = 0;
-		else
-			m_data.minParamIndex = (int)std::ceil((double)m_data.minParamIndex / (m_data.subdivisions + 1));
-
-		// Compute additional draw data
-		m_data.vLowerBoundPoint = sampleCurve(m_data.lowerBoundKnot);
-		m_data.vLowerBoundTangent = sampleFirstDerivative(m_data.lowerBoundKnot);
-		m_data.vLowerBoundTangent.normalize();
-		m_data.vUpperBoundPoint = sampleCurve(m_data.upperBoundKnot);
-		m_data.vUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
-		m_data.vUpperBoundTangent.normalize();
+	// The remaining stages are deferred if only the rotation minimizing frames are required
+	if (!(requiredStages & ~FlexiInstancer_Data::kOrientStages))
+	{
+		m_data.dirtyStages = dirtyStages & ~FlexiInstancer_Data::kOrientStages;
+		return;
 	}
 
 	// --- Position Adjustments ---
 	// Position adjustments will be applied regardless of whether orientation is enabled
-	m_data.isPositionAdjustmentEnabled = dataBlock.inputValue(computePositionAdjustmentsAttr).asBool();
-	if (m_data.isPositionAdjustmentEnabled)
-		computePositionAdjustments(dataBlock);
+	if (dirtyStages & FlexiInstancer_Data::kPositionAdjustmentsStage)
+	{
+		m_data.isPositionAdjustmentEnabled = dataBlock.inputValue(computePositionAdjustmentsAttr).asBool();
+		if (m_data.isPositionAdjustmentEnabled)
+			computePositionAdjustments(dataBlock);
+
+		dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	}
 
 	// --- Scale Adjustments ---
 	// Scale adjustments will be applied regardless of whether orientation is enabled
-	m_data.isScaleAdjustmentEnabled = dataBlock.inputValue(computeScaleAdjustmentsAttr).asBool();
-	if (m_data.isScaleAdjustmentEnabled)
-		computeScaleAdjustments(dataBlock);
+	if (dirtyStages & FlexiInstancer_Data::kScaleAdjustmentsStage)
+	{
+		m_data.isScaleAdjustmentEnabled = dataBlock.inputValue(computeScaleAdjustmentsAttr).asBool();
+		if (m_data.isScaleAdjustmentEnabled)
+			computeScaleAdjustments(dataBlock);
+
+		dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	}
 
 	// --- Twist Adjustments ---
 	// Twist adjustments will only be applied when orientation is enabled
-	m_data.isTwistAdjustmentEnabled = dataBlock.inputValue(computeTwistAdjustmentsAttr).asBool();
-	if (m_data.isTwistAdjustmentEnabled && m_data.isOrientEnabled)
-		computeTwistAdjustments(dataBlock);
+	if (dirtyStages & FlexiInstancer_Data::kTwistAdjustmentsStage)
+	{
+		m_data.isTwistAdjustmentEnabled = dataBlock.inputValue(computeTwistAdjustmentsAttr).asBool();
+		if (m_data.isTwistAdjustmentEnabled && m_data.isOrientEnabled)
+			computeTwistAdjustments(dataBlock);
+
+		dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	}
 
 	// --- Build Frames ---
 	// Always keep frames in local space as this is required by draw
 	// If compute needs world space transforms then it will be responsible for doing the conversions
 	// If the counter-twist cache has been built, any twist generated by the moving RMF will be back-propagated down the curve
-	m_data.frames.resize(m_data.instanceCount);
-
-	m_data.isDrawRibbonEnabled = dataBlock.inputValue(drawRibbonAttr).asBool();
-	m_data.counterTwistBlend = dataBlock.inputValue(counterTwistBlendAttr).asDouble();
-	m_data.counterTwist = dataBlock.inputValue(counterTwistAttr).asAngle().asRadians();
-	m_data.startTwist = dataBlock.inputValue(startTwistAttr).asAngle().asRadians();
-	m_data.endTwist = dataBlock.inputValue(endTwistAttr).asAngle().asRadians();
-	m_data.roll = dataBlock.inputValue(rollAttr).asAngle().asRadians();
-
-	if (m_data.isOrientEnabled)
+	if (dirtyStages & FlexiInstancer_Data::kFramesStage)
 	{
-		unsigned int increment = m_data.isDrawRibbonEnabled ? 1 : m_data.subdivisions + 1;
-		unsigned int outputIndex = 0;
-
-		for (unsigned int i = 0; i < m_data.sampleCount; i += increment)
+		m_data.frames.resize(m_data.instanceCount);
+
+		// We will still calculate data for the last output, discarding will only occur in the main compute function
+		m_data.isDiscardLastEnabled = dataBlock.inputValue(discardLastInstanceAttr).asBool();
+		m_data.isDrawRibbonEnabled = dataBlock.inputValue(drawRibbonAttr).asBool();
+		m_data.counterTwistBlend = dataBlock.inputValue(counterTwistBlendAttr).asDouble();
+		m_data.counterTwist = dataBlock.inputValue(counterTwistAttr).asAngle().asRadians();
+		m_data.startTwist = dataBlock.inputValue(startTwistAttr).asAngle().asRadians();
+		m_data.endTwist = dataBlock.inputValue(endTwistAttr).asAngle().asRadians();
+		m_data.roll = dataBlock.inputValue(rollAttr).asAngle().asRadians();
+
+		// The core adjusts the sample caches in place, they are therefore reset from the unadjusted RMF which is kept for the counter-twist cache
+		// Samples which are skipped when the ribbon is not drawn will hold the unadjusted data
+		if (m_data.isOrientEnabled)
 		{
-			bool isOutput = !m_data.isDrawRibbonEnabled || i % (m_data.subdivisions + 1) == 0;
-			// If the curve is closed, we remap the unclamped (restricted) sample parameter into the clamped (unrestricted) knot range
-			double normalizedParam = m_data.isClosed ? (m_data.naturalParameters[i] - m_data.lowerBoundKnot) / (m_data.upperBoundKnot - m_data.lowerBoundKnot)
-				: m_data.naturalParameters[i];
-			double totalWeightedTwist = 0.0;
-
-			// End twist
-			double endTwistWeight = normalizedParam;
-			double weightedEndTwist = m_data.endTwist * endTwistWeight;
-			totalWeightedTwist += weightedEndTwist;
-
-			// Start twist
-			double startTwistWeight = 1 - endTwistWeight;
-			double weightedStartTwist = m_data.startTwist * startTwistWeight;
-			totalWeightedTwist += weightedStartTwist;
-
-			// Counter twist
-			double counterTwistWeight = -1 * endTwistWeight * m_data.counterTwistBlend;
-			double weightedCounterTwist = m_data.counterTwist * counterTwistWeight;
-			totalWeightedTwist += weightedCounterTwist;
-
-			// Roll
-			totalWeightedTwist += m_data.roll;
-
-			// Twist adjustment
-			if (m_data.isTwistAdjustmentEnabled)
-			{
-				for (TwistAdjustment& twistAdjustment : m_data.twistAdjustments)
-				{
-					// The falloff curve has a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
-					double twistAdjustmentWeight = twistAdjustment.curve.getValue(normalizedParam);
-					double weightedTwistAdjustment = twistAdjustment.twist.asRadians() * twistAdjustmentWeight;
-					totalWeightedTwist += weightedTwistAdjustment;
-				}
-			}
-
-			// Scale adjustment
-			MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
-			if (m_data.isScaleAdjustmentEnabled)
-			{
-				for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-				{
-					double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(normalizedParam);
-					MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-					vScaleAdjustment += weightedScaleAdjustment;
-				}
-			}
-
-			// Position adjustment
-			MVector vPositionAdjustment{ 0.0, 0.0, 0.0 };
-			if (m_data.isPositionAdjustmentEnabled)
-			{
-				for (PositionAdjustment& positionAdjustment : m_data.positionAdjustments)
-				{
-					// The falloff curve has a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
-					double positionAdjustmentWeight = positionAdjustment.curve.getValue(normalizedParam);
-					MVector weightedPositionAdjustment = positionAdjustment.vPosition * positionAdjustmentWeight;
-					vPositionAdjustment += weightedPositionAdjustment;
-				}
-			}
-
-			MRS::Matrix44<double> orientFrame{ m_data.tangents[i], m_data.normals[i], m_data.binormals[i], m_data.points[i] };
-			// Apply rotation adjustments relative to the frame
-			orientFrame = orientFrame.preRotateInX(totalWeightedTwist);
-			// Apply position adjustments relative to rotation adjustments
-			orientFrame = orientFrame.preTranslate(&vPositionAdjustment.x);
-			// Apply scale adjustments relative to all other transformations
-			orientFrame = orientFrame.preScale(&vScaleAdjustment.x);
-
-			// Update the caches so that draw has the current data
-			// We are choosing not to update the point cache as changing the positions would need to affect the orient data for the ribbon draw
-			orientFrame[0].get(m_data.tangents[i]);
-			orientFrame[1].get(m_data.normals[i]);
-			orientFrame[2].get(m_data.binormals[i]);
-
-			if (isOutput)
-			{
-				MMatrix frame;
-				orientFrame.get(frame);
-				m_data.frames[outputIndex++] = frame;
-			}
+			m_data.tangents = m_data.rmfTangents;
+			m_data.normals = m_data.rmfNormals;
+			m_data.binormals = m_data.rmfBinormals;
 		}
 
-		// Transform lower threshold data
-		double totalWeightedLowerTwist = m_data.startTwist + m_data.roll;
-
-		if (m_data.isTwistAdjustmentEnabled)
-		{
-			for (TwistAdjustment& twistAdjustment : m_data.twistAdjustments)
-			{
-				double twistAdjustmentWeight = twistAdjustment.curve.getValue(0.0);
-				double weightedTwistAdjustment = twistAdjustment.twist.asRadians() * twistAdjustmentWeight;
-				totalWeightedLowerTwist += weightedTwistAdjustment;
-			}
-		}
+		buildFlexiFrames<FlexiPositionAdjustment>(m_data, m_data.grainSize);
 
-		MVector vLowerScaleAdjustment{ 1.0, 1.0, 1.0 };
-		if (m_data.isScaleAdjustmentEnabled)
+		if (m_data.isOrientEnabled)
 		{
-			for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-			{
-				double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(0.0);
-				MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-				vLowerScaleAdjustment += weightedScaleAdjustment;
-			}
-		}
-
-		MRS::Matrix33<double> lowerOrientFrame{ m_data.vLowerBoundTangent, m_data.vLowerBoundNormal, m_data.vLowerBoundBinormal };
-		lowerOrientFrame = lowerOrientFrame.preRotateInX(totalWeightedLowerTwist);
-		lowerOrientFrame = lowerOrientFrame.preScale(&vLowerScaleAdjustment.x);
+			// Transform lower threshold data
+			double totalWeightedLowerTwist = computeFlexiBaseTwist(m_data, 0.0);
 
-		lowerOrientFrame[0].get(m_data.vLowerBoundTangent);
-		lowerOrientFrame[1].get(m_data.vLowerBoundNormal);
-		lowerOrientFrame[2].get(m_data.vLowerBoundBinormal);
+			if (m_data.isTwistAdjustmentEnabled)
+				totalWeightedLowerTwist += sumFlexiAdjustments(m_data.twistAdjustments, 0.0);
 
-		// Transform upper threshold data
-		double totalWeightedUpperTwist = m_data.endTwist + m_data.roll + m_data.counterTwist * m_data.counterTwistBlend * -1;
+			MVector vLowerScaleAdjustment{ 1.0, 1.0, 1.0 };
+			if (m_data.isScaleAdjustmentEnabled)
+				vLowerScaleAdjustment += sumFlexiAdjustments(m_data.scaleAdjustments, 0.0);
 
-		if (m_data.isTwistAdjustmentEnabled)
-		{
-			for (TwistAdjustment& twistAdjustment : m_data.twistAdjustments)
-			{
-				double twistAdjustmentWeight = twistAdjustment.curve.getValue(1.0);
-				double weightedTwistAdjustment = twistAdjustment.twist.asRadians() * twistAdjustmentWeight;
-				totalWeightedUpperTwist += weightedTwistAdjustment;
-			}
-		}
+			adjustFlexiFrame(m_data.vRmfLowerBoundTangent, m_data.vRmfLowerBoundNormal, m_data.vRmfLowerBoundBinormal, totalWeightedLowerTwist, vLowerScaleAdjustment,
+				m_data.vLowerBoundTangent, m_data.vLowerBoundNormal, m_data.vLowerBoundBinormal);
 
-		MVector vUpperScaleAdjustment{ 1.0, 1.0, 1.0 };
-		if (m_data.isScaleAdjustmentEnabled)
-		{
-			for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-			{
-				double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(1.0);
-				MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-				vUpperScaleAdjustment += weightedScaleAdjustment;
-			}
-		}
+			// Transform upper threshold data
+			double totalWeightedUpperTwist = computeFlexiBaseTwist(m_data, 1.0);
 
-		MRS::Matrix33<double> upperOrientFrame{ m_data.vUpperBoundTangent, m_data.vUpperBoundNormal, m_data.vUpperBoundBinormal };
-		upperOrientFrame = upperOrientFrame.preRotateInX(totalWeightedUpperTwist);
-		upperOrientFrame = upperOrientFrame.preScale(&vUpperScaleAdjustment.x);
+			if (m_data.isTwistAdjustmentEnabled)
+				totalWeightedUpperTwist += sumFlexiAdjustments(m_data.twistAdjustments, 1.0);
 
-		upperOrientFrame[0].get(m_data.vUpperBoundTangent);
-		upperOrientFrame[1].get(m_data.vUpperBoundNormal);
-		upperOrientFrame[2].get(m_data.vUpperBoundBinormal);
-	}
-	else
-	{
-		for (unsigned int i = 0; i < m_data.sampleCount; i++)
-		{
-			MMatrix frame;
-			unsigned int parameterIndex = i * (m_data.subdivisions + 1);
-			// If the curve is closed, we remap the unclamped (restricted) sample parameter into the clamped (unrestricted) knot range
-			double normalizedParam = m_data.isClosed
-				? (m_data.naturalParameters[parameterIndex] - m_data.lowerBoundKnot) / (m_data.upperBoundKnot - m_data.lowerBoundKnot)
-				: m_data.naturalParameters[parameterIndex];
-
-			// Scale adjustment
-			MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
+			MVector vUpperScaleAdjustment{ 1.0, 1.0, 1.0 };
 			if (m_data.isScaleAdjustmentEnabled)
-			{
-				for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-				{
-					double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(normalizedParam);
-					MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-					vScaleAdjustment += weightedScaleAdjustment;
-				}
-			}
-
-			// Position adjustment
-			MVector vPositionAdjustment{ 0.0, 0.0, 0.0 };
-			if (m_data.isPositionAdjustmentEnabled)
-			{
-				for (PositionAdjustment& positionAdjustment : m_data.positionAdjustments)
-				{
-					// The falloff curve has a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
-					double positionAdjustmentWeight = positionAdjustment.curve.getValue(normalizedParam);
-					MVector weightedPositionAdjustment = positionAdjustment.vPosition * positionAdjustmentWeight;
-					vPositionAdjustment += weightedPositionAdjustment;
-				}
-			}
+				vUpperScaleAdjustment += sumFlexiAdjustments(m_data.scaleAdjustments, 1.0);
 
-			// Position
-			frame[3][0] = m_data.points[i].x + vPositionAdjustment.x; 
-			frame[3][1] = m_data.points[i].y + vPositionAdjustment.y; 
-			frame[3][2] = m_data.points[i].z + vPositionAdjustment.z;
-			// Scale
-			frame[0][0] = vScaleAdjustment.x; frame[1][1] = vScaleAdjustment.y; frame[2][2] = vScaleAdjustment.z;
-			m_data.frames[i] = frame;
+			adjustFlexiFrame(m_data.vRmfUpperBoundTangent, m_data.vRmfUpperBoundNormal, m_data.vRmfUpperBoundBinormal, totalWeightedUpperTwist, vUpperScaleAdjustment,
+				m_data.vUpperBoundTangent, m_data.vUpperBoundNormal, m_data.vUpperBoundBinormal);
 		}
 	}
 
+	// The particle stage is deferred until compute requests a particle output, draw does not depend on it
+	if (dirtyStages & FlexiInstancer_Data::kFramesStage)
+		dirtyStages |= FlexiInstancer_Data::kParticlesStage;
+
+	m_data.dirtyStages = dirtyStages & FlexiInstancer_Data::kParticlesStage;
+
 	// Update state trackers
 	dataBlock.outputValue(evalSinceDirtyAttr).setBool(true);
 	dataBlock.outputValue(drawSinceEvalAttr).setBool(false);
@@ -1474,150 +1382,14 @@ void FlexiInstancer::computeCurveData(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiInstancer::computePositionAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle positionAdjustmentArrayHandle = dataBlock.inputArrayValue(positionAdjustmentCompoundAttr);
-	unsigned int numPositionAdjustments = positionAdjustmentArrayHandle.elementCount();
-	m_data.positionAdjustments.resize(numPositionAdjustments);
-
-	for (unsigned int i = 0; i < numPositionAdjustments; ++i)
-	{
-		MDataHandle positionAdjustmentElementHandle = positionAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = positionAdjustmentElementHandle.child(positionAdjustmentRampAttr);
-		MDataHandle positionHandle = positionAdjustmentElementHandle.child(positionAdjustmentValueAttr);
-		MDataHandle offsetHandle = positionAdjustmentElementHandle.child(positionAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = positionAdjustmentElementHandle.child(positionAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = positionAdjustmentElementHandle.child(positionAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = positionAdjustmentElementHandle.child(positionAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		PositionAdjustment positionAdjustment;
-		positionAdjustment.vPosition = positionHandle.asVector();
-		positionAdjustment.offset = offsetHandle.asDouble();
-		positionAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		positionAdjustment.falloffMode = falloffModeHandle.asShort();
-		positionAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = positionAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		positionAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(positionAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(positionAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(positionAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (positionAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * positionAdjustment.falloffDistance + positionAdjustment.offset;
-				positionAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (positionAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * positionAdjustment.falloffDistance + positionAdjustment.offset;
-				positionAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (positionAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * positionAdjustment.falloffDistance + positionAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * positionAdjustment.falloffDistance + positionAdjustment.offset;
-				positionAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				positionAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (positionAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * positionAdjustment.falloffDistance + positionAdjustment.offset;
-				positionAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
+	// Frames must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	m_data.positionAdjustmentTable.invalidate();
 
-			rampArrayHandle.next();
-		}
-
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		std::sort(positionAdjustment.controlPoints.begin(), positionAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-		if (positionAdjustment.falloffMode == 1 || positionAdjustment.falloffMode == 2)
-		{
-			auto cvIter = positionAdjustment.controlPoints.begin();
-			while (cvIter != positionAdjustment.controlPoints.end() && cvIter->_pos < positionAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (positionAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = positionAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = positionAdjustment.controlPoints[positionAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (positionAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / positionAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / positionAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
-
-				positionAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						positionAdjustment.controlPoints.push_back(positionAdjustment.controlPoints[k]);
-						positionAdjustment.controlPoints.back()._pos -= positionAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					positionAdjustment.controlPoints.push_back(positionAdjustment.controlPoints[numTotalControlPoints - 1]);
-					positionAdjustment.controlPoints.back()._pos -= positionAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					positionAdjustment.controlPoints.push_back(positionAdjustment.controlPoints[0]);
-					positionAdjustment.controlPoints.back()._pos += positionAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						positionAdjustment.controlPoints.push_back(positionAdjustment.controlPoints[k]);
-						positionAdjustment.controlPoints.back()._pos += positionAdjustment.falloffDistance * (j + 1);
-					}
-				}
-
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < positionAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					positionAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
-
-		for (SeExpr2::Curve<double>::CV& controlPoint : positionAdjustment.controlPoints)
-			positionAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
-
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		positionAdjustment.curve.preparePoints();
-		m_data.positionAdjustments[i] = positionAdjustment;
-
-		positionAdjustmentArrayHandle.next();
-	}
-}
+	const FlexiAdjustmentAttributes attributes{ positionAdjustmentCompoundAttr, positionAdjustmentRampAttr, positionAdjustmentRampPositionAttr, positionAdjustmentRampValueAttr, positionAdjustmentRampInterpolationAttr,
+		positionAdjustmentValueAttr, positionAdjustmentOffsetAttr, positionAdjustmentFalloffDistanceAttr, positionAdjustmentFalloffModeAttr, positionAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.positionAdjustments);
+}
 
 /*	Description
 	-----------
@@ -1631,149 +1403,13 @@ void FlexiInstancer::computePositionAdjustments(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiInstancer::computeScaleAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle scaleAdjustmentArrayHandle = dataBlock.inputArrayValue(scaleAdjustmentCompoundAttr);
-	unsigned int numScaleAdjustments = scaleAdjustmentArrayHandle.elementCount();
-	m_data.scaleAdjustments.resize(numScaleAdjustments);
-
-	for (unsigned int i = 0; i < numScaleAdjustments; ++i)
-	{
-		MDataHandle scaleAdjustmentElementHandle = scaleAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentRampAttr);
-		MDataHandle scaleHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentValueAttr);
-		MDataHandle offsetHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		ScaleAdjustment scaleAdjustment;
-		scaleAdjustment.vScale = scaleHandle.asVector();
-		scaleAdjustment.offset = offsetHandle.asDouble();
-		scaleAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		scaleAdjustment.falloffMode = falloffModeHandle.asShort();
-		scaleAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = scaleAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		scaleAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(scaleAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(scaleAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(scaleAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (scaleAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (scaleAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (scaleAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				scaleAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (scaleAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-
-			rampArrayHandle.next();
-		}
-
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		std::sort(scaleAdjustment.controlPoints.begin(), scaleAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-		if (scaleAdjustment.falloffMode == 1 || scaleAdjustment.falloffMode == 2)
-		{
-			auto cvIter = scaleAdjustment.controlPoints.begin();
-			while (cvIter != scaleAdjustment.controlPoints.end() && cvIter->_pos < scaleAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (scaleAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = scaleAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = scaleAdjustment.controlPoints[scaleAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (scaleAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / scaleAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / scaleAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
-
-				scaleAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[k]);
-						scaleAdjustment.controlPoints.back()._pos -= scaleAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[numTotalControlPoints - 1]);
-					scaleAdjustment.controlPoints.back()._pos -= scaleAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[0]);
-					scaleAdjustment.controlPoints.back()._pos += scaleAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[k]);
-						scaleAdjustment.controlPoints.back()._pos += scaleAdjustment.falloffDistance * (j + 1);
-					}
-				}
-
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < scaleAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					scaleAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
-
-		for (SeExpr2::Curve<double>::CV& controlPoint : scaleAdjustment.controlPoints)
-			scaleAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
-
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		scaleAdjustment.curve.preparePoints();
-		m_data.scaleAdjustments[i] = scaleAdjustment;
+	// Frames must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	m_data.scaleAdjustmentTable.invalidate();
 
-		scaleAdjustmentArrayHandle.next();
-	}
+	const FlexiAdjustmentAttributes attributes{ scaleAdjustmentCompoundAttr, scaleAdjustmentRampAttr, scaleAdjustmentRampPositionAttr, scaleAdjustmentRampValueAttr, scaleAdjustmentRampInterpolationAttr,
+		scaleAdjustmentValueAttr, scaleAdjustmentOffsetAttr, scaleAdjustmentFalloffDistanceAttr, scaleAdjustmentFalloffModeAttr, scaleAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.scaleAdjustments);
 }
 
 /*	Description
@@ -1788,149 +1424,13 @@ void FlexiInstancer::computeScaleAdjustments(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiInstancer::computeTwistAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle twistAdjustmentArrayHandle = dataBlock.inputArrayValue(twistAdjustmentCompoundAttr);
-	unsigned int numTwistAdjustments = twistAdjustmentArrayHandle.elementCount();
-	m_data.twistAdjustments.resize(numTwistAdjustments);
-
-	for (unsigned int i = 0; i < numTwistAdjustments; ++i)
-	{
-		MDataHandle twistAdjustmentElementHandle = twistAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = twistAdjustmentElementHandle.child(twistAdjustmentRampAttr);
-		MDataHandle twistHandle = twistAdjustmentElementHandle.child(twistAdjustmentValueAttr);
-		MDataHandle offsetHandle = twistAdjustmentElementHandle.child(twistAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = twistAdjustmentElementHandle.child(twistAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = twistAdjustmentElementHandle.child(twistAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = twistAdjustmentElementHandle.child(twistAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		TwistAdjustment twistAdjustment;
-		twistAdjustment.twist = twistHandle.asAngle();
-		twistAdjustment.offset = offsetHandle.asDouble();
-		twistAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		twistAdjustment.falloffMode = falloffModeHandle.asShort();
-		twistAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = twistAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		twistAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(twistAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(twistAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(twistAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (twistAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (twistAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (twistAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				twistAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (twistAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-
-			rampArrayHandle.next();
-		}
+	// Frames must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.dirtyStages |= FlexiInstancer_Data::kFramesStage;
+	m_data.twistAdjustmentTable.invalidate();
 
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		if (twistAdjustment.falloffMode == 1 || twistAdjustment.falloffMode == 2)
-		{
-			std::sort(twistAdjustment.controlPoints.begin(), twistAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-			auto cvIter = twistAdjustment.controlPoints.begin();
-			while (cvIter != twistAdjustment.controlPoints.end() && cvIter->_pos < twistAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (twistAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = twistAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = twistAdjustment.controlPoints[twistAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (twistAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / twistAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / twistAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
-
-				twistAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[k]);
-						twistAdjustment.controlPoints.back()._pos -= twistAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[numTotalControlPoints - 1]);
-					twistAdjustment.controlPoints.back()._pos -= twistAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[0]);
-					twistAdjustment.controlPoints.back()._pos += twistAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[k]);
-						twistAdjustment.controlPoints.back()._pos += twistAdjustment.falloffDistance * (j + 1);
-					}
-				}
-
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < twistAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					twistAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
-
-		for (SeExpr2::Curve<double>::CV& controlPoint : twistAdjustment.controlPoints)
-			twistAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
-
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		twistAdjustment.curve.preparePoints();
-		m_data.twistAdjustments[i] = twistAdjustment;
-
-		twistAdjustmentArrayHandle.next();
-	}
+	const FlexiAdjustmentAttributes attributes{ twistAdjustmentCompoundAttr, twistAdjustmentRampAttr, twistAdjustmentRampPositionAttr, twistAdjustmentRampValueAttr, twistAdjustmentRampInterpolationAttr,
+		twistAdjustmentValueAttr, twistAdjustmentOffsetAttr, twistAdjustmentFalloffDistanceAttr, twistAdjustmentFalloffModeAttr, twistAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.twistAdjustments);
 }
 
 void FlexiInstancer::computeNaturalParameters()
@@ -1955,70 +1455,221 @@ void FlexiInstancer::computeNaturalParameters()
 		m_data.naturalParameters[m_data.parameterCount - 1] = m_data.naturalParameters[0];
 }
 
+/*	Description
+	-----------
+	Remaps the natural parameters into the clamped knot range which the adjustment falloff curves are defined over
+	The falloff curves have a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
+	The adjustment tables are invalidated if any parameter has changed, moving the control points alone will therefore not trigger a rebuild    */
+void FlexiInstancer::computeNormalizedParameters()
+{
+	bool isChanged = m_data.normalizedParameters.size() != m_data.parameterCount;
+	m_data.normalizedParameters.resize(m_data.parameterCount);
+
+	for (unsigned int i = 0; i < m_data.parameterCount; i++)
+	{
+		// If the curve is closed, we remap the unclamped (restricted) sample parameter into the clamped (unrestricted) knot range
+		double normalizedParam = m_data.isClosed ? (m_data.naturalParameters[i] - m_data.lowerBoundKnot) / (m_data.upperBoundKnot - m_data.lowerBoundKnot)
+			: m_data.naturalParameters[i];
+
+		isChanged = isChanged || m_data.normalizedParameters[i] != normalizedParam;
+		m_data.normalizedParameters[i] = normalizedParam;
+	}
+
+	if (isChanged)
+	{
+		m_data.positionAdjustmentTable.invalidate();
+		m_data.twistAdjustmentTable.invalidate();
+		m_data.scaleAdjustmentTable.invalidate();
+	}
+}
+
 void FlexiInstancer::computeArcLengthParameters()
 {
 	assert(m_data.parameterCount >= 2);
 
-	// Using the total arc-length, iterate over uniform increments and approximate values of t
-	// We are essentially solving the function L^-1(s) described above, however our values for s are not normalized (the concept remains the same)
+	// Iterate over uniform increments of the normalized arc-length and solve the function L^-1(s) described above
+	// The table integrates the curve's restricted parameter range, the resulting parameter is normalized and must be remapped into this range
+	// Remap: [0, 1] -> [lowerBoundKnot, upperBoundKnot] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
 	double percent = m_data.offset;
-	double totalLength = m_data.lengths[m_data.parameterCount - 1];
 	double step = 1.0 / (double)(m_data.parameterCount - 1);
+	double tDelta = m_data.upperBoundKnot - m_data.lowerBoundKnot;
 
+	// The increments are accumulated serially, each lookup is then independent and can be solved in parallel
 	for (unsigned int i = 0; i < m_data.parameterCount; i++)
 	{
-		double targetLength = percent * totalLength;
+		m_data.arcLengthParameters[i] = percent;
 
-		// Complete a binary search to find the closest tLength which is smaller than the targetLength
-		// We then just need to retrieve the t value which was used to calulate the tLength
-		unsigned int low = 0;
-		unsigned int high = m_data.parameterCount - 1;
-		unsigned int index;
-		double tLength;
+		percent += step;
+		percent = percent > 1.0 ? percent - 1.0 : percent;
+	}
 
-		while (low < high)
+	MRS::parallelFor(0, m_data.parameterCount, m_data.grainSize, [this, tDelta](unsigned int begin, unsigned int end)
+	{
+		for (unsigned int i = begin; i < end; i++)
 		{
-			index = low + (high - low) / 2;
-			tLength = m_data.lengths[index];
+			double t = m_data.arcLengthTable.arcLengthToNaturalParameter(m_data.arcLengthParameters[i]);
+			m_data.arcLengthParameters[i] = m_data.lowerBoundKnot + t * tDelta;
+		}
+	});
 
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
+	// Ensure precision error does not interfere with boundary conditions
+	if (m_data.offset == 0.0)
+		m_data.arcLengthParameters[m_data.parameterCount - 1] = m_data.upperBoundKnot;
+	else
+		m_data.arcLengthParameters[m_data.parameterCount - 1] = m_data.arcLengthParameters[0];
+}
+
+/*	Description
+	-----------
+	Computes the local particle frames by applying the current orientation mode to the frames of the curve data
+	The results are cached so that each particle output only needs to read them (ie. the world output no longer rebuilds the local data)    */
+void FlexiInstancer::computeParticleFrames(MDataBlock& dataBlock)
+{
+	short orientationMode = dataBlock.inputValue(orientationModeAttr).asShort();
+	unsigned int instanceCount = (unsigned)m_data.frames.size();
+	m_data.particleFrames.resize(instanceCount);
+	m_data.particleScales.resize(instanceCount);
+
+	// The scales of each chunk are extracted by the batch kernels, the particle scales initially hold the scales of the frames used by the orientation mode
+	MRS::parallelFor(0, instanceCount, m_data.grainSize, [this, orientationMode](unsigned int begin, unsigned int end)
+	{
+		if (orientationMode != 0)
+			MRS::extractScaleBatch(&m_data.frames[begin], end - begin, &m_data.particleScales[begin]);
+
+		for (unsigned int i = begin; i < end; i++)
+		{
+			const MMatrix& frame = m_data.frames[i];
+			MMatrix& particleFrame = m_data.particleFrames[i];
+			particleFrame = frame;
+
+			// Apply additional rotation to every second instance based on the current orientation mode
+			if (orientationMode != 0 && i % 2 == 1)
+			{
+				// The current matrix may be composed of non-uniform scaling which will skew any additional rotation we attempt to apply
+				// The scaling factor normalizes any existing scale on the pre-transposed value then applies the current scale to the transposed value
+				const MVector& scale = m_data.particleScales[i];
+				// Division by zero guard
+				double scaleFactor0 = scale.z == 0.0 ? 0.0 : scale.y / scale.z;
+				double scaleFactor1 = scale.y == 0.0 ? 0.0 : scale.z / scale.y;
+				// Mode 1 rotates by -90 degrees (clockwise), mode 2 rotates by +90 degrees (counter-clockwise)
+				double sign0 = orientationMode == 1 ? -1.0 : 1.0;
+				double sign1 = -sign0;
+
+				particleFrame[1][0] = frame[2][0] * scaleFactor0 * sign0;
+				particleFrame[1][1] = frame[2][1] * scaleFactor0 * sign0;
+				particleFrame[1][2] = frame[2][2] * scaleFactor0 * sign0;
+				particleFrame[2][0] = frame[1][0] * scaleFactor1 * sign1;
+				particleFrame[2][1] = frame[1][1] * scaleFactor1 * sign1;
+				particleFrame[2][2] = frame[1][2] * scaleFactor1 * sign1;
+			}
 		}
 
-		// The last iteration of the search may cause the index to increase due to the low value increasing on the second last iteration
-		// In this case, the tLength at the current index may be larger than the targetLength
-		// We must complete one final check and decrement the index if this was the case
-		if (tLength > targetLength)
-			index -= 1;
+		MRS::extractScaleBatch(&m_data.particleFrames[begin], end - begin, &m_data.particleScales[begin]);
+	});
+}
 
-		assert(m_data.lengths[index] <= targetLength);
-		assert(m_data.lengths[index + 1] >= targetLength);
+/*	Description
+	-----------
+	Writes the particle data for each instance into the MFnArrayAttrsData object held by the output handle
+	As with every output data object, it is written in place and is only created if the handle is empty (see the ownership rule in node_utils.cpp)
+	- The cached local particle frames and scales are reused between evaluations, only the channels of the output object are written
+	- The id and rotationType channels are constant for a given instance count, they are only written when the length of the id channel differs
 
-		// To retrieve the t value for the tLength we can calculate, t = index / (parameterCount - 1)
-		// However, we can increase the accuracy by determining the skew of the target length in relation to the lengths before and after
-		double tLengthBefore = m_data.lengths[index];
-		double tLengthAfter = m_data.lengths[index + 1];
-		double t = ((double)index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / ((double)m_data.parameterCount - 1.0);
+	The channels are only exposed as Maya arrays, which are not thread safe, their storage is therefore resolved on the evaluating thread
+	- Maya arrays hold their elements contiguously, the workers write through the pointers to the first element of each channel
 
-		// The lengths used in the above calculation were computed using the curve's restricted parameter range
-		// However the resulting parameter is now in an unrestricted range and needs to be remapped into this restricted range
-		// Remap: [0, 1] -> [lowerBoundKnot, upperBoundKnot] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-		if (m_data.isClosed)
-			t = m_data.lowerBoundKnot + t * (m_data.upperBoundKnot - m_data.lowerBoundKnot);
+	If a world transform is given, each block of cached local particle frames is transformed by the matrix batch kernels
+	- The world transform is shared as the right-hand side of every frame in the block
+	- The scale is then extracted from the transformed frames by the batch kernels, which is equivalent to extracting the scale of (localFrame * worldTransform)
 
-		m_data.arcLengthParameters[i] = t;
+	Args
+	----
+	worldTransform = Transform applied to the local particle frames, pass nullptr to write the local particle data    */
+void FlexiInstancer::writeParticleData(MDataHandle& outHandle, unsigned int instanceCount, const MMatrix* worldTransform) const
+{
+	assert(m_data.particleFrames.size() >= instanceCount);
 
-		percent += step;
-		percent = percent > 1.0 ? percent - 1.0 : percent;
+	MFnArrayAttrsData fnData;
+	MObject dataObj = outHandle.data();
+	if (dataObj.isNull() || !fnData.setObject(dataObj))
+		dataObj = fnData.create();
+
+	MIntArray idArray = fnData.intArray("id");
+	if (idArray.length() != instanceCount)
+	{
+		MIntArray rotationTypeArray = fnData.intArray("rotationType");
+		idArray.setLength(instanceCount);
+		rotationTypeArray.setLength(instanceCount);
+
+		for (unsigned int i = 0; i < instanceCount; i++)
+		{
+			idArray[i] = i;
+			rotationTypeArray[i] = 1;
+		}
 	}
 
-	// Ensure precision error does not interfere with boundary conditions
-	if (m_data.offset == 0.0)
-		m_data.arcLengthParameters[m_data.parameterCount - 1] = m_data.upperBoundKnot;
-	else
-		m_data.arcLengthParameters[m_data.parameterCount - 1] = m_data.arcLengthParameters[0];
+	MVectorArray positionArray = fnData.vectorArray("position");
+	positionArray.setLength(instanceCount);
+	MVectorArray aimDirectionArray = fnData.vectorArray("aimDirection");
+	aimDirectionArray.setLength(instanceCount);
+	MVectorArray aimWorldUpArray = fnData.vectorArray("aimWorldUp");
+	aimWorldUpArray.setLength(instanceCount);
+	MVectorArray scaleArray = fnData.vectorArray("scale");
+	scaleArray.setLength(instanceCount);
+
+	if (instanceCount > 0)
+	{
+		MVector* positions = &positionArray[0];
+		MVector* aimDirections = &aimDirectionArray[0];
+		MVector* aimWorldUps = &aimWorldUpArray[0];
+		MVector* scales = &scaleArray[0];
+
+		// MFnArrayAttrsData will normalize the aim vectors for us
+		if (worldTransform)
+		{
+			const MMatrix& transform = *worldTransform;
+
+			// Each chunk is processed in blocks so that the batch kernels can stage their results in fixed size buffers
+			MRS::parallelFor(0, instanceCount, m_data.grainSize, [&](unsigned int begin, unsigned int end)
+			{
+				const unsigned int blockSize = MRS::kMatrixBatchGrainSize;
+				MMatrix worldFrames[blockSize];
+
+				for (unsigned int first = begin; first < end; first += blockSize)
+				{
+					unsigned int count = std::min(end - first, blockSize);
+					MRS::multiplyMatrixBatch(&m_data.particleFrames[first], transform, count, worldFrames);
+					MRS::extractScaleBatch(worldFrames, count, scales + first);
+
+					for (unsigned int k = 0; k < count; k++)
+					{
+						const MMatrix& worldFrame = worldFrames[k];
+						unsigned int i = first + k;
+						positions[i] = MVector{ worldFrame[3][0], worldFrame[3][1], worldFrame[3][2] };
+						aimDirections[i] = MVector{ worldFrame[0][0], worldFrame[0][1], worldFrame[0][2] };
+						aimWorldUps[i] = MVector{ worldFrame[1][0], worldFrame[1][1], worldFrame[1][2] };
+					}
+				}
+			});
+		}
+		else
+		{
+			MRS::parallelFor(0, instanceCount, m_data.grainSize, [&](unsigned int begin, unsigned int end)
+			{
+				for (unsigned int i = begin; i < end; i++)
+				{
+					const MMatrix& particleFrame = m_data.particleFrames[i];
+					positions[i] = MVector{ particleFrame[3][0], particleFrame[3][1], particleFrame[3][2] };
+					aimDirections[i] = MVector{ particleFrame[0][0], particleFrame[0][1], particleFrame[0][2] };
+					aimWorldUps[i] = MVector{ particleFrame[1][0], particleFrame[1][1], particleFrame[1][2] };
+					scales[i] = m_data.particleScales[i];
+				}
+			});
+		}
+	}
+
+	outHandle.setMObject(dataObj);
+	outHandle.setClean();
 }
 
 /*	Description
@@ -2062,90 +1713,110 @@ MStatus FlexiInstancer::computeCounterTwistStability(double& outStability)
 	This function is called exclusively by the FlexiInstancerCounterTwist command and is used to calculate the counter twist cache for this node
 	Counter twist is an iterative calculation which is designed to stabalise the end frame of the curve
 	It essentially mitigates any twist deviation induced on the moving frame of the curve over a specified time range
-	This function assumes the command from which it was called has validated all inputs and checked that orientation computation is enabled    */
-MStatus FlexiInstancer::computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, MObject& animCurveObj, MAnimCurveChange& animMod)
+	This function assumes the command from which it was called has validated all inputs and checked that orientation computation is enabled
+
+	Optimizations
+	-------------
+	The node is evaluated under a separate context for each sample time, the global time is never changed and the scene is not updated per sample
+	- Only the curve inputs are pulled and evaluation stops after the RMF stage, the adjustment, frame and particle stages are never computed
+	- If an angular tolerance is given, evaluation stops once the curve has been built and the end normal is integrated adaptively instead
+	- The adaptive integration does not depend on the instance count or subdivisions and will typically require far fewer samples
+	- Only the end frame of each sample is retained, the angle calculations are then distributed over Maya's thread pool
+	- The accumulation of the angular deltas is sequential and is kept as a single serial pass
+	The node data is invalidated once the samples have been computed so that the next evaluation rebuilds it for the current time
+
+	Args
+	----
+	subSteps = Number of samples taken per time step, keyframes are only set at each time step
+		Additional samples help to resolve the direction of large rotations which occur between consecutive keyframes
+	angularTolerance = Maximum angular error in radians of each end normal computed by the adaptive integration (see BSpline::propagateNormalRMF)
+		If zero, the end normal is computed from the sampled RMF and will exactly match the drawn frames    */
+MStatus FlexiInstancer::computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, unsigned int subSteps, double angularTolerance, 
+	MObject& animCurveObj, MAnimCurveChange& animMod)
 {
 	MStatus status;
 
 	MFnAnimCurve fnAnimCurve{ animCurveObj };
-	MTime currentTime = MAnimControl::currentTime();
-	MTime iterTime = startTime;
-	double previousAngle = 0.0;
-	double totalAngle = 0.0;
-
-	// For each frame, calculate a signed angle between the upVector/endUpVectorOverride (projected onto the tangent plane) and the normal vector
-	// Note, if the up-vector is close to parallel with tangent, the projection onto the tangent plane will be close to a zero-vector (angle may experience flipping)
-	while (iterTime <= endTime)
-	{
-		if (!status)
-			return MStatus::kFailure;
 
+	// Determine the number of keyframes which fit within the time range, then the total number of samples including sub-steps
+	unsigned int keyCount = 0;
+	while (startTime + timeStep * (double)keyCount <= endTime)
+		++keyCount;
+
+	unsigned int sampleCount = (keyCount - 1) * subSteps + 1;
+	std::vector<MVector> upperBoundTangents(sampleCount);
+	std::vector<MVector> upperBoundNormals(sampleCount);
+	std::vector<MVector> counterTwistUpVectors(sampleCount);
+
+	// --- Sample End Frames ---
+	// Each sample time must be evaluated by the DG on the main thread
+	for (unsigned int i = 0; i < sampleCount; ++i)
+	{
+		MTime sampleTime = startTime + timeStep * ((double)i / subSteps);
+		MDGContext timeContext{ sampleTime };
+		MDGContextGuard contextGuard{ timeContext };
 		MDataBlock dataBlock = forceCache();
 
-		// This call does not cause the viewport loop to refresh
-		MAnimControl::setCurrentTime(iterTime);
-		// We must force a DG update (we can either call the "refresh" command or manually pull data from an output)
-		dataBlock.inputValue(outputWorldParticleArrayAttr);
+		computeContextCurveData(dataBlock, angularTolerance > 0.0 ? FlexiInstancer_Data::kCurveStages : FlexiInstancer_Data::kOrientStages);
+
+		if (!m_data.isOrientEnabled)
+		{
+			status = MStatus::kFailure;
+			break;
+		}
 
-		// Calculate upper threshold data
 		MVector vUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
 		vUpperBoundTangent.normalize();
-		MQuaternion qPrincipalNormal{ m_data.vPrincipalNormal.x, m_data.vPrincipalNormal.y, m_data.vPrincipalNormal.z, 0.0 };
-		unsigned int maxParamIndex = m_data.minParamIndex == 0 ? m_data.sampleCount - 1 : m_data.minParamIndex - 1;
-		MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[maxParamIndex], m_data.vUpperBoundPoint, m_data.tangents[maxParamIndex], m_data.vUpperBoundTangent);
-		// Normalize in case there is no offset
-		qReflection.normalizeIt();
-		MQuaternion qReflectionComposition = MRS::quaternionMultiply(qReflection, m_data.rmfReflections[maxParamIndex]);
-		MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-		MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-		MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-		MVector vUpperBoundNormal{ qNormal.x, qNormal.y, qNormal.z };
-		vUpperBoundNormal.normalize();
-
-		// Project the up-vector onto the end tangent
-		MVector vProjUpOnTangent = (m_data.vCounterTwistUp * vUpperBoundTangent) * vUpperBoundTangent;
-		// Project the up-vector onto the tangent plane
-		MVector vProjUpOnTangentPlane = m_data.vCounterTwistUp - vProjUpOnTangent;
-		vProjUpOnTangentPlane.normalize();
-
-		// Calculate sign of the angle
-		MVector vCrossProjWithNormal = vProjUpOnTangentPlane ^ vUpperBoundNormal;
-		double dotCrossWithTangent = vCrossProjWithNormal * vUpperBoundTangent;
-		int angularDirection = dotCrossWithTangent < 0.0 ? 1 : -1;
-
-		// Calculate angle
-		double currentAngle = std::acos(vProjUpOnTangentPlane * vUpperBoundNormal);
-		currentAngle *= angularDirection;
-
-		// Calculate delta from previous frame
-		double angularDelta;
-		if (std::abs(currentAngle - previousAngle) > M_PI)
+		upperBoundTangents[i] = vUpperBoundTangent;
+		counterTwistUpVectors[i] = m_data.vCounterTwistUp;
+
+		if (angularTolerance > 0.0)
 		{
-			// The normal is pointing in a similiar direction to the negated projection vector
-			// This causes a large discrepency between the previous and current angles (ie. angle is close to 180 degrees but direction has changed)
-			if (currentAngle > 0.0)
-				angularDelta = (-2 * M_PI) + (currentAngle - previousAngle);
-			else
-				angularDelta = (2 * M_PI) + (currentAngle - previousAngle);
+			// The principal normal is calculated in the same way as the RMF stage
+			MVector vLowerBoundTangent = sampleFirstDerivative(m_data.lowerBoundKnot);
+			vLowerBoundTangent.normalize();
+			MVector vLowerBoundNormal = computeFlexiPrincipalNormal(m_data.vNormalUp, vLowerBoundTangent);
+
+			upperBoundNormals[i] = m_curve.propagateNormalRMF(m_data.degree, m_data.knots, m_data.controlPoints, m_data.lowerBoundKnot, 
+				m_data.upperBoundKnot, vLowerBoundNormal, angularTolerance);
 		}
 		else
-			angularDelta = currentAngle - previousAngle;
+			upperBoundNormals[i] = m_data.vRmfUpperBoundNormal;
+	}
 
-		// Counter the twist
-		angularDelta *= -1;
+	// The data held by the node corresponds to the last sample context
+	invalidateCurveData();
 
-		// Set a keyframe at the current time using the accumulative angle
-		totalAngle += angularDelta;
-		fnAnimCurve.addKey(iterTime, totalAngle, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &animMod, &status);
+	if (!status)
+		return status;
 
-		previousAngle = currentAngle;
-		iterTime += timeStep;
-	}
+	// --- Key Counter Twist ---
+	return keyFlexiCounterTwist(upperBoundTangents, upperBoundNormals, counterTwistUpVectors, startTime, timeStep, subSteps, m_data.grainSize, 
+		fnAnimCurve, animMod);
+}
 
-	// Restore the previous time
-	MAnimControl::setCurrentTime(currentTime);
+/*	Description
+	-----------
+	Computes the required stages of the curve data for a datablock which belongs to a separate context (eg. a specific time)
+	The inputs may differ from the previously evaluated context, therefore the input stages are dirtied before evaluating
+	The stages themselves will determine whether their samples need to be recomputed (eg. only modified spans of the curve are resampled)
+	Once all contexts have been evaluated, invalidateCurveData() must be called    */
+void FlexiInstancer::computeContextCurveData(MDataBlock& dataBlock, int32_t requiredStages)
+{
+	m_data.dirtyStages |= FlexiInstancer_Data::kCountsStage | FlexiInstancer_Data::kControlPointsStage | FlexiInstancer_Data::kParametersStage;
+	computeCurveData(dataBlock, requiredStages);
+}
 
-	return status;
+/*	Description
+	-----------
+	Invalidates all of the data computed by computeCurveData so that it is rebuilt by the next evaluation from the normal context
+	This must be called after the node has been evaluated under a separate context, as the data no longer corresponds to the current time    */
+void FlexiInstancer::invalidateCurveData()
+{
+	m_data.dirtyStages = FlexiInstancer_Data::kAllStages;
+	MDataBlock dataBlock = forceCache();
+	dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
+	setDrawDirty();
 }
 
 /*	Description
@@ -2173,14 +1844,50 @@ MVector FlexiInstancer::sampleFirstDerivative(double t) const
 	return m_curve.sampleDerivative(1, t, m_data.degree, m_data.knots, m_data.controlPoints);
 }
 
+/*	Description
+	-----------
+	Samples the internal curve and optionally its first derivative for an array of parameters using previously evaluated data
+	The resulting derivatives will not be normalized
+
+	Args
+	----
+	parameters = Array of natural parameters, expected to be mostly increasing
+	count = Number of parameters to sample, each output array must hold at least this many elements    */
+void FlexiInstancer::sampleCurveBatch(const double* parameters, unsigned int count, MVector* outPoints, MVector* outFirstDerivatives) const
+{
+	m_curve.sampleBatch(m_data.degree, m_data.knots, m_data.controlPoints, parameters, count, outPoints, outFirstDerivatives);
+}
+
 void FlexiInstancer::instancingChangedCallback(MDagPath& child, MDagPath& parent, void* clientData)
 {
 	MGlobal::displayWarning("FlexiInstancerShape does not support instancing!");
 }
 
+/*	Description
+	-----------
+	Dirties the draw state of the node, the draw dirty count is incremented before notifying the renderer
+	The sub-scene override compares this count against the count it last updated with to determine if an update is required    */
+void FlexiInstancer::setDrawDirty()
+{
+	++m_drawDirtyCount;
+	MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+}
+
+/*	Description
+	-----------
+	Publishes the index of the active manipulator within the current tool context, an index of -1 signals that no manipulator is active
+	The draw dirty count is not affected, instead the renderer is notified so that the override can compare the version of the published state    */
+void FlexiInstancer::setActiveManip(int index)
+{
+	if (m_manipState.setActiveIndex(index))
+		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+}
+
 const MRS::BSpline& FlexiInstancer::getCurve() const { return m_curve; }
 const FlexiInstancer::FlexiInstancer_Data& FlexiInstancer::getCurveData() const { return m_data; }
 MDataBlock FlexiInstancer::getDataBlock() { return forceCache(); }
+unsigned int FlexiInstancer::getDrawDirtyCount() const { return m_drawDirtyCount; }
+const FlexiManipState& FlexiInstancer::getManipState() const { return m_manipState; }
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -2192,7 +1899,7 @@ MDataBlock FlexiInstancer::getDataBlock() { return forceCache(); }
 
 	MEL Command
 	-----------
-	FlexiInstancerCounterTwist [-startTime float] [-endTime float] [-timeStep float] [object]
+	FlexiInstancerCounterTwist [-startTime float] [-endTime float] [-timeStep float] [-subSteps int] [-tolerance angle] [object]
 
 	Flags
 	-----
@@ -2210,6 +1917,16 @@ MDataBlock FlexiInstancer::getDataBlock() { return forceCache(); }
 		A precautionary minimum value of 0.01 is enforced so that extremely small values do not tend towards an infinitely sized cached
 		The default value is 1.0
 
+	-subSteps(-ss)
+		This flag specifies the number of samples taken per time step, keyframes will only be set at each time step
+		Increasing the value allows large rotations of the end frame between keyframes to be resolved in the correct direction
+		The default value is 1
+
+	-tolerance(-tol)
+		This flag specifies the angular tolerance used to adaptively integrate the end frame of the curve
+		The end frame is then computed independently of the instance count and subdivisions, which is typically much cheaper
+		If this flag is not set, the end frame is computed from the samples of the curve and will exactly match the drawn frames
+
 	Args
 	----
 	object
@@ -2227,6 +1944,10 @@ const char* FlexiInstancer_CounterTwistCommand::kEndTimeFlag = "-et";
 const char* FlexiInstancer_CounterTwistCommand::kEndTimeFlagLong = "-endTime";
 const char* FlexiInstancer_CounterTwistCommand::kTimeStepFlag = "-ts";
 const char* FlexiInstancer_CounterTwistCommand::kTimeStepFlagLong = "-timeStep";
+const char* FlexiInstancer_CounterTwistCommand::kSubStepsFlag = "-ss";
+const char* FlexiInstancer_CounterTwistCommand::kSubStepsFlagLong = "-subSteps";
+const char* FlexiInstancer_CounterTwistCommand::kToleranceFlag = "-tol";
+const char* FlexiInstancer_CounterTwistCommand::kToleranceFlagLong = "-tolerance";
 
 MSyntax FlexiInstancer_CounterTwistCommand::newSyntax()
 {
@@ -2236,6 +1957,8 @@ MSyntax FlexiInstancer_CounterTwistCommand::newSyntax()
 	syntax.addFlag(kStartTimeFlag, kStartTimeFlagLong, MSyntax::kTime);
 	syntax.addFlag(kEndTimeFlag, kEndTimeFlagLong, MSyntax::kTime);
 	syntax.addFlag(kTimeStepFlag, kTimeStepFlagLong, MSyntax::kTime);
+	syntax.addFlag(kSubStepsFlag, kSubStepsFlagLong, MSyntax::kUnsigned);
+	syntax.addFlag(kToleranceFlag, kToleranceFlagLong, MSyntax::kAngle);
 
 	// Args
 	syntax.useSelectionAsDefault(true);
@@ -2258,6 +1981,12 @@ MSyntax FlexiInstancer_CounterTwistCommand::newSyntax()
 #define kErrorInvalidTimeStep \
 	"The \"-timeStep\" flag must be given a value greater or equal to 0.01 ."
 
+#define kErrorInvalidSubSteps \
+	"The \"-subSteps\" flag must be given a value greater or equal to 1 ."
+
+#define kErrorInvalidTolerance \
+	"The \"-tolerance\" flag must be given a value greater than 0 ."
+
 #define kErrorInvalidTimeInterval \
 	"The \"-endTime\" flag must be given a value greater than the \"-startTime\" flag"
 
@@ -2325,6 +2054,36 @@ MStatus FlexiInstancer_CounterTwistCommand::doIt(const MArgList& args)
 			return MStatus::kFailure;
 		}
 	}
+	unsigned int subSteps = 1;
+	if (argParser.isFlagSet(kSubStepsFlagLong))
+	{
+		if (!argParser.getFlagArgument(kSubStepsFlagLong, 0, subSteps))
+		{
+			MString msg;
+			MString msgFormat = kErrorParsingFlag;
+			msg.format(msgFormat, kSubStepsFlagLong);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+	}
+	MAngle tolerance{ 0.0 };
+	if (argParser.isFlagSet(kToleranceFlagLong))
+	{
+		if (!argParser.getFlagArgument(kToleranceFlagLong, 0, tolerance))
+		{
+			MString msg;
+			MString msgFormat = kErrorParsingFlag;
+			msg.format(msgFormat, kToleranceFlagLong);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+
+		if (tolerance.asRadians() <= 0.0)
+		{
+			displayError(kErrorInvalidTolerance);
+			return MStatus::kFailure;
+		}
+	}
 
 	// Check parsed values are valid
 	if (timeStep < 0.01)
@@ -2333,6 +2092,12 @@ MStatus FlexiInstancer_CounterTwistCommand::doIt(const MArgList& args)
 		return MStatus::kFailure;
 	}
 
+	if (subSteps < 1)
+	{
+		displayError(kErrorInvalidSubSteps);
+		return MStatus::kFailure;
+	}
+
 	if (endTime < startTime)
 	{
 		displayError(kErrorInvalidTimeInterval);
@@ -2429,7 +2194,7 @@ MStatus FlexiInstancer_CounterTwistCommand::doIt(const MArgList& args)
 
 	// Add keyframes and store the changes in a cache for undo/redo
 	if (status)
-		status = locator->computeCounterTwist(startTime, endTime, timeStep, animCurveObj, m_animChangeMod);
+		status = locator->computeCounterTwist(startTime, endTime, timeStep, subSteps, tolerance.asRadians(), animCurveObj, m_animChangeMod);
 
 	return status;
 }
@@ -2464,6 +2229,8 @@ MStatus FlexiInstancer_CounterTwistCommand::undoIt()
 #undef kErrorFlagNotSet
 #undef kErrorParsingFlag
 #undef kErrorInvalidTimeStep
+#undef kErrorInvalidSubSteps
+#undef kErrorInvalidTolerance
 #undef kErrorInvalidTimeInterval
 #undef kErrorNoValidObject
 #undef kErrorInvalidType
@@ -2650,22 +2417,25 @@ MStatus FlexiInstancer_StabilityCommand::doIt(const MArgList& args)
 		return MStatus::kFailure;
 	}
 
-	MTime currentTime = MAnimControl::currentTime();
-	// This call does not cause the viewport loop to refresh
-	MAnimControl::setCurrentTime(time);
-	// We must force a DG update (we can either call the "refresh" command or manually pull data from an output)
-	dataBlock.inputValue(FlexiInstancer::outputWorldParticleArrayAttr);
-
-	// Calculate the stability of the up-vector
-	double stability;
-	if (isQueryNormal)
-		locator->computeNormalStability(stability);
-	else
-		locator->computeCounterTwistStability(stability);
+	// Stability only depends on the tangents at the bounds of the curve
+	// Therefore the node is evaluated under a context for the given time and evaluation stops once the curve has been built
+	double stability = 0.0;
+	{
+		MDGContext timeContext{ time };
+		MDGContextGuard contextGuard{ timeContext };
+		MDataBlock timeDataBlock = locator->getDataBlock();
+		locator->computeContextCurveData(timeDataBlock, FlexiInstancer::FlexiInstancer_Data::kCurveStages);
+
+		// Calculate the stability of the up-vector
+		if (isQueryNormal)
+			status = locator->computeNormalStability(stability);
+		else
+			status = locator->computeCounterTwistStability(stability);
+	}
 
 	// Set result and cleanup
+	locator->invalidateCurveData();
 	setResult(stability);
-	MAnimControl::setCurrentTime(currentTime);
 	return status;
 }
 
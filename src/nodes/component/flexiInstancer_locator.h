@@ -10,9 +10,12 @@
 #include <maya/MArgList.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDGModifier.h>
 #include <maya/MEvaluationNode.h>
+#include <maya/MEvaluationNodeIterator.h>
 #include <maya/MFnArrayAttrsData.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnAnimCurve.h>
@@ -24,6 +27,7 @@
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
+#include <maya/MPoint.h>
 #include <maya/MPxCommand.h>
 #include <maya/MPxLocatorNode.h>
 #include <maya/MSelectionList.h>
@@ -31,6 +35,7 @@
 #include <maya/MString.h>
 #include <maya/MSyntax.h>
 #include <maya/MTime.h>
+#include <maya/MTimeArray.h>
 #include <maya/MTypeId.h>
 #include <maya/MVector.h>
 #include <maya/MViewport2Renderer.h>
@@ -39,13 +44,18 @@
 #include <SeExpr2/Curve.h>
 #include <SeExpr2/Vec.h>
 
+#include "flexiCore.h"
+#include "flexiDrawHelpers.h"
 #include "flexiHelpers.h"
 #include "data/eulerArray_data.h"
 #include "utils/math_utils.h"
+#include "utils/matrix_batch_utils.h"
 #include "utils/matrix_utils.h"
 #include "utils/node_utils.h"
 #include "utils/quaternion_utils.h"
 #include "utils/spline_utils.h"
+#include "utils/thread_utils.h"
+#include "utils/vector_array_utils.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -66,6 +76,29 @@ public:
 		~FlexiInstancer_Data();
 
 	public:
+		// Each stage of the curve data pipeline is invalidated by a specific set of input attributes
+		// A dirty stage will also dirty every stage which depends on it, allowing unaffected stages to retain their cached data
+		enum DirtyStage : int32_t
+		{
+			kCountsStage = 1 << 0,
+			kControlPointsStage = 1 << 1,
+			kKnotsStage = 1 << 2,
+			kLengthsStage = 1 << 3,
+			kParametersStage = 1 << 4,
+			kSamplesStage = 1 << 5,
+			kRmfStage = 1 << 6,
+			kPositionAdjustmentsStage = 1 << 7,
+			kScaleAdjustmentsStage = 1 << 8,
+			kTwistAdjustmentsStage = 1 << 9,
+			kFramesStage = 1 << 10,
+			// The particle stage is not required by draw, it is only rebuilt once compute requests a particle output
+			kParticlesStage = 1 << 11,
+			kAllStages = (1 << 12) - 1,
+			// Partial evaluations which stop once the curve itself or its rotation minimizing frames have been computed
+			kCurveStages = kCountsStage | kControlPointsStage | kKnotsStage,
+			kOrientStages = kCurveStages | kLengthsStage | kParametersStage | kSamplesStage | kRmfStage
+		};
+
 		// constants
 		static const unsigned int order;
 		static const unsigned int degree;
@@ -86,6 +119,10 @@ public:
 		bool isScaleAdjustmentEnabled;
 		bool isTwistAdjustmentEnabled;
 		bool isDrawRibbonEnabled;
+		int32_t dirtyStages;
+
+		// threading
+		unsigned int grainSize;
 		
 		// values
 		double offset;
@@ -105,27 +142,53 @@ public:
 		std::vector<double> naturalParameters;
 		std::vector<double> arcLengthParameters;
 		std::vector<double> blendedParameters;
+		std::vector<double> previousBlendedParameters;
+		// natural parameters remapped into the clamped range, used to sample the adjustments
+		std::vector<double> normalizedParameters;
 		unsigned int minParamIndex;
+
+		// resampling (batch evaluation scratch data, retained to avoid reallocation)
+		std::vector<unsigned int> resampleIndices;
+		std::vector<double> resampleParameters;
+		std::vector<MVector> resamplePoints;
+		std::vector<MVector> resampleTangents;
 		
-		// lengths (natural parameter increments)
-		std::vector<double> lengths;
+		// lengths (integrated per knot span, independent of the instance count)
+		MRS::ArcLengthTable arcLengthTable;
 
 		// sample xforms
 		MVector vPrincipalNormal;
-		std::vector<MVector> points;
-		std::vector<MVector> tangents;
-		std::vector<MVector> binormals;
-		std::vector<MVector> normals;
+		MRS::VectorArray points;
+		MRS::VectorArray tangents;
+		MRS::VectorArray binormals;
+		MRS::VectorArray normals;
 		std::vector<MQuaternion> rmfReflections;
+		std::vector<MQuaternion> rmfStepReflections;
+
+		// rmf xforms (unadjusted, allowing the frame stage to be rebuilt in isolation)
+		MRS::VectorArray rmfTangents;
+		MRS::VectorArray rmfBinormals;
+		MRS::VectorArray rmfNormals;
+		MVector vRmfLowerBoundTangent;
+		MVector vRmfLowerBoundBinormal;
+		MVector vRmfLowerBoundNormal;
+		MVector vRmfUpperBoundTangent;
+		MVector vRmfUpperBoundBinormal;
+		MVector vRmfUpperBoundNormal;
 
 		// input xforms
 		MVector vNormalUp;
 		MVector vCounterTwistUp;
 		std::vector<MVector> controlPoints;
+		std::vector<MVector> previousControlPoints;
 
 		// output xforms
 		std::vector<MMatrix> frames;
 
+		// particle xforms (local frames with the orientation mode applied)
+		std::vector<MMatrix> particleFrames;
+		std::vector<MVector> particleScales;
+
 		// draw xforms
 		MVector vLowerBoundPoint;
 		MVector vLowerBoundTangent;
@@ -140,6 +203,10 @@ public:
 		std::vector<PositionAdjustment> positionAdjustments;
 		std::vector<TwistAdjustment> twistAdjustments;
 		std::vector<ScaleAdjustment> scaleAdjustments;
+		// summed adjustment values at the normalized parameters, persisting until an adjustment or the parameterization changes
+		FlexiAdjustmentTable<PositionAdjustment> positionAdjustmentTable;
+		FlexiAdjustmentTable<TwistAdjustment> twistAdjustmentTable;
+		FlexiAdjustmentTable<ScaleAdjustment> scaleAdjustmentTable;
 	};
 
 public:
@@ -164,22 +231,34 @@ public:
 	MBoundingBox boundingBox() const;
 
 	// ------ Helpers ------
-	void computeCurveData(MDataBlock& dataBlock);
+	bool getDirtyStages(const MObject& attr, int32_t& outStages) const;
+	void computeCurveData(MDataBlock& dataBlock, int32_t requiredStages = FlexiInstancer_Data::kAllStages);
+	void computeContextCurveData(MDataBlock& dataBlock, int32_t requiredStages);
+	void invalidateCurveData();
 	void computePositionAdjustments(MDataBlock& dataBlock);
 	void computeScaleAdjustments(MDataBlock& dataBlock);
 	void computeTwistAdjustments(MDataBlock& dataBlock);
 	void computeNaturalParameters();
 	void computeArcLengthParameters();
+	void computeNormalizedParameters();
+	void computeParticleFrames(MDataBlock& dataBlock);
+	void writeParticleData(MDataHandle& outHandle, unsigned int instanceCount, const MMatrix* worldTransform) const;
 	MStatus computeNormalStability(double& outStability);
 	MStatus computeCounterTwistStability(double& outStability);
-	MStatus computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, MObject& animCurveObj, MAnimCurveChange& animMod);
+	MStatus computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, unsigned int subSteps, double angularTolerance, 
+		MObject& animCurveObj, MAnimCurveChange& animMod);
 	MVector sampleCurve(double t) const;
 	MVector sampleFirstDerivative(double t) const;
+	void sampleCurveBatch(const double* parameters, unsigned int count, MVector* outPoints, MVector* outFirstDerivatives = nullptr) const;
 	static void instancingChangedCallback(MDagPath& child, MDagPath& parent, void* clientData);
 
 	const MRS::BSpline& getCurve() const;
 	const FlexiInstancer_Data& getCurveData() const;
 	MDataBlock getDataBlock();
+	unsigned int getDrawDirtyCount() const;
+	void setDrawDirty();
+	const FlexiManipState& getManipState() const;
+	void setActiveManip(int index);
 
 	// ------ Attr ------
 	// inputs
@@ -258,6 +337,8 @@ public:
 	static MObject scaleAdjustmentFalloffModeAttr;
 	static MObject scaleAdjustmentFalloffDistanceAttr;
 	static MObject scaleAdjustmentRepeatAttr;
+	static MObject forceSerialEvaluationAttr;
+	static MObject parallelGrainSizeAttr;
 	// outputs
 	static MObject outputLocalParticleArrayAttr;
 	static MObject outputWorldParticleArrayAttr;
@@ -269,6 +350,12 @@ private:
 	// ------ Curve ------
 	MRS::BSpline m_curve;
 	FlexiInstancer_Data m_data;
+
+	// ------ Draw ------
+	// Incremented whenever the draw state is dirtied, the draw override uses this to skip draw cycles in which nothing has changed
+	unsigned int m_drawDirtyCount;
+	// Published by the tool contexts, the draw override uses this to display the falloff of the active manipulator
+	FlexiManipState m_manipState;
 	
 	// ------ Callbacks ------
 	MCallbackId m_instanceAddedCallbackId;
@@ -294,6 +381,10 @@ public:
 	static const char* kEndTimeFlagLong;
 	static const char* kTimeStepFlag;
 	static const char* kTimeStepFlagLong;
+	static const char* kSubStepsFlag;
+	static const char* kSubStepsFlagLong;
+	static const char* kToleranceFlag;
+	static const char* kToleranceFlagLong;
 
 	// ------ MPxCommand ------
 	bool isUndoable() const override;
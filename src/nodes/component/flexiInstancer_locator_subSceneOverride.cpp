@@ -20,10 +20,6 @@ FlexiInstancer_SubSceneOverride::FlexiInstancer_SubSceneOverride(const MObject&
 	MHWRender::MPxSubSceneOverride{ obj },
 	m_locatorObj{ obj },
 	m_displayStatus{ MHWRender::DisplayStatus::kNoStatus },
-	m_surfaceVertexCount{ -1 },
-	m_curveVertexCount{ -1 },
-	m_normalsVertexCount{ -1 },
-	m_hullVertexCount{ -1 },
 	m_surfaceRenderItem{ nullptr },
 	m_borderActiveRenderItem{ nullptr },
 	m_borderDormantRenderItem{ nullptr },
@@ -42,19 +38,16 @@ FlexiInstancer_SubSceneOverride::FlexiInstancer_SubSceneOverride(const MObject&
 	m_samplerState{ nullptr },
 	m_rampTexture{ nullptr },
 	m_diffuseTexture{ nullptr },
-	m_surfacePositionBuffer{ nullptr },
-	m_surfaceNormalBuffer{ nullptr },
-	m_surfaceTextureBuffer{ nullptr },
-	m_curvePositionBuffer{ nullptr },
-	m_normalsPositionBuffer{ nullptr },
-	m_hullPositionBuffer{ nullptr },
-	m_boundingBoxPositionBuffer{ nullptr },
-	m_surfaceIndexBuffer{ nullptr },
-	m_borderIndexBuffer{ nullptr },
-	m_curveIndexBuffer{ nullptr },
-	m_normalsIndexBuffer{ nullptr },
-	m_hullIndexBuffer{ nullptr },
-	m_boundingBoxIndexBuffer{ nullptr }
+	m_surfacePositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_surfaceNormalBuffer{ MHWRender::MGeometry::kNormal, 3 },
+	m_surfaceTextureBuffer{ MHWRender::MGeometry::kTexture, 2 },
+	m_curvePositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_normalsPositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_hullPositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_boundingBoxPositionBuffer{ MHWRender::MGeometry::kPosition, 3 },
+	m_drawSpaceTransformation{ 0 },
+	m_drawDirtyCount{ 0 },
+	m_manipStateVersion{ 0 }
 {
 	MStatus status;
 	MFnDependencyNode fnNode{ obj, &status };
@@ -85,8 +78,6 @@ FlexiInstancer_SubSceneOverride::~FlexiInstancer_SubSceneOverride()
 	m_hullRenderItem = nullptr;
 	m_boundingBoxRenderItem = nullptr;
 
-	deleteGeometryBuffers();
-
 	MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
 	if (!renderer)
 	{
@@ -158,10 +149,40 @@ MHWRender::DrawAPI FlexiInstancer_SubSceneOverride::supportedDrawAPIs() const
 /*	Description
 	-----------
 	If this function returns false then update() will not be called for the draw-preparation phase
-	This would only be the case if the vertex buffers and render items did not need to be updated    */
+	Draw cycles occur far more frequently than evaluation (eg. when tumbling the viewport), so an update is only requested if one of the following has changed:
+	- The draw state of the locator has been dirtied since the last update (tracked by its draw dirty count)
+	- The active manipulator published by a tool context has changed (tracked by the version of the locator's manipulator state)
+	- A state which does not propagate dirtiness to the locator (eg. selection, visibility, parent transforms, the active tool context)    */
 bool FlexiInstancer_SubSceneOverride::requiresUpdate(const MSubSceneContainer& container, const MFrameContext& frameContext) const
 {
-	return true;
+	// Render items and their shading resources are created by the first successful update
+	if (!m_boundingBoxRenderItem || !m_hullShader || !m_rampTexture || !m_diffuseTexture || !m_samplerState)
+		return true;
+
+	if (m_locator->getDrawDirtyCount() != m_drawDirtyCount)
+		return true;
+
+	// Ramp textures reflect the active manipulator which is not part of the DG, the tool contexts publish it through the manipulator state of the locator
+	if (m_locator->getManipState().getVersion() != m_manipStateVersion)
+		return true;
+
+	MDagPath path;
+	MDagPath::getAPathTo(m_locatorObj, path);
+	if (!path.isValid())
+		return false;
+
+	if (path.isVisible() != m_isVisible ||
+		MHWRender::MGeometryUtilities::displayStatus(path) != m_displayStatus ||
+		MHWRender::MGeometryUtilities::wireframeColor(path) != m_wireframeColor ||
+		(bool)m_overrideLevelOfDetailPlug.asShort() != m_boundingBoxEnabled ||
+		m_castsShadowsPlug.asBool() != m_castsShadows ||
+		m_receiveShadowsPlug.asBool() != m_receiveShadows)
+		return true;
+
+	if (m_drawSpaceTransformation == 1 && !m_drawTransform.isEquivalent(path.inclusiveMatrix()))
+		return true;
+
+	return MFnToolContext(MGlobal::currentToolContext()).name() != m_toolContextName;
 }
 
 /*	Description
@@ -179,6 +200,10 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 		return;
 	}
 
+	// The draw state is considered clean from this point, any dirtiness arising during the update will request another update
+	m_drawDirtyCount = m_locator->getDrawDirtyCount();
+	m_manipStateVersion = m_locator->getManipState().getVersion();
+
 	// Check if any locator input is dirty and evaluate if needed
 	// Otherwise check if drawing has already occurred since the last evaluation and if so signal to exit early
 	bool updateBuffers = true;
@@ -373,6 +398,9 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 		image.setPixels(m_diffusePixel, 1, 1);
 		m_diffuseTexture->update(image, false);
 
+		// The ramp texture holds no valid data until it is first generated
+		m_rampKey = FlexiRampKey();
+
 		itemsChanged = true;
 	}
 
@@ -396,6 +424,7 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 	bool castsShadows = m_castsShadowsPlug.asBool();
 	bool receiveShadows = m_receiveShadowsPlug.asBool();
 	MString context = MFnToolContext(MGlobal::currentToolContext()).name();
+	m_toolContextName = context;
 	bool upVectorContextEnabled = context == "FlexiInstancerUpVectorContext1" ? true : false;
 	bool scaleAdjustmentContextEnabled = context == "FlexiInstancerScaleAdjustmentContext1" && scaleAdjustmentsEnabled ? true : false;
 	bool twistAdjustmentContextEnabled = context == "FlexiInstancerTwistAdjustmentContext1" && twistAdjustmentsEnabled ? true : false;
@@ -463,11 +492,11 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 		m_boundingBoxRenderItem->enable(boundingBoxItemEnabled);
 
 		// Update line shaders
-		updateLineShader(m_wireframeShader, "lineWidth", 1.1f, "solidColor", m_wireframeColor);
-		updateLineShader(m_borderDormantShader, "lineWidth", 1.1f, "solidColor", m_borderDormantColor);
-		updateLineShader(m_curveDormantShader, "lineWidth", 1.1f, "solidColor", m_curveDormantColor);
-		updateLineShader(m_normalsDormantShader, "lineWidth", 1.8f, "solidColor", m_normalsDormantColor);
-		updateLineShader(m_hullShader, "lineWidth", 0.6f, "solidColor", m_curveDormantColor);
+		updateFlexiLineShader(m_wireframeShader, "lineWidth", 1.1f, "solidColor", m_wireframeColor);
+		updateFlexiLineShader(m_borderDormantShader, "lineWidth", 1.1f, "solidColor", m_borderDormantColor);
+		updateFlexiLineShader(m_curveDormantShader, "lineWidth", 1.1f, "solidColor", m_curveDormantColor);
+		updateFlexiLineShader(m_normalsDormantShader, "lineWidth", 1.8f, "solidColor", m_normalsDormantColor);
+		updateFlexiLineShader(m_hullShader, "lineWidth", 0.6f, "solidColor", m_curveDormantColor);
 
 		// Update surface shader
 		MHWRender::MTextureAssignment textureAssignment;
@@ -483,6 +512,7 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 	// This can be tested by calling MRenderItem::sourceDagPath()
 	MMatrix drawTransform;
 	short drawSpaceTransformation = dataBlock.inputValue(FlexiInstancer::drawSpaceTransformationAttr).asShort();
+	m_drawSpaceTransformation = drawSpaceTransformation;
 
 	if (drawSpaceTransformation == 1)
 		drawTransform = path.inclusiveMatrix();
@@ -508,20 +538,10 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 	// Unless an item has changed, as items to not update whilst disabled therefore their buffers may be stale when reenabled
 	if (!updateBuffers && !itemsChanged)
 	{
-		// Selecting manipulators within the up-vector context does not cause any dirty propagation in the DG however it should affect how the ramp texture is drawn
-		// Therefore, if the up-vector context is active we must force the texture to update before returning (this must be done on all draw cycles)
-		// Performance is not a major concern whilst the context is active (ie. heavy animation work is not done inside the context)
+		// Selecting manipulators within a context does not cause any dirty propagation in the DG however it should affect how the ramp texture is drawn
+		// The ramp is keyed on the manipulator state published by the context so it will only be regenerated if the active manipulator has changed
 		if (m_isVisible && !m_boundingBoxEnabled && m_ribbonDrawEnabled && m_computeOrientation)
-		{
-			if (m_upVectorContextEnabled)
-				updateRampTextureUpVectorContext();
-			else if (m_scaleAdjustmentContextEnabled)
-				updateRampTextureScaleAdjustmentContext();
-			else if (m_twistAdjustmentContextEnabled)
-				updateRampTextureTwistAdjustmentContext();
-			else if (m_positionAdjustmentContextEnabled)
-				updateRampTexturePositionAdjustmentContext();
-		}
+			updateRampTexture();
 
 		return;
 	}
@@ -536,8 +556,8 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 			updateBoundingBoxGeometryBuffers(bounds);
 
 			MHWRender::MVertexBufferArray boundingBoxVertexBuffers;
-			boundingBoxVertexBuffers.addBuffer("positions", m_boundingBoxPositionBuffer);
-			setGeometryForRenderItem(*m_boundingBoxRenderItem, boundingBoxVertexBuffers, *m_boundingBoxIndexBuffer, &bounds);
+			boundingBoxVertexBuffers.addBuffer("positions", m_boundingBoxPositionBuffer.buffer());
+			setGeometryForRenderItem(*m_boundingBoxRenderItem, boundingBoxVertexBuffers, *m_boundingBoxIndexBuffer.buffer(), &bounds);
 		}
 		else
 		{
@@ -545,25 +565,18 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 			if (m_ribbonDrawEnabled && m_computeOrientation)
 			{
 				updateRibbonGeometryBuffers();
-				if (m_upVectorContextEnabled)
-					updateRampTextureUpVectorContext();
-				else if (m_scaleAdjustmentContextEnabled)
-					updateRampTextureScaleAdjustmentContext();
-				else if (m_twistAdjustmentContextEnabled)
-					updateRampTextureTwistAdjustmentContext();
-				else if (m_positionAdjustmentContextEnabled)
-					updateRampTexturePositionAdjustmentContext();
+				updateRampTexture();
 
 				MHWRender::MVertexBufferArray surfaceVertexBuffers;
-				surfaceVertexBuffers.addBuffer("positions", m_surfacePositionBuffer);
-				surfaceVertexBuffers.addBuffer("normals", m_surfaceNormalBuffer);
-				surfaceVertexBuffers.addBuffer("uvs", m_surfaceTextureBuffer);
-				setGeometryForRenderItem(*m_surfaceRenderItem, surfaceVertexBuffers, *m_surfaceIndexBuffer, &bounds);
+				surfaceVertexBuffers.addBuffer("positions", m_surfacePositionBuffer.buffer());
+				surfaceVertexBuffers.addBuffer("normals", m_surfaceNormalBuffer.buffer());
+				surfaceVertexBuffers.addBuffer("uvs", m_surfaceTextureBuffer.buffer());
+				setGeometryForRenderItem(*m_surfaceRenderItem, surfaceVertexBuffers, *m_surfaceIndexBuffer.buffer(), &bounds);
 
 				MHWRender::MVertexBufferArray borderVertexBuffers;
-				borderVertexBuffers.addBuffer("positions", m_surfacePositionBuffer);
-				setGeometryForRenderItem(*m_borderActiveRenderItem, borderVertexBuffers, *m_borderIndexBuffer, &bounds);
-				setGeometryForRenderItem(*m_borderDormantRenderItem, borderVertexBuffers, *m_borderIndexBuffer, &bounds);
+				borderVertexBuffers.addBuffer("positions", m_surfacePositionBuffer.buffer());
+				setGeometryForRenderItem(*m_borderActiveRenderItem, borderVertexBuffers, *m_borderIndexBuffer.buffer(), &bounds);
+				setGeometryForRenderItem(*m_borderDormantRenderItem, borderVertexBuffers, *m_borderIndexBuffer.buffer(), &bounds);
 			}
 
 			// Curve buffers
@@ -572,9 +585,9 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 				updateCurveGeometryBuffers();
 
 				MHWRender::MVertexBufferArray curveVertexBuffers;
-				curveVertexBuffers.addBuffer("positions", m_curvePositionBuffer);
-				setGeometryForRenderItem(*m_curveActiveRenderItem, curveVertexBuffers, *m_curveIndexBuffer, &bounds);
-				setGeometryForRenderItem(*m_curveDormantRenderItem, curveVertexBuffers, *m_curveIndexBuffer, &bounds);
+				curveVertexBuffers.addBuffer("positions", m_curvePositionBuffer.buffer());
+				setGeometryForRenderItem(*m_curveActiveRenderItem, curveVertexBuffers, *m_curveIndexBuffer.buffer(), &bounds);
+				setGeometryForRenderItem(*m_curveDormantRenderItem, curveVertexBuffers, *m_curveIndexBuffer.buffer(), &bounds);
 			}
 
 			// Normals buffers
@@ -583,9 +596,9 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 				updateNormalsGeometryBuffers();
 
 				MHWRender::MVertexBufferArray normalsVertexBuffers;
-				normalsVertexBuffers.addBuffer("positions", m_normalsPositionBuffer);
-				setGeometryForRenderItem(*m_normalsActiveRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer, &bounds);
-				setGeometryForRenderItem(*m_normalsDormantRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer, &bounds);
+				normalsVertexBuffers.addBuffer("positions", m_normalsPositionBuffer.buffer());
+				setGeometryForRenderItem(*m_normalsActiveRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer.buffer(), &bounds);
+				setGeometryForRenderItem(*m_normalsDormantRenderItem, normalsVertexBuffers, *m_normalsIndexBuffer.buffer(), &bounds);
 			}
 
 			// Hull buffers
@@ -594,8 +607,8 @@ void FlexiInstancer_SubSceneOverride::update(MSubSceneContainer& container, cons
 				updateHullGeometryBuffers();
 
 				MHWRender::MVertexBufferArray hullVertexBuffers;
-				hullVertexBuffers.addBuffer("positions", m_hullPositionBuffer);
-				setGeometryForRenderItem(*m_hullRenderItem, hullVertexBuffers, *m_hullIndexBuffer, &bounds);
+				hullVertexBuffers.addBuffer("positions", m_hullPositionBuffer.buffer());
+				setGeometryForRenderItem(*m_hullRenderItem, hullVertexBuffers, *m_hullIndexBuffer.buffer(), &bounds);
 			}
 		}
 	}
@@ -644,18 +657,39 @@ void FlexiInstancer_SubSceneOverride::createShaderInstance(const MShaderManager*
 	Usually called in case of an error during the texture update process or when no texturing is required    */
 void FlexiInstancer_SubSceneOverride::setDefaultRamp()
 {
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		m_texturedPixels[pointerOffset++] = 128;
-		m_texturedPixels[pointerOffset++] = 128;
-		m_texturedPixels[pointerOffset++] = 128;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
+	writeFlexiDefaultRamp(m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
+}
 
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+/*	Description
+	-----------
+	Regenerates the ramp texture for the active context, the texture is keyed on the following inputs:
+	- The active context, each context is identified by its order in the below expression
+	- The version of the manipulator state which the active context publishes to the locator
+	- The draw dirty count of the locator, as the ramp data is derived from the evaluated adjustments and curve stability
+	If none of these inputs have changed since the last upload, the existing texture is reused    */
+void FlexiInstancer_SubSceneOverride::updateRampTexture()
+{
+	short context = m_upVectorContextEnabled ? 0 : m_scaleAdjustmentContextEnabled ? 1 : m_twistAdjustmentContextEnabled ? 2 : m_positionAdjustmentContextEnabled ? 3 : -1;
+	if (context == -1)
+		return;
+
+	const FlexiManipState& manipState = m_locator->getManipState();
+	FlexiRampKey rampKey{ context, manipState.getVersion(), m_drawDirtyCount };
+	if (rampKey == m_rampKey)
+		return;
+	m_rampKey = rampKey;
+
+	// The version must be read before the index, see FlexiManipState
+	int activeIndex = manipState.getActiveIndex();
+	if (m_upVectorContextEnabled)
+		updateRampTextureUpVectorContext(activeIndex);
+	else if (m_scaleAdjustmentContextEnabled)
+		updateRampTextureScaleAdjustmentContext(activeIndex);
+	else if (m_twistAdjustmentContextEnabled)
+		updateRampTextureTwistAdjustmentContext(activeIndex);
+	else if (m_positionAdjustmentContextEnabled)
+		updateRampTexturePositionAdjustmentContext(activeIndex);
 }
 
 /*	Description
@@ -666,349 +700,81 @@ void FlexiInstancer_SubSceneOverride::setDefaultRamp()
 	The ramp will only be displayed if one of the two manipulators belonging to the locator are active
 	- If the start manipulator is active, the ramp will represent the stability of the curves principal normal in relation to its respective up-vector
 	- If the end manipulator is active, the ramp will represent the stability of the curves counter-twist data in relation to its respective up-vector    */
-void FlexiInstancer_SubSceneOverride::updateRampTextureUpVectorContext()
+void FlexiInstancer_SubSceneOverride::updateRampTextureUpVectorContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiInstancerUpVectorContext -q -activeManipPlug FlexiInstancerUpVectorContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
+	if (activeIndex == -1)
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	// Constants
-	double lowThreshold = 0.8;
-	double maxIntensity = 0.9;
-	double influenceRatio = 0.25;
-	unsigned int influencedPixelCount = (int)(m_texturedPixelCount * influenceRatio);
-
-	// Calculate pixel data
-	if (activeManipPlug == FlexiInstancer::normalUpVectorOverrideCompoundAttr)
-	{
-		double stability;
+	// The start manipulator (position index 0) overrides the up-vector of the principal normal
+	// The end manipulator overrides the up-vector of the counter-twist data
+	double stability;
+	if (activeIndex == 0)
 		m_locator->computeNormalStability(stability);
-		stability = std::abs(stability);
-		unsigned int pointerOffset = 0;
-		
-		if (stability > lowThreshold)
-		{
-			// Remap = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-			double weightedStability = (stability - 0.8) / 0.2;
-
-			for (unsigned int pixelIndex = 0; pixelIndex < influencedPixelCount; ++pixelIndex)
-			{
-				// Initial pixels receive highest weight
-				double pixelWeight = (double)(influencedPixelCount - 1 - pixelIndex) / (influencedPixelCount - 1) * weightedStability;
-				pixelWeight = pixelWeight * pixelWeight * (3 - 2 * pixelWeight);
-
-				char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-				// Max intensity simply reduces the intensity of the red color
-				char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-				m_texturedPixels[pointerOffset++] = rChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-
-			for (unsigned int pixelIndex = influencedPixelCount; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-		else
-		{
-			for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-	}
 	else
-	{
-		double stability;
 		m_locator->computeCounterTwistStability(stability);
-		stability = std::abs(stability);
-		unsigned int pointerOffset = 0;
-
-		if (stability > lowThreshold)
-		{
-			double weightedStability = (stability - 0.8) / 0.2;
-
-			for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount - influencedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-
-			for (unsigned int pixelIndex = m_texturedPixelCount - influencedPixelCount; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				// End pixels receive highest weight
-				double pixelWeight = (double)(pixelIndex - m_texturedPixelCount + influencedPixelCount) / (influencedPixelCount - 1) * weightedStability;
-				pixelWeight = pixelWeight * pixelWeight * (3 - 2 * pixelWeight);
 
-				char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-				char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-				m_texturedPixels[pointerOffset++] = rChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = bgChannel;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-		else
-		{
-			for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-			{
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 128;
-				m_texturedPixels[pointerOffset++] = 255;
-			}
-		}
-	}
-
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+	writeFlexiStabilityRamp(stability, activeIndex != 0, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
-void FlexiInstancer_SubSceneOverride::updateRampTextureScaleAdjustmentContext()
+void FlexiInstancer_SubSceneOverride::updateRampTextureScaleAdjustmentContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiInstancerScaleAdjustmentContext -q -activeManipPlug FlexiInstancerScaleAdjustmentContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
+	// Retrieve the correct falloff ramp, the active index is the physical index of the adjustment
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
-	{
-		setDefaultRamp();
-		return;
-	}
-
-	// Retrieve the correct falloff ramp
-	MIntArray logicalIndices;
-	activeManipPlug.array().getExistingArrayAttributeIndices(logicalIndices);
-	unsigned int logicalIndex = activeManipPlug.logicalIndex();
-
-	int physicalIndex = -1;
-	for (unsigned int i = 0; i < logicalIndices.length(); ++i)
-	{
-		if (logicalIndices[i] == logicalIndex)
-			physicalIndex = i;
-	}
-	if (physicalIndex == -1)
+	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
+	if (activeIndex == -1 || (unsigned int)activeIndex >= curveData.scaleAdjustments.size())
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
-	assert(physicalIndex < curveData.scaleAdjustments.size());
-	ScaleAdjustment scaleAdjustmentRamp = curveData.scaleAdjustments[physicalIndex];
-
-	// Constants
-	double maxIntensity = 0.9;
-
-	// Calculate pixel data
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		double falloffParam = (double)pixelIndex / (m_texturedPixelCount - 1);
-		double pixelWeight = scaleAdjustmentRamp.curve.getValue(falloffParam);
-
-		char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-		// Max intensity simply reduces the intensity of the red color
-		char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
+	const ScaleAdjustment& scaleAdjustmentRamp = curveData.scaleAdjustments[activeIndex];
 
-		m_texturedPixels[pointerOffset++] = rChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
-
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+	writeFlexiFalloffRamp(scaleAdjustmentRamp.curve, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
-void FlexiInstancer_SubSceneOverride::updateRampTextureTwistAdjustmentContext()
+void FlexiInstancer_SubSceneOverride::updateRampTextureTwistAdjustmentContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiInstancerTwistAdjustmentContext -q -activeManipPlug FlexiInstancerTwistAdjustmentContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
+	// Retrieve the correct falloff ramp, the active index is the physical index of the adjustment
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
-	{
-		setDefaultRamp();
-		return;
-	}
-
-	// Retrieve the correct falloff ramp
-	MIntArray logicalIndices;
-	activeManipPlug.array().getExistingArrayAttributeIndices(logicalIndices);
-	unsigned int logicalIndex = activeManipPlug.logicalIndex();
-	int physicalIndex = -1;
-	for (unsigned int i = 0; i < logicalIndices.length(); ++i)
-	{
-		if (logicalIndices[i] == logicalIndex)
-			physicalIndex = i;
-	}
-	if (physicalIndex == -1)
+	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
+	if (activeIndex == -1 || (unsigned int)activeIndex >= curveData.twistAdjustments.size())
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
-	assert(physicalIndex < curveData.twistAdjustments.size());
-	TwistAdjustment twistAdjustmentRamp = curveData.twistAdjustments[physicalIndex];
-
-	// Constants
-	double maxIntensity = 0.9;
-
-	// Calculate pixel data
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		double falloffParam = (double)pixelIndex / (m_texturedPixelCount - 1);
-		double pixelWeight = twistAdjustmentRamp.curve.getValue(falloffParam);
+	const TwistAdjustment& twistAdjustmentRamp = curveData.twistAdjustments[activeIndex];
 
-		char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-		// Max intensity simply reduces the intensity of the red color
-		char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-		m_texturedPixels[pointerOffset++] = rChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
-
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
+	writeFlexiFalloffRamp(twistAdjustmentRamp.curve, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
-void FlexiInstancer_SubSceneOverride::updateRampTexturePositionAdjustmentContext()
+void FlexiInstancer_SubSceneOverride::updateRampTexturePositionAdjustmentContext(int activeIndex)
 {
-	MStatus status;
-
-	// Check if one of the manipulators belonging to the locator is active
-	MString activeManipPlugCmd = "FlexiInstancerPositionAdjustmentContext -q -activeManipPlug FlexiInstancerPositionAdjustmentContext1";
-	MString activeManipPlugName = MGlobal::executeCommandStringResult(activeManipPlugCmd);
-	MPlug activeManipPlug;
-	MSelectionList selList;
-	status = selList.add(activeManipPlugName);
-	if (status)
-		status = selList.getPlug(0, activeManipPlug);
-
+	// Retrieve the correct falloff ramp, the active index is the physical index of the adjustment
 	// If there are no active manipulators, set the entire ramp to a uniform color
-	if (!status)
-	{
-		setDefaultRamp();
-		return;
-	}
-
-	// Retrieve the correct falloff ramp
-	MIntArray logicalIndices;
-	activeManipPlug.array().getExistingArrayAttributeIndices(logicalIndices);
-	unsigned int logicalIndex = activeManipPlug.logicalIndex();
-	int physicalIndex = -1;
-	for (unsigned int i = 0; i < logicalIndices.length(); ++i)
-	{
-		if (logicalIndices[i] == logicalIndex)
-			physicalIndex = i;
-	}
-	if (physicalIndex == -1)
+	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
+	if (activeIndex == -1 || (unsigned int)activeIndex >= curveData.positionAdjustments.size())
 	{
 		setDefaultRamp();
 		return;
 	}
 
-	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
-	assert(physicalIndex < curveData.positionAdjustments.size());
-	PositionAdjustment positionAdjustmentRamp = curveData.positionAdjustments[physicalIndex];
-
-	// Constants
-	double maxIntensity = 0.9;
-
-	// Calculate pixel data
-	unsigned int pointerOffset = 0;
-	for (unsigned int pixelIndex = 0; pixelIndex < m_texturedPixelCount; ++pixelIndex)
-	{
-		double falloffParam = (double)pixelIndex / (m_texturedPixelCount - 1);
-		double pixelWeight = positionAdjustmentRamp.curve.getValue(falloffParam);
-
-		char rChannel = (char)((pixelWeight * 255) + (1.0 - pixelWeight) * 128);
-		// Max intensity simply reduces the intensity of the red color
-		char bgChannel = (char)((1.0 - pixelWeight * maxIntensity) * 128);
-
-		m_texturedPixels[pointerOffset++] = rChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = bgChannel;
-		m_texturedPixels[pointerOffset++] = 255;
-	}
-
-	// Create image for texture
-	MImage image;
-	image.setPixels(m_texturedPixels, m_texturedPixelCount, 1);
-	m_rampTexture->update(image, false);
-}
-
-void FlexiInstancer_SubSceneOverride::updateSurfaceShader(MShaderInstance* shader, const char* colorParameter, MColor color)
-{
-	shader->setParameter(colorParameter, &color.r);
-}
+	const PositionAdjustment& positionAdjustmentRamp = curveData.positionAdjustments[activeIndex];
 
-void FlexiInstancer_SubSceneOverride::updateLineShader(MShaderInstance* shader, const char* lineWidthParameter, float lineWidth, const char* colorParameter, MColor color)
-{
-	shader->setParameter(colorParameter, &color.r);
-	// Not sure what first number does
-	float lineWidthArray[2] = { lineWidth, lineWidth };
-	shader->setParameter(lineWidthParameter, lineWidthArray);
+	writeFlexiFalloffRamp(positionAdjustmentRamp.curve, m_texturedPixelCount, m_texturedPixels);
+	uploadFlexiRamp(m_texturedPixels, m_texturedPixelCount, m_rampTexture);
 }
 
 // Ribbon buffers
 void FlexiInstancer_SubSceneOverride::updateRibbonGeometryBuffers()
 {
-	deleteRibbonVertexBuffers();
-
 	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
 	// The total curve vertex count excludes the last sample as it overlaps the first sample whilst including two extra samples representing the curve thresholds
 	// If the offset equals zero, then we just use the sample data as the thresholds will be included
@@ -1017,298 +783,143 @@ void FlexiInstancer_SubSceneOverride::updateRibbonGeometryBuffers()
 	unsigned int surfaceIndicesCount = (curveVertexCount - 1) * 6;
 	unsigned int borderIndicesCount = curveVertexCount * 4;
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor surfacePositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	const MVertexBufferDescriptor surfaceNormalDesc("", MGeometry::kNormal, MGeometry::kFloat, 3);
-	const MVertexBufferDescriptor surfaceTextureDesc("", MGeometry::kTexture, MGeometry::kFloat, 2);
-	m_surfacePositionBuffer = new MVertexBuffer(surfacePositionDesc);
-	m_surfaceNormalBuffer = new MVertexBuffer(surfaceNormalDesc);
-	m_surfaceTextureBuffer = new MVertexBuffer(surfaceTextureDesc);
-
 	// VB for surface positions
-	if (m_surfacePositionBuffer)
+	// Return a block of memory to fill with our position data (the buffer is only reallocated if the vertex count has grown)
+	float* surfacePositions = m_surfacePositionBuffer.acquire(surfaceVertexCount);
+	if (surfacePositions)
 	{
-		// Return a block of memory to fill with our position data (bytes = size * desc.dataTypeSize() * desc.dimension())
-		float* surfacePositions = (float*)m_surfacePositionBuffer->acquire(surfaceVertexCount, true /*writeOnly*/);
-		if (surfacePositions)
+		int pointerOffset = 0;
+
+		if (curveData.offset == 0.0)
+		{
+			pointerOffset += streamFlexiOffsetPairs(curveData.points.lanes(), curveData.binormals.lanes(), m_ribbonWidthScale, curveVertexCount, surfacePositions + pointerOffset);
+		}
+		else
 		{
-			int pointerOffset = 0;
+			// Lower bound sample
+			pointerOffset += streamFlexiOffsetPairs(MRS::ConstVectorLanes{ curveData.vLowerBoundPoint }, MRS::ConstVectorLanes{ curveData.vLowerBoundBinormal }, m_ribbonWidthScale, 1, surfacePositions + pointerOffset);
 
-			if (curveData.offset == 0.0)
-			{
-				for (unsigned int i = 0; i < curveVertexCount; i++)
-				{
-					MFloatVector vert = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale;
-					MFloatVector vertOpposite = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale * -1;
-
-					surfacePositions[pointerOffset++] = vert[0];
-					surfacePositions[pointerOffset++] = vert[1];
-					surfacePositions[pointerOffset++] = vert[2];
-					surfacePositions[pointerOffset++] = vertOpposite[0];
-					surfacePositions[pointerOffset++] = vertOpposite[1];
-					surfacePositions[pointerOffset++] = vertOpposite[2];
-				}
-			}
-			else
-			{
-				// Lower bound sample
-				MFloatVector vert = curveData.vLowerBoundPoint + curveData.vLowerBoundBinormal * m_ribbonWidthScale;
-				MFloatVector vertOpposite = curveData.vLowerBoundPoint + curveData.vLowerBoundBinormal * m_ribbonWidthScale * -1;
-
-				surfacePositions[pointerOffset++] = vert[0];
-				surfacePositions[pointerOffset++] = vert[1];
-				surfacePositions[pointerOffset++] = vert[2];
-				surfacePositions[pointerOffset++] = vertOpposite[0];
-				surfacePositions[pointerOffset++] = vertOpposite[1];
-				surfacePositions[pointerOffset++] = vertOpposite[2];
-
-				// Mid samples
-				for (unsigned int i = curveData.minParamIndex; i < curveVertexCount - 2; i++)
-				{
-					vert = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale;
-					vertOpposite = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale * -1;
-
-					surfacePositions[pointerOffset++] = vert[0];
-					surfacePositions[pointerOffset++] = vert[1];
-					surfacePositions[pointerOffset++] = vert[2];
-					surfacePositions[pointerOffset++] = vertOpposite[0];
-					surfacePositions[pointerOffset++] = vertOpposite[1];
-					surfacePositions[pointerOffset++] = vertOpposite[2];
-				}
-
-				for (unsigned int i = 0; i < curveData.minParamIndex; i++)
-				{
-					vert = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale;
-					vertOpposite = curveData.points[i] + curveData.binormals[i] * m_ribbonWidthScale * -1;
-
-					surfacePositions[pointerOffset++] = vert[0];
-					surfacePositions[pointerOffset++] = vert[1];
-					surfacePositions[pointerOffset++] = vert[2];
-					surfacePositions[pointerOffset++] = vertOpposite[0];
-					surfacePositions[pointerOffset++] = vertOpposite[1];
-					surfacePositions[pointerOffset++] = vertOpposite[2];
-				}
-
-				// Upper bound sample
-				vert = curveData.vUpperBoundPoint + curveData.vUpperBoundBinormal * m_ribbonWidthScale;
-				vertOpposite = curveData.vUpperBoundPoint + curveData.vUpperBoundBinormal * m_ribbonWidthScale * -1;
-
-				surfacePositions[pointerOffset++] = vert[0];
-				surfacePositions[pointerOffset++] = vert[1];
-				surfacePositions[pointerOffset++] = vert[2];
-				surfacePositions[pointerOffset++] = vertOpposite[0];
-				surfacePositions[pointerOffset++] = vertOpposite[1];
-				surfacePositions[pointerOffset++] = vertOpposite[2];
-			}
+			// Mid samples
+			pointerOffset += streamFlexiOffsetPairs(curveData.points.lanes().offset(curveData.minParamIndex), curveData.binormals.lanes().offset(curveData.minParamIndex), m_ribbonWidthScale, curveVertexCount - 2 - curveData.minParamIndex, surfacePositions + pointerOffset);
 
-			// Transfer from CPU to GPU memory
-			m_surfacePositionBuffer->commit(surfacePositions);
+			pointerOffset += streamFlexiOffsetPairs(curveData.points.lanes(), curveData.binormals.lanes(), m_ribbonWidthScale, curveData.minParamIndex, surfacePositions + pointerOffset);
+
+			// Upper bound sample
+			pointerOffset += streamFlexiOffsetPairs(MRS::ConstVectorLanes{ curveData.vUpperBoundPoint }, MRS::ConstVectorLanes{ curveData.vUpperBoundBinormal }, m_ribbonWidthScale, 1, surfacePositions + pointerOffset);
 		}
+
+		// Transfer from CPU to GPU memory
+		m_surfacePositionBuffer.commit(surfacePositions);
 	}
 
 	// VB for surface normals
-	if (m_surfaceNormalBuffer)
+	float* surfaceNormals = m_surfaceNormalBuffer.acquire(surfaceVertexCount);
+	if (surfaceNormals)
 	{
-		float* surfaceNormals = (float*)m_surfaceNormalBuffer->acquire(surfaceVertexCount, true /*writeOnly*/);
-		if (surfaceNormals)
+		int pointerOffset = 0;
+
+		if (curveData.offset == 0.0)
+		{
+			pointerOffset += streamFlexiVectorPairs(curveData.normals.lanes(), curveVertexCount, surfaceNormals + pointerOffset);
+		}
+		else
 		{
-			int pointerOffset = 0;
+			// Lower bound sample
+			pointerOffset += streamFlexiVectorPairs(MRS::ConstVectorLanes{ curveData.vLowerBoundNormal }, 1, surfaceNormals + pointerOffset);
 
-			if (curveData.offset == 0.0)
-			{
-				for (unsigned int i = 0; i < curveVertexCount; i++)
-				{
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-				}
-			}
-			else
-			{
-				// Lower bound sample
-				surfaceNormals[pointerOffset++] = (float)curveData.vLowerBoundNormal[0];
-				surfaceNormals[pointerOffset++] = (float)curveData.vLowerBoundNormal[1];
-				surfaceNormals[pointerOffset++] = (float)curveData.vLowerBoundNormal[2];
-				surfaceNormals[pointerOffset++] = (float)curveData.vLowerBoundNormal[0];
-				surfaceNormals[pointerOffset++] = (float)curveData.vLowerBoundNormal[1];
-				surfaceNormals[pointerOffset++] = (float)curveData.vLowerBoundNormal[2];
-
-				// Mid samples
-				for (unsigned int i = curveData.minParamIndex; i < curveVertexCount - 2; i++)
-				{
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-				}
-
-				for (unsigned int i = 0; i < curveData.minParamIndex; i++)
-				{
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][0];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][1];
-					surfaceNormals[pointerOffset++] = (float)curveData.normals[i][2];
-				}
-
-				// Upper bound sample
-				surfaceNormals[pointerOffset++] = (float)curveData.vUpperBoundNormal[0];
-				surfaceNormals[pointerOffset++] = (float)curveData.vUpperBoundNormal[1];
-				surfaceNormals[pointerOffset++] = (float)curveData.vUpperBoundNormal[2];
-				surfaceNormals[pointerOffset++] = (float)curveData.vUpperBoundNormal[0];
-				surfaceNormals[pointerOffset++] = (float)curveData.vUpperBoundNormal[1];
-				surfaceNormals[pointerOffset++] = (float)curveData.vUpperBoundNormal[2];
-			}
+			// Mid samples
+			pointerOffset += streamFlexiVectorPairs(curveData.normals.lanes().offset(curveData.minParamIndex), curveVertexCount - 2 - curveData.minParamIndex, surfaceNormals + pointerOffset);
+
+			pointerOffset += streamFlexiVectorPairs(curveData.normals.lanes(), curveData.minParamIndex, surfaceNormals + pointerOffset);
 
-			m_surfaceNormalBuffer->commit(surfaceNormals);
+			// Upper bound sample
+			pointerOffset += streamFlexiVectorPairs(MRS::ConstVectorLanes{ curveData.vUpperBoundNormal }, 1, surfaceNormals + pointerOffset);
 		}
+
+		m_surfaceNormalBuffer.commit(surfaceNormals);
 	}
 
 	// VB for surface textures
-	if (m_surfaceTextureBuffer)
+	float* surfaceTextures = m_surfaceTextureBuffer.acquire(surfaceVertexCount);
+	if (surfaceTextures)
 	{
-		float* surfaceTextures = (float*)m_surfaceTextureBuffer->acquire(surfaceVertexCount, true /*writeOnly*/);
-		if (surfaceTextures)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveVertexCount; i++)
-			{
-				float xCoord = (float)i / (curveVertexCount - 1);
-				surfaceTextures[pointerOffset++] = xCoord;
-				surfaceTextures[pointerOffset++] = 1.0f;
-				surfaceTextures[pointerOffset++] = xCoord;
-				surfaceTextures[pointerOffset++] = 0.0f;
-			}
-			
-			// The texture will fill a 1*1 UV patch
-			// Ensure our UVs do not reach all the way to the edge of this patch as this was causing a bleeding effect on the first and last pixels
-			surfaceTextures[0] = 0.001f;
-			surfaceTextures[2] = 0.001f;
-			surfaceTextures[pointerOffset - 4] = 0.999f;
-			surfaceTextures[pointerOffset - 2] = 0.999f;
-
-			m_surfaceTextureBuffer->commit(surfaceTextures);
+		for (unsigned int i = 0; i < curveVertexCount; i++)
+		{
+			float xCoord = (float)i / (curveVertexCount - 1);
+			surfaceTextures[pointerOffset++] = xCoord;
+			surfaceTextures[pointerOffset++] = 1.0f;
+			surfaceTextures[pointerOffset++] = xCoord;
+			surfaceTextures[pointerOffset++] = 0.0f;
 		}
+		
+		// The texture will fill a 1*1 UV patch
+		// Ensure our UVs do not reach all the way to the edge of this patch as this was causing a bleeding effect on the first and last pixels
+		surfaceTextures[0] = 0.001f;
+		surfaceTextures[2] = 0.001f;
+		surfaceTextures[pointerOffset - 4] = 0.999f;
+		surfaceTextures[pointerOffset - 2] = 0.999f;
+
+		m_surfaceTextureBuffer.commit(surfaceTextures);
 	}
 
-	// Index buffers only need to be updated if the sampleCount changes
-	if (surfaceVertexCount == m_surfaceVertexCount)
+	// Index buffers only need to be regenerated if the topology changes
+	const FlexiTopology topology{ surfaceVertexCount };
+	if (m_surfaceIndexBuffer.isValid(topology) && m_borderIndexBuffer.isValid(topology))
 		return;
 
-	m_surfaceVertexCount = surfaceVertexCount;
-
-	deleteRibbonIndexBuffers();
-	m_surfaceIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-	m_borderIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for surface item
-	if (m_surfaceIndexBuffer)
+	unsigned int* surfaceIndices = m_surfaceIndexBuffer.acquire(surfaceIndicesCount);
+	if (surfaceIndices)
 	{
-		unsigned int* surfaceIndices = (unsigned int*)m_surfaceIndexBuffer->acquire(surfaceIndicesCount, true /*writeOnly*/);
-		if (surfaceIndices)
-		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < curveVertexCount - 1; i++)
-			{
-				// First triangle
-				surfaceIndices[pointerOffset++] = i * 2;
-				surfaceIndices[pointerOffset++] = i * 2 + 1;
-				surfaceIndices[pointerOffset++] = i * 2 + 2;
-
-				// Second triangle
-				surfaceIndices[pointerOffset++] = i * 2 + 3;
-				surfaceIndices[pointerOffset++] = i * 2 + 2;
-				surfaceIndices[pointerOffset++] = i * 2 + 1;
-			}
-
-			m_surfaceIndexBuffer->commit(surfaceIndices);
-		}
-	}
+		int pointerOffset = 0;
 
-	// IB for border item
-	if (m_borderIndexBuffer)
-	{
-		unsigned int* borderIndices = (unsigned int*)m_borderIndexBuffer->acquire(borderIndicesCount, true /*writeOnly*/);
-		if (borderIndices)
+		for (unsigned int i = 0; i < curveVertexCount - 1; i++)
 		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < curveVertexCount - 1; i++)
-			{
-				// Top
-				borderIndices[pointerOffset++] = i * 2;
-				borderIndices[pointerOffset++] = i * 2 + 2;
-				// Bottom
-				borderIndices[pointerOffset++] = i * 2 + 1;
-				borderIndices[pointerOffset++] = i * 2 + 3;
-			}
-			// Left
-			borderIndices[pointerOffset++] = 0;
-			borderIndices[pointerOffset++] = 1;
-			// Right
-			borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2;
-			borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2 + 1;
-
-			m_borderIndexBuffer->commit(borderIndices);
+			// First triangle
+			surfaceIndices[pointerOffset++] = i * 2;
+			surfaceIndices[pointerOffset++] = i * 2 + 1;
+			surfaceIndices[pointerOffset++] = i * 2 + 2;
+
+			// Second triangle
+			surfaceIndices[pointerOffset++] = i * 2 + 3;
+			surfaceIndices[pointerOffset++] = i * 2 + 2;
+			surfaceIndices[pointerOffset++] = i * 2 + 1;
 		}
-	}
-}
 
-void FlexiInstancer_SubSceneOverride::deleteRibbonVertexBuffers()
-{
-	if (m_surfacePositionBuffer)
-	{
-		delete m_surfacePositionBuffer;
-		m_surfacePositionBuffer = nullptr;
+		m_surfaceIndexBuffer.commit(surfaceIndices, topology);
 	}
 
-	if (m_surfaceNormalBuffer)
-	{
-		delete m_surfaceNormalBuffer;
-		m_surfaceNormalBuffer = nullptr;
-	}
-
-	if (m_surfaceTextureBuffer)
-	{
-		delete m_surfaceTextureBuffer;
-		m_surfaceTextureBuffer = nullptr;
-	}
-}
-
-void FlexiInstancer_SubSceneOverride::deleteRibbonIndexBuffers()
-{
-	if (m_surfaceIndexBuffer)
+	// IB for border item
+	unsigned int* borderIndices = m_borderIndexBuffer.acquire(borderIndicesCount);
+	if (borderIndices)
 	{
-		delete m_surfaceIndexBuffer;
-		m_surfaceIndexBuffer = nullptr;
-	}
+		int pointerOffset = 0;
 
-	if (m_borderIndexBuffer)
-	{
-		delete m_borderIndexBuffer;
-		m_borderIndexBuffer = nullptr;
+		for (unsigned int i = 0; i < curveVertexCount - 1; i++)
+		{
+			// Top
+			borderIndices[pointerOffset++] = i * 2;
+			borderIndices[pointerOffset++] = i * 2 + 2;
+			// Bottom
+			borderIndices[pointerOffset++] = i * 2 + 1;
+			borderIndices[pointerOffset++] = i * 2 + 3;
+		}
+		// Left
+		borderIndices[pointerOffset++] = 0;
+		borderIndices[pointerOffset++] = 1;
+		// Right
+		borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2;
+		borderIndices[pointerOffset++] = (curveVertexCount - 1) * 2 + 1;
+
+		m_borderIndexBuffer.commit(borderIndices, topology);
 	}
 }
 
-void FlexiInstancer_SubSceneOverride::deleteRibbonGeometryBuffers()
-{
-	deleteRibbonVertexBuffers();
-	deleteRibbonIndexBuffers();
-}
-
 // Curve buffers
 void FlexiInstancer_SubSceneOverride::updateCurveGeometryBuffers()
 {
-	deleteCurveVertexBuffers();
-
 	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
 	// The total curve vertex count excludes the last sample as it overlaps the first sample whilst including two extra samples representing the curve thresholds
 	unsigned int curveVertexCount = curveData.sampleCount + 1;
@@ -1318,52 +929,30 @@ void FlexiInstancer_SubSceneOverride::updateCurveGeometryBuffers()
 	unsigned int preWrapVertexCount = curveData.minParamIndex == 0 ? 0 : curveVertexCount - 2 - curveData.minParamIndex;
 	unsigned int postWrapVertexCount = curveVertexCount - 2 - preWrapVertexCount;
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor curvePositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_curvePositionBuffer = new MVertexBuffer(curvePositionDesc);
-
 	// VB for curve positions
-	if (m_curvePositionBuffer)
+	float* curvePositions = m_curvePositionBuffer.acquire(curveVertexCount);
+	if (curvePositions)
 	{
-		float* curvePositions = (float*)m_curvePositionBuffer->acquire(curveVertexCount, true /*writeOnly*/);
-		if (curvePositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			// Lower bound sample
-			curvePositions[pointerOffset++] = (float)curveData.vLowerBoundPoint[0];
-			curvePositions[pointerOffset++] = (float)curveData.vLowerBoundPoint[1];
-			curvePositions[pointerOffset++] = (float)curveData.vLowerBoundPoint[2];
+		// Lower bound sample
+		pointerOffset += streamFlexiVectors(&curveData.vLowerBoundPoint, 1, curvePositions + pointerOffset);
 
-			// Mid samples (wrap vertex included at i = 0)
-			for (unsigned int i = curveData.minParamIndex; i < curveData.sampleCount - 1; i++)
-			{
-				curvePositions[pointerOffset++] = (float)curveData.points[i][0];
-				curvePositions[pointerOffset++] = (float)curveData.points[i][1];
-				curvePositions[pointerOffset++] = (float)curveData.points[i][2];
-			}
+		// Mid samples (wrap vertex included at i = 0)
+		pointerOffset += streamFlexiVectors(curveData.points.lanes().offset(curveData.minParamIndex), curveData.sampleCount - 1 - curveData.minParamIndex, curvePositions + pointerOffset);
 
-			for (unsigned int i = 0; i < curveData.minParamIndex; i++)
-			{
-				curvePositions[pointerOffset++] = (float)curveData.points[i][0];
-				curvePositions[pointerOffset++] = (float)curveData.points[i][1];
-				curvePositions[pointerOffset++] = (float)curveData.points[i][2];
-			}
+		pointerOffset += streamFlexiVectors(curveData.points.lanes(), curveData.minParamIndex, curvePositions + pointerOffset);
 
-			// Upper bound sample
-			curvePositions[pointerOffset++] = (float)curveData.vUpperBoundPoint[0];
-			curvePositions[pointerOffset++] = (float)curveData.vUpperBoundPoint[1];
-			curvePositions[pointerOffset++] = (float)curveData.vUpperBoundPoint[2];
+		// Upper bound sample
+		pointerOffset += streamFlexiVectors(&curveData.vUpperBoundPoint, 1, curvePositions + pointerOffset);
 
-			m_curvePositionBuffer->commit(curvePositions);
-		}
+		m_curvePositionBuffer.commit(curvePositions);
 	}
 
-	// The index buffer always need to be recalculated due to the offset
-	m_curveVertexCount = curveVertexCount;
-
-	deleteCurveIndexBuffers();
-	m_curveIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
+	// The index buffer only needs to be regenerated if the sample count, closed state or wrap vertex (determined by the offset) changes
+	const FlexiTopology topology{ curveVertexCount, curveData.minParamIndex, curveData.isClosed };
+	if (m_curveIndexBuffer.isValid(topology))
+		return;
 
 	// IB for curve item
 	unsigned int curveIndicesCount = 0;
@@ -1378,355 +967,172 @@ void FlexiInstancer_SubSceneOverride::updateCurveGeometryBuffers()
 	else if (postWrapVertexCount > 0)
 		curveIndicesCount += postWrapVertexCount;
 
-	if (m_curveIndexBuffer)
+	unsigned int* curveIndices = m_curveIndexBuffer.acquire(curveIndicesCount);
+	if (curveIndices)
 	{
-		unsigned int* curveIndices = (unsigned int*)m_curveIndexBuffer->acquire(curveIndicesCount, true /*writeOnly*/);
-		if (curveIndices)
-		{
-			int pointerOffset = 0;
-
-			if (preWrapVertexCount % 2)
-			{
-				// Create a segment between the low threshold and the first pre wrap sample
-				// Create segments between every other pre wrap sample
-				// There will not be a segment connecting the last pre wrap sample with the wrap sample
-				for (unsigned int i = 0; i <= preWrapVertexCount; i++)
-					curveIndices[pointerOffset++] = i;
-			}
-			else if (preWrapVertexCount > 0)
-			{
-				// Skipping the low threshold, create a segment between the first pre wrap sample and the next
-				// Create segments between every other pre wrap sample
-				// There will not be a segment connecting the last pre wrap sample with the wrap sample
-				for (unsigned int i = 1; i <= preWrapVertexCount; i++)
-					curveIndices[pointerOffset++] = i;
-			}
-
-			if (postWrapVertexCount % 2)
-			{
-				// Create a segment from the first post wrap sample to the next (remember first post wrap is the wrap sample)
-				// Create segments between every other post wrap sample
-				// There will be a segment connecting the last post wrap sample with upper threshold
-				for (unsigned int i = preWrapVertexCount + 1; i <= preWrapVertexCount + 1 + postWrapVertexCount; i++)
-					curveIndices[pointerOffset++] = i;
-			}
-			else if (postWrapVertexCount > 0)
-			{
-				// Create a segment from the first post wrap sample to the next (remember first post wrap is the wrap sample)
-				// Create segments between every other post wrap sample
-				// There will not be a segment connecting the last post wrap sample with upper threshold
-				for (unsigned int i = preWrapVertexCount + 1; i <= preWrapVertexCount + postWrapVertexCount; i++)
-					curveIndices[pointerOffset++] = i;
-			}
+		int pointerOffset = 0;
 
-			m_curveIndexBuffer->commit(curveIndices);
+		if (preWrapVertexCount % 2)
+		{
+			// Create a segment between the low threshold and the first pre wrap sample
+			// Create segments between every other pre wrap sample
+			// There will not be a segment connecting the last pre wrap sample with the wrap sample
+			for (unsigned int i = 0; i <= preWrapVertexCount; i++)
+				curveIndices[pointerOffset++] = i;
+		}
+		else if (preWrapVertexCount > 0)
+		{
+			// Skipping the low threshold, create a segment between the first pre wrap sample and the next
+			// Create segments between every other pre wrap sample
+			// There will not be a segment connecting the last pre wrap sample with the wrap sample
+			for (unsigned int i = 1; i <= preWrapVertexCount; i++)
+				curveIndices[pointerOffset++] = i;
 		}
-	}
-}
 
-void FlexiInstancer_SubSceneOverride::deleteCurveVertexBuffers()
-{
-	if (m_curvePositionBuffer)
-	{
-		delete m_curvePositionBuffer;
-		m_curvePositionBuffer = nullptr;
-	}
-}
+		if (postWrapVertexCount % 2)
+		{
+			// Create a segment from the first post wrap sample to the next (remember first post wrap is the wrap sample)
+			// Create segments between every other post wrap sample
+			// There will be a segment connecting the last post wrap sample with upper threshold
+			for (unsigned int i = preWrapVertexCount + 1; i <= preWrapVertexCount + 1 + postWrapVertexCount; i++)
+				curveIndices[pointerOffset++] = i;
+		}
+		else if (postWrapVertexCount > 0)
+		{
+			// Create a segment from the first post wrap sample to the next (remember first post wrap is the wrap sample)
+			// Create segments between every other post wrap sample
+			// There will not be a segment connecting the last post wrap sample with upper threshold
+			for (unsigned int i = preWrapVertexCount + 1; i <= preWrapVertexCount + postWrapVertexCount; i++)
+				curveIndices[pointerOffset++] = i;
+		}
 
-void FlexiInstancer_SubSceneOverride::deleteCurveIndexBuffers()
-{
-	if (m_curveIndexBuffer)
-	{
-		delete m_curveIndexBuffer;
-		m_curveIndexBuffer = nullptr;
+		m_curveIndexBuffer.commit(curveIndices, topology);
 	}
 }
 
-void FlexiInstancer_SubSceneOverride::deleteCurveGeometryBuffers()
-{
-	deleteCurveVertexBuffers();
-	deleteCurveIndexBuffers();
-}
-
 // Normals buffers
 void FlexiInstancer_SubSceneOverride::updateNormalsGeometryBuffers()
 {
-	deleteNormalsVertexBuffers();
-
 	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
 	unsigned int normalsVertexCount = curveData.instanceCount * 2;
 	unsigned int skipCount = (curveData.sampleCount - 1) / (curveData.instanceCount - 1);
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor normalsPositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_normalsPositionBuffer = new MVertexBuffer(normalsPositionDesc);
-
 	// VB for normals positions
-	if (m_normalsPositionBuffer)
+	float* normalsPositions = m_normalsPositionBuffer.acquire(normalsVertexCount);
+	if (normalsPositions)
 	{
-		float* normalsPositions = (float*)m_normalsPositionBuffer->acquire(normalsVertexCount, true /*writeOnly*/);
-		if (normalsPositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < curveData.instanceCount; i++)
-			{
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][0];
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][1];
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][2];
+		pointerOffset += streamFlexiSegments(curveData.points.lanes(), curveData.normals.lanes(), m_normalsLengthScale, skipCount, curveData.instanceCount, normalsPositions + pointerOffset);
 
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][0] + (float)curveData.normals[i * skipCount][0] * m_normalsLengthScale;
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][1] + (float)curveData.normals[i * skipCount][1] * m_normalsLengthScale;
-				normalsPositions[pointerOffset++] = (float)curveData.points[i * skipCount][2] + (float)curveData.normals[i * skipCount][2] * m_normalsLengthScale;
-			}
-
-			m_normalsPositionBuffer->commit(normalsPositions);
-		}
+		m_normalsPositionBuffer.commit(normalsPositions);
 	}
 
-	// Index buffers only need to be updated if the sampleCount attribute changes
-	if (normalsVertexCount == m_normalsVertexCount)
+	// Index buffers only need to be regenerated if the topology changes
+	const FlexiTopology topology{ normalsVertexCount };
+	if (m_normalsIndexBuffer.isValid(topology))
 		return;
 
-	m_normalsVertexCount = normalsVertexCount;
-
-	deleteNormalsIndexBuffers();
-	m_normalsIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for normals item
-	if (m_normalsIndexBuffer)
+	unsigned int* normalsIndices = m_normalsIndexBuffer.acquire(normalsVertexCount);
+	if (normalsIndices)
 	{
-		unsigned int* normalsIndices = (unsigned int*)m_normalsIndexBuffer->acquire(normalsVertexCount, true /*writeOnly*/);
-		if (normalsIndices)
-		{
-			int pointerOffset = 0;
-
-			for (unsigned int i = 0; i < normalsVertexCount; i++)
-				normalsIndices[pointerOffset++] = i;
-
-			m_normalsIndexBuffer->commit(normalsIndices);
-		}
-	}
-}
+		int pointerOffset = 0;
 
-void FlexiInstancer_SubSceneOverride::deleteNormalsVertexBuffers()
-{
-	if (m_normalsPositionBuffer)
-	{
-		delete m_normalsPositionBuffer;
-		m_normalsPositionBuffer = nullptr;
-	}
-}
+		for (unsigned int i = 0; i < normalsVertexCount; i++)
+			normalsIndices[pointerOffset++] = i;
 
-void FlexiInstancer_SubSceneOverride::deleteNormalsIndexBuffers()
-{
-	if (m_normalsIndexBuffer)
-	{
-		delete m_normalsIndexBuffer;
-		m_normalsIndexBuffer = nullptr;
+		m_normalsIndexBuffer.commit(normalsIndices, topology);
 	}
 }
 
-void FlexiInstancer_SubSceneOverride::deleteNormalsGeometryBuffers()
-{
-	deleteNormalsVertexBuffers();
-	deleteNormalsIndexBuffers();
-}
-
 // Hull buffers
 void FlexiInstancer_SubSceneOverride::updateHullGeometryBuffers()
 {
-	deleteHullVertexBuffers();
-
 	const FlexiInstancer::FlexiInstancer_Data& curveData = m_locator->getCurveData();
 	unsigned int hullVertexCount = (int)curveData.controlPoints.size();
 	unsigned int hullIndicesCount = (hullVertexCount - 1) * 2;
 
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor hullPositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_hullPositionBuffer = new MVertexBuffer(hullPositionDesc);
-
 	// VB for hull positions
-	if (m_hullPositionBuffer)
+	float* hullPositions = m_hullPositionBuffer.acquire(hullVertexCount);
+	if (hullPositions)
 	{
-		float* hullPositions = (float*)m_hullPositionBuffer->acquire(hullVertexCount, true /*writeOnly*/);
-		if (hullPositions)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < hullVertexCount; i++)
-			{
-				hullPositions[pointerOffset++] = (float)curveData.controlPoints[i][0];
-				hullPositions[pointerOffset++] = (float)curveData.controlPoints[i][1];
-				hullPositions[pointerOffset++] = (float)curveData.controlPoints[i][2];
-			}
+		pointerOffset += streamFlexiVectors(curveData.controlPoints.data(), hullVertexCount, hullPositions + pointerOffset);
 
-			m_hullPositionBuffer->commit(hullPositions);
-		}
+		m_hullPositionBuffer.commit(hullPositions);
 	}
 
-	// Index buffers only need to be updated if the sampleCount attribute changes
-	if (hullVertexCount == m_hullVertexCount)
+	// Index buffers only need to be regenerated if the topology changes
+	const FlexiTopology topology{ hullVertexCount };
+	if (m_hullIndexBuffer.isValid(topology))
 		return;
 
-	m_hullVertexCount = hullVertexCount;
-
-	deleteHullIndexBuffers();
-	m_hullIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for hull item
-	if (m_hullIndexBuffer)
+	unsigned int* hullIndices = m_hullIndexBuffer.acquire(hullIndicesCount);
+	if (hullIndices)
 	{
-		unsigned int* hullIndices = (unsigned int*)m_hullIndexBuffer->acquire(hullIndicesCount, true /*writeOnly*/);
-		if (hullIndices)
-		{
-			int pointerOffset = 0;
+		int pointerOffset = 0;
 
-			for (unsigned int i = 0; i < hullVertexCount - 1; i++)
-			{
-				hullIndices[pointerOffset++] = i;
-				hullIndices[pointerOffset++] = i + 1;
-			}
-
-			m_hullIndexBuffer->commit(hullIndices);
+		for (unsigned int i = 0; i < hullVertexCount - 1; i++)
+		{
+			hullIndices[pointerOffset++] = i;
+			hullIndices[pointerOffset++] = i + 1;
 		}
-	}
-}
-
-void FlexiInstancer_SubSceneOverride::deleteHullVertexBuffers()
-{
-	if (m_hullPositionBuffer)
-	{
-		delete m_hullPositionBuffer;
-		m_hullPositionBuffer = nullptr;
-	}
-}
 
-void FlexiInstancer_SubSceneOverride::deleteHullIndexBuffers()
-{
-	if (m_hullIndexBuffer)
-	{
-		delete m_hullIndexBuffer;
-		m_hullIndexBuffer = nullptr;
+		m_hullIndexBuffer.commit(hullIndices, topology);
 	}
 }
 
-void FlexiInstancer_SubSceneOverride::deleteHullGeometryBuffers()
-{
-	deleteHullVertexBuffers();
-	deleteHullIndexBuffers();
-}
-
 // Bounding box buffers
 void FlexiInstancer_SubSceneOverride::updateBoundingBoxGeometryBuffers(const MBoundingBox& bounds)
 {
-	deleteBoundingBoxVertexBuffers();
-
-	// Acquire vertex buffer resources
-	const MVertexBufferDescriptor boundingBoxPositionDesc("", MGeometry::kPosition, MGeometry::kFloat, 3);
-	m_boundingBoxPositionBuffer = new MVertexBuffer(boundingBoxPositionDesc);
-
 	// VB for bounding box positions
-	if (m_boundingBoxPositionBuffer)
+	float* boundingBoxPositions = m_boundingBoxPositionBuffer.acquire(8);
+	if (boundingBoxPositions)
 	{
-		float* boundingBoxPositions = (float*)m_boundingBoxPositionBuffer->acquire(8, true /*writeOnly*/);
-		if (boundingBoxPositions)
-		{
-			MPoint pMin = bounds.min();
-			MPoint pMax = bounds.max();
-			
-			boundingBoxPositions[0] = (float)pMin.x; boundingBoxPositions[1] = (float)pMin.y; boundingBoxPositions[2] = (float)pMin.z;
-			boundingBoxPositions[3] = (float)pMin.x; boundingBoxPositions[4] = (float)pMin.y; boundingBoxPositions[5] = (float)pMax.z;
-			boundingBoxPositions[6] = (float)pMax.x; boundingBoxPositions[7] = (float)pMin.y; boundingBoxPositions[8] = (float)pMax.z;
-			boundingBoxPositions[9] = (float)pMax.x; boundingBoxPositions[10] = (float)pMin.y; boundingBoxPositions[11] = (float)pMin.z;
-			boundingBoxPositions[12] = (float)pMin.x; boundingBoxPositions[13] = (float)pMax.y; boundingBoxPositions[14] = (float)pMin.z;
-			boundingBoxPositions[15] = (float)pMin.x; boundingBoxPositions[16] = (float)pMax.y; boundingBoxPositions[17] = (float)pMax.z;
-			boundingBoxPositions[18] = (float)pMax.x; boundingBoxPositions[19] = (float)pMax.y; boundingBoxPositions[20] = (float)pMax.z;
-			boundingBoxPositions[21] = (float)pMax.x; boundingBoxPositions[22] = (float)pMax.y; boundingBoxPositions[23] = (float)pMin.z;
-			
-			m_boundingBoxPositionBuffer->commit(boundingBoxPositions);
-		}
+		MPoint pMin = bounds.min();
+		MPoint pMax = bounds.max();
+		
+		boundingBoxPositions[0] = (float)pMin.x; boundingBoxPositions[1] = (float)pMin.y; boundingBoxPositions[2] = (float)pMin.z;
+		boundingBoxPositions[3] = (float)pMin.x; boundingBoxPositions[4] = (float)pMin.y; boundingBoxPositions[5] = (float)pMax.z;
+		boundingBoxPositions[6] = (float)pMax.x; boundingBoxPositions[7] = (float)pMin.y; boundingBoxPositions[8] = (float)pMax.z;
+		boundingBoxPositions[9] = (float)pMax.x; boundingBoxPositions[10] = (float)pMin.y; boundingBoxPositions[11] = (float)pMin.z;
+		boundingBoxPositions[12] = (float)pMin.x; boundingBoxPositions[13] = (float)pMax.y; boundingBoxPositions[14] = (float)pMin.z;
+		boundingBoxPositions[15] = (float)pMin.x; boundingBoxPositions[16] = (float)pMax.y; boundingBoxPositions[17] = (float)pMax.z;
+		boundingBoxPositions[18] = (float)pMax.x; boundingBoxPositions[19] = (float)pMax.y; boundingBoxPositions[20] = (float)pMax.z;
+		boundingBoxPositions[21] = (float)pMax.x; boundingBoxPositions[22] = (float)pMax.y; boundingBoxPositions[23] = (float)pMin.z;
+		
+		m_boundingBoxPositionBuffer.commit(boundingBoxPositions);
 	}
 
 	// Index buffer is static once created
-	if (m_boundingBoxIndexBuffer)
+	const FlexiTopology topology{ 8 };
+	if (m_boundingBoxIndexBuffer.isValid(topology))
 		return;
 
-	m_boundingBoxIndexBuffer = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
-
 	// IB for bounding box item
-	if (m_boundingBoxIndexBuffer)
+	unsigned int* boundingBoxIndices = m_boundingBoxIndexBuffer.acquire(24);
+	if (boundingBoxIndices)
 	{
-		unsigned int* boundingBoxIndices = (unsigned int*)m_boundingBoxIndexBuffer->acquire(24, true /*writeOnly*/);
-		if (boundingBoxIndices)
-		{
-			boundingBoxIndices[0] = 0; boundingBoxIndices[1] = 1;
-			boundingBoxIndices[2] = 1; boundingBoxIndices[3] = 2;
-			boundingBoxIndices[4] = 2; boundingBoxIndices[5] = 3;
-			boundingBoxIndices[6] = 3; boundingBoxIndices[7] = 0;
-			boundingBoxIndices[8] = 4; boundingBoxIndices[9] = 5;
-			boundingBoxIndices[10] = 5; boundingBoxIndices[11] = 6;
-			boundingBoxIndices[12] = 6; boundingBoxIndices[13] = 7;
-			boundingBoxIndices[14] = 7; boundingBoxIndices[15] = 4;
-			boundingBoxIndices[16] = 0; boundingBoxIndices[17] = 4;
-			boundingBoxIndices[18] = 1; boundingBoxIndices[19] = 5;
-			boundingBoxIndices[20] = 2; boundingBoxIndices[21] = 6;
-			boundingBoxIndices[22] = 3; boundingBoxIndices[23] = 7;
-
-			m_boundingBoxIndexBuffer->commit(boundingBoxIndices);
-		}
+		boundingBoxIndices[0] = 0; boundingBoxIndices[1] = 1;
+		boundingBoxIndices[2] = 1; boundingBoxIndices[3] = 2;
+		boundingBoxIndices[4] = 2; boundingBoxIndices[5] = 3;
+		boundingBoxIndices[6] = 3; boundingBoxIndices[7] = 0;
+		boundingBoxIndices[8] = 4; boundingBoxIndices[9] = 5;
+		boundingBoxIndices[10] = 5; boundingBoxIndices[11] = 6;
+		boundingBoxIndices[12] = 6; boundingBoxIndices[13] = 7;
+		boundingBoxIndices[14] = 7; boundingBoxIndices[15] = 4;
+		boundingBoxIndices[16] = 0; boundingBoxIndices[17] = 4;
+		boundingBoxIndices[18] = 1; boundingBoxIndices[19] = 5;
+		boundingBoxIndices[20] = 2; boundingBoxIndices[21] = 6;
+		boundingBoxIndices[22] = 3; boundingBoxIndices[23] = 7;
+
+		m_boundingBoxIndexBuffer.commit(boundingBoxIndices, topology);
 	}
 }
 
-void FlexiInstancer_SubSceneOverride::deleteBoundingBoxVertexBuffers()
-{
-	if (m_boundingBoxPositionBuffer)
-	{
-		delete m_boundingBoxPositionBuffer;
-		m_boundingBoxPositionBuffer = nullptr;
-	}
-}
-
-void FlexiInstancer_SubSceneOverride::deleteBoundingBoxIndexBuffers()
-{
-	if (m_boundingBoxIndexBuffer)
-	{
-		delete m_boundingBoxIndexBuffer;
-		m_boundingBoxIndexBuffer = nullptr;
-	}
-}
-
-void FlexiInstancer_SubSceneOverride::deleteBoundingBoxGeometryBuffers()
-{
-	deleteBoundingBoxVertexBuffers();
-	deleteBoundingBoxIndexBuffers();
-}
-
-// All buffers
-void FlexiInstancer_SubSceneOverride::deleteVertexBuffers()
-{
-	deleteRibbonVertexBuffers();
-	deleteCurveVertexBuffers();
-	deleteNormalsVertexBuffers();
-	deleteHullVertexBuffers();
-	deleteBoundingBoxVertexBuffers();
-}
-
-void FlexiInstancer_SubSceneOverride::deleteIndexBuffers()
-{
-	deleteRibbonIndexBuffers();
-	deleteCurveIndexBuffers();
-	deleteNormalsIndexBuffers();
-	deleteHullIndexBuffers();
-	deleteBoundingBoxIndexBuffers();
-}
-
-void FlexiInstancer_SubSceneOverride::deleteGeometryBuffers()
-{
-	deleteVertexBuffers();
-	deleteIndexBuffers();
-}
-
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 static void printShaderParameters(MShaderInstance* shader)
@@ -102,8 +102,7 @@ private:
 	MPoint m_pEnd;
 
 	// Interaction
-	static const double m_offsetHandleDragIncrement;
-	int m_offsetHandleDragDirection;
+	static const unsigned int m_offsetHandleSubdivisions;
 	MVector m_vInterPlaneNormalOffsetHandle;
 	MPoint m_pMousePressOffsetHandle;
 	MVector m_vMousePressDirectionOffsetHandle;
@@ -115,17 +114,10 @@ private:
 	// ------ Helpers ------
 	MPoint sampleCurve(double param);
 
-	MPoint getCameraPosition(M3dView& view) const;
-	MPoint getCameraPosition(const MHWRender::MFrameContext& frameContext) const;
-	MVector getCameraAimDirection(M3dView& view) const;
-	MVector getCameraAimDirection(const MHWRender::MFrameContext& frameContext) const;
-	MVector getCameraUpDirection(M3dView& view) const;
-	MVector getCameraUpDirection(const MHWRender::MFrameContext& frameContext) const;
-
-	bool computeMouseIntersection(const MPoint& pMouse, const MVector& vMouseDirection, const MPoint& pPointOnInterPlane,
-		const MVector& vInterPlaneNormal, MPoint& pIntersection);
 	bool computeCurrentMouseIntersection(const MPoint& pPointOnInterPlane, const MVector& vInterPlaneNormal, MPoint& pIntersection);
 
+	double computeClosestCurveParam(const MPoint& pLineOrigin, const MVector& vLineDirection);
+
 	void updateOffsetHandle();
 
 	MStatus updateOffsetHandlePlug(double offset);
@@ -181,6 +173,7 @@ public:
 
 private:
 	// ------ Helpers ------
+	void publishActiveManip();
 	static void updateManipulatorsCallback(void* data);
 	static void nodePlugChangedCallback(MNodeMessage::AttributeMessage msg, MPlug& plug, MPlug& otherPlug, void* data);
 
@@ -178,6 +178,13 @@
 	twistAdjustmentRepeat, scaleAdjustmentRepeat - bool
 		Specifies whether to repeat the adjustment ramp so that it covers the curve's entire domain
 
+	forceSerialEvaluation - bool
+		Specifies whether to run every per-sample loop on the evaluating thread, designed to be used for debugging and profiling
+		The outputs are identical regardless of this setting
+
+	parallelGrainSize - int [1, inf)
+		Specifies the number of samples processed by each task when per-sample loops are distributed over Maya's thread pool
+
 	outputLocalFrames - matrixArray
 		Array of local space matrices sampled along the curve
 
@@ -210,6 +217,7 @@
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 FlexiSpine::FlexiSpine() :
+	m_drawDirtyCount{ 0 },
 	m_instanceAddedCallbackId{ 0 }
 {}
 
@@ -234,7 +242,10 @@ FlexiSpine::FlexiSpine_Data::FlexiSpine_Data() :
 	isCounterTwistUpVectorOverrideEnabled{ false },
 	isScaleAdjustmentEnabled{ false },
 	isTwistAdjustmentEnabled{ false },
+	isScaleAdjustmentDirty{ true },
+	isTwistAdjustmentDirty{ true },
 	isDrawRibbonEnabled{ true },
+	grainSize{ MRS::kDefaultGrainSize },
 	parameterizationBlend{ 1.0 },
 	counterTwistBlend{ 0.0 },
 	counterTwist{ 0.0 },
@@ -313,6 +324,8 @@ MObject FlexiSpine::scaleAdjustmentOffsetAttr;
 MObject FlexiSpine::scaleAdjustmentRepeatAttr;
 MObject FlexiSpine::scaleAdjustmentFalloffModeAttr;
 MObject FlexiSpine::scaleAdjustmentFalloffDistanceAttr;
+MObject FlexiSpine::forceSerialEvaluationAttr;
+MObject FlexiSpine::parallelGrainSizeAttr;
 MObject FlexiSpine::evalSinceDirtyAttr;
 MObject FlexiSpine::drawSinceEvalAttr;
 MObject FlexiSpine::outputLocalFramesAttr;
@@ -455,6 +468,11 @@ MStatus FlexiSpine::initialize()
 		scaleAdjustmentOffsetAttr, scaleAdjustmentFalloffModeAttr, scaleAdjustmentFalloffDistanceAttr, scaleAdjustmentRepeatAttr };
 	createCompoundAttribute(scaleAdjustmentCompoundAttr, scaleAdjustmentCompoundChildren, "scaleAdjustment", "scaleAdjustment", kArrayPreset);
 
+	// Evaluation attributes must not have any affects relation (ie. the results are identical whether or not evaluation is parallel)
+	createBoolAttribute(forceSerialEvaluationAttr, "forceSerialEvaluation", "forceSerialEvaluation", false, kDefaultPreset);
+	createIntAttribute(parallelGrainSizeAttr, "parallelGrainSize", "parallelGrainSize", MRS::kDefaultGrainSize, kDefaultPreset);
+	setMin<int>(parallelGrainSizeAttr, 1);
+
 	// State trackers are also internal only attributes
 	createBoolAttribute(evalSinceDirtyAttr, "evalSinceDirty", "evalSinceDirty", false, kReadable | kWritable | kCached | kHidden);
 	createBoolAttribute(drawSinceEvalAttr, "drawSinceEval", "drawSinceEval", false, kReadable | kWritable | kCached | kHidden);
@@ -499,6 +517,8 @@ MStatus FlexiSpine::initialize()
 	addAttribute(twistAdjustmentCompoundAttr);
 	addAttribute(computeScaleAdjustmentsAttr);
 	addAttribute(scaleAdjustmentCompoundAttr);
+	addAttribute(forceSerialEvaluationAttr);
+	addAttribute(parallelGrainSizeAttr);
 	addAttribute(evalSinceDirtyAttr);
 	addAttribute(drawSinceEvalAttr);
 	addAttribute(outputLocalFramesAttr);
@@ -774,6 +794,35 @@ MStatus FlexiSpine::initialize()
 	ie. A dirty plug does not mean the node will automatically recompute as this only occurs when something downstream is pulling    */
 MStatus FlexiSpine::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
 {
+	// Adjustments are only rebuilt once their own inputs are dirtied, otherwise their tables persist between evaluations
+	if (plug == twistAdjustmentCompoundAttr ||
+		plug == twistAdjustmentRampAttr ||
+		plug == twistAdjustmentRampPositionAttr ||
+		plug == twistAdjustmentRampValueAttr ||
+		plug == twistAdjustmentRampInterpolationAttr ||
+		plug == twistAdjustmentValueAttr ||
+		plug == twistAdjustmentOffsetAttr ||
+		plug == twistAdjustmentFalloffModeAttr ||
+		plug == twistAdjustmentFalloffDistanceAttr ||
+		plug == twistAdjustmentRepeatAttr ||
+		plug == computeTwistAdjustmentsAttr)
+		m_data.isTwistAdjustmentDirty = true;
+	else if (plug == scaleAdjustmentCompoundAttr ||
+		plug == scaleAdjustmentRampAttr ||
+		plug == scaleAdjustmentRampPositionAttr ||
+		plug == scaleAdjustmentRampValueAttr ||
+		plug == scaleAdjustmentRampInterpolationAttr ||
+		plug == scaleAdjustmentValueAttr ||
+		plug == scaleAdjustmentValueXAttr ||
+		plug == scaleAdjustmentValueYAttr ||
+		plug == scaleAdjustmentValueZAttr ||
+		plug == scaleAdjustmentOffsetAttr ||
+		plug == scaleAdjustmentFalloffModeAttr ||
+		plug == scaleAdjustmentFalloffDistanceAttr ||
+		plug == scaleAdjustmentRepeatAttr ||
+		plug == computeScaleAdjustmentsAttr)
+		m_data.isScaleAdjustmentDirty = true;
+
 	// Highest priority attributes first
 	if (plug == controlPointsAttr ||
 		plug == upVectorAttr || plug == upVectorXAttr || plug == upVectorYAttr || plug == upVectorZAttr ||
@@ -824,7 +873,7 @@ MStatus FlexiSpine::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
 		MDataBlock dataBlock = forceCache();
 		dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
 
-		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+		setDrawDirty();
 	}
 	else if ( // These attributes do not need to force evaluation
 		plug == customDrawSpaceTransformAttr ||
@@ -833,7 +882,7 @@ MStatus FlexiSpine::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
 		plug == drawNormalsAttr ||
 		plug == drawHullAttr)
 	{
-		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+		setDrawDirty();
 	}
 
 	return MStatus::kSuccess;
@@ -850,6 +899,34 @@ MStatus FlexiSpine::preEvaluation(const MDGContext& context, const MEvaluationNo
 	{
 		MStatus status;
 
+		if ((evaluationNode.dirtyPlugExists(twistAdjustmentCompoundAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampPositionAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRampInterpolationAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentOffsetAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentFalloffModeAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentFalloffDistanceAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(twistAdjustmentRepeatAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(computeTwistAdjustmentsAttr, &status) && status))
+			m_data.isTwistAdjustmentDirty = true;
+		if ((evaluationNode.dirtyPlugExists(scaleAdjustmentCompoundAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampPositionAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRampInterpolationAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueXAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueYAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentValueZAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentOffsetAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentFalloffModeAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentFalloffDistanceAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(scaleAdjustmentRepeatAttr, &status) && status) ||
+			(evaluationNode.dirtyPlugExists(computeScaleAdjustmentsAttr, &status) && status))
+			m_data.isScaleAdjustmentDirty = true;
+
 		if ((evaluationNode.dirtyPlugExists(controlPointsAttr, &status) && status) ||
 			(evaluationNode.dirtyPlugExists(upVectorAttr, &status) && status) ||
 			(evaluationNode.dirtyPlugExists(upVectorXAttr, &status) && status) ||
@@ -906,7 +983,7 @@ MStatus FlexiSpine::preEvaluation(const MDGContext& context, const MEvaluationNo
 			MDataBlock dataBlock = forceCache();
 			dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
 
-			MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+			setDrawDirty();
 		}
 		else if (
 			(evaluationNode.dirtyPlugExists(customDrawSpaceTransformAttr, &status) && status) ||
@@ -915,7 +992,7 @@ MStatus FlexiSpine::preEvaluation(const MDGContext& context, const MEvaluationNo
 			(evaluationNode.dirtyPlugExists(drawNormalsAttr, &status) && status) ||
 			(evaluationNode.dirtyPlugExists(drawHullAttr, &status) && status))
 		{
-			MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+			setDrawDirty();
 		}
 	}
 
@@ -1128,18 +1205,57 @@ MBoundingBox FlexiSpine::boundingBox() const
 	------------
 	This function is responsible for computing curve data based on the current input values
 	The method is seperate from compute as our draw override needs to be able request updated data without cleaning the output attributes
-	Basic state tracking has been implemented so that the draw cycle can query whether the function has already been invoked by MPxNode::compute()    */
+	Basic state tracking has been implemented so that the draw cycle can query whether the function has already been invoked by MPxNode::compute()
+	Per-sample loops are split into chunks which are distributed over Maya's thread pool (see MRS::parallelFor)
+	- Only the composition of the RMF reflections remains serial, each chunk writes to its own elements so the results match the serial path exactly    */
 void FlexiSpine::computeCurveData(MDataBlock& dataBlock)
-{	
+{
+	// --- Curve ---
+	computeCurve(dataBlock);
+	computeCurveSamples(dataBlock);
+
+	// --- Scale Adjustments ---
+	// Scale adjustments will be applied regardless of whether orientation is enabled
+	// The adjustments are only rebuilt once their inputs have been dirtied (see setDependentsDirty)
+	m_data.isScaleAdjustmentEnabled = dataBlock.inputValue(computeScaleAdjustmentsAttr).asBool();
+	if (m_data.isScaleAdjustmentEnabled && m_data.isScaleAdjustmentDirty)
+		computeScaleAdjustments(dataBlock);
+
+	// --- Twist Adjustments ---
+	// Twist adjustments will only be applied when orientation is enabled
+	m_data.isTwistAdjustmentEnabled = dataBlock.inputValue(computeTwistAdjustmentsAttr).asBool();
+	if (m_data.isTwistAdjustmentEnabled && m_data.isOrientEnabled && m_data.isTwistAdjustmentDirty)
+		computeTwistAdjustments(dataBlock);
+
+	// --- Build Frames ---
+	// Always keep frames in local space as this is required by draw
+	// If compute needs world space transforms then it will be responsible for doing the conversions
+	// If the counter-twist cache has been built, any twist generated by the moving RMF will be back-propagated down the curve
+	m_data.isDrawRibbonEnabled = dataBlock.inputValue(drawRibbonAttr).asBool();
+	m_data.counterTwistBlend = dataBlock.inputValue(counterTwistBlendAttr).asDouble();
+	m_data.counterTwist = dataBlock.inputValue(counterTwistAttr).asAngle().asRadians();
+	m_data.startTwist = dataBlock.inputValue(startTwistAttr).asAngle().asRadians();
+	m_data.endTwist = dataBlock.inputValue(endTwistAttr).asAngle().asRadians();
+	m_data.roll = dataBlock.inputValue(rollAttr).asAngle().asRadians();
+
+	computeNormalizedParameters();
+	m_data.frames.resize(m_data.outputCount);
+	buildFlexiFrames(m_data, m_data.grainSize);
+
+	dataBlock.outputValue(evalSinceDirtyAttr).setBool(true);
+	dataBlock.outputValue(drawSinceEvalAttr).setBool(false);
+}
+
+/*	Description
+	-----------
+	Computes the control points and knots which define the curve along with the orientation inputs, the curve is not sampled
+	This allows the curve to be evaluated for a separate context (eg. a specific time) without computing any of the output data
+	Once all contexts have been evaluated, invalidateCurveData() must be called    */
+void FlexiSpine::computeCurve(MDataBlock& dataBlock)
+{
 	bool previouslyClosed = m_data.isClosed;
 	unsigned int previousNumOfPoints = (int)m_data.controlPoints.size();
 
-	// --- Counts ---
-	m_data.subdivisions = (unsigned)dataBlock.inputValue(subdivisionsAttr).asInt();
-	m_data.outputCount = (unsigned)dataBlock.inputValue(outputCountAttr).asInt();
-	m_data.parameterCount = m_data.outputCount + (m_data.outputCount - 1) * m_data.subdivisions;
-	assert(m_data.parameterCount >= 2);
-
 	// --- States ---
 	m_data.isClosed = dataBlock.inputValue(closeCurveAttr).asBool();
 	m_data.isDiscardLastEnabled = dataBlock.inputValue(discardLastOutputAttr).asBool();
@@ -1193,22 +1309,49 @@ void FlexiSpine::computeCurveData(MDataBlock& dataBlock)
 	m_data.lowerBoundKnot = m_data.knots[m_data.degree];
 	m_data.upperBoundKnot = m_data.knots[n + 1];
 
+	// --- Orientation ---
+	m_data.isOrientEnabled = dataBlock.inputValue(computeOrientationAttr).asBool();
+	m_data.isNormalUpVectorOverrideEnabled = dataBlock.inputValue(normalUpVectorOverrideStateAttr).asBool();
+	m_data.vNormalUp = m_data.isNormalUpVectorOverrideEnabled ? dataBlock.inputValue(normalUpVectorOverrideAttr).asVector()
+		: dataBlock.inputValue(upVectorAttr).asVector();
+	m_data.vNormalUp.normalize();
+	m_data.isCounterTwistUpVectorOverrideEnabled = dataBlock.inputValue(counterTwistUpVectorOverrideStateAttr).asBool();
+	m_data.vCounterTwistUp = m_data.isCounterTwistUpVectorOverrideEnabled ? dataBlock.inputValue(counterTwistUpVectorOverrideAttr).asVector()
+		: dataBlock.inputValue(upVectorAttr).asVector();
+	m_data.vCounterTwistUp.normalize();
+}
+
+/*	Description
+	-----------
+	Computes the parameters of the curve and samples the points, tangents and RMF normals at each parameter, the adjustments and frames are not computed
+	The control points and orientation inputs must have already been computed for the same datablock (see computeCurve)    */
+void FlexiSpine::computeCurveSamples(MDataBlock& dataBlock)
+{
+	// --- Threading ---
+	m_data.grainSize = dataBlock.inputValue(forceSerialEvaluationAttr).asBool() ? MRS::kSerialGrainSize
+		: (unsigned)dataBlock.inputValue(parallelGrainSizeAttr).asInt();
+
+	// --- Counts ---
+	m_data.subdivisions = (unsigned)dataBlock.inputValue(subdivisionsAttr).asInt();
+	m_data.outputCount = (unsigned)dataBlock.inputValue(outputCountAttr).asInt();
+	m_data.parameterCount = m_data.outputCount + (m_data.outputCount - 1) * m_data.subdivisions;
+	assert(m_data.parameterCount >= 2);
+
 	// --- Parameterization ---
 	m_data.parameterizationBlend = dataBlock.inputValue(parameterizationBlendAttr).asDouble();
 	
 	// Could be optimized for when arc-length parameterization is disabled however this is rare, therefore simplify for the general case
-	m_data.lengths.resize(m_data.parameterCount);
 	m_data.naturalParameters.resize(m_data.parameterCount);
 	m_data.arcLengthParameters.resize(m_data.parameterCount);
 	m_data.blendedParameters.resize(m_data.parameterCount);
 
-	m_curve.computeLengths(m_data.degree, m_data.knots, m_data.controlPoints, m_data.lengths);
+	m_data.arcLengthTable.build(m_data.degree, m_data.knots, m_data.controlPoints);
 	m_curve.computeNaturalParameters(m_data.naturalParameters, m_data.lowerBoundKnot, m_data.upperBoundKnot);
-	m_curve.computeArcLengthParameters(m_data.lengths, m_data.arcLengthParameters);
+	m_curve.computeArcLengthParameters(m_data.arcLengthTable, m_data.arcLengthParameters);
 
 	if (m_data.isClosed)
 	{
-		// The lengths used in the arc-length calculation were computed using the curve's restricted parameter range
+		// The table used in the arc-length calculation was integrated over the curve's restricted parameter range
 		// However the resulting parameters are now in an unrestricted range and need to be remapped into this restricted range
 		// Remap: [0, 1] -> [m_lowerBoundKnot, m_upperBoundKnot] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
 		for (unsigned int i = 0; i < m_data.parameterCount; ++i)
@@ -1225,16 +1368,7 @@ void FlexiSpine::computeCurveData(MDataBlock& dataBlock)
 	m_data.blendedParameters[m_data.parameterCount - 1] = m_data.upperBoundKnot;
 
 	// --- Sample Curve ---
-	m_data.isOrientEnabled = dataBlock.inputValue(computeOrientationAttr).asBool();
 	m_data.sampleCount = m_data.isOrientEnabled ? m_data.parameterCount : m_data.outputCount;
-	m_data.isNormalUpVectorOverrideEnabled = dataBlock.inputValue(normalUpVectorOverrideStateAttr).asBool();
-	m_data.vNormalUp = m_data.isNormalUpVectorOverrideEnabled ? dataBlock.inputValue(normalUpVectorOverrideAttr).asVector()
-		: dataBlock.inputValue(upVectorAttr).asVector();
-	m_data.vNormalUp.normalize();
-	m_data.isCounterTwistUpVectorOverrideEnabled = dataBlock.inputValue(counterTwistUpVectorOverrideStateAttr).asBool();
-	m_data.vCounterTwistUp = m_data.isCounterTwistUpVectorOverrideEnabled ? dataBlock.inputValue(counterTwistUpVectorOverrideAttr).asVector()
-		: dataBlock.inputValue(upVectorAttr).asVector();
-	m_data.vCounterTwistUp.normalize();
 
 	if (m_data.isOrientEnabled)
 	{
@@ -1242,192 +1376,67 @@ void FlexiSpine::computeCurveData(MDataBlock& dataBlock)
 		// Arc-length parameterization also prevents optimizing for the local modification property of B-splines
 		m_data.points.resize(m_data.sampleCount);
 		m_data.tangents.resize(m_data.sampleCount);
-		m_data.rmfReflections.resize(m_data.sampleCount);
 
-		m_data.points[0] = sampleCurve(m_data.blendedParameters[0]);
-		m_data.tangents[0] = sampleFirstDerivative(m_data.blendedParameters[0]);
-		m_data.tangents[0].normalize();
-		m_data.rmfReflections[0] = MQuaternion::identity;
-
-		MVector vRight = m_data.vNormalUp ^ m_data.tangents[0];
-		vRight.normalize();
-		m_data.vPrincipalNormal = m_data.tangents[0] ^ vRight;
-		MQuaternion qPrincipalNormal{ m_data.vPrincipalNormal.x, m_data.vPrincipalNormal.y, m_data.vPrincipalNormal.z, 0.0 };
-
-		// Each sequential reflection is stored as a composition of all previous reflections
-		for (unsigned int i = 1; i < m_data.sampleCount; ++i)
+		// Evaluate all samples before the iterative RMF computation, each block of a chunk is evaluated as an independent batch
+		// The batch is staged as MVectors and then written to the lanes of the caches
+		MRS::parallelFor(0, m_data.sampleCount, m_data.grainSize, [this](unsigned int begin, unsigned int end)
 		{
-			m_data.points[i] = sampleCurve(m_data.blendedParameters[i]);
-			m_data.tangents[i] = sampleFirstDerivative(m_data.blendedParameters[i]);
-			m_data.tangents[i].normalize();
+			MVector points[MRS::kVectorArrayGrainSize];
+			MVector tangents[MRS::kVectorArrayGrainSize];
 
-			MQuaternion qReflection = m_curve.computeDoubleReflectionRMF(m_data.points[i - 1], m_data.points[i], m_data.tangents[i - 1], m_data.tangents[i]);
-			m_data.rmfReflections[i] = MRS::quaternionMultiply(qReflection, m_data.rmfReflections[i - 1]);
-		}
-
-		// We are not optimizing the case where drawing of the ribbon is disabled (technically we could calculate normals at the specific output positions)
-		m_data.normals.resize(m_data.sampleCount);
-		m_data.binormals.resize(m_data.sampleCount);
+			for (unsigned int first = begin; first < end; first += MRS::kVectorArrayGrainSize)
+			{
+				unsigned int count = std::min(end - first, MRS::kVectorArrayGrainSize);
+				sampleCurveBatch(&m_data.blendedParameters[first], count, points, tangents);
 
-		m_data.normals[0] = m_data.vPrincipalNormal;
-		m_data.binormals[0] = m_data.tangents[0] ^ m_data.vPrincipalNormal;
+				for (unsigned int i = 0; i < count; ++i)
+				{
+					m_data.points.set(first + i, points[i]);
+					m_data.tangents.set(first + i, tangents[i].normal());
+				}
+			}
+		});
 
-		for (unsigned int i = 1; i < m_data.sampleCount; ++i)
-		{
-			MQuaternion qReflectionComposition = m_data.rmfReflections[i];
-			MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-			MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-			MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-			MVector vNormal{ qNormal.x, qNormal.y, qNormal.z };
-			vNormal.normalize();
-
-			m_data.normals[i] = vNormal;
-			m_data.binormals[i] = m_data.tangents[i] ^ vNormal;
-		}
+		// We are not optimizing the case where drawing of the ribbon is disabled (technically we could calculate normals at the specific output positions)
+		computeFlexiRMF(m_data.points, m_data.tangents, m_data.vNormalUp, m_data.grainSize, m_data.vPrincipalNormal, m_data.rmfStepReflections,
+			m_data.rmfReflections, m_data.normals, m_data.binormals);
 	}
 	else
 	{
 		m_data.points.resize(m_data.sampleCount);
+		m_data.sampleParameters.resize(m_data.sampleCount);
 
 		for (unsigned int i = 0; i < m_data.sampleCount; i++)
 		{
 			unsigned int parameterIndex = i * (m_data.subdivisions + 1);
-			m_data.points[i] = sampleCurve(m_data.blendedParameters[parameterIndex]);
+			m_data.sampleParameters[i] = m_data.blendedParameters[parameterIndex];
 		}
-	}
-
-	// --- Scale Adjustments ---
-	// Scale adjustments will be applied regardless of whether orientation is enabled
-	m_data.isScaleAdjustmentEnabled = dataBlock.inputValue(computeScaleAdjustmentsAttr).asBool();
-	if (m_data.isScaleAdjustmentEnabled)
-		computeScaleAdjustments(dataBlock);
-
-	// --- Twist Adjustments ---
-	// Twist adjustments will only be applied when orientation is enabled
-	m_data.isTwistAdjustmentEnabled = dataBlock.inputValue(computeTwistAdjustmentsAttr).asBool();
-	if (m_data.isTwistAdjustmentEnabled && m_data.isOrientEnabled)
-		computeTwistAdjustments(dataBlock);
-
-	// --- Build Frames ---
-	// Always keep frames in local space as this is required by draw
-	// If compute needs world space transforms then it will be responsible for doing the conversions
-	// If the counter-twist cache has been built, any twist generated by the moving RMF will be back-propagated down the curve
-	m_data.frames.resize(m_data.outputCount);
-
-	m_data.isDrawRibbonEnabled = dataBlock.inputValue(drawRibbonAttr).asBool();
-	m_data.counterTwistBlend = dataBlock.inputValue(counterTwistBlendAttr).asDouble();
-	m_data.counterTwist = dataBlock.inputValue(counterTwistAttr).asAngle().asRadians();
-	m_data.startTwist = dataBlock.inputValue(startTwistAttr).asAngle().asRadians();
-	m_data.endTwist = dataBlock.inputValue(endTwistAttr).asAngle().asRadians();
-	m_data.roll = dataBlock.inputValue(rollAttr).asAngle().asRadians();
-
-	if (m_data.isOrientEnabled)
-	{
-		unsigned int increment = m_data.isDrawRibbonEnabled ? 1 : m_data.subdivisions + 1;
-		unsigned int outputIndex = 0;
-
-		for (unsigned int i = 0; i < m_data.sampleCount; i += increment)
-		{
-			bool isOutput = !m_data.isDrawRibbonEnabled || i % (m_data.subdivisions + 1) == 0;
-			// If the curve is closed, we remap the unclamped (restricted) sample parameter into the clamped (unrestricted) knot range
-			double normalizedParam = m_data.isClosed ? (m_data.naturalParameters[i] - m_data.lowerBoundKnot) / (m_data.upperBoundKnot - m_data.lowerBoundKnot)
-				: m_data.naturalParameters[i];
-			double totalWeightedTwist = 0.0;
-
-			// End twist
-			double endTwistWeight = normalizedParam;
-			double weightedEndTwist = m_data.endTwist * endTwistWeight;
-			totalWeightedTwist += weightedEndTwist;
-
-			// Start twist
-			double startTwistWeight = 1 - endTwistWeight;
-			double weightedStartTwist = m_data.startTwist * startTwistWeight;
-			totalWeightedTwist += weightedStartTwist;
-
-			// Counter twist
-			double counterTwistWeight = -1 * endTwistWeight * m_data.counterTwistBlend;
-			double weightedCounterTwist = m_data.counterTwist * counterTwistWeight;
-			totalWeightedTwist += weightedCounterTwist;
-
-			// Roll
-			totalWeightedTwist += m_data.roll;
-
-			// Twist adjustment
-			if (m_data.isTwistAdjustmentEnabled)
-			{
-				for (TwistAdjustment& twistAdjustment : m_data.twistAdjustments)
-				{
-					// The falloff curve has a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
-					double twistAdjustmentWeight = twistAdjustment.curve.getValue(normalizedParam);
-					double weightedTwistAdjustment = twistAdjustment.twist.asRadians() * twistAdjustmentWeight;
-					totalWeightedTwist += weightedTwistAdjustment;
-				}
-			}
-
-			// Scale adjustment
-			MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
-			if (m_data.isScaleAdjustmentEnabled)
-			{
-				for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-				{
-					double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(normalizedParam);
-					MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-					vScaleAdjustment += weightedScaleAdjustment;
-				}
-			}
-
-			MRS::Matrix33<double> orientFrame{ m_data.tangents[i], m_data.normals[i], m_data.binormals[i] };
-			orientFrame = orientFrame.preRotateInX(totalWeightedTwist);
-			// Ensure scale is applied relative to all other transformations
-			orientFrame = orientFrame.preScale(&vScaleAdjustment.x);
 
-			// Update the caches so that draw has the current data
-			orientFrame[0].get(m_data.tangents[i]);
-			orientFrame[1].get(m_data.normals[i]);
-			orientFrame[2].get(m_data.binormals[i]);
-
-			if (isOutput)
-			{
-				MMatrix frame;
-				orientFrame.get(frame);
-				frame[3][0] = m_data.points[i].x; frame[3][1] = m_data.points[i].y; frame[3][2] = m_data.points[i].z;
-				m_data.frames[outputIndex++] = frame;
-			}
-		}
-	}
-	else
-	{
-		for (unsigned int i = 0; i < m_data.sampleCount; i++)
+		MRS::parallelFor(0, m_data.sampleCount, m_data.grainSize, [this](unsigned int begin, unsigned int end)
 		{
-			MMatrix frame;
-			unsigned int parameterIndex = i * (m_data.subdivisions + 1);
-			// If the curve is closed, we remap the unclamped (restricted) sample parameter into the clamped (unrestricted) knot range
-			double normalizedParam = m_data.isClosed
-				? (m_data.naturalParameters[parameterIndex] - m_data.lowerBoundKnot) / (m_data.upperBoundKnot - m_data.lowerBoundKnot)
-				: m_data.naturalParameters[parameterIndex];
+			MVector points[MRS::kVectorArrayGrainSize];
 
-			// Scale adjustment
-			if (m_data.isScaleAdjustmentEnabled)
+			for (unsigned int first = begin; first < end; first += MRS::kVectorArrayGrainSize)
 			{
-				MVector vScaleAdjustment{ 1.0, 1.0, 1.0 };
-				for (ScaleAdjustment& scaleAdjustment : m_data.scaleAdjustments)
-				{
-					double scaleAdjustmentWeight = scaleAdjustment.curve.getValue(normalizedParam);
-					MVector weightedScaleAdjustment = scaleAdjustment.vScale * scaleAdjustmentWeight;
-					vScaleAdjustment += weightedScaleAdjustment;
-				}
+				unsigned int count = std::min(end - first, MRS::kVectorArrayGrainSize);
+				sampleCurveBatch(&m_data.sampleParameters[first], count, points);
 
-				frame[0][0] = vScaleAdjustment.x; frame[1][1] = vScaleAdjustment.y; frame[2][2] = vScaleAdjustment.z;
+				for (unsigned int i = 0; i < count; ++i)
+					m_data.points.set(first + i, points[i]);
 			}
-
-			// Position
-			frame[3][0] = m_data.points[i].x; frame[3][1] = m_data.points[i].y; frame[3][2] = m_data.points[i].z;
-			m_data.frames[i] = frame;
-		}
+		});
 	}
+}
 
-	dataBlock.outputValue(evalSinceDirtyAttr).setBool(true);
-	dataBlock.outputValue(drawSinceEvalAttr).setBool(false);
+/*	Description
+	-----------
+	Invalidates all of the data computed by computeCurveData so that it is rebuilt by the next evaluation from the normal context
+	This must be called after the node has been evaluated under a separate context, as the data no longer corresponds to the current time    */
+void FlexiSpine::invalidateCurveData()
+{
+	MDataBlock dataBlock = forceCache();
+	dataBlock.outputValue(evalSinceDirtyAttr).setBool(false);
+	setDrawDirty();
 }
 
 /*	Description
@@ -1442,149 +1451,13 @@ void FlexiSpine::computeCurveData(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiSpine::computeScaleAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle scaleAdjustmentArrayHandle = dataBlock.inputArrayValue(scaleAdjustmentCompoundAttr);
-	unsigned int numScaleAdjustments = scaleAdjustmentArrayHandle.elementCount();
-	m_data.scaleAdjustments.resize(numScaleAdjustments);
-
-	for (unsigned int i = 0; i < numScaleAdjustments; ++i)
-	{
-		MDataHandle scaleAdjustmentElementHandle = scaleAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentRampAttr);
-		MDataHandle scaleHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentValueAttr);
-		MDataHandle offsetHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = scaleAdjustmentElementHandle.child(scaleAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		ScaleAdjustment scaleAdjustment;
-		scaleAdjustment.vScale = scaleHandle.asVector();
-		scaleAdjustment.offset = offsetHandle.asDouble();
-		scaleAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		scaleAdjustment.falloffMode = falloffModeHandle.asShort();
-		scaleAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = scaleAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		scaleAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(scaleAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(scaleAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(scaleAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (scaleAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (scaleAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (scaleAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				scaleAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (scaleAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * scaleAdjustment.falloffDistance + scaleAdjustment.offset;
-				scaleAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-
-			rampArrayHandle.next();
-		}
-
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		std::sort(scaleAdjustment.controlPoints.begin(), scaleAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-		if (scaleAdjustment.falloffMode == 1 || scaleAdjustment.falloffMode == 2)
-		{
-			auto cvIter = scaleAdjustment.controlPoints.begin();
-			while (cvIter != scaleAdjustment.controlPoints.end() && cvIter->_pos < scaleAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (scaleAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = scaleAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = scaleAdjustment.controlPoints[scaleAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (scaleAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / scaleAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / scaleAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
+	// The table must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.isScaleAdjustmentDirty = false;
+	m_data.scaleAdjustmentTable.invalidate();
 
-				scaleAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[k]);
-						scaleAdjustment.controlPoints.back()._pos -= scaleAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[numTotalControlPoints - 1]);
-					scaleAdjustment.controlPoints.back()._pos -= scaleAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[0]);
-					scaleAdjustment.controlPoints.back()._pos += scaleAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						scaleAdjustment.controlPoints.push_back(scaleAdjustment.controlPoints[k]);
-						scaleAdjustment.controlPoints.back()._pos += scaleAdjustment.falloffDistance * (j + 1);
-					}
-				}
-
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < scaleAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					scaleAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
-
-		for (SeExpr2::Curve<double>::CV& controlPoint : scaleAdjustment.controlPoints)
-			scaleAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
-
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		scaleAdjustment.curve.preparePoints();
-		m_data.scaleAdjustments[i] = scaleAdjustment;
-
-		scaleAdjustmentArrayHandle.next();
-	}
+	const FlexiAdjustmentAttributes attributes{ scaleAdjustmentCompoundAttr, scaleAdjustmentRampAttr, scaleAdjustmentRampPositionAttr, scaleAdjustmentRampValueAttr, scaleAdjustmentRampInterpolationAttr,
+		scaleAdjustmentValueAttr, scaleAdjustmentOffsetAttr, scaleAdjustmentFalloffDistanceAttr, scaleAdjustmentFalloffModeAttr, scaleAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.scaleAdjustments);
 }
 
 /*	Description
@@ -1599,148 +1472,39 @@ void FlexiSpine::computeScaleAdjustments(MDataBlock& dataBlock)
 	- When the associated array plug is altered (elements added or removed) this will not trigger a call to compute    */
 void FlexiSpine::computeTwistAdjustments(MDataBlock& dataBlock)
 {
-	MArrayDataHandle twistAdjustmentArrayHandle = dataBlock.inputArrayValue(twistAdjustmentCompoundAttr);
-	unsigned int numTwistAdjustments = twistAdjustmentArrayHandle.elementCount();
-	m_data.twistAdjustments.resize(numTwistAdjustments);
+	// The table must be rebuilt from the updated data, the manipulators may call this function outside of computeCurveData
+	m_data.isTwistAdjustmentDirty = false;
+	m_data.twistAdjustmentTable.invalidate();
 
-	for (unsigned int i = 0; i < numTwistAdjustments; ++i)
-	{
-		MDataHandle twistAdjustmentElementHandle = twistAdjustmentArrayHandle.inputValue();
-
-		// Get child handles for the current element
-		MArrayDataHandle rampArrayHandle = twistAdjustmentElementHandle.child(twistAdjustmentRampAttr);
-		MDataHandle twistHandle = twistAdjustmentElementHandle.child(twistAdjustmentValueAttr);
-		MDataHandle offsetHandle = twistAdjustmentElementHandle.child(twistAdjustmentOffsetAttr);
-		MDataHandle falloffDistanceHandle = twistAdjustmentElementHandle.child(twistAdjustmentFalloffDistanceAttr);
-		MDataHandle falloffModeHandle = twistAdjustmentElementHandle.child(twistAdjustmentFalloffModeAttr);
-		MDataHandle repeatHandle = twistAdjustmentElementHandle.child(twistAdjustmentRepeatAttr);
-
-		// Retrieve data for current adjustment and store in struct
-		TwistAdjustment twistAdjustment;
-		twistAdjustment.twist = twistHandle.asAngle();
-		twistAdjustment.offset = offsetHandle.asDouble();
-		twistAdjustment.falloffDistance = falloffDistanceHandle.asDouble();
-		twistAdjustment.falloffMode = falloffModeHandle.asShort();
-		twistAdjustment.repeat = repeatHandle.asBool();
-
-		// Curve will be formed by ramp control points
-		unsigned int numRampControlPoints = rampArrayHandle.elementCount();
-		unsigned int numTotalControlPoints = twistAdjustment.falloffMode == 2 ? numRampControlPoints * 2 : numRampControlPoints;
-		// Note, we cannot resize the controlPoints vector as the CV class does not have a default constructor (reserve instead)
-		twistAdjustment.controlPoints.reserve(numTotalControlPoints);
-
-		for (unsigned int j = 0; j < numRampControlPoints; ++j)
-		{
-			MDataHandle controlPointHandle = rampArrayHandle.inputValue();
-			float position = controlPointHandle.child(twistAdjustmentRampPositionAttr).asFloat();
-			position = std::max(std::min(position, 1.0f), 0.0f);
-			float value = controlPointHandle.child(twistAdjustmentRampValueAttr).asFloat();
-			value = std::max(std::min(value, 1.0f), 0.0f);
-			short interp = controlPointHandle.child(twistAdjustmentRampInterpolationAttr).asShort();
-
-			// Forward
-			if (twistAdjustment.falloffMode == 0)
-			{
-				double adjustedPosition = (double)position * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Backward
-			else if (twistAdjustment.falloffMode == 1)
-			{
-				double adjustedPosition = (double)position * -1 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Mirror
-			else if (twistAdjustment.falloffMode == 2)
-			{
-				// The entire mirrored curve has a total default falloff distance of 1.0
-				double forwardPosition = (double)position * 0.5 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				double backwardPosition = (double)position * -0.5 * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ backwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-				twistAdjustment.controlPoints.push_back({ forwardPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-			// Center
-			else if (twistAdjustment.falloffMode == 3)
-			{
-				// Remap: [0, 1] -> [-0.5, 0.5] = low2 + (value - low1) * (high2 - low2) / (high1 - low1)
-				double remappedPosition = -0.5 + (double)position;
-				double adjustedPosition = remappedPosition * twistAdjustment.falloffDistance + twistAdjustment.offset;
-				twistAdjustment.controlPoints.push_back({ adjustedPosition, (double)value, static_cast<SeExpr2::Curve<double>::InterpType>(interp) });
-			}
-
-			rampArrayHandle.next();
-		}
-
-		// If mirroring has occurred, the current interpolation type of each mirrored segment is currently incorrect
-		// This is because the interpolation type of an entire segment is defined by its lower bound control point
-		// Currently, each mirrored segment has a lower bound control point whose interpolation type is defined by an upper bound control point
-		if (twistAdjustment.falloffMode == 1 || twistAdjustment.falloffMode == 2)
-		{
-			std::sort(twistAdjustment.controlPoints.begin(), twistAdjustment.controlPoints.end(), SeExpr2::Curve<double>::cvLessThan);
-			auto cvIter = twistAdjustment.controlPoints.begin();
-			while (cvIter != twistAdjustment.controlPoints.end() && cvIter->_pos < twistAdjustment.offset)
-			{
-				cvIter->_interp = std::next(cvIter)->_interp;
-				cvIter++;
-			}
-		}
-
-		// If repeat is enabled, ensure the adjustment has full coverage over the curve's domain
-		if (twistAdjustment.repeat && numRampControlPoints >= 2)
-		{
-			double lowerBoundPos = twistAdjustment.controlPoints[0]._pos;
-			double upperBoundPos = twistAdjustment.controlPoints[twistAdjustment.controlPoints.size() - 1]._pos;
-
-			// The adjustment's complexity has an inversely proportional relationship to the falloff distance, implement a limit
-			if (twistAdjustment.falloffDistance > 0.01)
-			{
-				unsigned int lowerRepititionCount = std::max(0, (int)std::ceil(lowerBoundPos / twistAdjustment.falloffDistance));
-				unsigned int upperRepititionCount = std::max(0, (int)std::ceil((1.0 - upperBoundPos) / twistAdjustment.falloffDistance));
-				unsigned int totalRepitionCount = lowerRepititionCount + upperRepititionCount;
-
-				twistAdjustment.controlPoints.reserve(numTotalControlPoints * (totalRepitionCount + 1));
-
-				for (unsigned int j = 0; j < lowerRepititionCount; ++j)
-				{
-					for (unsigned int k = 0; k < numTotalControlPoints - 1; ++k)
-					{
-						twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[k]);
-						twistAdjustment.controlPoints.back()._pos -= twistAdjustment.falloffDistance * (j + 1);
-					}
-
-					// We must ensure the last control point of the current set is not overlapping the first control point of the previous set
-					twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[numTotalControlPoints - 1]);
-					twistAdjustment.controlPoints.back()._pos -= twistAdjustment.falloffDistance * (j + 1) + 0.00001;
-				}
-
-				for (unsigned int j = 0; j < upperRepititionCount; ++j)
-				{
-					// We must ensure the first control point of the current set is not overlapping the last control point of the previous set
-					twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[0]);
-					twistAdjustment.controlPoints.back()._pos += twistAdjustment.falloffDistance * (j + 1) + 0.00001;
-
-					for (unsigned int k = 1; k < numTotalControlPoints; ++k)
-					{
-						twistAdjustment.controlPoints.push_back(twistAdjustment.controlPoints[k]);
-						twistAdjustment.controlPoints.back()._pos += twistAdjustment.falloffDistance * (j + 1);
-					}
-				}
+	const FlexiAdjustmentAttributes attributes{ twistAdjustmentCompoundAttr, twistAdjustmentRampAttr, twistAdjustmentRampPositionAttr, twistAdjustmentRampValueAttr, twistAdjustmentRampInterpolationAttr,
+		twistAdjustmentValueAttr, twistAdjustmentOffsetAttr, twistAdjustmentFalloffDistanceAttr, twistAdjustmentFalloffModeAttr, twistAdjustmentRepeatAttr };
+	computeFlexiAdjustments(dataBlock, attributes, m_data.twistAdjustments);
+}
 
-				// Override the interpolation type of the last control point of each repition so that we get a jump in value between sets
-				for (unsigned int j = numTotalControlPoints - 1; j < twistAdjustment.controlPoints.size(); j += numTotalControlPoints)
-					twistAdjustment.controlPoints[j]._interp = SeExpr2::Curve<double>::InterpType::kNone;
-			}
-		}
+/*	Description
+	-----------
+	Remaps the natural parameters into the clamped knot range which the adjustment falloff curves are defined over
+	The falloff curves have a uniform parameter space and should be sampled using uniform inputs even if the curve is parameterized in terms of arc-length
+	The adjustment tables are invalidated if any parameter has changed, moving the control points alone will therefore not trigger a rebuild    */
+void FlexiSpine::computeNormalizedParameters()
+{
+	bool isChanged = m_data.normalizedParameters.size() != m_data.parameterCount;
+	m_data.normalizedParameters.resize(m_data.parameterCount);
 
-		for (SeExpr2::Curve<double>::CV& controlPoint : twistAdjustment.controlPoints)
-			twistAdjustment.curve.addPoint(controlPoint._pos, controlPoint._val, controlPoint._interp);
+	for (unsigned int i = 0; i < m_data.parameterCount; i++)
+	{
+		// If the curve is closed, we remap the unclamped (restricted) sample parameter into the clamped (unrestricted) knot range
+		double normalizedParam = m_data.isClosed ? (m_data.naturalParameters[i] - m_data.lowerBoundKnot) / (m_data.upperBoundKnot - m_data.lowerBoundKnot)
+			: m_data.naturalParameters[i];
 
-		// This will again sort the control points by position (Maya's ramps do not keep element plugs ordered)
-		// It also creates a linear segment at each boundary of the curve where the value of each segment matches the first and last control points respectively
-		twistAdjustment.curve.preparePoints();
-		m_data.twistAdjustments[i] = twistAdjustment;
+		isChanged = isChanged || m_data.normalizedParameters[i] != normalizedParam;
+		m_data.normalizedParameters[i] = normalizedParam;
+	}
 
-		twistAdjustmentArrayHandle.next();
+	if (isChanged)
+	{
+		m_data.twistAdjustmentTable.invalidate();
+		m_data.scaleAdjustmentTable.invalidate();
 	}
 }
 
@@ -1785,86 +1549,87 @@ MStatus FlexiSpine::computeCounterTwistStability(double& outStability)
 	This function is called exclusively by the FlexiSpineCounterTwist command and is used to calculate the counter twist cache for this node
 	Counter twist is an iterative calculation which is designed to stabalise the end frame of the curve
 	It essentially mitigates any twist deviation induced on the moving frame of the curve over a specified time range
-	This function assumes the command from which it was called has validated all inputs and checked that orientation computation is enabled    */
-MStatus FlexiSpine::computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, MObject& animCurveObj, MAnimCurveChange& animMod)
+	This function assumes the command from which it was called has validated all inputs and checked that orientation computation is enabled
+
+	Optimizations
+	-------------
+	The node is evaluated under a separate context for each sample time, the global time is never changed and the scene is not updated per sample
+	- Only the curve inputs are pulled and evaluation stops once the RMF has been sampled, the adjustments and frames are never computed
+	- If an angular tolerance is given, evaluation stops once the curve has been built and the end normal is integrated adaptively instead
+	- Only the end frame of each sample is retained, the angles are then calculated and keyed as a single batch (see keyFlexiCounterTwist)
+	The node data is invalidated once the samples have been computed so that the next evaluation rebuilds it for the current time
+
+	Args
+	----
+	subSteps = Number of samples taken per time step, keyframes are only set at each time step
+		Additional samples help to resolve the direction of large rotations which occur between consecutive keyframes
+	angularTolerance = Maximum angular error in radians of each end normal computed by the adaptive integration (see BSpline::propagateNormalRMF)
+		If zero, the end normal is computed from the sampled RMF and will exactly match the drawn frames    */
+MStatus FlexiSpine::computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, unsigned int subSteps, double angularTolerance, 
+	MObject& animCurveObj, MAnimCurveChange& animMod)
 {
 	MStatus status;
 
 	MFnAnimCurve fnAnimCurve{ animCurveObj };
-	MTime currentTime = MAnimControl::currentTime();
-	MTime iterTime = startTime;
-	double previousAngle = 0.0;
-	double totalAngle = 0.0;
-
-	// For each frame, calculate a signed angle between the upVector/endUpVectorOverride (projected onto the tangent plane) and the normal vector
-	// Note, if the up-vector is close to parallel with tangent, the projection onto the tangent plane will be close to a zero-vector (angle may experience flipping)
-	while (iterTime <= endTime)
-	{
-		if (!status)
-			return MStatus::kFailure;
 
+	// Determine the number of keyframes which fit within the time range, then the total number of samples including sub-steps
+	unsigned int keyCount = 0;
+	while (startTime + timeStep * (double)keyCount <= endTime)
+		++keyCount;
+
+	unsigned int sampleCount = (keyCount - 1) * subSteps + 1;
+	std::vector<MVector> upperBoundTangents(sampleCount);
+	std::vector<MVector> upperBoundNormals(sampleCount);
+	std::vector<MVector> counterTwistUpVectors(sampleCount);
+
+	// --- Sample End Frames ---
+	// Each sample time must be evaluated by the DG on the main thread
+	for (unsigned int i = 0; i < sampleCount; ++i)
+	{
+		MTime sampleTime = startTime + timeStep * ((double)i / subSteps);
+		MDGContext timeContext{ sampleTime };
+		MDGContextGuard contextGuard{ timeContext };
 		MDataBlock dataBlock = forceCache();
 
-		// This call does not cause the viewport loop to refresh
-		MAnimControl::setCurrentTime(iterTime);
-		// We must force a DG update (we can either call the "refresh" command or manually pull data from an output)
-		dataBlock.inputValue(outputWorldFramesAttr);
+		computeCurve(dataBlock);
 
-		// Calculate upper threshold data
-		MVector vUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
-		vUpperBoundTangent.normalize();
-		MQuaternion qPrincipalNormal{ m_data.vPrincipalNormal.x, m_data.vPrincipalNormal.y, m_data.vPrincipalNormal.z, 0.0 };
-		MQuaternion qReflectionComposition = m_data.rmfReflections[m_data.sampleCount - 1];
-		MQuaternion qReflectionCompositionConjugate = qReflectionComposition.conjugate();
-		MQuaternion qNormalProjected = MRS::quaternionMultiply(qReflectionComposition, qPrincipalNormal);
-		MQuaternion qNormal = MRS::quaternionMultiply(qNormalProjected, qReflectionCompositionConjugate);
-		MVector vUpperBoundNormal{ qNormal.x, qNormal.y, qNormal.z };
-		vUpperBoundNormal.normalize();
-
-		// Project the up-vector onto the end tangent
-		MVector vProjUpOnTangent = (m_data.vCounterTwistUp * vUpperBoundTangent) * vUpperBoundTangent;
-		// Project the up-vector onto the tangent plane
-		MVector vProjUpOnTangentPlane = m_data.vCounterTwistUp - vProjUpOnTangent;
-		vProjUpOnTangentPlane.normalize();
-
-		// Calculate sign of the angle
-		MVector vCrossProjWithNormal = vProjUpOnTangentPlane ^ vUpperBoundNormal;
-		double dotCrossWithTangent = vCrossProjWithNormal * vUpperBoundTangent;
-		int angularDirection = dotCrossWithTangent < 0.0 ? 1 : -1;
-
-		// Calculate angle
-		double currentAngle = std::acos(vProjUpOnTangentPlane * vUpperBoundNormal);
-		currentAngle *= angularDirection;
-
-		// Calculate delta from previous frame
-		double angularDelta;
-		if (std::abs(currentAngle - previousAngle) > M_PI)
+		if (!m_data.isOrientEnabled)
 		{
-			// The normal is pointing in a similiar direction to the negated projection vector
-			// This causes a large discrepency between the previous and current angles (ie. angle is close to 180 degrees but direction has changed)
-			if (currentAngle > 0.0)
-				angularDelta = (-2 * M_PI) + (currentAngle - previousAngle);
-			else
-				angularDelta = (2 * M_PI) + (currentAngle - previousAngle);
+			status = MStatus::kFailure;
+			break;
 		}
-		else
-			angularDelta = currentAngle - previousAngle;
 
-		// Counter the twist
-		angularDelta *= -1;
+		MVector vUpperBoundTangent = sampleFirstDerivative(m_data.upperBoundKnot);
+		vUpperBoundTangent.normalize();
+		upperBoundTangents[i] = vUpperBoundTangent;
+		counterTwistUpVectors[i] = m_data.vCounterTwistUp;
 
-		// Set a keyframe at the current time using the accumulative angle
-		totalAngle += angularDelta;
-		fnAnimCurve.addKey(iterTime, totalAngle, MFnAnimCurve::kTangentLinear, MFnAnimCurve::kTangentLinear, &animMod, &status);
+		if (angularTolerance > 0.0)
+		{
+			// The principal normal is calculated in the same way as the RMF
+			MVector vLowerBoundTangent = sampleFirstDerivative(m_data.lowerBoundKnot);
+			vLowerBoundTangent.normalize();
+			MVector vLowerBoundNormal = computeFlexiPrincipalNormal(m_data.vNormalUp, vLowerBoundTangent);
 
-		previousAngle = currentAngle;
-		iterTime += timeStep;
+			upperBoundNormals[i] = m_curve.propagateNormalRMF(m_data.degree, m_data.knots, m_data.controlPoints, m_data.lowerBoundKnot, 
+				m_data.upperBoundKnot, vLowerBoundNormal, angularTolerance);
+		}
+		else
+		{
+			computeCurveSamples(dataBlock);
+			upperBoundNormals[i] = m_data.normals[m_data.sampleCount - 1];
+		}
 	}
 
-	// Restore the previous time
-	MAnimControl::setCurrentTime(currentTime);
+	// The data held by the node corresponds to the last sample context
+	invalidateCurveData();
 
-	return status;
+	if (!status)
+		return status;
+
+	// --- Key Counter Twist ---
+	return keyFlexiCounterTwist(upperBoundTangents, upperBoundNormals, counterTwistUpVectors, startTime, timeStep, subSteps, m_data.grainSize, 
+		fnAnimCurve, animMod);
 }
 
 /*	Description
@@ -1892,14 +1657,50 @@ MVector FlexiSpine::sampleFirstDerivative(double t) const
 	return m_curve.sampleDerivative(1, t, m_data.degree, m_data.knots, m_data.controlPoints);
 }
 
+/*	Description
+	-----------
+	Samples the internal curve and optionally its first derivative for an array of parameters using previously evaluated data
+	The resulting derivatives will not be normalized
+
+	Args
+	----
+	parameters = Array of natural parameters, expected to be mostly increasing
+	count = Number of parameters to sample, each output array must hold at least this many elements    */
+void FlexiSpine::sampleCurveBatch(const double* parameters, unsigned int count, MVector* outPoints, MVector* outFirstDerivatives) const
+{
+	m_curve.sampleBatch(m_data.degree, m_data.knots, m_data.controlPoints, parameters, count, outPoints, outFirstDerivatives);
+}
+
 void FlexiSpine::instancingChangedCallback(MDagPath& child, MDagPath& parent, void* clientData)
 {
 	MGlobal::displayWarning("FlexiSpineShape does not support instancing!");
 }
 
+/*	Description
+	-----------
+	Dirties the draw state of the node, the draw dirty count is incremented before notifying the renderer
+	The sub-scene override compares this count against the count it last updated with to determine if an update is required    */
+void FlexiSpine::setDrawDirty()
+{
+	++m_drawDirtyCount;
+	MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+}
+
+/*	Description
+	-----------
+	Publishes the index of the active manipulator within the current tool context, an index of -1 signals that no manipulator is active
+	The draw dirty count is not affected, instead the renderer is notified so that the override can compare the version of the published state    */
+void FlexiSpine::setActiveManip(int index)
+{
+	if (m_manipState.setActiveIndex(index))
+		MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+}
+
 const MRS::BSpline& FlexiSpine::getCurve() const { return m_curve; }
 const FlexiSpine::FlexiSpine_Data& FlexiSpine::getCurveData() const { return m_data; }
 MDataBlock FlexiSpine::getDataBlock() { return forceCache(); }
+unsigned int FlexiSpine::getDrawDirtyCount() const { return m_drawDirtyCount; }
+const FlexiManipState& FlexiSpine::getManipState() const { return m_manipState; }
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -1911,7 +1712,7 @@ MDataBlock FlexiSpine::getDataBlock() { return forceCache(); }
 	
 	MEL Command
 	-----------
-	FlexiSpineCounterTwist [-startTime float] [-endTime float] [-timeStep float] [object]
+	FlexiSpineCounterTwist [-startTime float] [-endTime float] [-timeStep float] [-subSteps int] [-tolerance angle] [object]
 
 	Flags
 	-----
@@ -1929,6 +1730,16 @@ MDataBlock FlexiSpine::getDataBlock() { return forceCache(); }
 		A precautionary minimum value of 0.01 is enforced so that extremely small values do not tend towards an infinitely sized cached
 		The default value is 1.0
 
+	-subSteps(-ss)
+		This flag specifies the number of samples taken per time step, keyframes will only be set at each time step
+		Increasing the value allows large rotations of the end frame between keyframes to be resolved in the correct direction
+		The default value is 1
+
+	-tolerance(-tol)
+		This flag specifies the angular tolerance used to adaptively integrate the end frame of the curve
+		The end frame is then computed independently of the output count and subdivisions, which is typically much cheaper
+		If this flag is not set, the end frame is computed from the samples of the curve and will exactly match the drawn frames
+
 	Args
 	----
 	object
@@ -1946,6 +1757,10 @@ const char* FlexiSpine_CounterTwistCommand::kEndTimeFlag = "-et";
 const char* FlexiSpine_CounterTwistCommand::kEndTimeFlagLong = "-endTime";
 const char* FlexiSpine_CounterTwistCommand::kTimeStepFlag = "-ts";
 const char* FlexiSpine_CounterTwistCommand::kTimeStepFlagLong = "-timeStep";
+const char* FlexiSpine_CounterTwistCommand::kSubStepsFlag = "-ss";
+const char* FlexiSpine_CounterTwistCommand::kSubStepsFlagLong = "-subSteps";
+const char* FlexiSpine_CounterTwistCommand::kToleranceFlag = "-tol";
+const char* FlexiSpine_CounterTwistCommand::kToleranceFlagLong = "-tolerance";
 
 MSyntax FlexiSpine_CounterTwistCommand::newSyntax()
 {
@@ -1955,6 +1770,8 @@ MSyntax FlexiSpine_CounterTwistCommand::newSyntax()
 	syntax.addFlag(kStartTimeFlag, kStartTimeFlagLong, MSyntax::kTime);
 	syntax.addFlag(kEndTimeFlag, kEndTimeFlagLong, MSyntax::kTime);
 	syntax.addFlag(kTimeStepFlag, kTimeStepFlagLong, MSyntax::kTime);
+	syntax.addFlag(kSubStepsFlag, kSubStepsFlagLong, MSyntax::kUnsigned);
+	syntax.addFlag(kToleranceFlag, kToleranceFlagLong, MSyntax::kAngle);
 
 	// Args
 	syntax.useSelectionAsDefault(true);
@@ -1977,6 +1794,12 @@ MSyntax FlexiSpine_CounterTwistCommand::newSyntax()
 #define kErrorInvalidTimeStep \
 	"The \"-timeStep\" flag must be given a value greater or equal to 0.01 ."
 
+#define kErrorInvalidSubSteps \
+	"The \"-subSteps\" flag must be given a value greater or equal to 1 ."
+
+#define kErrorInvalidTolerance \
+	"The \"-tolerance\" flag must be given a value greater than 0 ."
+
 #define kErrorInvalidTimeInterval \
 	"The \"-endTime\" flag must be given a value greater than the \"-startTime\" flag"
 
@@ -2044,6 +1867,36 @@ MStatus FlexiSpine_CounterTwistCommand::doIt(const MArgList& args)
 			return MStatus::kFailure;
 		}
 	}
+	unsigned int subSteps = 1;
+	if (argParser.isFlagSet(kSubStepsFlagLong))
+	{
+		if (!argParser.getFlagArgument(kSubStepsFlagLong, 0, subSteps))
+		{
+			MString msg;
+			MString msgFormat = kErrorParsingFlag;
+			msg.format(msgFormat, kSubStepsFlagLong);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+	}
+	MAngle tolerance{ 0.0 };
+	if (argParser.isFlagSet(kToleranceFlagLong))
+	{
+		if (!argParser.getFlagArgument(kToleranceFlagLong, 0, tolerance))
+		{
+			MString msg;
+			MString msgFormat = kErrorParsingFlag;
+			msg.format(msgFormat, kToleranceFlagLong);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+
+		if (tolerance.asRadians() <= 0.0)
+		{
+			displayError(kErrorInvalidTolerance);
+			return MStatus::kFailure;
+		}
+	}
 
 	// Check parsed values are valid
 	if (timeStep < 0.01)
@@ -2052,6 +1905,12 @@ MStatus FlexiSpine_CounterTwistCommand::doIt(const MArgList& args)
 		return MStatus::kFailure;
 	}
 
+	if (subSteps < 1)
+	{
+		displayError(kErrorInvalidSubSteps);
+		return MStatus::kFailure;
+	}
+
 	if (endTime < startTime)
 	{
 		displayError(kErrorInvalidTimeInterval);
@@ -2148,7 +2007,7 @@ MStatus FlexiSpine_CounterTwistCommand::doIt(const MArgList& args)
 
 	// Add keyframes and store the changes in a cache for undo/redo
 	if (status)
-		status = locator->computeCounterTwist(startTime, endTime, timeStep, animCurveObj, m_animChangeMod);
+		status = locator->computeCounterTwist(startTime, endTime, timeStep, subSteps, tolerance.asRadians(), animCurveObj, m_animChangeMod);
 
 	return status;
 }
@@ -2183,6 +2042,8 @@ MStatus FlexiSpine_CounterTwistCommand::undoIt()
 #undef kErrorFlagNotSet
 #undef kErrorParsingFlag
 #undef kErrorInvalidTimeStep
+#undef kErrorInvalidSubSteps
+#undef kErrorInvalidTolerance
 #undef kErrorInvalidTimeInterval
 #undef kErrorNoValidObject
 #undef kErrorInvalidType
@@ -2369,22 +2230,25 @@ MStatus FlexiSpine_StabilityCommand::doIt(const MArgList& args)
 		return MStatus::kFailure;
 	}
 
-	MTime currentTime = MAnimControl::currentTime();
-	// This call does not cause the viewport loop to refresh
-	MAnimControl::setCurrentTime(time);
-	// We must force a DG update (we can either call the "refresh" command or manually pull data from an output)
-	dataBlock.inputValue(FlexiSpine::outputWorldFramesAttr);
-
-	// Calculate the stability of the up-vector
-	double stability;
-	if (isQueryNormal)
-		locator->computeNormalStability(stability);
-	else
-		locator->computeCounterTwistStability(stability);
+	// Stability only depends on the tangents at the bounds of the curve
+	// Therefore the node is evaluated under a context for the given time and evaluation stops once the curve has been built
+	double stability = 0.0;
+	{
+		MDGContext timeContext{ time };
+		MDGContextGuard contextGuard{ timeContext };
+		MDataBlock timeDataBlock = locator->getDataBlock();
+		locator->computeCurve(timeDataBlock);
+
+		// Calculate the stability of the up-vector
+		if (isQueryNormal)
+			status = locator->computeNormalStability(stability);
+		else
+			status = locator->computeCounterTwistStability(stability);
+	}
 
 	// Set result and cleanup
+	locator->invalidateCurveData();
 	setResult(stability);
-	MAnimControl::setCurrentTime(currentTime);
 	return status;
 }
 
@@ -11,6 +11,7 @@
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDGModifier.h>
 #include <maya/MEvaluationNode.h>
 #include <maya/MFnDependencyNode.h>
@@ -38,6 +39,8 @@
 #include <SeExpr2/Curve.h>
 #include <SeExpr2/Vec.h>
 
+#include "flexiCore.h"
+#include "flexiDrawHelpers.h"
 #include "flexiHelpers.h"
 #include "data/eulerArray_data.h"
 #include "utils/math_utils.h"
@@ -45,6 +48,8 @@
 #include "utils/node_utils.h"
 #include "utils/quaternion_utils.h"
 #include "utils/spline_utils.h"
+#include "utils/thread_utils.h"
+#include "utils/vector_array_utils.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -83,7 +88,12 @@ public:
 		bool isCounterTwistUpVectorOverrideEnabled;
 		bool isScaleAdjustmentEnabled;
 		bool isTwistAdjustmentEnabled;
+		bool isScaleAdjustmentDirty;
+		bool isTwistAdjustmentDirty;
 		bool isDrawRibbonEnabled;
+
+		// threading
+		unsigned int grainSize;
 		
 		// values
 		double parameterizationBlend;
@@ -102,18 +112,20 @@ public:
 		std::vector<double> naturalParameters;
 		std::vector<double> arcLengthParameters;
 		std::vector<double> blendedParameters;
+		std::vector<double> sampleParameters;
 		unsigned int minParamIndex;
 
-		// lengths (natural parameter increments)
-		std::vector<double> lengths;
+		// lengths (integrated per knot span, independent of the output count)
+		MRS::ArcLengthTable arcLengthTable;
 
 		// sample xforms
 		MVector vPrincipalNormal;
-		std::vector<MVector> points;
-		std::vector<MVector> tangents;
-		std::vector<MVector> binormals;
-		std::vector<MVector> normals;
+		MRS::VectorArray points;
+		MRS::VectorArray tangents;
+		MRS::VectorArray binormals;
+		MRS::VectorArray normals;
 		std::vector<MQuaternion> rmfReflections;
+		std::vector<MQuaternion> rmfStepReflections;
 
 		// input xforms
 		MVector vNormalUp;
@@ -126,6 +138,10 @@ public:
 		// adjustments
 		std::vector<TwistAdjustment> twistAdjustments;
 		std::vector<ScaleAdjustment> scaleAdjustments;
+		// summed adjustment values at the normalized parameters, persisting until an adjustment or the parameterization changes
+		std::vector<double> normalizedParameters;
+		FlexiAdjustmentTable<TwistAdjustment> twistAdjustmentTable;
+		FlexiAdjustmentTable<ScaleAdjustment> scaleAdjustmentTable;
 	};
 
 public:
@@ -151,18 +167,28 @@ public:
 
 	// ------ Helpers ------
 	void computeCurveData(MDataBlock& dataBlock);
+	void computeCurve(MDataBlock& dataBlock);
+	void computeCurveSamples(MDataBlock& dataBlock);
+	void invalidateCurveData();
 	void computeScaleAdjustments(MDataBlock& dataBlock);
 	void computeTwistAdjustments(MDataBlock& dataBlock);
+	void computeNormalizedParameters();
 	MStatus computeNormalStability(double& outStability);
 	MStatus computeCounterTwistStability(double& outStability);
-	MStatus computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, MObject& animCurveObj, MAnimCurveChange& animMod);
+	MStatus computeCounterTwist(MTime startTime, MTime endTime, MTime timeStep, unsigned int subSteps, double angularTolerance, 
+		MObject& animCurveObj, MAnimCurveChange& animMod);
 	MVector sampleCurve(double t) const;
 	MVector sampleFirstDerivative(double t) const;
+	void sampleCurveBatch(const double* parameters, unsigned int count, MVector* outPoints, MVector* outFirstDerivatives = nullptr) const;
 	static void instancingChangedCallback(MDagPath& child, MDagPath& parent, void* clientData);
 
 	const MRS::BSpline& getCurve() const;
 	const FlexiSpine_Data& getCurveData() const;
 	MDataBlock getDataBlock();
+	unsigned int getDrawDirtyCount() const;
+	void setDrawDirty();
+	const FlexiManipState& getManipState() const;
+	void setActiveManip(int index);
 
 	// ------ Attr ------
 	// inputs
@@ -226,6 +252,8 @@ public:
 	static MObject scaleAdjustmentRepeatAttr;
 	static MObject scaleAdjustmentFalloffModeAttr;
 	static MObject scaleAdjustmentFalloffDistanceAttr;
+	static MObject forceSerialEvaluationAttr;
+	static MObject parallelGrainSizeAttr;
 	// outputs
 	static MObject outputLocalFramesAttr;
 	static MObject outputLocalPositionsAttr;
@@ -244,6 +272,12 @@ private:
 	MRS::BSpline m_curve;
 	FlexiSpine_Data m_data;
 
+	// ------ Draw ------
+	// Incremented whenever the draw state is dirtied, the draw override uses this to skip draw cycles in which nothing has changed
+	unsigned int m_drawDirtyCount;
+	// Published by the tool contexts, the draw override uses this to display the falloff of the active manipulator
+	FlexiManipState m_manipState;
+
 	// ------ Callbacks ------
 	MCallbackId m_instanceAddedCallbackId;
 };
@@ -268,6 +302,10 @@ public:
 	static const char* kEndTimeFlagLong;
 	static const char* kTimeStepFlag;
 	static const char* kTimeStepFlagLong;
+	static const char* kSubStepsFlag;
+	static const char* kSubStepsFlagLong;
+	static const char* kToleranceFlag;
+	static const char* kToleranceFlagLong;
 
 	// ------ MPxCommand ------
 	bool isUndoable() const override;
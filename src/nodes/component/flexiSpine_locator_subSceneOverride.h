@@ -26,6 +26,7 @@
 #include <maya/MUserData.h>
 #include <maya/MVector.h>
 
+#include "flexiDrawHelpers.h"
 #include "flexiSpine_locator.h"
 #include "utils/color_utils.h"
 
@@ -104,21 +105,21 @@ private:
 	MHWRender::MRenderItem* m_hullRenderItem;
 	MHWRender::MRenderItem* m_boundingBoxRenderItem;
 
-	// buffer
-	MHWRender::MVertexBuffer* m_surfacePositionBuffer;
-	MHWRender::MVertexBuffer* m_surfaceNormalBuffer;
-	MHWRender::MVertexBuffer* m_surfaceTextureBuffer;
-	MHWRender::MVertexBuffer* m_curvePositionBuffer;
-	MHWRender::MVertexBuffer* m_normalsPositionBuffer;
-	MHWRender::MVertexBuffer* m_hullPositionBuffer;
-	MHWRender::MVertexBuffer* m_boundingBoxPositionBuffer;
-
-	MHWRender::MIndexBuffer* m_surfaceIndexBuffer;
-	MHWRender::MIndexBuffer* m_borderIndexBuffer;
-	MHWRender::MIndexBuffer* m_curveIndexBuffer;
-	MHWRender::MIndexBuffer* m_normalsIndexBuffer;
-	MHWRender::MIndexBuffer* m_hullIndexBuffer;
-	MHWRender::MIndexBuffer* m_boundingBoxIndexBuffer;
+	// buffer (persistent between updates, see flexiDrawHelpers.h)
+	FlexiVertexBuffer m_surfacePositionBuffer;
+	FlexiVertexBuffer m_surfaceNormalBuffer;
+	FlexiVertexBuffer m_surfaceTextureBuffer;
+	FlexiVertexBuffer m_curvePositionBuffer;
+	FlexiVertexBuffer m_normalsPositionBuffer;
+	FlexiVertexBuffer m_hullPositionBuffer;
+	FlexiVertexBuffer m_boundingBoxPositionBuffer;
+
+	FlexiIndexBuffer m_surfaceIndexBuffer;
+	FlexiIndexBuffer m_borderIndexBuffer;
+	FlexiIndexBuffer m_curveIndexBuffer;
+	FlexiIndexBuffer m_normalsIndexBuffer;
+	FlexiIndexBuffer m_hullIndexBuffer;
+	FlexiIndexBuffer m_boundingBoxIndexBuffer;
 
 	// Cache non-networked plugs
 	MPlug m_overrideLevelOfDetailPlug;
@@ -139,48 +140,25 @@ private:
 	bool m_upVectorContextEnabled;
 	bool m_scaleAdjustmentContextEnabled;
 	bool m_twistAdjustmentContextEnabled;
-	int m_surfaceVertexCount;
-	int m_curveVertexCount;
-	int m_normalsVertexCount;
-	int m_hullVertexCount;
+	short m_drawSpaceTransformation;
+	unsigned int m_drawDirtyCount;
+	unsigned int m_manipStateVersion;
+	FlexiRampKey m_rampKey;
+	MString m_toolContextName;
 
 	// ------ Helpers ------
 	void createShaderInstance(const MShaderManager* shaderManager, MFragmentManager* fragmentManager);
 	void setDefaultRamp();
-	void updateRampTextureUpVectorContext();
-	void updateRampTextureScaleAdjustmentContext();
-	void updateRampTextureTwistAdjustmentContext();
-	void updateSurfaceShader(MShaderInstance* shader, const char* colorParameter, MColor color);
-	void updateLineShader(MShaderInstance* shader, const char* lineWidthParameter, float lineWidth, const char* colorParameter, MColor color);
+	void updateRampTexture();
+	void updateRampTextureUpVectorContext(int activeIndex);
+	void updateRampTextureScaleAdjustmentContext(int activeIndex);
+	void updateRampTextureTwistAdjustmentContext(int activeIndex);
 
 	void updateRibbonGeometryBuffers();
-	void deleteRibbonVertexBuffers();
-	void deleteRibbonIndexBuffers();
-	void deleteRibbonGeometryBuffers();
-
 	void updateCurveGeometryBuffers();
-	void deleteCurveVertexBuffers();
-	void deleteCurveIndexBuffers();
-	void deleteCurveGeometryBuffers();
-
 	void updateNormalsGeometryBuffers();
-	void deleteNormalsVertexBuffers();
-	void deleteNormalsIndexBuffers();
-	void deleteNormalsGeometryBuffers();
-
 	void updateHullGeometryBuffers();
-	void deleteHullVertexBuffers();
-	void deleteHullIndexBuffers();
-	void deleteHullGeometryBuffers();
-
 	void updateBoundingBoxGeometryBuffers(const MBoundingBox& bounds);
-	void deleteBoundingBoxVertexBuffers();
-	void deleteBoundingBoxIndexBuffers();
-	void deleteBoundingBoxGeometryBuffers();
-
-	void deleteVertexBuffers();
-	void deleteIndexBuffers();
-	void deleteGeometryBuffers();
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -113,15 +113,6 @@ private:
 	bool m_isActive;
 
 	// ------ Helpers ------
-	MPoint getCameraPosition(M3dView& view) const;
-	MPoint getCameraPosition(const MHWRender::MFrameContext& frameContext) const;
-	MVector getCameraAimDirection(M3dView& view) const;
-	MVector getCameraAimDirection(const MHWRender::MFrameContext& frameContext) const;
-	MVector getCameraUpDirection(M3dView& view) const;
-	MVector getCameraUpDirection(const MHWRender::MFrameContext& frameContext) const;
-
-	bool computeMouseIntersection(const MPoint& pMouse, const MVector& vMouseDirection, const MPoint& pPointOnInterPlane,
-		const MVector& vInterPlaneNormal, MPoint& pIntersection);
 	bool computeCurrentMouseIntersection(const MPoint& pPointOnInterPlane, const MVector& vInterPlaneNormal, MPoint& pIntersection);
 
 	MStatus updatePlugDirection(MVector& vDirection);
@@ -180,6 +171,7 @@ public:
 
 private:
 	// ------ Helpers ------
+	void publishActiveManip();
 	static void updateManipulatorsCallback(void* data);
 	static void nodePlugChangedCallback(MNodeMessage::AttributeMessage msg, MPlug& plug, MPlug& otherPlug, void* data);
 
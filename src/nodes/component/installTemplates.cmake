@@ -8,6 +8,7 @@ configure_file("${TEMPLATE_DIR}/AEFlexiChainDoubleShapeTemplate.mel.in" "${DIST_
 configure_file("${TEMPLATE_DIR}/AEFlexiChainTripleShapeTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}FlexiChainTripleShapeTemplate.mel")
 configure_file("${TEMPLATE_DIR}/AEVChainPlanarSolverTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}VChainPlanarSolverTemplate.mel")
 configure_file("${TEMPLATE_DIR}/AEVChainSolverTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}VChainSolverTemplate.mel")
+configure_file("${TEMPLATE_DIR}/AEVChainSolverArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}VChainSolverArrayTemplate.mel")
 configure_file("${TEMPLATE_DIR}/NEAimTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AimTemplate.xml")
 configure_file("${TEMPLATE_DIR}/NEAimTransformTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AimTransformTemplate.xml")
 configure_file("${TEMPLATE_DIR}/NEFlexiSpineShapeTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}FlexiSpineShapeTemplate.xml")
@@ -17,3 +18,4 @@ configure_file("${TEMPLATE_DIR}/NEFlexiChainDoubleShapeTemplate.xml.in" "${DIST_
 configure_file("${TEMPLATE_DIR}/NEFlexiChainTripleShapeTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}FlexiChainTripleShapeTemplate.xml")
 configure_file("${TEMPLATE_DIR}/NEVChainPlanarSolverTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}VChainPlanarSolverTemplate.xml")
 configure_file("${TEMPLATE_DIR}/NEVChainSolverTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}VChainSolverTemplate.xml")
+configure_file("${TEMPLATE_DIR}/NEVChainSolverArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}VChainSolverArrayTemplate.xml")
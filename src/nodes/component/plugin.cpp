@@ -31,6 +31,7 @@
 #include "aim_node.h"
 #include "vChainPlanarSolver_node.h"
 #include "vChainSolver_node.h"
+#include "vChainSolverArray_node.h"
 
 #include "utils/macros.h"
 #include "utils/plugin_utils.h"
@@ -88,6 +89,7 @@ const MTypeId FootRoll::kTypeId = 0x00131008;
 const MTypeId VChainSolver::kTypeId = 0x00131009;
 const MTypeId Aim::kTypeId = 0x0013100a;
 const MTypeId VChainPlanarSolver::kTypeId = 0x0013100b;
+const MTypeId VChainSolverArray::kTypeId = 0x0013100c;
 
 // Names
 const MString Aim::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Aim";
@@ -95,6 +97,7 @@ const MString AimTransform::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "AimTransform
 const MString FootRoll::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "FootRoll";
 const MString VChainSolver::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "VChainSolver";
 const MString VChainPlanarSolver::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "VChainPlanarSolver";
+const MString VChainSolverArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "VChainSolverArray";
 
 const MString FlexiSpine::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "FlexiSpineShape";
 const MString FlexiSpine::kDrawClassification = "drawdb/subscene/" MRS_XSTR(NODE_NAME_PREFIX) "FlexiSpineShape";
@@ -238,6 +241,9 @@ MStatus initializePlugin(MObject plugin)
 	errorMessage.format(kErrorInvalidPluginId, VChainPlanarSolver::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(VChainPlanarSolver::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, VChainSolverArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(VChainSolverArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, FlexiSpine::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(FlexiSpine::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
@@ -363,6 +369,9 @@ MStatus initializePlugin(MObject plugin)
 	errorMessage.format(kErrorPluginRegistration, VChainPlanarSolver::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<VChainPlanarSolver>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, VChainSolverArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<VChainSolverArray>(fnPlugin), errorMessage);
+
 	// FlexiSpine
 	errorMessage.format(kErrorPluginRegistration, FlexiSpine_UpVectorManip::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerManipulator<FlexiSpine_UpVectorManip>(fnPlugin), errorMessage);
@@ -677,6 +686,9 @@ MStatus uninitializePlugin(MObject plugin)
 	errorMessage.format(kErrorPluginDeregistration, VChainPlanarSolver::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<VChainPlanarSolver>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, VChainSolverArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<VChainSolverArray>(fnPlugin), errorMessage);
+
 	// FlexiSpine
 	MGlobal::executeCommand("callbacks -removeCallback MRS_FlexiSpine_rmbCallback -hook addRMBBakingMenuItems -owner FlexiSpine;");
 
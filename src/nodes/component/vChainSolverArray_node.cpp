@@ -0,0 +1,485 @@
+#include "vChainSolverArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Solves a batch of independent v-shaped chains, each producing the same solution as a VChainSolver node.
+	The chains share the axis and solver settings, whilst the positions and segment lengths are provided per chain.
+	This allows many identical limbs (eg. crowd or creature rigs) to be evaluated by a single node instead of paying the per-node evaluation overhead for each limb.
+	See VChainSolver for a description of the solution and the behaviour of each solver.
+
+	Attributes
+	----------
+	rootPosition - matrixArray
+		Frames providing the world position of the root transform of each chain.
+
+	handlePosition - matrixArray
+		Frames providing the world position of the handle transform of each chain.
+
+	upVectorPosition - matrixArray
+		Frames providing the world position of the up-vector transform of each chain.
+		The number of chains is determined by the shortest of the rootPosition, handlePosition and upVectorPosition arrays.
+
+	length0 - doubleArray
+		The length of the first segment of each chain.
+		Missing elements default to 10.0, lengths are clamped to a minimum of 0.01.
+
+	length1 - doubleArray
+		The length of the second segment of each chain.
+		Missing elements default to 10.0, lengths are clamped to a minimum of 0.01.
+
+	parentInverseFrame, aimAxis, upAxis, direction, solver, maxCompressionRatio, maxRigidExtensionRatio, maxNonRigidExtensionRatio,
+	maxHeightReductionRatio, heightReductionDeceleration, hierarchicalOutput
+		Shared by every chain, see VChainSolver.
+
+	outputFrames - matrixArray
+		The concatenated frames of each chain, chain i occupies the range [i * 7, i * 7 + 7).
+		The frames of each chain are ordered as per the outputFrames of VChainSolver.
+
+	outputRootToEffectorOffset - doubleArray
+		The distance between the root position and the effector position of each chain.
+
+	Notes
+	-----
+	Chains are solved in blocks whose intermediate values are stored as a structure of arrays.
+	Each stage of the triangle solve is a loop over the block with no dependencies between chains, allowing the compiler to vectorize the arithmetic and the calls to acos/atan.
+	Conditions which differ between chains are resolved by selecting between the results of both branches, the solver choice is shared and is therefore hoisted out of the loops.
+	Blocks are distributed over Maya's thread pool once the number of chains exceeds the default grain size.
+*/
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+// The number of chains whose intermediate values are stored in a single TriangleBlock
+const unsigned int kBlockSize = 64;
+const double kDefaultLength = 10.0;
+const double kMinLength = 0.01;
+
+struct SolverSettings
+{
+	short solver;
+	double maxCompressionRatio;
+	double maxRigidExtensionRatio;
+	double maxNonRigidExtensionRatio;
+	double maxHeightReductionRatio;
+	double heightReductionDeceleration;
+};
+
+// Structure of arrays holding the triangles of a block of chains, lanes [0, count) are valid
+struct TriangleBlock
+{
+	unsigned int count;
+	// Inputs
+	double handleOffset[kBlockSize];
+	double rigidA[kBlockSize];
+	double rigidB[kBlockSize];
+	// Solution
+	double a[kBlockSize];
+	double b[kBlockSize];
+	double c[kBlockSize];
+	double A[kBlockSize];
+	double B[kBlockSize];
+	double C[kBlockSize];
+};
+
+/*	Non-rigid lengths and angles for the height based solvers, see VChainSolver::computeData
+	The non-rigid solution is computed for every lane and only kept by those whose handle exceeds the maximum rigid extension    */
+void solveHeightExtension(TriangleBlock& block, const SolverSettings& settings, const double* maxRigidEffectorOffset, const double* maxNonRigidEffectorOffset,
+	const bool* isNonRigid, bool* solvedAngles)
+{
+	const unsigned int count = block.count;
+	const bool isReduction = settings.solver == VChainSolver::kHeightReductionExtensionSolver;
+
+	double effectorOffset[kBlockSize];
+	double projNonRigidA[kBlockSize];
+	double projNonRigidB[kBlockSize];
+	double height[kBlockSize];
+	double angleA[kBlockSize];
+	double angleB[kBlockSize];
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		double rigidA = block.rigidA[i];
+		double rigidB = block.rigidB[i];
+		double maxRigidOffset = maxRigidEffectorOffset[i];
+
+		effectorOffset[i] = std::min(block.handleOffset[i], maxNonRigidEffectorOffset[i]);
+		double cosRigidA = (rigidB * rigidB + maxRigidOffset * maxRigidOffset - rigidA * rigidA) / (2 * rigidB * maxRigidOffset);
+		double cosRigidB = (rigidA * rigidA + maxRigidOffset * maxRigidOffset - rigidB * rigidB) / (2 * rigidA * maxRigidOffset);
+		double projRigidA = cosRigidB * rigidA;
+		double projRigidB = cosRigidA * rigidB;
+		double ratioA = projRigidA / (projRigidA + projRigidB);
+		projNonRigidA[i] = ratioA * effectorOffset[i];
+		projNonRigidB[i] = effectorOffset[i] - projNonRigidA[i];
+		height[i] = std::sqrt(rigidA * rigidA - projRigidA * projRigidA);
+	}
+
+	if (isReduction && settings.maxHeightReductionRatio != 0.0)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			double nonRigidRatio = (effectorOffset[i] - maxRigidEffectorOffset[i]) / (maxNonRigidEffectorOffset[i] - maxRigidEffectorOffset[i]);
+			double minNonRigidHeight = height[i] * (1.0 - settings.maxHeightReductionRatio);
+			height[i] = MRS::variableDeceleration(height[i], minNonRigidHeight, nonRigidRatio, settings.heightReductionDeceleration);
+		}
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+		angleA[i] = std::atan(height[i] / projNonRigidB[i]);
+
+	for (unsigned int i = 0; i < count; ++i)
+		angleB[i] = std::atan(height[i] / projNonRigidA[i]);
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		double heightSquared = height[i] * height[i];
+		double nonRigidA = std::sqrt(projNonRigidA[i] * projNonRigidA[i] + heightSquared);
+		double nonRigidB = std::sqrt(projNonRigidB[i] * projNonRigidB[i] + heightSquared);
+		// Optimisation - the angles of an isosceles solution are equal
+		double A = MRS::isEqual(nonRigidA, nonRigidB) ? angleB[i] : angleA[i];
+		double B = angleB[i];
+
+		block.a[i] = isNonRigid[i] ? nonRigidA : block.a[i];
+		block.b[i] = isNonRigid[i] ? nonRigidB : block.b[i];
+		block.c[i] = isNonRigid[i] ? effectorOffset[i] : block.c[i];
+		block.A[i] = A;
+		block.B[i] = B;
+		block.C[i] = M_PI - A - B;
+		solvedAngles[i] = isNonRigid[i];
+	}
+}
+
+/*	Solves the lengths and angles of each triangle in the block, producing the same solution as VChainSolver::computeData
+	The resulting angles have been adjusted for the given direction    */
+void solveTriangleBlock(TriangleBlock& block, const SolverSettings& settings, short direction)
+{
+	const unsigned int count = block.count;
+
+	double maxRigidEffectorOffset[kBlockSize];
+	double maxNonRigidEffectorOffset[kBlockSize];
+	bool isNonRigid[kBlockSize];
+	bool solvedAngles[kBlockSize];
+
+	// ------ Rigid ------
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		double chainLength = block.rigidA[i] + block.rigidB[i];
+		double minEffectorOffset = chainLength * (1.0 - settings.maxCompressionRatio);
+		maxRigidEffectorOffset[i] = chainLength * settings.maxRigidExtensionRatio;
+		maxNonRigidEffectorOffset[i] = chainLength * (settings.maxRigidExtensionRatio + settings.maxNonRigidExtensionRatio);
+
+		// Clamp the effector between the maximum compression and maximum rigid extension
+		block.a[i] = block.rigidA[i];
+		block.b[i] = block.rigidB[i];
+		block.c[i] = std::min(std::max(block.handleOffset[i], minEffectorOffset), maxRigidEffectorOffset[i]);
+		isNonRigid[i] = block.handleOffset[i] > maxRigidEffectorOffset[i];
+		solvedAngles[i] = false;
+	}
+
+	// ------ Non-Rigid ------
+	switch (settings.solver)
+	{
+		case VChainSolver::kRigidSolver:
+			break;
+
+		case VChainSolver::kLengthDampeningSolver:
+		{
+			// Length dampening only applies if the rigid chain is not fully extended
+			if (settings.maxRigidExtensionRatio < 1.0)
+			{
+				for (unsigned int i = 0; i < count; ++i)
+				{
+					double chainLength = block.rigidA[i] + block.rigidB[i];
+					double softness = chainLength - maxRigidEffectorOffset[i];
+					double effectorOffset = std::min(-softness * std::pow(M_E, (maxRigidEffectorOffset[i] - block.handleOffset[i]) / softness) + chainLength,
+						maxNonRigidEffectorOffset[i]);
+					block.c[i] = isNonRigid[i] ? effectorOffset : block.c[i];
+				}
+			}
+
+			break;
+		}
+
+		case VChainSolver::kHeightLockExtensionSolver:
+		case VChainSolver::kHeightReductionExtensionSolver:
+		{
+			solveHeightExtension(block, settings, maxRigidEffectorOffset, maxNonRigidEffectorOffset, isNonRigid, solvedAngles);
+			break;
+		}
+	}
+
+	// ------ Angles ------
+	// Law of cosines for lanes whose angles have not been solved with their lengths, see VChainSolver::solveAngles
+	double cosC[kBlockSize];
+	double cosA[kBlockSize];
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		double aSquared = block.a[i] * block.a[i];
+		double bSquared = block.b[i] * block.b[i];
+		double cSquared = block.c[i] * block.c[i];
+		cosC[i] = (aSquared + bSquared - cSquared) / (2 * block.a[i] * block.b[i]);
+		cosA[i] = (bSquared + cSquared - aSquared) / (2 * block.b[i] * block.c[i]);
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+		cosC[i] = std::acos(cosC[i]);
+
+	for (unsigned int i = 0; i < count; ++i)
+		cosA[i] = std::acos(cosA[i]);
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		double C = cosC[i];
+		// Optimization for isosceles
+		double A = MRS::isEqual(block.a[i], block.b[i]) ? (M_PI - C) / 2.0 : cosA[i];
+		double B = MRS::isEqual(block.a[i], block.b[i]) ? A : M_PI - A - C;
+
+		block.A[i] = (solvedAngles[i] ? block.A[i] : A) * direction;
+		block.B[i] = (solvedAngles[i] ? block.B[i] : B) * direction;
+		block.C[i] = (solvedAngles[i] ? block.C[i] : C) * direction;
+	}
+}
+
+} // anonymous
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+VChainSolverArray::VChainSolverArray() :
+	m_aimAxis{ -1 },
+	m_upAxis{ -1 },
+	m_computeFrames{ nullptr }
+{}
+
+VChainSolverArray::~VChainSolverArray() {}
+
+// ------ Attr ------
+MObject VChainSolverArray::parentInverseFrameAttr;
+MObject VChainSolverArray::rootPositionAttr;
+MObject VChainSolverArray::handlePositionAttr;
+MObject VChainSolverArray::upVectorPositionAttr;
+MObject VChainSolverArray::aimAxisAttr;
+MObject VChainSolverArray::upAxisAttr;
+MObject VChainSolverArray::length0Attr;
+MObject VChainSolverArray::length1Attr;
+MObject VChainSolverArray::directionAttr;
+MObject VChainSolverArray::solverAttr;
+MObject VChainSolverArray::maxCompressionRatioAttr;
+MObject VChainSolverArray::maxRigidExtensionRatioAttr;
+MObject VChainSolverArray::maxNonRigidExtensionRatioAttr;
+MObject VChainSolverArray::maxHeightReductionRatioAttr;
+MObject VChainSolverArray::heightReductionDecelerationAttr;
+MObject VChainSolverArray::hierarchicalOutputAttr;
+MObject VChainSolverArray::outputFramesAttr;
+MObject VChainSolverArray::outputRootToEffectorOffsetAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType VChainSolverArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus VChainSolverArray::initialize()
+{
+	std::unordered_map<const char*, short> axisFields{ {"+x", VChainSolver::kPosX}, {"+y", VChainSolver::kPosY}, {"+z", VChainSolver::kPosZ},
+		{"-x", VChainSolver::kNegX}, {"-y", VChainSolver::kNegY}, {"-z", VChainSolver::kNegZ} };
+	std::unordered_map<const char*, short> directionFields{ {"backward", VChainSolver::kBackward}, {"forward", VChainSolver::kForward} };
+	std::unordered_map<const char*, short> solverFields{ {"rigid", VChainSolver::kRigidSolver}, {"lengthDampening", VChainSolver::kLengthDampeningSolver},
+		{"heightLockExtension", VChainSolver::kHeightLockExtensionSolver}, {"heightReductionExtension", VChainSolver::kHeightReductionExtensionSolver} };
+	std::vector<MMatrix> positions;
+	std::vector<double> lengths;
+	std::vector<MMatrix> outputFrames;
+	std::vector<double> outputOffsets;
+
+	createMatrixAttribute(parentInverseFrameAttr, "parentInverseFrame", "parentInverseFrame", MMatrix::identity, kDefaultPreset);
+	createMatrixDataArrayAttribute(rootPositionAttr, "rootPosition", "rootPosition", positions, kDefaultPreset);
+	createMatrixDataArrayAttribute(handlePositionAttr, "handlePosition", "handlePosition", positions, kDefaultPreset);
+	createMatrixDataArrayAttribute(upVectorPositionAttr, "upVectorPosition", "upVectorPosition", positions, kDefaultPreset);
+	createEnumAttribute(aimAxisAttr, "aimAxis", "aimAxis", axisFields, 0, kDefaultPreset | kKeyable);
+	createEnumAttribute(upAxisAttr, "upAxis", "upAxis", axisFields, 1, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(length0Attr, "length0", "length0", lengths, kDefaultPreset);
+	createDoubleDataArrayAttribute(length1Attr, "length1", "length1", lengths, kDefaultPreset);
+	createEnumAttribute(directionAttr, "direction", "direction", directionFields, 1, kDefaultPreset | kKeyable);
+	createEnumAttribute(solverAttr, "solver", "solver", solverFields, 0, kDefaultPreset | kKeyable);
+	createDoubleAttribute(maxCompressionRatioAttr, "maxCompressionRatio", "maxCompressionRatio", 0.9, kDefaultPreset | kKeyable);
+	setMinMax<double>(maxCompressionRatioAttr, 0.0, 0.95);
+	createDoubleAttribute(maxRigidExtensionRatioAttr, "maxRigidExtensionRatio", "maxRigidExtensionRatio", 0.98, kDefaultPreset | kKeyable);
+	setMinMax<double>(maxRigidExtensionRatioAttr, 0.05, 1.0);
+	createDoubleAttribute(maxNonRigidExtensionRatioAttr, "maxNonRigidExtensionRatio", "maxNonRigidExtensionRatio", 0.05, kDefaultPreset | kKeyable);
+	setMin<double>(maxNonRigidExtensionRatioAttr, 0.0);
+	createDoubleAttribute(maxHeightReductionRatioAttr, "maxHeightReductionRatio", "maxHeightReductionRatio", 1.0, kDefaultPreset | kKeyable);
+	setMinMax<double>(maxHeightReductionRatioAttr, 0.0, 1.0);
+	createDoubleAttribute(heightReductionDecelerationAttr, "heightReductionDeceleration", "heightReductionDeceleration", 0.0, kDefaultPreset | kKeyable);
+	setMinMax<double>(heightReductionDecelerationAttr, 0.0, 0.95);
+	createBoolAttribute(hierarchicalOutputAttr, "hierarchicalOutput", "hierarchicalOutput", true, kDefaultPreset | kKeyable);
+	createMatrixDataArrayAttribute(outputFramesAttr, "outputFrames", "outputFrames", outputFrames, kReadOnlyPreset);
+	createDoubleDataArrayAttribute(outputRootToEffectorOffsetAttr, "outputRootToEffectorOffset", "outputRootToEffectorOffset", outputOffsets, kReadOnlyPreset);
+
+	addAttribute(parentInverseFrameAttr);
+	addAttribute(rootPositionAttr);
+	addAttribute(handlePositionAttr);
+	addAttribute(upVectorPositionAttr);
+	addAttribute(aimAxisAttr);
+	addAttribute(upAxisAttr);
+	addAttribute(length0Attr);
+	addAttribute(length1Attr);
+	addAttribute(directionAttr);
+	addAttribute(solverAttr);
+	addAttribute(maxCompressionRatioAttr);
+	addAttribute(maxRigidExtensionRatioAttr);
+	addAttribute(maxNonRigidExtensionRatioAttr);
+	addAttribute(maxHeightReductionRatioAttr);
+	addAttribute(heightReductionDecelerationAttr);
+	addAttribute(hierarchicalOutputAttr);
+	addAttribute(outputFramesAttr);
+	addAttribute(outputRootToEffectorOffsetAttr);
+
+	attributeAffects(parentInverseFrameAttr, outputFramesAttr);
+	attributeAffects(rootPositionAttr, outputFramesAttr);
+	attributeAffects(handlePositionAttr, outputFramesAttr);
+	attributeAffects(upVectorPositionAttr, outputFramesAttr);
+	attributeAffects(aimAxisAttr, outputFramesAttr);
+	attributeAffects(upAxisAttr, outputFramesAttr);
+	attributeAffects(length0Attr, outputFramesAttr);
+	attributeAffects(length1Attr, outputFramesAttr);
+	attributeAffects(directionAttr, outputFramesAttr);
+	attributeAffects(solverAttr, outputFramesAttr);
+	attributeAffects(maxCompressionRatioAttr, outputFramesAttr);
+	attributeAffects(maxRigidExtensionRatioAttr, outputFramesAttr);
+	attributeAffects(maxNonRigidExtensionRatioAttr, outputFramesAttr);
+	attributeAffects(maxHeightReductionRatioAttr, outputFramesAttr);
+	attributeAffects(heightReductionDecelerationAttr, outputFramesAttr);
+	attributeAffects(hierarchicalOutputAttr, outputFramesAttr);
+
+	attributeAffects(parentInverseFrameAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(rootPositionAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(handlePositionAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(upVectorPositionAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(length0Attr, outputRootToEffectorOffsetAttr);
+	attributeAffects(length1Attr, outputRootToEffectorOffsetAttr);
+	attributeAffects(solverAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(maxCompressionRatioAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(maxRigidExtensionRatioAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(maxNonRigidExtensionRatioAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(maxHeightReductionRatioAttr, outputRootToEffectorOffsetAttr);
+	attributeAffects(heightReductionDecelerationAttr, outputRootToEffectorOffsetAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus VChainSolverArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputFramesAttr && plug != outputRootToEffectorOffsetAttr)
+		return MStatus::kUnknownParameter;
+
+	// ------ Inputs ------
+	// Both outputs are produced by the same solve, therefore a request for either output will write both outputs and set them clean
+	MMatrix parentInverseFrame = inputMatrixValue(dataBlock, parentInverseFrameAttr);
+	// The arrays are copied on this thread as the data function sets must not be accessed by the workers
+	inputMatrixDataArrayValue(dataBlock, rootPositionAttr, m_rootPositions);
+	inputMatrixDataArrayValue(dataBlock, handlePositionAttr, m_handlePositions);
+	inputMatrixDataArrayValue(dataBlock, upVectorPositionAttr, m_upVectorPositions);
+	inputDoubleDataArrayValue(dataBlock, length0Attr, m_lengths0);
+	inputDoubleDataArrayValue(dataBlock, length1Attr, m_lengths1);
+	short aimAxis = inputEnumValue(dataBlock, aimAxisAttr);
+	short upAxis = inputEnumValue(dataBlock, upAxisAttr);
+	short direction = inputEnumValue(dataBlock, directionAttr);
+	bool hierarchicalOutput = inputBoolValue(dataBlock, hierarchicalOutputAttr);
+
+	SolverSettings settings;
+	settings.solver = inputEnumValue(dataBlock, solverAttr);
+	settings.maxCompressionRatio = inputDoubleValue(dataBlock, maxCompressionRatioAttr);
+	settings.maxRigidExtensionRatio = inputDoubleValue(dataBlock, maxRigidExtensionRatioAttr);
+	settings.maxNonRigidExtensionRatio = inputDoubleValue(dataBlock, maxNonRigidExtensionRatioAttr);
+	settings.maxHeightReductionRatio = inputDoubleValue(dataBlock, maxHeightReductionRatioAttr);
+	settings.heightReductionDeceleration = inputDoubleValue(dataBlock, heightReductionDecelerationAttr);
+	// Ensure compression is less than extension
+	settings.maxCompressionRatio = 1.0 - settings.maxCompressionRatio < settings.maxRigidExtensionRatio ? 
+		settings.maxCompressionRatio : 1.0 - settings.maxRigidExtensionRatio;
+
+	if (aimAxis != m_aimAxis || upAxis != m_upAxis)
+	{
+		m_aimAxis = aimAxis;
+		m_upAxis = upAxis;
+		m_computeFrames = VChainSolver::selectComputeFrames(aimAxis, upAxis);
+	}
+
+	unsigned int chainCount = (unsigned int)std::min(m_rootPositions.size(), std::min(m_handlePositions.size(), m_upVectorPositions.size()));
+	unsigned int length0Count = std::min(chainCount, (unsigned int)m_lengths0.size());
+	unsigned int length1Count = std::min(chainCount, (unsigned int)m_lengths1.size());
+
+	// ------ Solve ------
+	// Results are written to the node buffers by the workers and given to the outputs on this thread
+	m_outputFrames.resize(chainCount * kFrameCount);
+	m_outputOffsets.resize(chainCount);
+	VChainSolver::ComputeFramesFunction computeFrames = m_computeFrames;
+
+	MRS::parallelFor(0, chainCount, MRS::kDefaultGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		TriangleBlock block;
+		MVector aimVectors[kBlockSize];
+		MVector normalVectors[kBlockSize];
+		MVector binormalVectors[kBlockSize];
+		MVector rootVectors[kBlockSize];
+		VChainSolver::Triangle solution;
+
+		for (unsigned int blockBegin = begin; blockBegin < end; blockBegin += kBlockSize)
+		{
+			block.count = std::min(kBlockSize, end - blockBegin);
+
+			// --- Basis ---
+			// Using double cross product technique to build an orthonormal transform
+			for (unsigned int lane = 0; lane < block.count; ++lane)
+			{
+				unsigned int i = blockBegin + lane;
+				MVector rootPosition = MRS::extractTranslation(m_rootPositions[i]);
+				MVector handlePosition = MRS::extractTranslation(m_handlePositions[i]);
+				MVector upVectorPosition = MRS::extractTranslation(m_upVectorPositions[i]);
+
+				MVector aimVector = handlePosition - rootPosition;
+				block.handleOffset[lane] = aimVector.length();
+				aimVector.normalize();
+
+				MVector binormalVector = aimVector ^ (upVectorPosition - rootPosition);
+				binormalVector.normalize();
+
+				aimVectors[lane] = aimVector;
+				normalVectors[lane] = binormalVector ^ aimVector;
+				binormalVectors[lane] = binormalVector;
+				rootVectors[lane] = rootPosition;
+
+				block.rigidA[lane] = i < length0Count ? std::max(m_lengths0[i], kMinLength) : kDefaultLength;
+				block.rigidB[lane] = i < length1Count ? std::max(m_lengths1[i], kMinLength) : kDefaultLength;
+			}
+
+			// --- Triangle ---
+			solveTriangleBlock(block, settings, direction);
+
+			// --- Frames ---
+			for (unsigned int lane = 0; lane < block.count; ++lane)
+			{
+				unsigned int i = blockBegin + lane;
+				solution.a = block.a[lane];
+				solution.b = block.b[lane];
+				solution.c = block.c[lane];
+				solution.A = block.A[lane];
+				solution.B = block.B[lane];
+				solution.C = block.C[lane];
+
+				computeFrames(aimVectors[lane], normalVectors[lane], binormalVectors[lane], rootVectors[lane], parentInverseFrame, solution, direction,
+					hierarchicalOutput, &m_outputFrames[i * kFrameCount]);
+
+				m_outputOffsets[i] = block.c[lane];
+			}
+		}
+	});
+
+	outputMatrixDataArrayValue(dataBlock, outputFramesAttr, m_outputFrames);
+	outputDoubleDataArrayValue(dataBlock, outputRootToEffectorOffsetAttr, m_outputOffsets);
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
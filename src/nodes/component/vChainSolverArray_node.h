@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MObject.h>
+#include <maya/MPlug.h>
+#include <maya/MPxNode.h>
+#include <maya/MStatus.h>
+#include <maya/MString.h>
+#include <maya/MTypeId.h>
+#include <maya/MVector.h>
+
+#include "vChainSolver_node.h"
+
+#include "utils/math_utils.h"
+#include "utils/matrix_utils.h"
+#include "utils/node_utils.h"
+#include "utils/thread_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+class VChainSolverArray : public MPxNode, MRS::NodeHelper
+{
+public:
+	VChainSolverArray();
+	~VChainSolverArray();
+
+	// ------ Const ------
+	static const MTypeId kTypeId;
+	static const MString kTypeName;
+
+	// The number of output frames per chain, the basis frame followed by the six local frames (see VChainSolver)
+	static const unsigned int kFrameCount = 7;
+
+	// ------ MPxNode ------
+	SchedulingType schedulingType() const override;
+	static MStatus initialize();
+	MStatus compute(const MPlug &plug, MDataBlock &dataBlock) override;
+
+	// ------ Attr ------
+	// Basis
+	static MObject parentInverseFrameAttr;
+	static MObject rootPositionAttr;
+	static MObject handlePositionAttr;
+	static MObject upVectorPositionAttr;
+	static MObject aimAxisAttr;
+	static MObject upAxisAttr;
+	// Solver
+	static MObject length0Attr;
+	static MObject length1Attr;
+	static MObject directionAttr;
+	static MObject solverAttr;
+	static MObject maxCompressionRatioAttr;
+	static MObject maxRigidExtensionRatioAttr;
+	static MObject maxNonRigidExtensionRatioAttr;
+	static MObject maxHeightReductionRatioAttr;
+	static MObject heightReductionDecelerationAttr;
+	static MObject hierarchicalOutputAttr;
+	// Output
+	static MObject outputFramesAttr;
+	static MObject outputRootToEffectorOffsetAttr;
+
+private:
+	// ------ Data ------
+	short m_aimAxis;
+	short m_upAxis;
+	VChainSolver::ComputeFramesFunction m_computeFrames;
+	std::vector<MMatrix> m_rootPositions;
+	std::vector<MMatrix> m_handlePositions;
+	std::vector<MMatrix> m_upVectorPositions;
+	std::vector<double> m_lengths0;
+	std::vector<double> m_lengths1;
+	std::vector<MMatrix> m_outputFrames;
+	std::vector<double> m_outputOffsets;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -187,7 +187,10 @@ VChainSolver::Triangle::~Triangle() {}
 
 VChainSolver::VChainSolver() :
 	m_evalSinceDirty{ false },
-	m_outputFrames(7)
+	m_outputFrames(7),
+	m_aimAxis{ -1 },
+	m_upAxis{ -1 },
+	m_computeFrames{ nullptr }
 {}
 
 VChainSolver::~VChainSolver() {}
@@ -379,6 +382,14 @@ void VChainSolver::computeData(MDataBlock& dataBlock)
 	short aimAxis = inputEnumValue(dataBlock, aimAxisAttr);
 	short upAxis = inputEnumValue(dataBlock, upAxisAttr);
 
+	// Frames are computed by a specialization of the resolved axis pair, the selection only needs to change with the axes
+	if (aimAxis != m_aimAxis || upAxis != m_upAxis)
+	{
+		m_aimAxis = aimAxis;
+		m_upAxis = upAxis;
+		m_computeFrames = selectComputeFrames(aimAxis, upAxis);
+	}
+
 	// Using double cross product technique to build an orthonormal transform
 	MVector aimVector = handlePosition - rootPosition;
 	double handleOffset = aimVector.length();
@@ -389,234 +400,6 @@ void VChainSolver::computeData(MDataBlock& dataBlock)
 
 	MVector normalVector = binormalVector ^ aimVector;
 
-	MRS::Matrix33<double> basisOrientFrame{ aimVector, normalVector , binormalVector };
-
-	// Resolve upAxis conflicts
-	switch (aimAxis)
-	{
-		// upAxis defaults to (+y) if it conflicts with aimAxis (+x, -x)
-		case kPosX: case kNegX:
-		{
-			if (upAxis == kPosX || upAxis == kNegX)
-				upAxis = kPosY;
-
-			break;
-		}
-		// upAxis defaults to (+x) if it conflicts with aimAxis (+y, -y)
-		case kPosY: case kNegY:
-		{
-			if (upAxis == kPosY || upAxis == kNegY)
-				upAxis = kPosX;
-
-			break;
-		}
-		// upAxis defaults to (+y) if it conflicts with aimAxis (+z, -z)
-		case kPosZ: case kNegZ:
-		{
-			if (upAxis == kPosZ || upAxis == kNegZ)
-				upAxis = kPosY;
-
-			break;
-		}
-	}
-
-	// Determine the roll axis
-	short aimX = aimAxis == kPosX ? 1 : aimAxis == kNegX ? -1 : 0;
-	short upX = upAxis == kPosX ? 1 : upAxis == kNegX ? -1 : 0;
-	short aimY = aimAxis == kPosY ? 1 : aimAxis == kNegY ? -1 : 0;
-	short upY = upAxis == kPosY ? 1 : upAxis == kNegY ? -1 : 0;
-	short aimZ = aimAxis == kPosZ ? 1 : aimAxis == kNegZ ? -1 : 0;
-	short upZ = upAxis == kPosZ ? 1 : upAxis == kNegZ ? -1 : 0;
-
-	// Cross product
-	short rollX = aimY * upZ - aimZ * upY;
-	short rollY = aimZ * upX - aimX * upZ;
-	short rollZ = aimX * upY - aimY * upX;
-
-	Axis rollAxis = rollX == 1 ? kPosX : rollX == -1 ? kNegX : rollY == 1 ? kPosY : rollY == -1 ? kNegY : rollZ == 1 ? kPosZ : kNegZ;
-
-	// Re-orient the basis
-	switch (aimAxis)
-	{
-		case kPosX:
-		{
-			switch (upAxis)
-			{
-				case kPosZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(-M_PI_2);
-					break;
-				}
-				case kNegY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI);
-					break;
-				}
-				case kNegZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI_2);
-					break;
-				}
-			}
-			break;
-		}
-		case kPosY:
-		{
-			switch (upAxis)
-			{
-				case kPosX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-				case kPosZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(-M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-				case kNegX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-				case kNegZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-			}
-			break;
-		}
-		case kPosZ:
-		{
-			switch (upAxis)
-			{
-				case kPosX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI_2);
-					break;
-				}
-				case kPosY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI_2);
-					break;
-				}
-				case kNegX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-				case kNegY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI);
-					break;
-				}
-			}
-			break;
-		}
-		case kNegX:
-		{
-			switch (upAxis)
-			{
-				case kPosY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI);
-					break;
-				}
-				case kPosZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(-M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI);
-					break;
-				}
-				case kNegY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI);
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI);
-					break;
-				}
-				case kNegZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI);
-					break;
-				}
-			}
-			break;
-		}
-		case kNegY:
-		{
-			switch (upAxis)
-			{
-				case kPosX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI_2);
-					break;
-				}
-				case kPosZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(-M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI_2);
-					break;
-				}
-				case kNegX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(M_PI);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-				case kNegZ:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInX(M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI_2);
-					break;
-				}
-			}
-			break;
-		}
-		case kNegZ:
-		{
-			switch (upAxis)
-			{
-				case kPosX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(-M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI_2);
-					break;
-				}
-				case kPosY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(-M_PI_2);
-					break;
-				}
-				case kNegX:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(-M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(-M_PI_2);
-					break;
-				}
-				case kNegY:
-				{
-					basisOrientFrame = basisOrientFrame.preRotateInY(-M_PI_2);
-					basisOrientFrame = basisOrientFrame.preRotateInZ(M_PI);
-					break;
-				}
-			}
-			break;
-		}
-	}
-
-	MMatrix basisFrame;
-	basisOrientFrame.get(basisFrame.matrix);
-	basisFrame[3][0] = rootPosition[0]; basisFrame[3][1] = rootPosition[1]; basisFrame[3][2] = rootPosition[2];
-	basisFrame *= parentInverseFrame;
-
 	// ------ Triangle ------
 	double rigidA = inputDoubleValue(dataBlock, length0Attr);
 	double rigidB = inputDoubleValue(dataBlock, length1Attr);
@@ -755,815 +538,208 @@ void VChainSolver::computeData(MDataBlock& dataBlock)
 	// ------ Frames ------
 	bool hierarchicalOutput = inputBoolValue(dataBlock, hierarchicalOutputAttr);
 
-	MRS::Matrix44<double> localFrame0;
-	MRS::Matrix44<double> localFrame1;
-	MRS::Matrix44<double> localFrame2;
-	MRS::Matrix44<double> localFrame3;
-	MRS::Matrix44<double> localFrame4;
-	MRS::Matrix44<double> localFrame5;
-
-	// Hierarchical ouputs have sequential locality. The initial output has locality relative to the basis parent frame (ie. determined via parentInverseFrame)
-	if (hierarchicalOutput)
-	{
-		switch (rollAxis)
-		{
-			case kPosX:
-			{
-				localFrame0 = localFrame0.preRotateInX(m_solution.B);
-
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						localFrame1[3][1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame1[3][1] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame1[3][2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame1[3][2] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame2 = localFrame2.preRotateInX((m_solution.C - M_PI * direction) * 0.5);
-
-				localFrame3 = localFrame3.preRotateInX((m_solution.C - M_PI * direction) * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						localFrame4[3][1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame4[3][1] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame4[3][2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame4[3][2] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame5 = localFrame5.preRotateInX(m_solution.A);
-
-				break;
-			}
-			case kPosY:
-			{
-				localFrame0 = localFrame0.preRotateInY(m_solution.B);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame1[3][0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame1[3][0] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame1[3][2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame1[3][2] = -m_solution.a;
-						break;
-					}
-				}
+	m_computeFrames(aimVector, normalVector, binormalVector, rootPosition, parentInverseFrame, m_solution, direction, hierarchicalOutput, m_outputFrames.data());
 
-				localFrame2 = localFrame2.preRotateInY((m_solution.C - M_PI * direction) * 0.5);
-
-				localFrame3 = localFrame3.preRotateInY((m_solution.C - M_PI * direction) * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame4[3][0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame4[3][0] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame4[3][2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame4[3][2] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame5 = localFrame5.preRotateInY(m_solution.A);
-
-				break;
-			}
-			case kPosZ:
-			{
-				localFrame0 = localFrame0.preRotateInZ(m_solution.B);
+	// ------ Internal State ------
+	m_evalSinceDirty = true;
+}
 
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame1[3][0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame1[3][0] = -m_solution.a;
-						break;
-					}
-					case kPosY:
-					{
-						localFrame1[3][1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame1[3][1] = -m_solution.a;
-						break;
-					}
-				}
+// ------ Helpers ------
 
-				localFrame2 = localFrame2.preRotateInZ((m_solution.C - M_PI * direction) * 0.5);
+/*	Solve the angles of a given Triangle whose sides are assumed to be non-zero	lengths */
+void VChainSolver::solveAngles(Triangle& triangle)
+{
+	assert(triangle.a > 0.0);
+	assert(triangle.b > 0.0);
+	assert(triangle.c > 0.0);
 
-				localFrame3 = localFrame3.preRotateInZ((m_solution.C - M_PI * direction) * 0.5);
+	double aSquared = triangle.a * triangle.a;
+	double bSquared = triangle.b * triangle.b;
+	double cSquared = triangle.c * triangle.c;
 
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame4[3][0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame4[3][0] = -m_solution.b;
-						break;
-					}
-					case kPosY:
-					{
-						localFrame4[3][1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame4[3][1] = -m_solution.b;
-						break;
-					}
-				}
+	triangle.C = std::acos((aSquared + bSquared - cSquared) / (2 * triangle.a * triangle.b));
 
-				localFrame5 = localFrame5.preRotateInZ(m_solution.A);
+	// Optimization for isosceles
+	if (MRS::isEqual(triangle.a, triangle.b))
+		triangle.A = triangle.B = (M_PI - triangle.C) / 2.0;
+	else
+	{
+		triangle.A = std::acos((bSquared + cSquared - aSquared) / (2 * triangle.b * triangle.c));
+		triangle.B = M_PI - triangle.A - triangle.C;
+	}
+}
 
-				break;
-			}
-			case kNegX:
-			{
-				localFrame0 = localFrame0.preRotateInX(-m_solution.B);
+// ------ Frames ------
 
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						localFrame1[3][1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame1[3][1] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame1[3][2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame1[3][2] = -m_solution.a;
-						break;
-					}
-				}
+namespace {
 
-				localFrame2 = localFrame2.preRotateInX(M_PI_2 * direction - m_solution.C * 0.5);
+// Axis values are resolved at compile time so that each specialization of VChainSolver::computeFrames is branch-free
+constexpr unsigned int axisIndex(short axis)
+{
+	return (unsigned int)(axis % 3);
+}
 
-				localFrame3 = localFrame3.preRotateInX(M_PI_2 * direction - m_solution.C * 0.5);
+constexpr double axisSign(short axis)
+{
+	return axis < 3 ? 1.0 : -1.0;
+}
 
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						localFrame4[3][1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame4[3][1] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame4[3][2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame4[3][2] = -m_solution.b;
-						break;
-					}
-				}
+// Returns the given component of the unit vector for an axis
+constexpr short axisComponent(short axis, unsigned int index)
+{
+	return axisIndex(axis) != index ? 0 : axis < 3 ? 1 : -1;
+}
 
-				localFrame5 = localFrame5.preRotateInX(-m_solution.A);
+// upAxis defaults to (+x) if it conflicts with aimAxis (+y, -y), otherwise it defaults to (+y)
+constexpr short resolveUpAxis(short aimAxis, short upAxis)
+{
+	return axisIndex(aimAxis) != axisIndex(upAxis) ? upAxis : axisIndex(aimAxis) == 1 ? VChainSolver::kPosX : VChainSolver::kPosY;
+}
 
-				break;
-			}
-			case kNegY:
-			{
-				localFrame0 = localFrame0.preRotateInY(-m_solution.B);
+// Returns the given component of the cross product between the aim and up axes
+constexpr short rollComponent(short aimAxis, short upAxis, unsigned int index)
+{
+	return axisComponent(aimAxis, (index + 1) % 3) * axisComponent(upAxis, (index + 2) % 3) -
+		axisComponent(aimAxis, (index + 2) % 3) * axisComponent(upAxis, (index + 1) % 3);
+}
 
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame1[3][0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame1[3][0] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame1[3][2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame1[3][2] = -m_solution.a;
-						break;
-					}
-				}
+constexpr short rollAxis(short aimAxis, short upAxis)
+{
+	return rollComponent(aimAxis, upAxis, 0) != 0 ? (rollComponent(aimAxis, upAxis, 0) > 0 ? VChainSolver::kPosX : VChainSolver::kNegX) :
+		rollComponent(aimAxis, upAxis, 1) != 0 ? (rollComponent(aimAxis, upAxis, 1) > 0 ? VChainSolver::kPosY : VChainSolver::kNegY) :
+		rollComponent(aimAxis, upAxis, 2) > 0 ? VChainSolver::kPosZ : VChainSolver::kNegZ;
+}
 
-				localFrame2 = localFrame2.preRotateInY(M_PI_2 * direction - m_solution.C * 0.5);
+template<unsigned int Index>
+MRS::Matrix44<double> preRotateInAxis(const MRS::Matrix44<double>& matrix, double rot);
 
-				localFrame3 = localFrame3.preRotateInY(M_PI_2 * direction - m_solution.C * 0.5);
+template<>
+MRS::Matrix44<double> preRotateInAxis<0>(const MRS::Matrix44<double>& matrix, double rot)
+{
+	return matrix.preRotateInX(rot);
+}
 
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame4[3][0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame4[3][0] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						localFrame4[3][2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						localFrame4[3][2] = -m_solution.b;
-						break;
-					}
-				}
+template<>
+MRS::Matrix44<double> preRotateInAxis<1>(const MRS::Matrix44<double>& matrix, double rot)
+{
+	return matrix.preRotateInY(rot);
+}
 
-				localFrame5 = localFrame5.preRotateInY(-m_solution.A);
+template<>
+MRS::Matrix44<double> preRotateInAxis<2>(const MRS::Matrix44<double>& matrix, double rot)
+{
+	return matrix.preRotateInZ(rot);
+}
 
-				break;
-			}
-			case kNegZ:
-			{
-				localFrame0 = localFrame0.preRotateInZ(-m_solution.B);
+} // anonymous
 
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame1[3][0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame1[3][0] = -m_solution.a;
-						break;
-					}
-					case kPosY:
-					{
-						localFrame1[3][1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame1[3][1] = -m_solution.a;
-						break;
-					}
-				}
+/*	Computes the basis and local frames for a resolved aim/up axis pair
+	The basis orientation is a signed permutation of the aim, normal and binormal vectors and the solved angles are applied around the roll axis
+	Triangle angles are expected to have been adjusted for direction    */
+template<short AimAxis, short UpAxis>
+void VChainSolver::computeFrames(const MVector& aimVector, const MVector& normalVector, const MVector& binormalVector, const MVector& rootPosition,
+	const MMatrix& parentInverseFrame, const Triangle& solution, short direction, bool hierarchicalOutput, MMatrix* outputFrames)
+{
+	constexpr short kRollAxis = rollAxis(AimAxis, UpAxis);
+	constexpr unsigned int kAimIndex = axisIndex(AimAxis);
+	constexpr unsigned int kRollIndex = axisIndex(kRollAxis);
+	constexpr double kAimSign = axisSign(AimAxis);
+	constexpr double kRollSign = axisSign(kRollAxis);
 
-				localFrame2 = localFrame2.preRotateInZ(M_PI_2 * direction - m_solution.C * 0.5);
+	// ------ Basis ------
+	MVector basisRows[3];
+	basisRows[kAimIndex] = aimVector * kAimSign;
+	basisRows[axisIndex(UpAxis)] = normalVector * axisSign(UpAxis);
+	basisRows[kRollIndex] = binormalVector * kRollSign;
 
-				localFrame3 = localFrame3.preRotateInZ(M_PI_2 * direction - m_solution.C * 0.5);
+	MMatrix basisFrame;
+	MRS::Matrix44<double>{ basisRows[0], basisRows[1], basisRows[2], rootPosition }.get(basisFrame.matrix);
+	basisFrame *= parentInverseFrame;
 
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						localFrame4[3][0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						localFrame4[3][0] = -m_solution.b;
-						break;
-					}
-					case kPosY:
-					{
-						localFrame4[3][1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						localFrame4[3][1] = -m_solution.b;
-						break;
-					}
-				}
+	// ------ Frames ------
+	double rollB = kRollSign * solution.B;
+	double rollC = kRollSign * (solution.C - M_PI * direction) * 0.5;
+	double rollA = kRollSign * solution.A;
 
-				localFrame5 = localFrame5.preRotateInZ(-m_solution.A);
+	MRS::Matrix44<double> localFrame0;
+	MRS::Matrix44<double> localFrame1;
+	MRS::Matrix44<double> localFrame2;
+	MRS::Matrix44<double> localFrame3;
+	MRS::Matrix44<double> localFrame4;
+	MRS::Matrix44<double> localFrame5;
 
-				break;
-			}
-		}
+	// Hierarchical ouputs have sequential locality. The initial output has locality relative to the basis parent frame (ie. determined via parentInverseFrame)
+	if (hierarchicalOutput)
+	{
+		localFrame0 = preRotateInAxis<kRollIndex>(localFrame0, rollB);
+		localFrame1[3][kAimIndex] = kAimSign * solution.a;
+		localFrame2 = preRotateInAxis<kRollIndex>(localFrame2, rollC);
+		localFrame3 = preRotateInAxis<kRollIndex>(localFrame3, rollC);
+		localFrame4[3][kAimIndex] = kAimSign * solution.b;
+		localFrame5 = preRotateInAxis<kRollIndex>(localFrame5, rollA);
 	}
 	// Non-hierarchical outputs all have locality relative to the basis parent frame (ie. determined via parentInverseFrame)
 	else
 	{
 		double aOffset[3]{ 0.0, 0.0, 0.0 };
 		double bOffset[3]{ 0.0, 0.0, 0.0 };
-
-		switch (rollAxis)
-		{
-			case kPosX:
-			{
-				localFrame0 = basisFrame.matrix;
-				localFrame0 = localFrame0.preRotateInX(m_solution.B);
-				
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						aOffset[1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						aOffset[1] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						aOffset[2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						aOffset[2] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame1 = localFrame0.preTranslate(aOffset);
-
-				localFrame2 = localFrame1.preRotateInX((m_solution.C - M_PI * direction) * 0.5);
-
-				localFrame3 = localFrame2.preRotateInX((m_solution.C - M_PI * direction) * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						bOffset[1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						bOffset[1] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						bOffset[2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						bOffset[2] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame4 = localFrame3.preTranslate(bOffset);
-
-				localFrame5 = localFrame4.preRotateInX(m_solution.A);
-
-				break;
-			}
-			case kPosY:
-			{
-				localFrame0 = basisFrame.matrix;
-				localFrame0 = localFrame0.preRotateInY(m_solution.B);
-				
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						aOffset[0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						aOffset[0] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						aOffset[2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						aOffset[2] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame1 = localFrame0.preTranslate(aOffset);
-
-				localFrame2 = localFrame1.preRotateInY((m_solution.C - M_PI * direction) * 0.5);
-
-				localFrame3 = localFrame2.preRotateInY((m_solution.C - M_PI * direction) * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						bOffset[0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						bOffset[0] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						bOffset[2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						bOffset[2] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame4 = localFrame3.preTranslate(bOffset);
-
-				localFrame5 = localFrame4.preRotateInY(m_solution.A);
-
-				break;
-			}
-			case kPosZ:
-			{
-				localFrame0 = basisFrame.matrix;
-				localFrame0 = localFrame0.preRotateInZ(m_solution.B);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						aOffset[0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						aOffset[0] = -m_solution.a;
-						break;
-					}
-					case kPosY:
-					{
-						aOffset[1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						aOffset[1] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame1 = localFrame0.preTranslate(aOffset);
-
-				localFrame2 = localFrame1.preRotateInZ((m_solution.C - M_PI * direction) * 0.5);
-
-				localFrame3 = localFrame2.preRotateInZ((m_solution.C - M_PI * direction) * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						bOffset[0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						bOffset[0] = -m_solution.b;
-						break;
-					}
-					case kPosY:
-					{
-						bOffset[1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						bOffset[1] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame4 = localFrame3.preTranslate(bOffset);
-
-				localFrame5 = localFrame4.preRotateInZ(m_solution.A);
-
-				break;
-			}
-			case kNegX:
-			{
-				localFrame0 = basisFrame.matrix;
-				localFrame0 = localFrame0.preRotateInX(-m_solution.B);
-				
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						aOffset[1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						aOffset[1] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						aOffset[2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						aOffset[2] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame1 = localFrame0.preTranslate(aOffset);
-
-				localFrame2 = localFrame1.preRotateInX(M_PI_2 * direction - m_solution.C * 0.5);
-
-				localFrame3 = localFrame2.preRotateInX(M_PI_2 * direction - m_solution.C * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosY:
-					{
-						bOffset[1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						bOffset[1] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						bOffset[2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						bOffset[2] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame4 = localFrame3.preTranslate(bOffset);
-
-				localFrame5 = localFrame4.preRotateInX(-m_solution.A);
-
-				break;
-			}
-			case kNegY:
-			{
-				localFrame0 = basisFrame.matrix;
-				localFrame0 = localFrame0.preRotateInY(-m_solution.B);
-				
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						aOffset[0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						aOffset[0] = -m_solution.a;
-						break;
-					}
-					case kPosZ:
-					{
-						aOffset[2] = m_solution.a;
-						break;
-					}
-					case kNegZ:
-					{
-						aOffset[2] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame1 = localFrame0.preTranslate(aOffset);
-
-				localFrame2 = localFrame1.preRotateInY(M_PI_2 * direction - m_solution.C * 0.5);
-
-				localFrame3 = localFrame2.preRotateInY(M_PI_2 * direction - m_solution.C * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						bOffset[0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						bOffset[0] = -m_solution.b;
-						break;
-					}
-					case kPosZ:
-					{
-						bOffset[2] = m_solution.b;
-						break;
-					}
-					case kNegZ:
-					{
-						bOffset[2] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame4 = localFrame3.preTranslate(bOffset);
-
-				localFrame5 = localFrame4.preRotateInY(-m_solution.A);
-
-				break;
-			}
-			case kNegZ:
-			{
-				localFrame0 = basisFrame.matrix;
-				localFrame0 = localFrame0.preRotateInZ(-m_solution.B);
-				
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						aOffset[0] = m_solution.a;
-						break;
-					}
-					case kNegX:
-					{
-						aOffset[0] = -m_solution.a;
-						break;
-					}
-					case kPosY:
-					{
-						aOffset[1] = m_solution.a;
-						break;
-					}
-					case kNegY:
-					{
-						aOffset[1] = -m_solution.a;
-						break;
-					}
-				}
-
-				localFrame1 = localFrame0.preTranslate(aOffset);
-
-				localFrame2 = localFrame1.preRotateInZ(M_PI_2 * direction - m_solution.C * 0.5);
-
-				localFrame3 = localFrame2.preRotateInZ(M_PI_2 * direction - m_solution.C * 0.5);
-
-				switch (aimAxis)
-				{
-					case kPosX:
-					{
-						bOffset[0] = m_solution.b;
-						break;
-					}
-					case kNegX:
-					{
-						bOffset[0] = -m_solution.b;
-						break;
-					}
-					case kPosY:
-					{
-						bOffset[1] = m_solution.b;
-						break;
-					}
-					case kNegY:
-					{
-						bOffset[1] = -m_solution.b;
-						break;
-					}
-				}
-
-				localFrame4 = localFrame3.preTranslate(bOffset);
-
-				localFrame5 = localFrame4.preRotateInZ(-m_solution.A);
-
-				break;
-			}
-		}
+		aOffset[kAimIndex] = kAimSign * solution.a;
+		bOffset[kAimIndex] = kAimSign * solution.b;
+
+		localFrame0 = preRotateInAxis<kRollIndex>(MRS::Matrix44<double>{ basisFrame.matrix }, rollB);
+		localFrame1 = localFrame0.preTranslate(aOffset);
+		localFrame2 = preRotateInAxis<kRollIndex>(localFrame1, rollC);
+		localFrame3 = preRotateInAxis<kRollIndex>(localFrame2, rollC);
+		localFrame4 = localFrame3.preTranslate(bOffset);
+		localFrame5 = preRotateInAxis<kRollIndex>(localFrame4, rollA);
 	}
 
-	m_outputFrames[0] = basisFrame;
-	localFrame0.get(m_outputFrames[1].matrix);
-	localFrame1.get(m_outputFrames[2].matrix);
-	localFrame2.get(m_outputFrames[3].matrix);
-	localFrame3.get(m_outputFrames[4].matrix);
-	localFrame4.get(m_outputFrames[5].matrix);
-	localFrame5.get(m_outputFrames[6].matrix);
-
-	// ------ Internal State ------
-	m_evalSinceDirty = true;
+	outputFrames[0] = basisFrame;
+	localFrame0.get(outputFrames[1].matrix);
+	localFrame1.get(outputFrames[2].matrix);
+	localFrame2.get(outputFrames[3].matrix);
+	localFrame3.get(outputFrames[4].matrix);
+	localFrame4.get(outputFrames[5].matrix);
+	localFrame5.get(outputFrames[6].matrix);
 }
 
-// ------ Helpers ------
-
-/*	Solve the angles of a given Triangle whose sides are assumed to be non-zero	lengths */
-void VChainSolver::solveAngles(Triangle& triangle)
+/*	Conflicting up axes are resolved here so that only the 24 valid axis pairs are instantiated    */
+template<short AimAxis>
+VChainSolver::ComputeFramesFunction VChainSolver::selectComputeFrames(short upAxis)
 {
-	assert(triangle.a > 0.0);
-	assert(triangle.b > 0.0);
-	assert(triangle.c > 0.0);
-
-	double aSquared = triangle.a * triangle.a;
-	double bSquared = triangle.b * triangle.b;
-	double cSquared = triangle.c * triangle.c;
-
-	triangle.C = std::acos((aSquared + bSquared - cSquared) / (2 * triangle.a * triangle.b));
+	switch (upAxis)
+	{
+		case kPosX:
+			return &computeFrames<AimAxis, resolveUpAxis(AimAxis, kPosX)>;
+		case kNegX:
+			return &computeFrames<AimAxis, resolveUpAxis(AimAxis, kNegX)>;
+		case kNegY:
+			return &computeFrames<AimAxis, resolveUpAxis(AimAxis, kNegY)>;
+		case kPosZ:
+			return &computeFrames<AimAxis, resolveUpAxis(AimAxis, kPosZ)>;
+		case kNegZ:
+			return &computeFrames<AimAxis, resolveUpAxis(AimAxis, kNegZ)>;
+		default:
+			return &computeFrames<AimAxis, resolveUpAxis(AimAxis, kPosY)>;
+	}
+}
 
-	// Optimization for isosceles
-	if (MRS::isEqual(triangle.a, triangle.b))
-		triangle.A = triangle.B = (M_PI - triangle.C) / 2.0;
-	else
+VChainSolver::ComputeFramesFunction VChainSolver::selectComputeFrames(short aimAxis, short upAxis)
+{
+	switch (aimAxis)
 	{
-		triangle.A = std::acos((bSquared + cSquared - aSquared) / (2 * triangle.b * triangle.c));
-		triangle.B = M_PI - triangle.A - triangle.C;
+		case kPosY:
+			return selectComputeFrames<kPosY>(upAxis);
+		case kPosZ:
+			return selectComputeFrames<kPosZ>(upAxis);
+		case kNegX:
+			return selectComputeFrames<kNegX>(upAxis);
+		case kNegY:
+			return selectComputeFrames<kNegY>(upAxis);
+		case kNegZ:
+			return selectComputeFrames<kNegZ>(upAxis);
+		default:
+			return selectComputeFrames<kPosX>(upAxis);
 	}
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
@@ -13,6 +14,7 @@
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 #include <maya/MTypeId.h>
+#include <maya/MVector.h>
 
 #include "utils/math_utils.h"
 #include "utils/matrix_utils.h"
@@ -33,6 +35,7 @@ public:
 	{
 	private:
 		friend class VChainSolver;
+		friend class VChainSolverArray;
 		Triangle();
 		~Triangle();
 
@@ -88,6 +91,14 @@ public:
 	void computeData(MDataBlock& dataBlock);
 	void solveAngles(Triangle& triangle);
 
+	// ------ Frames ------
+	// Writes the basis frame followed by the six local frames of the solution to outputFrames[0, 7)
+	typedef void(*ComputeFramesFunction)(const MVector& aimVector, const MVector& normalVector, const MVector& binormalVector, const MVector& rootPosition,
+		const MMatrix& parentInverseFrame, const Triangle& solution, short direction, bool hierarchicalOutput, MMatrix* outputFrames);
+
+	// Each valid aim/up axis pair is compiled as a separate specialization, callers should only reselect the function when the axes change
+	static ComputeFramesFunction selectComputeFrames(short aimAxis, short upAxis);
+
 	// ------ Attr ------
 	// Basis
 	static MObject parentInverseFrameAttr;
@@ -112,12 +123,23 @@ public:
 	static MObject outputRootToEffectorOffsetAttr;
 
 private:
+	// ------ Frames ------
+	template<short AimAxis, short UpAxis>
+	static void computeFrames(const MVector& aimVector, const MVector& normalVector, const MVector& binormalVector, const MVector& rootPosition,
+		const MMatrix& parentInverseFrame, const Triangle& solution, short direction, bool hierarchicalOutput, MMatrix* outputFrames);
+
+	template<short AimAxis>
+	static ComputeFramesFunction selectComputeFrames(short upAxis);
+
 	// ------ Dirty Tracker ------
 	bool m_evalSinceDirty;
 
 	// ------ Data ------
 	Triangle m_solution;
 	std::vector<MMatrix> m_outputFrames;
+	short m_aimAxis;
+	short m_upAxis;
+	ComputeFramesFunction m_computeFrames;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
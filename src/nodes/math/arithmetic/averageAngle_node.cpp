@@ -35,12 +35,14 @@ MStatus AverageAngle::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MAngle> inputs = inputPluginDataArrayValue<AngleArrayData, MAngle>(dataBlock, inputAttr);
+	MRS::DataArrayView<AngleArrayData> inputs = inputPluginDataArrayView<AngleArrayData>(dataBlock, inputAttr);
 
-	size_t count = inputs.size();
+	// Values are stored in radians
+	const double* values = inputs.values();
+	unsigned int count = inputs.length();
 	double sum = 0.0;
-	for (const MAngle& angle : inputs)
-		sum += angle.asRadians();
+	for (unsigned int i = 0; i < count; ++i)
+		sum += values[i];
 
 	outputAngleValue(dataBlock, outputAttr, count == 0 ? 0.0 : sum / count);
 
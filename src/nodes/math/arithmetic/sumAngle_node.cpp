@@ -35,11 +35,13 @@ MStatus SumAngle::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MAngle> inputs = inputPluginDataArrayValue<AngleArrayData, MAngle>(dataBlock, inputAttr);
+	MRS::DataArrayView<AngleArrayData> inputs = inputPluginDataArrayView<AngleArrayData>(dataBlock, inputAttr);
 
+	// Values are stored in radians
+	const double* values = inputs.values();
 	double sum = 0.0;
-	for (const MAngle& input : inputs)
-		sum += input.asRadians();
+	for (unsigned int i = 0; i < inputs.length(); ++i)
+		sum += values[i];
 
 	outputAngleValue(dataBlock, outputAttr, sum);
 
@@ -35,11 +35,14 @@ MStatus MaxElementAngle::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MAngle> inputs = inputPluginDataArrayValue<AngleArrayData, MAngle>(dataBlock, inputAttr);
+	MRS::DataArrayView<AngleArrayData> inputs = inputPluginDataArrayView<AngleArrayData>(dataBlock, inputAttr);
 
-	auto max = std::max_element(inputs.cbegin(), inputs.cend(), [](const MAngle& lhs, const MAngle& rhs) -> bool { return lhs.asRadians() < rhs.asRadians(); });
+	// Values are stored in radians
+	const double* begin = inputs.values();
+	const double* end = begin + inputs.length();
+	const double* max = std::max_element(begin, end);
 	
-	outputAngleValue(dataBlock, outputAttr, max != inputs.cend() ? *max : 0.0);
+	outputAngleValue(dataBlock, outputAttr, max != end ? *max : 0.0);
 
 	return MStatus::kSuccess;
 }
@@ -43,11 +43,11 @@ MStatus SelectAngleArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MAngle> ifFalse = inputPluginDataArrayValue<AngleArrayData, MAngle>(dataBlock, ifFalseAttr);
-	std::vector<MAngle> ifTrue = inputPluginDataArrayValue<AngleArrayData, MAngle>(dataBlock, ifTrueAttr);
 	bool condition = inputBoolValue(dataBlock, conditionAttr);
+	// The selected buffer is shared with the output rather than copied
+	MRS::DataArrayView<AngleArrayData> selected = inputPluginDataArrayView<AngleArrayData>(dataBlock, condition ? ifTrueAttr : ifFalseAttr);
 
-	outputPluginDataArrayValue<AngleArrayData, MAngle>(dataBlock, outputAttr, condition ? ifTrue : ifFalse);
+	outputPluginDataArrayValue<AngleArrayData>(dataBlock, outputAttr, selected);
 
 	return MStatus::kSuccess;
 }
@@ -43,11 +43,11 @@ MStatus SelectEulerArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MEulerRotation> ifFalse = inputPluginDataArrayValue<EulerArrayData, MEulerRotation>(dataBlock, ifFalseAttr);
-	std::vector<MEulerRotation> ifTrue = inputPluginDataArrayValue<EulerArrayData, MEulerRotation>(dataBlock, ifTrueAttr);
 	bool condition = inputBoolValue(dataBlock, conditionAttr);
+	// The selected buffer is shared with the output rather than copied
+	MRS::DataArrayView<EulerArrayData> selected = inputPluginDataArrayView<EulerArrayData>(dataBlock, condition ? ifTrueAttr : ifFalseAttr);
 
-	outputPluginDataArrayValue<EulerArrayData, MEulerRotation>(dataBlock, outputAttr, condition ? ifTrue : ifFalse);
+	outputPluginDataArrayValue<EulerArrayData>(dataBlock, outputAttr, selected);
 
 	return MStatus::kSuccess;
 }
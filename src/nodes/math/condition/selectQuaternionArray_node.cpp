@@ -43,11 +43,11 @@ MStatus SelectQuaternionArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MQuaternion> ifFalse = inputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, ifFalseAttr);
-	std::vector<MQuaternion> ifTrue = inputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, ifTrueAttr);
 	bool condition = inputBoolValue(dataBlock, conditionAttr);
+	// The selected buffer is shared with the output rather than copied
+	MRS::DataArrayView<QuaternionArrayData> selected = inputPluginDataArrayView<QuaternionArrayData>(dataBlock, condition ? ifTrueAttr : ifFalseAttr);
 
-	outputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, outputAttr, condition ? ifTrue : ifFalse);
+	outputPluginDataArrayValue<QuaternionArrayData>(dataBlock, outputAttr, selected);
 
 	return MStatus::kSuccess;
 }
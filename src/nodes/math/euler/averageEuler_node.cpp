@@ -9,6 +9,7 @@ AverageEuler::~AverageEuler() {}
 MObject AverageEuler::inputRotationOrderAttr;
 MObject AverageEuler::inputAttr;
 MObject AverageEuler::outputRotationOrderAttr;
+MObject AverageEuler::nlerpToleranceAttr;
 MObject AverageEuler::outputAttr;
 MObject AverageEuler::outputXAttr;
 MObject AverageEuler::outputYAttr;
@@ -30,16 +31,20 @@ MStatus AverageEuler::initialize()
 	createIntDataArrayAttribute(inputRotationOrderAttr, "inputRotationOrder", "inputRotationOrder", inputRotationOrder, kDefaultPreset | kKeyable);
 	createPluginDataArrayAttribute<EulerArrayData, MEulerRotation>(inputAttr, "input", "input", inputs, kDefaultPreset | kKeyable);
 	createEnumAttribute(outputRotationOrderAttr, "outputRotationOrder", "outputRotationOrder", outputRotationOrderFields, 0, kDefaultPreset | kKeyable);
+	createAngleAttribute(nlerpToleranceAttr, "nlerpTolerance", "nlerpTolerance", MAngle(0.0), kDefaultPreset | kKeyable);
+	setMin(nlerpToleranceAttr, MAngle(0.0));
 	createEulerAttribute(outputAttr, outputXAttr, outputYAttr, outputZAttr, "output", "output", output, kReadOnlyPreset);
 
 	addAttribute(inputRotationOrderAttr);
 	addAttribute(inputAttr);
 	addAttribute(outputRotationOrderAttr);
+	addAttribute(nlerpToleranceAttr);
 	addAttribute(outputAttr);
 
 	attributeAffects(inputRotationOrderAttr, outputAttr);
 	attributeAffects(inputAttr, outputAttr);
 	attributeAffects(outputRotationOrderAttr, outputAttr);
+	attributeAffects(nlerpToleranceAttr, outputAttr);
 
 	return MStatus::kSuccess;
 }
@@ -52,6 +57,7 @@ MStatus AverageEuler::compute(const MPlug& plug, MDataBlock& dataBlock)
 	std::vector<int> inputRotationOrder = inputIntDataArrayValue(dataBlock, inputRotationOrderAttr);
 	std::vector<MEulerRotation> inputs = inputPluginDataArrayValue<EulerArrayData, MEulerRotation>(dataBlock, inputAttr);
 	short outputRotationOrder = inputEnumValue(dataBlock, outputRotationOrderAttr);
+	double nlerpTolerance = inputAngleValue(dataBlock, nlerpToleranceAttr).asRadians();
 	size_t count = inputs.size();
 	inputRotationOrder.resize(count, 0);
 
@@ -66,7 +72,7 @@ MStatus AverageEuler::compute(const MPlug& plug, MDataBlock& dataBlock)
 			m_rotations[i] = euler.asQuaternion();
 		}
 
-		MQuaternion qAverage = MRS::averageQuaternion(m_rotations);
+		MQuaternion qAverage = MRS::averageQuaternion(m_rotations, nlerpTolerance);
 		average = qAverage.asEulerRotation();
 		average.reorderIt((MEulerRotation::RotationOrder)outputRotationOrder);
 	}
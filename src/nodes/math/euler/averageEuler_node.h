@@ -1,5 +1,6 @@
 #pragma once
 
+#include <maya/MAngle.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MEulerRotation.h>
@@ -35,6 +36,7 @@ public:
 	// ------ Attr ------
 	static MObject inputRotationOrderAttr;
 	static MObject inputAttr;
+	static MObject nlerpToleranceAttr;
 	static MObject outputAttr;
 	static MObject outputXAttr;
 	static MObject outputYAttr;
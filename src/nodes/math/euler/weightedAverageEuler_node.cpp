@@ -10,6 +10,7 @@ MObject WeightedAverageEuler::inputRotationOrderAttr;
 MObject WeightedAverageEuler::inputAttr;
 MObject WeightedAverageEuler::weightAttr;
 MObject WeightedAverageEuler::outputRotationOrderAttr;
+MObject WeightedAverageEuler::nlerpToleranceAttr;
 MObject WeightedAverageEuler::outputAttr;
 MObject WeightedAverageEuler::outputXAttr;
 MObject WeightedAverageEuler::outputYAttr;
@@ -33,18 +34,22 @@ MStatus WeightedAverageEuler::initialize()
 	createDoubleDataArrayAttribute(weightAttr, "weight", "weight", weights, kDefaultPreset | kKeyable);
 	createIntDataArrayAttribute(inputRotationOrderAttr, "inputRotationOrder", "inputRotationOrder", inputRotationOrder, kDefaultPreset | kKeyable);
 	createEnumAttribute(outputRotationOrderAttr, "outputRotationOrder", "outputRotationOrder", outputRotationOrderFields, 0, kDefaultPreset | kKeyable);
+	createAngleAttribute(nlerpToleranceAttr, "nlerpTolerance", "nlerpTolerance", MAngle(0.0), kDefaultPreset | kKeyable);
+	setMin(nlerpToleranceAttr, MAngle(0.0));
 	createEulerAttribute(outputAttr, outputXAttr, outputYAttr, outputZAttr, "output", "output", output, kReadOnlyPreset);
 
 	addAttribute(inputRotationOrderAttr);
 	addAttribute(inputAttr);
 	addAttribute(weightAttr);
 	addAttribute(outputRotationOrderAttr);
+	addAttribute(nlerpToleranceAttr);
 	addAttribute(outputAttr);
 
 	attributeAffects(inputRotationOrderAttr, outputAttr);
 	attributeAffects(inputAttr, outputAttr);
 	attributeAffects(weightAttr, outputAttr);
 	attributeAffects(outputRotationOrderAttr, outputAttr);
+	attributeAffects(nlerpToleranceAttr, outputAttr);
 
 	return MStatus::kSuccess;
 }
@@ -58,6 +63,7 @@ MStatus WeightedAverageEuler::compute(const MPlug& plug, MDataBlock& dataBlock)
 	std::vector<MEulerRotation> inputs = inputPluginDataArrayValue<EulerArrayData, MEulerRotation>(dataBlock, inputAttr);
 	std::vector<double> weights = inputDoubleDataArrayValue(dataBlock, weightAttr);
 	short outputRotationOrder = inputEnumValue(dataBlock, outputRotationOrderAttr);
+	double nlerpTolerance = inputAngleValue(dataBlock, nlerpToleranceAttr).asRadians();
 	size_t count = inputs.size();
 	inputRotationOrder.resize(count, 0);
 	weights.resize(count, 1.0);
@@ -73,7 +79,7 @@ MStatus WeightedAverageEuler::compute(const MPlug& plug, MDataBlock& dataBlock)
 			m_rotations[i] = euler.asQuaternion();
 		}
 
-		MQuaternion qAverage = MRS::averageWeightedQuaternion(m_rotations, weights);
+		MQuaternion qAverage = MRS::averageWeightedQuaternion(m_rotations, weights, nlerpTolerance);
 		average = qAverage.asEulerRotation();
 		average.reorderIt((MEulerRotation::RotationOrder)outputRotationOrder);
 	}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <maya/MAngle.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MEulerRotation.h>
@@ -38,6 +39,7 @@ public:
 	static MObject weightAttr;
 	static MObject inputRotationOrderAttr;
 	static MObject outputRotationOrderAttr;
+	static MObject nlerpToleranceAttr;
 	static MObject outputAttr;
 	static MObject outputXAttr;
 	static MObject outputYAttr;
@@ -0,0 +1,1126 @@
+#include "fusedExpression_node.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+#include <maya/MFn.h>
+#include <maya/MFnMatrixData.h>
+
+#include "absolute_node.h"
+#include "acos_node.h"
+#include "add_node.h"
+#include "addVector_node.h"
+#include "asin_node.h"
+#include "atan_node.h"
+#include "atan2_node.h"
+#include "ceil_node.h"
+#include "clamp_node.h"
+#include "convertQuaternionToMatrix_node.h"
+#include "cos_node.h"
+#include "crossProduct_node.h"
+#include "divide_node.h"
+#include "divideVector_node.h"
+#include "dotProduct_node.h"
+#include "extractBasisXFromMatrix_node.h"
+#include "extractBasisYFromMatrix_node.h"
+#include "extractBasisZFromMatrix_node.h"
+#include "extractQuaternionFromMatrix_node.h"
+#include "extractRotationMatrix_node.h"
+#include "extractScaleFromMatrix_node.h"
+#include "extractScaleMatrix_node.h"
+#include "extractTranslationFromMatrix_node.h"
+#include "extractTranslationMatrix_node.h"
+#include "floor_node.h"
+#include "lerp_node.h"
+#include "lerpVector_node.h"
+#include "max_node.h"
+#include "min_node.h"
+#include "multiply_node.h"
+#include "multiplyMatrix_node.h"
+#include "multiplyPointByMatrix_node.h"
+#include "multiplyQuaternion_node.h"
+#include "multiplyVector_node.h"
+#include "multiplyVectorByMatrix_node.h"
+#include "negate_node.h"
+#include "negateVector_node.h"
+#include "normalizeVector_node.h"
+#include "postMultiplyMatrixByAxisXAngle_node.h"
+#include "postMultiplyMatrixByAxisYAngle_node.h"
+#include "postMultiplyMatrixByAxisZAngle_node.h"
+#include "postMultiplyMatrixByQuaternion_node.h"
+#include "postMultiplyMatrixByScale_node.h"
+#include "postMultiplyMatrixByTranslation_node.h"
+#include "power_node.h"
+#include "preMultiplyMatrixByAxisXAngle_node.h"
+#include "preMultiplyMatrixByAxisYAngle_node.h"
+#include "preMultiplyMatrixByAxisZAngle_node.h"
+#include "preMultiplyMatrixByQuaternion_node.h"
+#include "preMultiplyMatrixByScale_node.h"
+#include "preMultiplyMatrixByTranslation_node.h"
+#include "reciprocal_node.h"
+#include "remap_node.h"
+#include "rotateVectorByQuaternion_node.h"
+#include "round_node.h"
+#include "sin_node.h"
+#include "smoothstep_node.h"
+#include "smoothstepVector_node.h"
+#include "squareRoot_node.h"
+#include "subtract_node.h"
+#include "subtractVector_node.h"
+#include "tan_node.h"
+#include "vectorLength_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+FusedExpression::FusedExpression() : m_isCompiled{ false } {}
+FusedExpression::~FusedExpression() {}
+
+// ------ Attr ------
+MObject FusedExpression::expressionAttr;
+MObject FusedExpression::scalarInputAttr;
+MObject FusedExpression::scalarNameAttr;
+MObject FusedExpression::scalarValueAttr;
+MObject FusedExpression::angleInputAttr;
+MObject FusedExpression::angleNameAttr;
+MObject FusedExpression::angleValueAttr;
+MObject FusedExpression::vectorInputAttr;
+MObject FusedExpression::vectorNameAttr;
+MObject FusedExpression::vectorValueAttr;
+MObject FusedExpression::vectorValueXAttr;
+MObject FusedExpression::vectorValueYAttr;
+MObject FusedExpression::vectorValueZAttr;
+MObject FusedExpression::matrixInputAttr;
+MObject FusedExpression::matrixNameAttr;
+MObject FusedExpression::matrixValueAttr;
+MObject FusedExpression::quaternionInputAttr;
+MObject FusedExpression::quaternionNameAttr;
+MObject FusedExpression::quaternionValueAttr;
+MObject FusedExpression::quaternionValueXAttr;
+MObject FusedExpression::quaternionValueYAttr;
+MObject FusedExpression::quaternionValueZAttr;
+MObject FusedExpression::quaternionValueWAttr;
+MObject FusedExpression::outputAttr;
+MObject FusedExpression::outputAngleAttr;
+MObject FusedExpression::outputVectorAttr;
+MObject FusedExpression::outputVectorXAttr;
+MObject FusedExpression::outputVectorYAttr;
+MObject FusedExpression::outputVectorZAttr;
+MObject FusedExpression::outputMatrixAttr;
+MObject FusedExpression::outputQuaternionAttr;
+MObject FusedExpression::outputQuaternionXAttr;
+MObject FusedExpression::outputQuaternionYAttr;
+MObject FusedExpression::outputQuaternionZAttr;
+MObject FusedExpression::outputQuaternionWAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType FusedExpression::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus FusedExpression::initialize()
+{
+	MString expression;
+	MString inputName;
+
+	createStringAttribute(expressionAttr, "expression", "expression", expression, kDefaultPreset);
+
+	createStringAttribute(scalarNameAttr, "scalarName", "scalarName", inputName, kDefaultPreset);
+	createDoubleAttribute(scalarValueAttr, "scalarValue", "scalarValue", 0.0, kDefaultPreset | kKeyable);
+	std::vector<MObject> scalarInputChildren{ scalarNameAttr, scalarValueAttr };
+	createCompoundAttribute(scalarInputAttr, scalarInputChildren, "scalarInput", "scalarInput", kArrayPreset);
+
+	createStringAttribute(angleNameAttr, "angleName", "angleName", inputName, kDefaultPreset);
+	createAngleAttribute(angleValueAttr, "angleValue", "angleValue", 0.0, kDefaultPreset | kKeyable);
+	std::vector<MObject> angleInputChildren{ angleNameAttr, angleValueAttr };
+	createCompoundAttribute(angleInputAttr, angleInputChildren, "angleInput", "angleInput", kArrayPreset);
+
+	createStringAttribute(vectorNameAttr, "vectorName", "vectorName", inputName, kDefaultPreset);
+	createVectorAttribute(vectorValueAttr, vectorValueXAttr, vectorValueYAttr, vectorValueZAttr, "vectorValue", "vectorValue", MVector::zero, kDefaultPreset | kKeyable);
+	std::vector<MObject> vectorInputChildren{ vectorNameAttr, vectorValueAttr };
+	createCompoundAttribute(vectorInputAttr, vectorInputChildren, "vectorInput", "vectorInput", kArrayPreset);
+
+	createStringAttribute(matrixNameAttr, "matrixName", "matrixName", inputName, kDefaultPreset);
+	createMatrixAttribute(matrixValueAttr, "matrixValue", "matrixValue", MMatrix::identity, kDefaultPreset);
+	std::vector<MObject> matrixInputChildren{ matrixNameAttr, matrixValueAttr };
+	createCompoundAttribute(matrixInputAttr, matrixInputChildren, "matrixInput", "matrixInput", kArrayPreset);
+
+	createStringAttribute(quaternionNameAttr, "quaternionName", "quaternionName", inputName, kDefaultPreset);
+	createQuaternionAttribute(quaternionValueAttr, quaternionValueXAttr, quaternionValueYAttr, quaternionValueZAttr, quaternionValueWAttr, "quaternionValue", "quaternionValue",
+		MQuaternion::identity, kDefaultPreset | kKeyable);
+	std::vector<MObject> quaternionInputChildren{ quaternionNameAttr, quaternionValueAttr };
+	createCompoundAttribute(quaternionInputAttr, quaternionInputChildren, "quaternionInput", "quaternionInput", kArrayPreset);
+
+	createDoubleAttribute(outputAttr, "output", "output", 0.0, kReadOnlyPreset);
+	createAngleAttribute(outputAngleAttr, "outputAngle", "outputAngle", 0.0, kReadOnlyPreset);
+	createVectorAttribute(outputVectorAttr, outputVectorXAttr, outputVectorYAttr, outputVectorZAttr, "outputVector", "outputVector", MVector::zero, kReadOnlyPreset);
+	createMatrixAttribute(outputMatrixAttr, "outputMatrix", "outputMatrix", MMatrix::identity, kReadOnlyPreset);
+	createQuaternionAttribute(outputQuaternionAttr, outputQuaternionXAttr, outputQuaternionYAttr, outputQuaternionZAttr, outputQuaternionWAttr, "outputQuaternion", "outputQuaternion",
+		MQuaternion::identity, kReadOnlyPreset);
+
+	addAttribute(expressionAttr);
+	addAttribute(scalarInputAttr);
+	addAttribute(angleInputAttr);
+	addAttribute(vectorInputAttr);
+	addAttribute(matrixInputAttr);
+	addAttribute(quaternionInputAttr);
+	addAttribute(outputAttr);
+	addAttribute(outputAngleAttr);
+	addAttribute(outputVectorAttr);
+	addAttribute(outputMatrixAttr);
+	addAttribute(outputQuaternionAttr);
+
+	attributeAffects(expressionAttr, outputAttr);
+	attributeAffects(scalarInputAttr, outputAttr);
+	attributeAffects(angleInputAttr, outputAttr);
+	attributeAffects(vectorInputAttr, outputAttr);
+	attributeAffects(matrixInputAttr, outputAttr);
+	attributeAffects(quaternionInputAttr, outputAttr);
+	attributeAffects(expressionAttr, outputAngleAttr);
+	attributeAffects(scalarInputAttr, outputAngleAttr);
+	attributeAffects(angleInputAttr, outputAngleAttr);
+	attributeAffects(vectorInputAttr, outputAngleAttr);
+	attributeAffects(matrixInputAttr, outputAngleAttr);
+	attributeAffects(quaternionInputAttr, outputAngleAttr);
+	attributeAffects(expressionAttr, outputVectorAttr);
+	attributeAffects(scalarInputAttr, outputVectorAttr);
+	attributeAffects(angleInputAttr, outputVectorAttr);
+	attributeAffects(vectorInputAttr, outputVectorAttr);
+	attributeAffects(matrixInputAttr, outputVectorAttr);
+	attributeAffects(quaternionInputAttr, outputVectorAttr);
+	attributeAffects(expressionAttr, outputMatrixAttr);
+	attributeAffects(scalarInputAttr, outputMatrixAttr);
+	attributeAffects(angleInputAttr, outputMatrixAttr);
+	attributeAffects(vectorInputAttr, outputMatrixAttr);
+	attributeAffects(matrixInputAttr, outputMatrixAttr);
+	attributeAffects(quaternionInputAttr, outputMatrixAttr);
+	attributeAffects(expressionAttr, outputQuaternionAttr);
+	attributeAffects(scalarInputAttr, outputQuaternionAttr);
+	attributeAffects(angleInputAttr, outputQuaternionAttr);
+	attributeAffects(vectorInputAttr, outputQuaternionAttr);
+	attributeAffects(matrixInputAttr, outputQuaternionAttr);
+	attributeAffects(quaternionInputAttr, outputQuaternionAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus FusedExpression::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAttr && plug != outputAngleAttr && plug != outputVectorAttr && plug != outputVectorXAttr && plug != outputVectorYAttr &&
+		plug != outputVectorZAttr && plug != outputMatrixAttr && plug != outputQuaternionAttr && plug != outputQuaternionXAttr &&
+		plug != outputQuaternionYAttr && plug != outputQuaternionZAttr && plug != outputQuaternionWAttr)
+		return MStatus::kUnknownParameter;
+
+	if (!prepareEvaluation(dataBlock))
+		return MStatus::kFailure;
+
+	double result[MRS::ExpressionProgram::kMaxValueSize] = {};
+	MRS::ExpressionProgram::EvaluationError error = m_program.evaluate(m_scalars.data(), m_vectors.data(), m_matrices.data(), m_quaternions.data(), result);
+	if (error != MRS::ExpressionProgram::kNoError)
+	{
+		MGlobal::displayError(MRS::ExpressionProgram::errorMessage(error));
+		return MStatus::kFailure;
+	}
+
+	MRS::ExpressionProgram::ValueType resultType = m_program.resultType();
+	bool isScalar = resultType == MRS::ExpressionProgram::kScalar;
+	bool isVector = resultType == MRS::ExpressionProgram::kVector;
+	bool isQuaternion = resultType == MRS::ExpressionProgram::kQuaternion;
+
+	MMatrix matrix;
+	if (resultType == MRS::ExpressionProgram::kMatrix)
+		std::copy(result, result + 16, &matrix.matrix[0][0]);
+
+	outputDoubleValue(dataBlock, outputAttr, isScalar ? result[0] : 0.0);
+	outputAngleValue(dataBlock, outputAngleAttr, MAngle(isScalar ? result[0] : 0.0));
+	outputVectorValue(dataBlock, outputVectorAttr, isVector ? MVector(result[0], result[1], result[2]) : MVector::zero);
+	outputMatrixValue(dataBlock, outputMatrixAttr, matrix);
+	outputQuaternionValue(dataBlock, outputQuaternionAttr, outputQuaternionXAttr, outputQuaternionYAttr, outputQuaternionZAttr, outputQuaternionWAttr,
+		isQuaternion ? MQuaternion(result[0], result[1], result[2], result[3]) : MQuaternion::identity);
+
+	return MStatus::kSuccess;
+}
+
+// ------ Helpers ------
+
+#define kErrorInvalidExpression \
+	"Invalid expression on node \"^1s\": ^2s."
+
+/*	Description
+	-----------
+	Gathers the input values into flat buffers and recompiles the program if the expression or any input name has changed
+	Names are copied into buffers which retain their capacity so that a typical evaluation does not allocate    */
+
+bool FusedExpression::prepareEvaluation(MDataBlock& dataBlock)
+{
+	const MString& expression = dataBlock.inputValue(expressionAttr).asString();
+	m_pendingExpression.assign(expression.asChar(), expression.length());
+
+	MArrayDataHandle scalarArrayHandle = dataBlock.inputArrayValue(scalarInputAttr);
+	MArrayDataHandle angleArrayHandle = dataBlock.inputArrayValue(angleInputAttr);
+	MArrayDataHandle vectorArrayHandle = dataBlock.inputArrayValue(vectorInputAttr);
+	MArrayDataHandle matrixArrayHandle = dataBlock.inputArrayValue(matrixInputAttr);
+	MArrayDataHandle quaternionArrayHandle = dataBlock.inputArrayValue(quaternionInputAttr);
+	unsigned int scalarCount = scalarArrayHandle.elementCount();
+	unsigned int angleCount = angleArrayHandle.elementCount();
+	unsigned int vectorCount = vectorArrayHandle.elementCount();
+	unsigned int matrixCount = matrixArrayHandle.elementCount();
+	unsigned int quaternionCount = quaternionArrayHandle.elementCount();
+
+	m_pendingScalarNames.resize(scalarCount + angleCount);
+	m_pendingVectorNames.resize(vectorCount);
+	m_pendingMatrixNames.resize(matrixCount);
+	m_pendingQuaternionNames.resize(quaternionCount);
+	m_scalars.resize(scalarCount + angleCount);
+	m_vectors.resize(3 * vectorCount);
+	m_matrices.resize(16 * matrixCount);
+	m_quaternions.resize(4 * quaternionCount);
+
+	for (unsigned int i = 0; i < scalarCount; ++i)
+	{
+		scalarArrayHandle.jumpToArrayElement(i);
+		MDataHandle elementHandle = scalarArrayHandle.inputValue();
+		const MString& inputName = elementHandle.child(scalarNameAttr).asString();
+		m_pendingScalarNames[i].assign(inputName.asChar(), inputName.length());
+		m_scalars[i] = elementHandle.child(scalarValueAttr).asDouble();
+	}
+
+	for (unsigned int i = 0; i < angleCount; ++i)
+	{
+		angleArrayHandle.jumpToArrayElement(i);
+		MDataHandle elementHandle = angleArrayHandle.inputValue();
+		const MString& inputName = elementHandle.child(angleNameAttr).asString();
+		m_pendingScalarNames[scalarCount + i].assign(inputName.asChar(), inputName.length());
+		m_scalars[scalarCount + i] = elementHandle.child(angleValueAttr).asAngle().asRadians();
+	}
+
+	for (unsigned int i = 0; i < vectorCount; ++i)
+	{
+		vectorArrayHandle.jumpToArrayElement(i);
+		MDataHandle elementHandle = vectorArrayHandle.inputValue();
+		const MString& inputName = elementHandle.child(vectorNameAttr).asString();
+		m_pendingVectorNames[i].assign(inputName.asChar(), inputName.length());
+		const MVector& v = elementHandle.child(vectorValueAttr).asVector();
+		m_vectors[3 * i] = v.x;
+		m_vectors[3 * i + 1] = v.y;
+		m_vectors[3 * i + 2] = v.z;
+	}
+
+	for (unsigned int i = 0; i < matrixCount; ++i)
+	{
+		matrixArrayHandle.jumpToArrayElement(i);
+		MDataHandle elementHandle = matrixArrayHandle.inputValue();
+		const MString& inputName = elementHandle.child(matrixNameAttr).asString();
+		m_pendingMatrixNames[i].assign(inputName.asChar(), inputName.length());
+		const MMatrix& m = elementHandle.child(matrixValueAttr).asMatrix();
+		std::copy(&m.matrix[0][0], &m.matrix[0][0] + 16, m_matrices.data() + 16 * i);
+	}
+
+	for (unsigned int i = 0; i < quaternionCount; ++i)
+	{
+		quaternionArrayHandle.jumpToArrayElement(i);
+		MDataHandle elementHandle = quaternionArrayHandle.inputValue();
+		const MString& inputName = elementHandle.child(quaternionNameAttr).asString();
+		m_pendingQuaternionNames[i].assign(inputName.asChar(), inputName.length());
+		MDataHandle valueHandle = elementHandle.child(quaternionValueAttr);
+		m_quaternions[4 * i] = valueHandle.child(quaternionValueXAttr).asDouble();
+		m_quaternions[4 * i + 1] = valueHandle.child(quaternionValueYAttr).asDouble();
+		m_quaternions[4 * i + 2] = valueHandle.child(quaternionValueZAttr).asDouble();
+		m_quaternions[4 * i + 3] = valueHandle.child(quaternionValueWAttr).asDouble();
+	}
+
+	if (m_isCompiled && m_pendingExpression == m_expression && m_pendingScalarNames == m_scalarNames && m_pendingVectorNames == m_vectorNames &&
+		m_pendingMatrixNames == m_matrixNames && m_pendingQuaternionNames == m_quaternionNames)
+		return m_program.isValid();
+
+	m_expression = m_pendingExpression;
+	m_scalarNames = m_pendingScalarNames;
+	m_vectorNames = m_pendingVectorNames;
+	m_matrixNames = m_pendingMatrixNames;
+	m_quaternionNames = m_pendingQuaternionNames;
+	m_isCompiled = true;
+
+	// Compilation errors are only reported once per change
+	std::string error;
+	if (!m_program.compile(m_expression, m_scalarNames, m_vectorNames, m_matrixNames, m_quaternionNames, error))
+	{
+		MString msg;
+		MString msgFormat = kErrorInvalidExpression;
+		msg.format(msgFormat, name(), MString(error.c_str()));
+		MGlobal::displayError(msg);
+		return false;
+	}
+
+	return true;
+}
+
+// Cleanup
+#undef kErrorInvalidExpression
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+FusedExpression_CollapseCommand::FusedExpression_CollapseCommand() {}
+FusedExpression_CollapseCommand::~FusedExpression_CollapseCommand() {}
+
+// ------ Helpers ------
+
+namespace {
+
+enum PortType
+{
+	kScalarPort,
+	kAnglePort,
+	kVectorPort,
+	kMatrixPort,
+	kQuaternionPort,
+};
+
+struct Port
+{
+	MObject attr;
+	PortType type;
+};
+
+/*	Description
+	-----------
+	Describes how a supported math node is written as an expression
+	Each pattern is self delimiting (ie. a call or a parenthesized operation) so that substitutions and component access never require additional parentheses
+	Occurrences of $0-$4 in the pattern are replaced by the expressions of the corresponding input ports    */
+
+struct CollapsibleNode
+{
+	MTypeId typeId;
+	const char* pattern;
+	std::vector<Port> inputs;
+	Port output;
+};
+
+// Static attributes are only valid once the plugin has been initialized, therefore the table is populated on first use
+const std::vector<CollapsibleNode>& collapsibleNodes()
+{
+	static const std::vector<CollapsibleNode> nodes{
+		// Arithmetic
+		{ Add::kTypeId, "($0 + $1)", { { Add::input1Attr, kScalarPort }, { Add::input2Attr, kScalarPort } }, { Add::outputAttr, kScalarPort } },
+		{ Subtract::kTypeId, "($0 - $1)", { { Subtract::input1Attr, kScalarPort }, { Subtract::input2Attr, kScalarPort } }, { Subtract::outputAttr, kScalarPort } },
+		{ Multiply::kTypeId, "($0 * $1)", { { Multiply::input1Attr, kScalarPort }, { Multiply::input2Attr, kScalarPort } }, { Multiply::outputAttr, kScalarPort } },
+		{ Divide::kTypeId, "($0 / $1)", { { Divide::input1Attr, kScalarPort }, { Divide::input2Attr, kScalarPort } }, { Divide::outputAttr, kScalarPort } },
+		{ Negate::kTypeId, "(-$0)", { { Negate::inputAttr, kScalarPort } }, { Negate::outputAttr, kScalarPort } },
+		{ Reciprocal::kTypeId, "(1 / $0)", { { Reciprocal::inputAttr, kScalarPort } }, { Reciprocal::outputAttr, kScalarPort } },
+		// Condition
+		{ Min::kTypeId, "min($0, $1)", { { Min::input1Attr, kScalarPort }, { Min::input2Attr, kScalarPort } }, { Min::outputAttr, kScalarPort } },
+		{ Max::kTypeId, "max($0, $1)", { { Max::input1Attr, kScalarPort }, { Max::input2Attr, kScalarPort } }, { Max::outputAttr, kScalarPort } },
+		// Distance
+		{ Absolute::kTypeId, "abs($0)", { { Absolute::inputAttr, kScalarPort } }, { Absolute::outputAttr, kScalarPort } },
+		// Interpolate
+		{ Lerp::kTypeId, "lerp($0, $1, $2)", { { Lerp::input1Attr, kScalarPort }, { Lerp::input2Attr, kScalarPort }, { Lerp::tAttr, kScalarPort } },
+			{ Lerp::outputAttr, kScalarPort } },
+		{ Smoothstep::kTypeId, "smoothstep($0, $1, $2)", { { Smoothstep::input1Attr, kScalarPort }, { Smoothstep::input2Attr, kScalarPort },
+			{ Smoothstep::tAttr, kScalarPort } }, { Smoothstep::outputAttr, kScalarPort } },
+		{ LerpVector::kTypeId, "lerp($0, $1, $2)", { { LerpVector::input1Attr, kVectorPort }, { LerpVector::input2Attr, kVectorPort },
+			{ LerpVector::tAttr, kScalarPort } }, { LerpVector::outputAttr, kVectorPort } },
+		{ SmoothstepVector::kTypeId, "smoothstep($0, $1, $2)", { { SmoothstepVector::input1Attr, kVectorPort }, { SmoothstepVector::input2Attr, kVectorPort },
+			{ SmoothstepVector::tAttr, kScalarPort } }, { SmoothstepVector::outputAttr, kVectorPort } },
+		// Power
+		{ Power::kTypeId, "pow($0, $1)", { { Power::baseAttr, kScalarPort }, { Power::exponentAttr, kScalarPort } }, { Power::outputAttr, kScalarPort } },
+		{ SquareRoot::kTypeId, "sqrt($0)", { { SquareRoot::inputAttr, kScalarPort } }, { SquareRoot::outputAttr, kScalarPort } },
+		// Range
+		{ Clamp::kTypeId, "clamp($0, $1, $2)", { { Clamp::inputAttr, kScalarPort }, { Clamp::minAttr, kScalarPort }, { Clamp::maxAttr, kScalarPort } },
+			{ Clamp::outputAttr, kScalarPort } },
+		{ Remap::kTypeId, "remap($0, $1, $2, $3, $4)", { { Remap::inputAttr, kScalarPort }, { Remap::low1Attr, kScalarPort }, { Remap::high1Attr, kScalarPort },
+			{ Remap::low2Attr, kScalarPort }, { Remap::high2Attr, kScalarPort } }, { Remap::outputAttr, kScalarPort } },
+		// Round
+		{ Floor::kTypeId, "floor($0)", { { Floor::inputAttr, kScalarPort } }, { Floor::outputAttr, kScalarPort } },
+		{ Ceil::kTypeId, "ceil($0)", { { Ceil::inputAttr, kScalarPort } }, { Ceil::outputAttr, kScalarPort } },
+		{ Round::kTypeId, "round($0)", { { Round::inputAttr, kScalarPort } }, { Round::outputAttr, kScalarPort } },
+		// Trigonometry
+		{ Sin::kTypeId, "sin($0)", { { Sin::inputAttr, kAnglePort } }, { Sin::outputAttr, kScalarPort } },
+		{ Cos::kTypeId, "cos($0)", { { Cos::inputAttr, kAnglePort } }, { Cos::outputAttr, kScalarPort } },
+		{ Tan::kTypeId, "tan($0)", { { Tan::inputAttr, kAnglePort } }, { Tan::outputAttr, kScalarPort } },
+		{ Asin::kTypeId, "asin($0)", { { Asin::inputAttr, kScalarPort } }, { Asin::outputAttr, kAnglePort } },
+		{ Acos::kTypeId, "acos($0)", { { Acos::inputAttr, kScalarPort } }, { Acos::outputAttr, kAnglePort } },
+		{ Atan::kTypeId, "atan($0)", { { Atan::inputAttr, kScalarPort } }, { Atan::outputAttr, kAnglePort } },
+		{ Atan2::kTypeId, "atan2($0, $1)", { { Atan2::yAttr, kScalarPort }, { Atan2::xAttr, kScalarPort } }, { Atan2::outputAttr, kAnglePort } },
+		// Vector
+		{ AddVector::kTypeId, "($0 + $1)", { { AddVector::input1Attr, kVectorPort }, { AddVector::input2Attr, kVectorPort } }, { AddVector::outputAttr, kVectorPort } },
+		{ SubtractVector::kTypeId, "($0 - $1)", { { SubtractVector::input1Attr, kVectorPort }, { SubtractVector::input2Attr, kVectorPort } },
+			{ SubtractVector::outputAttr, kVectorPort } },
+		{ MultiplyVector::kTypeId, "($0 * $1)", { { MultiplyVector::input1Attr, kVectorPort }, { MultiplyVector::input2Attr, kScalarPort } },
+			{ MultiplyVector::outputAttr, kVectorPort } },
+		{ DivideVector::kTypeId, "($0 / $1)", { { DivideVector::input1Attr, kVectorPort }, { DivideVector::input2Attr, kScalarPort } },
+			{ DivideVector::outputAttr, kVectorPort } },
+		{ NegateVector::kTypeId, "(-$0)", { { NegateVector::inputAttr, kVectorPort } }, { NegateVector::outputAttr, kVectorPort } },
+		{ CrossProduct::kTypeId, "cross($0, $1)", { { CrossProduct::input1Attr, kVectorPort }, { CrossProduct::input2Attr, kVectorPort } },
+			{ CrossProduct::outputAttr, kVectorPort } },
+		{ DotProduct::kTypeId, "dot($0, $1)", { { DotProduct::input1Attr, kVectorPort }, { DotProduct::input2Attr, kVectorPort } },
+			{ DotProduct::outputAttr, kScalarPort } },
+		{ VectorLength::kTypeId, "length($0)", { { VectorLength::inputAttr, kVectorPort } }, { VectorLength::outputAttr, kScalarPort } },
+		{ NormalizeVector::kTypeId, "normalize($0)", { { NormalizeVector::inputAttr, kVectorPort } }, { NormalizeVector::outputAttr, kVectorPort } },
+		{ MultiplyPointByMatrix::kTypeId, "transformPoint($0, $1)", { { MultiplyPointByMatrix::input1Attr, kVectorPort }, { MultiplyPointByMatrix::input2Attr, kMatrixPort } },
+			{ MultiplyPointByMatrix::outputAttr, kVectorPort } },
+		{ MultiplyVectorByMatrix::kTypeId, "transformVector($0, $1)", { { MultiplyVectorByMatrix::input1Attr, kVectorPort }, { MultiplyVectorByMatrix::input2Attr, kMatrixPort } },
+			{ MultiplyVectorByMatrix::outputAttr, kVectorPort } },
+		{ RotateVectorByQuaternion::kTypeId, "rotate($0, $1)", { { RotateVectorByQuaternion::inputAttr, kVectorPort },
+			{ RotateVectorByQuaternion::unitQuaternionAttr, kQuaternionPort } }, { RotateVectorByQuaternion::outputAttr, kVectorPort } },
+		// Matrix
+		{ MultiplyMatrix::kTypeId, "($0 * $1)", { { MultiplyMatrix::input1Attr, kMatrixPort }, { MultiplyMatrix::input2Attr, kMatrixPort } },
+			{ MultiplyMatrix::outputAttr, kMatrixPort } },
+		{ ExtractTranslationFromMatrix::kTypeId, "translation($0)", { { ExtractTranslationFromMatrix::inputAttr, kMatrixPort } },
+			{ ExtractTranslationFromMatrix::outputAttr, kVectorPort } },
+		{ ExtractScaleFromMatrix::kTypeId, "scale($0)", { { ExtractScaleFromMatrix::inputAttr, kMatrixPort } }, { ExtractScaleFromMatrix::outputAttr, kVectorPort } },
+		{ ExtractQuaternionFromMatrix::kTypeId, "rotation($0)", { { ExtractQuaternionFromMatrix::inputAttr, kMatrixPort } },
+			{ ExtractQuaternionFromMatrix::outputAttr, kQuaternionPort } },
+		// The normalize flag is a boolean, it is exposed to the expression as a scalar which is non-zero when set
+		{ ExtractBasisXFromMatrix::kTypeId, "basisX($0, $1)", { { ExtractBasisXFromMatrix::inputAttr, kMatrixPort }, { ExtractBasisXFromMatrix::normalizeAttr, kScalarPort } },
+			{ ExtractBasisXFromMatrix::outputAttr, kVectorPort } },
+		{ ExtractBasisYFromMatrix::kTypeId, "basisY($0, $1)", { { ExtractBasisYFromMatrix::inputAttr, kMatrixPort }, { ExtractBasisYFromMatrix::normalizeAttr, kScalarPort } },
+			{ ExtractBasisYFromMatrix::outputAttr, kVectorPort } },
+		{ ExtractBasisZFromMatrix::kTypeId, "basisZ($0, $1)", { { ExtractBasisZFromMatrix::inputAttr, kMatrixPort }, { ExtractBasisZFromMatrix::normalizeAttr, kScalarPort } },
+			{ ExtractBasisZFromMatrix::outputAttr, kVectorPort } },
+		{ ExtractTranslationMatrix::kTypeId, "translationMatrix($0)", { { ExtractTranslationMatrix::inputAttr, kMatrixPort } },
+			{ ExtractTranslationMatrix::outputAttr, kMatrixPort } },
+		{ ExtractRotationMatrix::kTypeId, "rotationMatrix($0)", { { ExtractRotationMatrix::inputAttr, kMatrixPort } }, { ExtractRotationMatrix::outputAttr, kMatrixPort } },
+		{ ExtractScaleMatrix::kTypeId, "scaleMatrix($0)", { { ExtractScaleMatrix::inputAttr, kMatrixPort } }, { ExtractScaleMatrix::outputAttr, kMatrixPort } },
+		{ PreMultiplyMatrixByTranslation::kTypeId, "preTranslate($0, $1)", { { PreMultiplyMatrixByTranslation::inputAttr, kMatrixPort },
+			{ PreMultiplyMatrixByTranslation::translationAttr, kVectorPort } }, { PreMultiplyMatrixByTranslation::outputAttr, kMatrixPort } },
+		{ PostMultiplyMatrixByTranslation::kTypeId, "postTranslate($0, $1)", { { PostMultiplyMatrixByTranslation::inputAttr, kMatrixPort },
+			{ PostMultiplyMatrixByTranslation::translationAttr, kVectorPort } }, { PostMultiplyMatrixByTranslation::outputAttr, kMatrixPort } },
+		{ PreMultiplyMatrixByScale::kTypeId, "preScale($0, $1)", { { PreMultiplyMatrixByScale::inputAttr, kMatrixPort }, { PreMultiplyMatrixByScale::scaleAttr, kVectorPort } },
+			{ PreMultiplyMatrixByScale::outputAttr, kMatrixPort } },
+		{ PostMultiplyMatrixByScale::kTypeId, "postScale($0, $1)", { { PostMultiplyMatrixByScale::inputAttr, kMatrixPort }, { PostMultiplyMatrixByScale::scaleAttr, kVectorPort } },
+			{ PostMultiplyMatrixByScale::outputAttr, kMatrixPort } },
+		{ PreMultiplyMatrixByAxisXAngle::kTypeId, "preRotateX($0, $1)", { { PreMultiplyMatrixByAxisXAngle::inputAttr, kMatrixPort },
+			{ PreMultiplyMatrixByAxisXAngle::angleXAttr, kAnglePort } }, { PreMultiplyMatrixByAxisXAngle::outputAttr, kMatrixPort } },
+		{ PreMultiplyMatrixByAxisYAngle::kTypeId, "preRotateY($0, $1)", { { PreMultiplyMatrixByAxisYAngle::inputAttr, kMatrixPort },
+			{ PreMultiplyMatrixByAxisYAngle::angleYAttr, kAnglePort } }, { PreMultiplyMatrixByAxisYAngle::outputAttr, kMatrixPort } },
+		{ PreMultiplyMatrixByAxisZAngle::kTypeId, "preRotateZ($0, $1)", { { PreMultiplyMatrixByAxisZAngle::inputAttr, kMatrixPort },
+			{ PreMultiplyMatrixByAxisZAngle::angleZAttr, kAnglePort } }, { PreMultiplyMatrixByAxisZAngle::outputAttr, kMatrixPort } },
+		{ PostMultiplyMatrixByAxisXAngle::kTypeId, "postRotateX($0, $1)", { { PostMultiplyMatrixByAxisXAngle::inputAttr, kMatrixPort },
+			{ PostMultiplyMatrixByAxisXAngle::angleXAttr, kAnglePort } }, { PostMultiplyMatrixByAxisXAngle::outputAttr, kMatrixPort } },
+		{ PostMultiplyMatrixByAxisYAngle::kTypeId, "postRotateY($0, $1)", { { PostMultiplyMatrixByAxisYAngle::inputAttr, kMatrixPort },
+			{ PostMultiplyMatrixByAxisYAngle::angleYAttr, kAnglePort } }, { PostMultiplyMatrixByAxisYAngle::outputAttr, kMatrixPort } },
+		{ PostMultiplyMatrixByAxisZAngle::kTypeId, "postRotateZ($0, $1)", { { PostMultiplyMatrixByAxisZAngle::inputAttr, kMatrixPort },
+			{ PostMultiplyMatrixByAxisZAngle::angleZAttr, kAnglePort } }, { PostMultiplyMatrixByAxisZAngle::outputAttr, kMatrixPort } },
+		{ PreMultiplyMatrixByQuaternion::kTypeId, "(matrix($1) * $0)", { { PreMultiplyMatrixByQuaternion::inputAttr, kMatrixPort },
+			{ PreMultiplyMatrixByQuaternion::quaternionAttr, kQuaternionPort } }, { PreMultiplyMatrixByQuaternion::outputAttr, kMatrixPort } },
+		{ PostMultiplyMatrixByQuaternion::kTypeId, "($0 * matrix($1))", { { PostMultiplyMatrixByQuaternion::inputAttr, kMatrixPort },
+			{ PostMultiplyMatrixByQuaternion::quaternionAttr, kQuaternionPort } }, { PostMultiplyMatrixByQuaternion::outputAttr, kMatrixPort } },
+		// Quaternion
+		{ MultiplyQuaternion::kTypeId, "($0 * $1)", { { MultiplyQuaternion::input1Attr, kQuaternionPort }, { MultiplyQuaternion::input2Attr, kQuaternionPort } },
+			{ MultiplyQuaternion::outputAttr, kQuaternionPort } },
+		{ ConvertQuaternionToMatrix::kTypeId, "matrix($0)", { { ConvertQuaternionToMatrix::inputAttr, kQuaternionPort } },
+			{ ConvertQuaternionToMatrix::outputAttr, kMatrixPort } },
+	};
+
+	return nodes;
+}
+
+const CollapsibleNode* findCollapsibleNode(const MTypeId& typeId)
+{
+	for (const CollapsibleNode& node : collapsibleNodes())
+	{
+		if (node.typeId == typeId)
+			return &node;
+	}
+
+	return nullptr;
+}
+
+int findNode(const MObjectArray& nodes, const MObject& node)
+{
+	for (unsigned int i = 0; i < nodes.length(); ++i)
+	{
+		if (nodes[i] == node)
+			return (int)i;
+	}
+
+	return -1;
+}
+
+// Uses the shortest representation which round trips to the same value
+std::string formatLiteral(double value)
+{
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+	if (std::strtod(buffer, nullptr) != value)
+		std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+
+	return buffer;
+}
+
+// Returns the output of the fused node which replaces an output of the given type
+MObject fusedOutputAttribute(PortType type)
+{
+	switch (type)
+	{
+		case kAnglePort:
+			return FusedExpression::outputAngleAttr;
+		case kVectorPort:
+			return FusedExpression::outputVectorAttr;
+		case kMatrixPort:
+			return FusedExpression::outputMatrixAttr;
+		case kQuaternionPort:
+			return FusedExpression::outputQuaternionAttr;
+		default:
+			return FusedExpression::outputAttr;
+	}
+}
+
+/*	Description
+	-----------
+	Builds the expression for a set of nodes which form a tree (or DAG) terminating at a single root
+	Connections between members are inlined, connections from outside the set become named inputs and unconnected inputs become literals
+	Unit conversion nodes are transparent when they sit between two members, their conversion factor is folded into the expression    */
+
+class ExpressionBuilder
+{
+public:
+	ExpressionBuilder(const MObjectArray& nodes, const std::vector<const CollapsibleNode*>& specs) :
+		m_nodes{ nodes },
+		m_specs{ specs },
+		m_states(nodes.length(), kUnvisited),
+		m_expressions(nodes.length()) {}
+
+	// ------ Inputs ------
+	struct NamedInput
+	{
+		std::string name;
+		MPlug source;
+	};
+
+	std::vector<NamedInput> scalarInputs;
+	std::vector<NamedInput> angleInputs;
+	std::vector<NamedInput> vectorInputs;
+	std::vector<NamedInput> matrixInputs;
+	std::vector<NamedInput> quaternionInputs;
+	MObjectArray internalConversions;
+	MString error;
+
+	// Returns false if a connection lies outside the set
+	bool isInternalDestination(const MPlug& destination)
+	{
+		MObject node = destination.node();
+		if (findNode(m_nodes, node) != -1)
+			return true;
+
+		if (!node.hasFn(MFn::kUnitConversion))
+			return false;
+
+		// A unit conversion is internal when every one of its destinations is a member
+		MFnDependencyNode fnConversion{ node };
+		MPlug outputPlug = fnConversion.findPlug("output", false);
+		MPlugArray destinations;
+		outputPlug.connectedTo(destinations, false, true);
+		if (destinations.length() == 0)
+			return false;
+
+		for (unsigned int i = 0; i < destinations.length(); ++i)
+		{
+			if (findNode(m_nodes, destinations[i].node()) == -1)
+				return false;
+		}
+
+		if (findNode(internalConversions, node) == -1)
+			internalConversions.append(node);
+
+		return true;
+	}
+
+	bool build(unsigned int index, std::string& outExpression)
+	{
+		if (m_states[index] == kVisited)
+		{
+			outExpression = m_expressions[index];
+			return true;
+		}
+
+		MFnDependencyNode fnDep{ m_nodes[index] };
+		if (m_states[index] == kVisiting)
+		{
+			error = "Cycle detected at node \"" + fnDep.name() + "\".";
+			return false;
+		}
+
+		m_states[index] = kVisiting;
+
+		const CollapsibleNode& spec = *m_specs[index];
+		std::vector<std::string> arguments(spec.inputs.size());
+		for (size_t i = 0; i < spec.inputs.size(); ++i)
+		{
+			if (!buildPort(MPlug(m_nodes[index], spec.inputs[i].attr), spec.inputs[i].type, arguments[i]))
+				return false;
+		}
+
+		std::string expression;
+		for (const char* c = spec.pattern; *c; ++c)
+		{
+			if (*c == '$')
+			{
+				++c;
+				expression += arguments[*c - '0'];
+			}
+			else
+				expression += *c;
+		}
+
+		m_states[index] = kVisited;
+		m_expressions[index] = expression;
+		outExpression = expression;
+		return true;
+	}
+
+	bool isVisited(unsigned int index) const
+	{
+		return m_states[index] == kVisited;
+	}
+
+private:
+	enum VisitState
+	{
+		kUnvisited,
+		kVisiting,
+		kVisited,
+	};
+
+	bool buildPort(const MPlug& plug, PortType type, std::string& outExpression)
+	{
+		MPlugArray sources;
+		plug.connectedTo(sources, true, false);
+
+		if (sources.length() != 0)
+			return buildConnection(sources[0], type, outExpression);
+
+		// Vector and quaternion children may be individually connected
+		if (type == kVectorPort || type == kQuaternionPort)
+		{
+			std::string expression = type == kVectorPort ? "vec(" : "quat(";
+			for (unsigned int i = 0; i < plug.numChildren(); ++i)
+			{
+				std::string component;
+				if (!buildPort(plug.child(i), kScalarPort, component))
+					return false;
+
+				expression += (i == 0 ? "" : ", ") + component;
+			}
+
+			outExpression = expression + ")";
+			return true;
+		}
+
+		if (type == kMatrixPort)
+		{
+			MMatrix matrix = MFnMatrixData{ plug.asMObject() }.matrix();
+			std::string expression = "mat(";
+			for (unsigned int i = 0; i < 16; ++i)
+				expression += (i == 0 ? "" : ", ") + formatLiteral(matrix.matrix[i / 4][i % 4]);
+
+			outExpression = expression + ")";
+			return true;
+		}
+
+		// Angles are exposed to the expression in radians
+		outExpression = formatLiteral(type == kAnglePort ? plug.asMAngle().asRadians() : plug.asDouble());
+		return true;
+	}
+
+	bool buildConnection(const MPlug& source, PortType type, std::string& outExpression)
+	{
+		MPlug memberSource = source;
+		double conversionFactor = 1.0;
+
+		// Look through unit conversions which are fed by a member
+		if (source.node().hasFn(MFn::kUnitConversion))
+		{
+			MFnDependencyNode fnConversion{ source.node() };
+			MPlugArray conversionSources;
+			fnConversion.findPlug("input", false).connectedTo(conversionSources, true, false);
+			if (conversionSources.length() != 0 && findNode(m_nodes, conversionSources[0].node()) != -1)
+			{
+				memberSource = conversionSources[0];
+				conversionFactor = fnConversion.findPlug("conversionFactor", false).asDouble();
+			}
+		}
+
+		int memberIndex = findNode(m_nodes, memberSource.node());
+		if (memberIndex == -1)
+		{
+			outExpression = addNamedInput(source, type);
+			return true;
+		}
+
+		std::string memberExpression;
+		if (!build((unsigned int)memberIndex, memberExpression))
+			return false;
+
+		// Connections from a vector or quaternion output's child become component access
+		const CollapsibleNode& spec = *m_specs[memberIndex];
+		if (memberSource.isChild() && memberSource.parent().attribute() == spec.output.attr)
+		{
+			MPlug outputPlug(m_nodes[memberIndex], spec.output.attr);
+			const char* components[4] = { ".x", ".y", ".z", ".w" };
+			for (unsigned int i = 0; i < outputPlug.numChildren(); ++i)
+			{
+				if (outputPlug.child(i) == memberSource)
+					memberExpression += components[i];
+			}
+		}
+
+		outExpression = conversionFactor == 1.0 ? memberExpression : "(" + memberExpression + " * " + formatLiteral(conversionFactor) + ")";
+		return true;
+	}
+
+	std::string addNamedInput(const MPlug& source, PortType type)
+	{
+		std::vector<NamedInput>& inputs = namedInputs(type);
+		for (const NamedInput& input : inputs)
+		{
+			if (input.source == source)
+				return input.name;
+		}
+
+		// Derive a readable identifier from the source plug, eg. "pCube1.translateX" becomes "pCube1_translateX"
+		std::string name = source.name().asChar();
+		for (char& c : name)
+		{
+			if (!std::isalnum((unsigned char)c))
+				c = '_';
+		}
+
+		if (name.empty() || std::isdigit((unsigned char)name[0]))
+			name = "_" + name;
+
+		std::string uniqueName = name;
+		for (unsigned int suffix = 1; isNameTaken(uniqueName); ++suffix)
+			uniqueName = name + std::to_string(suffix);
+
+		inputs.push_back({ uniqueName, source });
+		return uniqueName;
+	}
+
+	bool isNameTaken(const std::string& name) const
+	{
+		if (name == "pi")
+			return true;
+
+		for (const std::vector<NamedInput>* inputs : { &scalarInputs, &angleInputs, &vectorInputs, &matrixInputs, &quaternionInputs })
+		{
+			for (const NamedInput& input : *inputs)
+			{
+				if (input.name == name)
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	std::vector<NamedInput>& namedInputs(PortType type)
+	{
+		switch (type)
+		{
+			case kAnglePort:
+				return angleInputs;
+			case kVectorPort:
+				return vectorInputs;
+			case kMatrixPort:
+				return matrixInputs;
+			case kQuaternionPort:
+				return quaternionInputs;
+			default:
+				return scalarInputs;
+		}
+	}
+
+	const MObjectArray& m_nodes;
+	const std::vector<const CollapsibleNode*>& m_specs;
+	std::vector<VisitState> m_states;
+	std::vector<std::string> m_expressions;
+};
+
+} // namespace
+
+// ------ Registration ------
+
+const char* FusedExpression_CollapseCommand::kNameFlag = "-n";
+const char* FusedExpression_CollapseCommand::kNameFlagLong = "-name";
+
+MSyntax FusedExpression_CollapseCommand::newSyntax()
+{
+	MSyntax syntax;
+
+	// Flags
+	syntax.addFlag(kNameFlag, kNameFlagLong, MSyntax::kString);
+
+	// Args
+	syntax.useSelectionAsDefault(true);
+	syntax.setObjectType(MSyntax::kSelectionList, 1);
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+}
+
+// ------ MPxCommand ------
+
+bool FusedExpression_CollapseCommand::isUndoable() const
+{
+	return true;
+}
+
+#define kErrorParsingFlag \
+	"Error parsing flag \"^1s\"."
+
+#define kErrorNoValidObject \
+	"This command requires one or more math nodes to be specified or selected."
+
+#define kErrorInvalidType \
+	"Object \"^1s\" has an invalid type. Only scalar, angle, vector, matrix and quaternion math nodes with an expression equivalent can be collapsed."
+
+#define kErrorMultipleOutputs \
+	"Nodes \"^1s\" and \"^2s\" both output outside of the specified nodes. A collapsed network must have a single output node."
+
+#define kErrorDisconnectedNode \
+	"Node \"^1s\" does not contribute to the output of node \"^2s\"."
+
+MStatus FusedExpression_CollapseCommand::doIt(const MArgList& args)
+{
+	MStatus status;
+
+	// Argument list parser
+	MArgDatabase argParser(syntax(), args);
+
+	// Parse command flags
+	MString fusedName;
+	if (argParser.isFlagSet(kNameFlagLong) && !argParser.getFlagArgument(kNameFlagLong, 0, fusedName))
+	{
+		MString msg;
+		MString msgFormat = kErrorParsingFlag;
+		msg.format(msgFormat, kNameFlagLong);
+		displayError(msg);
+		return MStatus::kFailure;
+	}
+
+	// Parse specified objects from either command args or current selection
+	MSelectionList selectionList;
+	argParser.getObjects(selectionList);
+
+	if (selectionList.length() == 0)
+	{
+		displayError(kErrorNoValidObject);
+		return MStatus::kFailure;
+	}
+
+	MObjectArray nodes;
+	std::vector<const CollapsibleNode*> specs;
+	for (unsigned int i = 0; i < selectionList.length(); ++i)
+	{
+		MObject node;
+		selectionList.getDependNode(i, node);
+		MFnDependencyNode fnDep{ node };
+		const CollapsibleNode* spec = findCollapsibleNode(fnDep.typeId());
+		if (!spec)
+		{
+			MString msg;
+			MString msgFormat = kErrorInvalidType;
+			msg.format(msgFormat, fnDep.name());
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+
+		if (findNode(nodes, node) == -1)
+		{
+			nodes.append(node);
+			specs.push_back(spec);
+		}
+	}
+
+	// Find the single node whose output leaves the set, the output may also feed other members
+	ExpressionBuilder builder{ nodes, specs };
+	int rootIndex = -1;
+	std::vector<MPlugArray> rootConnections(5);
+	for (unsigned int i = 0; i < nodes.length(); ++i)
+	{
+		MPlug outputPlug(nodes[i], specs[i]->output.attr);
+		std::vector<MPlug> outputPlugs{ outputPlug };
+		if (specs[i]->output.type == kVectorPort || specs[i]->output.type == kQuaternionPort)
+		{
+			for (unsigned int j = 0; j < outputPlug.numChildren(); ++j)
+				outputPlugs.push_back(outputPlug.child(j));
+		}
+
+		bool hasInternalConnections = false;
+		std::vector<MPlugArray> externalConnections(outputPlugs.size());
+		for (size_t j = 0; j < outputPlugs.size(); ++j)
+		{
+			MPlugArray destinations;
+			outputPlugs[j].connectedTo(destinations, false, true);
+			for (unsigned int k = 0; k < destinations.length(); ++k)
+			{
+				if (builder.isInternalDestination(destinations[k]))
+					hasInternalConnections = true;
+				else
+					externalConnections[j].append(destinations[k]);
+			}
+		}
+
+		// A node is a root if anything external depends on it, or if nothing depends on it at all
+		bool hasExternalConnections = false;
+		for (const MPlugArray& connections : externalConnections)
+			hasExternalConnections = hasExternalConnections || connections.length() != 0;
+
+		if (!hasExternalConnections && hasInternalConnections)
+			continue;
+
+		if (rootIndex != -1)
+		{
+			MString msg;
+			MString msgFormat = kErrorMultipleOutputs;
+			msg.format(msgFormat, MFnDependencyNode(nodes[rootIndex]).name(), MFnDependencyNode(nodes[i]).name());
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+
+		rootIndex = (int)i;
+		for (size_t j = 0; j < externalConnections.size(); ++j)
+			rootConnections[j] = externalConnections[j];
+	}
+
+	// Every member has a destination in the set, which can only occur if the nodes form a cycle
+	if (rootIndex == -1)
+		rootIndex = 0;
+
+	std::string expression;
+	if (!builder.build((unsigned int)rootIndex, expression))
+	{
+		displayError(builder.error);
+		return MStatus::kFailure;
+	}
+
+	MString rootName = MFnDependencyNode(nodes[rootIndex]).name();
+	for (unsigned int i = 0; i < nodes.length(); ++i)
+	{
+		if (!builder.isVisited(i))
+		{
+			MString msg;
+			MString msgFormat = kErrorDisconnectedNode;
+			msg.format(msgFormat, MFnDependencyNode(nodes[i]).name(), rootName);
+			displayError(msg);
+			return MStatus::kFailure;
+		}
+	}
+
+	// Create the fused node, it must exist before its plugs can be edited
+	MObject fusedNode = m_createDGMod.createNode(FusedExpression::kTypeId, &status);
+	if (!status)
+		return status;
+
+	if (fusedName.length() != 0)
+		m_createDGMod.renameNode(fusedNode, fusedName);
+
+	status = m_createDGMod.doIt();
+	if (!status)
+		return status;
+
+	m_collapseDGMod.newPlugValueString(MPlug(fusedNode, FusedExpression::expressionAttr), expression.c_str());
+
+	// Named inputs
+	struct InputArray
+	{
+		const std::vector<ExpressionBuilder::NamedInput>& inputs;
+		MObject compoundAttr;
+		MObject nameAttr;
+		MObject valueAttr;
+	};
+
+	InputArray inputArrays[5] = {
+		{ builder.scalarInputs, FusedExpression::scalarInputAttr, FusedExpression::scalarNameAttr, FusedExpression::scalarValueAttr },
+		{ builder.angleInputs, FusedExpression::angleInputAttr, FusedExpression::angleNameAttr, FusedExpression::angleValueAttr },
+		{ builder.vectorInputs, FusedExpression::vectorInputAttr, FusedExpression::vectorNameAttr, FusedExpression::vectorValueAttr },
+		{ builder.matrixInputs, FusedExpression::matrixInputAttr, FusedExpression::matrixNameAttr, FusedExpression::matrixValueAttr },
+		{ builder.quaternionInputs, FusedExpression::quaternionInputAttr, FusedExpression::quaternionNameAttr, FusedExpression::quaternionValueAttr },
+	};
+
+	for (const InputArray& inputArray : inputArrays)
+	{
+		MPlug arrayPlug(fusedNode, inputArray.compoundAttr);
+		for (unsigned int i = 0; i < inputArray.inputs.size(); ++i)
+		{
+			MPlug elementPlug = arrayPlug.elementByLogicalIndex(i);
+			m_collapseDGMod.newPlugValueString(elementPlug.child(inputArray.nameAttr), inputArray.inputs[i].name.c_str());
+			m_collapseDGMod.connect(inputArray.inputs[i].source, elementPlug.child(inputArray.valueAttr));
+		}
+	}
+
+	// Transfer the external destinations of the root
+	const CollapsibleNode& rootSpec = *specs[rootIndex];
+	MPlug rootOutputPlug(nodes[rootIndex], rootSpec.output.attr);
+	MPlug fusedOutputPlug(fusedNode, fusedOutputAttribute(rootSpec.output.type));
+
+	for (unsigned int i = 0; i < rootConnections.size(); ++i)
+	{
+		// Only compound outputs have children, the remaining entries are always empty
+		if (rootConnections[i].length() == 0)
+			continue;
+
+		MPlug sourcePlug = i == 0 ? rootOutputPlug : rootOutputPlug.child(i - 1);
+		MPlug fusedSourcePlug = i == 0 ? fusedOutputPlug : fusedOutputPlug.child(i - 1);
+		for (unsigned int j = 0; j < rootConnections[i].length(); ++j)
+		{
+			m_collapseDGMod.disconnect(sourcePlug, rootConnections[i][j]);
+			m_collapseDGMod.connect(fusedSourcePlug, rootConnections[i][j]);
+		}
+	}
+
+	// Remove the collapsed network
+	for (unsigned int i = 0; i < builder.internalConversions.length(); ++i)
+		m_collapseDGMod.deleteNode(builder.internalConversions[i]);
+	for (unsigned int i = 0; i < nodes.length(); ++i)
+		m_collapseDGMod.deleteNode(nodes[i]);
+
+	status = m_collapseDGMod.doIt();
+	if (!status)
+	{
+		m_createDGMod.undoIt();
+		return status;
+	}
+
+	setResult(MFnDependencyNode(fusedNode).name());
+	return status;
+}
+
+MStatus FusedExpression_CollapseCommand::redoIt()
+{
+	MStatus status;
+
+	status = m_createDGMod.doIt();
+	if (status)
+	{
+		status = m_collapseDGMod.doIt();
+	}
+
+	return status;
+}
+
+MStatus FusedExpression_CollapseCommand::undoIt()
+{
+	MStatus status;
+
+	status = m_collapseDGMod.undoIt();
+	if (status)
+	{
+		status = m_createDGMod.undoIt();
+	}
+
+	return status;
+}
+
+// Cleanup
+#undef kErrorParsingFlag
+#undef kErrorNoValidObject
+#undef kErrorInvalidType
+#undef kErrorMultipleOutputs
+#undef kErrorDisconnectedNode
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <maya/MAngle.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MArgList.h>
+#include <maya/MArrayDataHandle.h>
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDGModifier.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MGlobal.h>
+#include <maya/MMatrix.h>
+#include <maya/MObject.h>
+#include <maya/MObjectArray.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MPxCommand.h>
+#include <maya/MPxNode.h>
+#include <maya/MQuaternion.h>
+#include <maya/MSelectionList.h>
+#include <maya/MStatus.h>
+#include <maya/MString.h>
+#include <maya/MSyntax.h>
+#include <maya/MTypeId.h>
+#include <maya/MVector.h>
+
+#include "utils/expression_utils.h"
+#include "utils/node_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Evaluates an expression over named scalar, angle, vector, matrix and quaternion inputs in a single compute
+	The expression is compiled to bytecode once and only recompiled when the expression or input names change
+	Operators and functions reproduce the per-op math nodes, see MRS::ExpressionProgram for the supported grammar
+
+	Considerations
+	--------------
+	Angle inputs are exposed to the expression in radians, the outputAngle plug interprets a scalar result in radians
+	Outputs which do not match the type of the expression are set to zero, or to the identity for the matrix and quaternion outputs    */
+
+class FusedExpression : public MPxNode, MRS::NodeHelper
+{
+public:
+	FusedExpression();
+	~FusedExpression();
+
+	// ------ Const ------
+	static const MTypeId kTypeId;
+	static const MString kTypeName;
+
+	// ------ MPxNode ------
+	SchedulingType schedulingType() const override;
+	static MStatus initialize();
+	MStatus compute(const MPlug &plug, MDataBlock &dataBlock) override;
+
+	// ------ Attr ------
+	static MObject expressionAttr;
+	static MObject scalarInputAttr;
+	static MObject scalarNameAttr;
+	static MObject scalarValueAttr;
+	static MObject angleInputAttr;
+	static MObject angleNameAttr;
+	static MObject angleValueAttr;
+	static MObject vectorInputAttr;
+	static MObject vectorNameAttr;
+	static MObject vectorValueAttr;
+	static MObject vectorValueXAttr;
+	static MObject vectorValueYAttr;
+	static MObject vectorValueZAttr;
+	static MObject matrixInputAttr;
+	static MObject matrixNameAttr;
+	static MObject matrixValueAttr;
+	static MObject quaternionInputAttr;
+	static MObject quaternionNameAttr;
+	static MObject quaternionValueAttr;
+	static MObject quaternionValueXAttr;
+	static MObject quaternionValueYAttr;
+	static MObject quaternionValueZAttr;
+	static MObject quaternionValueWAttr;
+	static MObject outputAttr;
+	static MObject outputAngleAttr;
+	static MObject outputVectorAttr;
+	static MObject outputVectorXAttr;
+	static MObject outputVectorYAttr;
+	static MObject outputVectorZAttr;
+	static MObject outputMatrixAttr;
+	static MObject outputQuaternionAttr;
+	static MObject outputQuaternionXAttr;
+	static MObject outputQuaternionYAttr;
+	static MObject outputQuaternionZAttr;
+	static MObject outputQuaternionWAttr;
+
+private:
+	// ------ Helpers ------
+	bool prepareEvaluation(MDataBlock& dataBlock);
+
+	// ------ Data ------
+	MRS::ExpressionProgram m_program;
+	bool m_isCompiled;
+	// Compilation keys, angle names are appended to the scalar names
+	std::string m_expression;
+	std::vector<std::string> m_scalarNames;
+	std::vector<std::string> m_vectorNames;
+	std::vector<std::string> m_matrixNames;
+	std::vector<std::string> m_quaternionNames;
+	// Evaluation buffers, reused between computes
+	std::string m_pendingExpression;
+	std::vector<std::string> m_pendingScalarNames;
+	std::vector<std::string> m_pendingVectorNames;
+	std::vector<std::string> m_pendingMatrixNames;
+	std::vector<std::string> m_pendingQuaternionNames;
+	std::vector<double> m_scalars;
+	std::vector<double> m_vectors;
+	std::vector<double> m_matrices;
+	std::vector<double> m_quaternions;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Class defines a command that will be used to collapse a connected network of math nodes into a single FusedExpression node
+class FusedExpression_CollapseCommand : public MPxCommand
+{
+public:
+	FusedExpression_CollapseCommand();
+	~FusedExpression_CollapseCommand() override;
+
+	// ------ Registration ------
+	static const MString kCommandName;
+	static MSyntax newSyntax();
+
+	// ------ Const ------
+	static const char* kNameFlag;
+	static const char* kNameFlagLong;
+
+	// ------ MPxCommand ------
+	bool isUndoable() const override;
+	MStatus doIt(const MArgList& args) override;
+	MStatus redoIt() override;
+	MStatus undoIt() override;
+
+private:
+	// ------ Data ------
+	MDGModifier m_createDGMod;
+	MDGModifier m_collapseDGMod;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -76,6 +76,8 @@ configure_file("${PROJECT_DIR}/euler/scripts/templates/AEConvertEulerToQuaternio
 configure_file("${PROJECT_DIR}/euler/scripts/templates/AEDivideEulerTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}DivideEulerTemplate.mel")
 configure_file("${PROJECT_DIR}/euler/scripts/templates/AEMultiplyEulerTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}MultiplyEulerTemplate.mel")
 configure_file("${PROJECT_DIR}/euler/scripts/templates/AEWeightedAverageEulerTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}WeightedAverageEulerTemplate.mel")
+configure_file("${PROJECT_DIR}/expression/scripts/templates/AEFusedExpressionTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}FusedExpressionTemplate.mel")
+configure_file("${PROJECT_DIR}/interpolate/scripts/templates/AEEaseArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}EaseArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/interpolate/scripts/templates/AELerpTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}LerpTemplate.mel")
 configure_file("${PROJECT_DIR}/interpolate/scripts/templates/AELerpAngleTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}LerpAngleTemplate.mel")
 configure_file("${PROJECT_DIR}/interpolate/scripts/templates/AELerpMatrixTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}LerpMatrixTemplate.mel")
@@ -144,14 +146,23 @@ configure_file("${PROJECT_DIR}/round/scripts/templates/AEFloorAngleTemplate.mel.
 configure_file("${PROJECT_DIR}/round/scripts/templates/AERoundTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}RoundTemplate.mel")
 configure_file("${PROJECT_DIR}/round/scripts/templates/AERoundAngleTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}RoundAngleTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAcosTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AcosTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAcosArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AcosArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAsinTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AsinTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAsinArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AsinArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAtanTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AtanTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAtanArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AtanArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAtan2Template.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}Atan2Template.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEAtan2ArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}Atan2ArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AECartesianToPolarTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}CartesianToPolarTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AECartesianToPolarArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}CartesianToPolarArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AECosTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}CosTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AECosArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}CosArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEPolarToCartesianTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}PolarToCartesianTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AEPolarToCartesianArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}PolarToCartesianArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AESinTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}SinTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AESinArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}SinArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AETanTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}TanTemplate.mel")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/AETanArrayTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}TanArrayTemplate.mel")
 configure_file("${PROJECT_DIR}/vector/scripts/templates/AEAddVectorTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AddVectorTemplate.mel")
 configure_file("${PROJECT_DIR}/vector/scripts/templates/AEAngleBetweenVectorsTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AngleBetweenVectorsTemplate.mel")
 configure_file("${PROJECT_DIR}/vector/scripts/templates/AEAverageVectorTemplate.mel.in" "${DIST_INSTALL_DIR}/module/templates/ae/AE${NODE_NAME_PREFIX}AverageVectorTemplate.mel")
@@ -255,6 +266,8 @@ configure_file("${PROJECT_DIR}/euler/scripts/templates/NEConvertEulerToQuaternio
 configure_file("${PROJECT_DIR}/euler/scripts/templates/NEDivideEulerTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}DivideEulerTemplate.xml")
 configure_file("${PROJECT_DIR}/euler/scripts/templates/NEMultiplyEulerTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}MultiplyEulerTemplate.xml")
 configure_file("${PROJECT_DIR}/euler/scripts/templates/NEWeightedAverageEulerTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}WeightedAverageEulerTemplate.xml")
+configure_file("${PROJECT_DIR}/expression/scripts/templates/NEFusedExpressionTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}FusedExpressionTemplate.xml")
+configure_file("${PROJECT_DIR}/interpolate/scripts/templates/NEEaseArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}EaseArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/interpolate/scripts/templates/NELerpAngleTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}LerpAngleTemplate.xml")
 configure_file("${PROJECT_DIR}/interpolate/scripts/templates/NELerpMatrixTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}LerpMatrixTemplate.xml")
 configure_file("${PROJECT_DIR}/interpolate/scripts/templates/NELerpTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}LerpTemplate.xml")
@@ -322,14 +335,23 @@ configure_file("${PROJECT_DIR}/round/scripts/templates/NEFloorTemplate.xml.in" "
 configure_file("${PROJECT_DIR}/round/scripts/templates/NERoundAngleTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}RoundAngleTemplate.xml")
 configure_file("${PROJECT_DIR}/round/scripts/templates/NERoundTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}RoundTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAcosTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AcosTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAcosArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AcosArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAsinTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AsinTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAsinArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AsinArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAtan2Template.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}Atan2Template.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAtan2ArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}Atan2ArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAtanTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AtanTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEAtanArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AtanArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NECartesianToPolarTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}CartesianToPolarTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NECartesianToPolarArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}CartesianToPolarArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NECosTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}CosTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NECosArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}CosArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEPolarToCartesianTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}PolarToCartesianTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NEPolarToCartesianArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}PolarToCartesianArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NESinTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}SinTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NESinArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}SinArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NETanTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}TanTemplate.xml")
+configure_file("${PROJECT_DIR}/trigonometry/scripts/templates/NETanArrayTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}TanArrayTemplate.xml")
 configure_file("${PROJECT_DIR}/vector/scripts/templates/NEAddVectorTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AddVectorTemplate.xml")
 configure_file("${PROJECT_DIR}/vector/scripts/templates/NEAngleBetweenVectorsTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AngleBetweenVectorsTemplate.xml")
 configure_file("${PROJECT_DIR}/vector/scripts/templates/NEAverageVectorTemplate.xml.in" "${DIST_INSTALL_DIR}/module/templates/ne/NE${NODE_NAME_PREFIX}AverageVectorTemplate.xml")
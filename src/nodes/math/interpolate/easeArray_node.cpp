@@ -0,0 +1,73 @@
+#include "easeArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+EaseArray::EaseArray() {}
+EaseArray::~EaseArray() {}
+
+// ------ Attr ------
+MObject EaseArray::input1Attr;
+MObject EaseArray::input2Attr;
+MObject EaseArray::easingAttr;
+MObject EaseArray::tAttr;
+MObject EaseArray::outputAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType EaseArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus EaseArray::initialize()
+{
+	std::vector<double> doubleArray;
+
+	createDoubleAttribute(input1Attr, "input1", "input1", 0.0, kDefaultPreset | kKeyable);
+	createDoubleAttribute(input2Attr, "input2", "input2", 1.0, kDefaultPreset | kKeyable);
+	createEasingAttribute(easingAttr, "easing", "easing", MRS::kLinear, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(tAttr, "t", "t", doubleArray, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(outputAttr, "output", "output", doubleArray, kReadOnlyPreset);
+
+	addAttribute(input1Attr);
+	addAttribute(input2Attr);
+	addAttribute(easingAttr);
+	addAttribute(tAttr);
+	addAttribute(outputAttr);
+
+	attributeAffects(input1Attr, outputAttr);
+	attributeAffects(input2Attr, outputAttr);
+	attributeAffects(easingAttr, outputAttr);
+	attributeAffects(tAttr, outputAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus EaseArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAttr)
+		return MStatus::kUnknownParameter;
+
+	double input1 = inputDoubleValue(dataBlock, input1Attr);
+	double input2 = inputDoubleValue(dataBlock, input2Attr);
+	MRS::Easing easing = inputEasingValue(dataBlock, easingAttr);
+	// The parameters are copied on this thread as the data function sets must not be accessed by the workers
+	inputDoubleDataArrayValue(dataBlock, tAttr, m_t);
+	unsigned int count = (unsigned int)m_t.size();
+	m_output.resize(count);
+
+	MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		// Parameters are clamped to the domain of the easing functions
+		double* values = &m_output[begin];
+		for (unsigned int i = begin; i < end; ++i)
+			values[i - begin] = MRS::clamp(m_t[i], 0.0, 1.0);
+
+		MRS::easeArray(easing, input1, input2, values, end - begin, values);
+	});
+
+	outputDoubleDataArrayValue(dataBlock, outputAttr, m_output);
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
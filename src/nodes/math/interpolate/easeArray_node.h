@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MObject.h>
+#include <maya/MPlug.h>
+#include <maya/MPxNode.h>
+#include <maya/MStatus.h>
+#include <maya/MString.h>
+#include <maya/MTypeId.h>
+
+#include "data/angleArray_data.h"
+#include "utils/math_utils.h"
+#include "utils/node_utils.h"
+#include "utils/simd_math_utils.h"
+#include "utils/thread_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Interpolates between input1 and input2 for each parameter of the t array, using the selected easing function
+	Parameters are clamped to the domain [0, 1], see MRS::easeArray for the accuracy of the vectorized easing functions    */
+
+class EaseArray : public MPxNode, MRS::NodeHelper
+{
+public:
+	EaseArray();
+	~EaseArray();
+
+	// ------ Const ------
+	static const MTypeId kTypeId;
+	static const MString kTypeName;
+
+	// ------ MPxNode ------
+	SchedulingType schedulingType() const override;
+	static MStatus initialize();
+	MStatus compute(const MPlug &plug, MDataBlock &dataBlock) override;
+
+	// ------ Attr ------
+	static MObject input1Attr;
+	static MObject input2Attr;
+	static MObject easingAttr;
+	static MObject tAttr;
+	static MObject outputAttr;
+
+private:
+	// ------ Data ------
+	std::vector<double> m_t;
+	std::vector<double> m_output;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
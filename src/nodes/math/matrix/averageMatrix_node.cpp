@@ -7,6 +7,7 @@ AverageMatrix::~AverageMatrix() {}
 
 // ------ Attr ------
 MObject AverageMatrix::inputAttr;
+MObject AverageMatrix::nlerpToleranceAttr;
 MObject AverageMatrix::outputAttr;
 
 // ------ MPxNode ------
@@ -21,12 +22,16 @@ MStatus AverageMatrix::initialize()
 	MMatrix output;
 
 	createMatrixDataArrayAttribute(inputAttr, "input", "input", input, kDefaultPreset | kKeyable);
+	createAngleAttribute(nlerpToleranceAttr, "nlerpTolerance", "nlerpTolerance", MAngle(0.0), kDefaultPreset | kKeyable);
+	setMin(nlerpToleranceAttr, MAngle(0.0));
 	createMatrixAttribute(outputAttr, "output", "output", output, kReadOnlyPreset);
 
 	addAttribute(inputAttr);
+	addAttribute(nlerpToleranceAttr);
 	addAttribute(outputAttr);
 
 	attributeAffects(inputAttr, outputAttr);
+	attributeAffects(nlerpToleranceAttr, outputAttr);
 
 	return MStatus::kSuccess;
 }
@@ -37,6 +42,7 @@ MStatus AverageMatrix::compute(const MPlug& plug, MDataBlock& dataBlock)
 		return MStatus::kUnknownParameter;
 
 	std::vector<MMatrix> inputs = inputMatrixDataArrayValue(dataBlock, inputAttr);
+	double nlerpTolerance = inputAngleValue(dataBlock, nlerpToleranceAttr).asRadians();
 	size_t count = inputs.size();
 
 	MMatrix average = MMatrix::identity;
@@ -46,11 +52,10 @@ MStatus AverageMatrix::compute(const MPlug& plug, MDataBlock& dataBlock)
 		m_rotation.resize(count);
 		m_scale.resize(count);
 
-		for (unsigned int i = 0; i < count; ++i)
-			MRS::decomposeMatrix(inputs[i], m_translation[i], m_rotation[i], m_scale[i]);
+		MRS::decomposeMatrixBatch(inputs.data(), (unsigned int)count, m_translation.data(), m_rotation.data(), m_scale.data());
 
 		MVector translationAverage = MRS::averageVector(m_translation);
-		MQuaternion rotationAverage = MRS::averageQuaternion(m_rotation);
+		MQuaternion rotationAverage = MRS::averageQuaternion(m_rotation, nlerpTolerance);
 		MVector scaleAverage = MRS::averageVector(m_scale);
 
 		average = MRS::composeMatrix(translationAverage, rotationAverage, scaleAverage);
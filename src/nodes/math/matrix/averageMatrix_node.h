@@ -1,5 +1,6 @@
 #pragma once
 
+#include <maya/MAngle.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MObject.h>
@@ -11,6 +12,7 @@
 #include <maya/MTypeId.h>
 #include <maya/MVector.h>
 
+#include "utils/matrix_batch_utils.h"
 #include "utils/matrix_utils.h"
 #include "utils/node_utils.h"
 #include "utils/quaternion_utils.h"
@@ -35,6 +37,7 @@ public:
 
 	// ------ Attr ------
 	static MObject inputAttr;
+	static MObject nlerpToleranceAttr;
 	static MObject outputAttr;
 
 private:
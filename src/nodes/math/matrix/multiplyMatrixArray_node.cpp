@@ -36,20 +36,24 @@ MStatus MultiplyMatrixArray::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MMatrix> inputs = inputMatrixDataArrayValue(dataBlock, inputAttr);
-	size_t count = inputs.size();
-
-	if (count == 0)
-		outputMatrixValue(dataBlock, outputAttr, MMatrix::identity);
-	else
+	MFnMatrixArrayData inputs;
+	inputMatrixDataArrayView(dataBlock, inputAttr, inputs);
+	unsigned int count = inputs.length();
+
+	// The product is accumulated serially, each chunk of inputs is staged contiguously so that it can be multiplied by the batch kernels
+	MMatrix output = MMatrix::identity;
+	MMatrix matrices[MRS::kMatrixBatchGrainSize];
+	for (unsigned int begin = 0; begin < count; begin += MRS::kMatrixBatchGrainSize)
 	{
-		MMatrix output = inputs[0];
-		for (unsigned int i = 1; i < count; ++i)
-			output *= inputs[i];
+		unsigned int end = std::min(count, begin + MRS::kMatrixBatchGrainSize);
+		for (unsigned int i = begin; i < end; ++i)
+			matrices[i - begin] = inputs[i];
 
-		outputMatrixValue(dataBlock, outputAttr, output);
+		MRS::multiplyMatrixSequence(matrices, end - begin, output);
 	}
 
+	outputMatrixValue(dataBlock, outputAttr, output);
+
 	return MStatus::kSuccess;
 }
 
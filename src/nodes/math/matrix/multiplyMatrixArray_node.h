@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
+
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPxNode.h>
@@ -10,6 +13,7 @@
 #include <maya/MString.h>
 #include <maya/MTypeId.h>
 
+#include "utils/matrix_batch_utils.h"
 #include "utils/node_utils.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -8,6 +8,7 @@ WeightedAverageMatrix::~WeightedAverageMatrix() {}
 // ------ Attr ------
 MObject WeightedAverageMatrix::inputAttr;
 MObject WeightedAverageMatrix::weightAttr;
+MObject WeightedAverageMatrix::nlerpToleranceAttr;
 MObject WeightedAverageMatrix::outputAttr;
 
 // ------ MPxNode ------
@@ -24,14 +25,18 @@ MStatus WeightedAverageMatrix::initialize()
 
 	createMatrixDataArrayAttribute(inputAttr, "input", "input", input, kDefaultPreset | kKeyable);
 	createDoubleDataArrayAttribute(weightAttr, "weight", "weight", weight, kDefaultPreset | kKeyable);
+	createAngleAttribute(nlerpToleranceAttr, "nlerpTolerance", "nlerpTolerance", MAngle(0.0), kDefaultPreset | kKeyable);
+	setMin(nlerpToleranceAttr, MAngle(0.0));
 	createMatrixAttribute(outputAttr, "output", "output", output, kReadOnlyPreset);
 
 	addAttribute(inputAttr);
 	addAttribute(weightAttr);
+	addAttribute(nlerpToleranceAttr);
 	addAttribute(outputAttr);
 
 	attributeAffects(inputAttr, outputAttr);
 	attributeAffects(weightAttr, outputAttr);
+	attributeAffects(nlerpToleranceAttr, outputAttr);
 
 	return MStatus::kSuccess;
 }
@@ -41,10 +46,13 @@ MStatus WeightedAverageMatrix::compute(const MPlug& plug, MDataBlock& dataBlock)
 	if (plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MMatrix> inputs = inputMatrixDataArrayValue(dataBlock, inputAttr);
-	std::vector<double> weights = inputDoubleDataArrayValue(dataBlock, weightAttr);
-	size_t count = inputs.size();
-	weights.resize(count, 1.0);
+	MFnMatrixArrayData inputs;
+	inputMatrixDataArrayView(dataBlock, inputAttr, inputs);
+	MFnDoubleArrayData weights;
+	inputDoubleDataArrayView(dataBlock, weightAttr, weights);
+	double nlerpTolerance = inputAngleValue(dataBlock, nlerpToleranceAttr).asRadians();
+	unsigned int count = inputs.length();
+	unsigned int weightCount = std::min(count, weights.length());
 
 	MMatrix average = MMatrix::identity;
 	if (count)
@@ -52,13 +60,25 @@ MStatus WeightedAverageMatrix::compute(const MPlug& plug, MDataBlock& dataBlock)
 		m_translation.resize(count);
 		m_rotation.resize(count);
 		m_scale.resize(count);
+		m_weights.resize(count);
+
+		// Each chunk of inputs is staged contiguously so that it can be decomposed by the batch kernels
+		MMatrix matrices[MRS::kMatrixBatchGrainSize];
+		for (unsigned int begin = 0; begin < count; begin += MRS::kMatrixBatchGrainSize)
+		{
+			unsigned int end = std::min(count, begin + MRS::kMatrixBatchGrainSize);
+			for (unsigned int i = begin; i < end; ++i)
+				matrices[i - begin] = inputs[i];
+
+			MRS::decomposeMatrixBatch(matrices, end - begin, &m_translation[begin], &m_rotation[begin], &m_scale[begin]);
+		}
 
 		for (unsigned int i = 0; i < count; ++i)
-			MRS::decomposeMatrix(inputs[i], m_translation[i], m_rotation[i], m_scale[i]);
+			m_weights[i] = i < weightCount ? weights[i] : 1.0;
 
-		MVector translationAverage = MRS::averageWeightedVector(m_translation, weights);
-		MQuaternion rotationAverage = MRS::averageWeightedQuaternion(m_rotation, weights);
-		MVector scaleAverage = MRS::averageWeightedVector(m_scale, weights);
+		MVector translationAverage = MRS::averageWeightedVector(m_translation, m_weights);
+		MQuaternion rotationAverage = MRS::averageWeightedQuaternion(m_rotation, m_weights, nlerpTolerance);
+		MVector scaleAverage = MRS::averageWeightedVector(m_scale, m_weights);
 
 		average = MRS::composeMatrix(translationAverage, rotationAverage, scaleAverage);
 	}
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <algorithm>
+
+#include <maya/MAngle.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MMatrixArray.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPxNode.h>
@@ -11,6 +16,7 @@
 #include <maya/MTypeId.h>
 #include <maya/MVector.h>
 
+#include "utils/matrix_batch_utils.h"
 #include "utils/matrix_utils.h"
 #include "utils/node_utils.h"
 #include "utils/quaternion_utils.h"
@@ -36,6 +42,7 @@ public:
 	// ------ Attr ------
 	static MObject inputAttr;
 	static MObject weightAttr;
+	static MObject nlerpToleranceAttr;
 	static MObject outputAttr;
 
 private:
@@ -43,6 +50,7 @@ private:
 	std::vector<MVector> m_translation;
 	std::vector<MQuaternion> m_rotation;
 	std::vector<MVector> m_scale;
+	std::vector<double> m_weights;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -75,6 +75,8 @@
 #include "euler/divideEuler_node.h"
 #include "euler/multiplyEuler_node.h"
 #include "euler/weightedAverageEuler_node.h"
+#include "expression/fusedExpression_node.h"
+#include "interpolate/easeArray_node.h"
 #include "interpolate/lerp_node.h"
 #include "interpolate/lerpAngle_node.h"
 #include "interpolate/lerpMatrix_node.h"
@@ -143,14 +145,23 @@
 #include "round/round_node.h"
 #include "round/roundAngle_node.h"
 #include "trigonometry/acos_node.h"
+#include "trigonometry/acosArray_node.h"
 #include "trigonometry/asin_node.h"
+#include "trigonometry/asinArray_node.h"
 #include "trigonometry/atan_node.h"
+#include "trigonometry/atanArray_node.h"
 #include "trigonometry/atan2_node.h"
+#include "trigonometry/atan2Array_node.h"
 #include "trigonometry/cartesianToPolar_node.h"
+#include "trigonometry/cartesianToPolarArray_node.h"
 #include "trigonometry/cos_node.h"
+#include "trigonometry/cosArray_node.h"
 #include "trigonometry/polarToCartesian_node.h"
+#include "trigonometry/polarToCartesianArray_node.h"
 #include "trigonometry/sin_node.h"
+#include "trigonometry/sinArray_node.h"
 #include "trigonometry/tan_node.h"
+#include "trigonometry/tanArray_node.h"
 #include "vector/addVector_node.h"
 #include "vector/angleBetweenVectors_node.h"
 #include "vector/averageVector_node.h"
@@ -410,6 +421,27 @@ const MTypeId PolarToCartesian::kTypeId = 0x001310df;
 // Project Block11 IDs : [0x001310e0 - 0x001310ef]
 const MTypeId CartesianToPolar::kTypeId = 0x001310e0;
 
+// |---------|
+// |  1.2.0  |
+// |---------|
+
+// ------ EXPRESSION ------
+const MTypeId FusedExpression::kTypeId = 0x001310e1;
+
+// ------ INTERPOLATION ------
+const MTypeId EaseArray::kTypeId = 0x001310e2;
+
+// ------ TRIGONOMETRY ------
+const MTypeId AcosArray::kTypeId = 0x001310e3;
+const MTypeId AsinArray::kTypeId = 0x001310e4;
+const MTypeId AtanArray::kTypeId = 0x001310e5;
+const MTypeId Atan2Array::kTypeId = 0x001310e6;
+const MTypeId CartesianToPolarArray::kTypeId = 0x001310e7;
+const MTypeId CosArray::kTypeId = 0x001310e8;
+const MTypeId PolarToCartesianArray::kTypeId = 0x001310e9;
+const MTypeId SinArray::kTypeId = 0x001310ea;
+const MTypeId TanArray::kTypeId = 0x001310eb;
+
 
 // ------ kTypeName ---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -497,6 +529,7 @@ const MString MultiplyEuler::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "MultiplyEul
 const MString WeightedAverageEuler::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "WeightedAverageEuler";
 
 // ------ INTERPOLATE ------
+const MString EaseArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "EaseArray";
 const MString Lerp::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Lerp";
 const MString LerpAngle::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "LerpAngle";
 const MString LerpMatrix::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "LerpMatrix";
@@ -579,14 +612,23 @@ const MString RoundAngle::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "RoundAngle";
 
 // ------ TRIGONOMETRY ------
 const MString Acos::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Acos";
+const MString AcosArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "AcosArray";
 const MString Asin::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Asin";
+const MString AsinArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "AsinArray";
 const MString Atan::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Atan";
+const MString AtanArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "AtanArray";
 const MString Atan2::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Atan2";
+const MString Atan2Array::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Atan2Array";
 const MString CartesianToPolar::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "CartesianToPolar";
+const MString CartesianToPolarArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "CartesianToPolarArray";
 const MString Cos::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Cos";
+const MString CosArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "CosArray";
 const MString PolarToCartesian::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "PolarToCartesian";
+const MString PolarToCartesianArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "PolarToCartesianArray";
 const MString Sin::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Sin";
+const MString SinArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "SinArray";
 const MString Tan::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Tan";
+const MString TanArray::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "TanArray";
 
 // ------ VECTOR ------
 const MString AddVector::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "AddVector";
@@ -616,6 +658,13 @@ const MString WeightedAverageVector::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "Wei
 const MString AngleBetweenVectors::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "AngleBetweenVectors";
 const MString SignedAngleBetweenVectors::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "SignedAngleBetweenVectors";
 
+// ------ EXPRESSION ------
+const MString FusedExpression::kTypeName = MRS_XSTR(NODE_NAME_PREFIX) "FusedExpression";
+
+// ------ kCommandName ------------------------------------------------------------------------------------------------------------------------------------------------------
+
+const MString FusedExpression_CollapseCommand::kCommandName = "FusedExpressionCollapse";
+
 
 // ------ Exports -----------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -862,7 +911,14 @@ MStatus initializePlugin(MObject plugin)
 	errorMessage.format(kErrorInvalidPluginId, WeightedAverageEuler::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(WeightedAverageEuler::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	// ------ EXPRESSION ------
+	errorMessage.format(kErrorInvalidPluginId, FusedExpression::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(FusedExpression::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	// ------ INTERPOLATE ------
+	errorMessage.format(kErrorInvalidPluginId, EaseArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(EaseArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Lerp::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Lerp::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
@@ -1074,30 +1130,57 @@ MStatus initializePlugin(MObject plugin)
 	errorMessage.format(kErrorInvalidPluginId, Acos::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Acos::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, AcosArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(AcosArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Asin::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Asin::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, AsinArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(AsinArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Atan::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Atan::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, AtanArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(AtanArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Atan2::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Atan2::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, Atan2Array::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Atan2Array::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, CartesianToPolar::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(CartesianToPolar::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, CartesianToPolarArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(CartesianToPolarArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Cos::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Cos::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, CosArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(CosArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, PolarToCartesian::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(PolarToCartesian::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, PolarToCartesianArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(PolarToCartesianArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Sin::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Sin::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, SinArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(SinArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	errorMessage.format(kErrorInvalidPluginId, Tan::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(Tan::kTypeId, PROJECT_ID_CACHE), errorMessage);
 
+	errorMessage.format(kErrorInvalidPluginId, TanArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(TanArray::kTypeId, PROJECT_ID_CACHE), errorMessage);
+
 	// ------ VECTOR ------
 	errorMessage.format(kErrorInvalidPluginId, AddVector::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::validateId(AddVector::kTypeId, PROJECT_ID_CACHE), errorMessage);
@@ -1410,7 +1493,17 @@ MStatus initializePlugin(MObject plugin)
 	errorMessage.format(kErrorPluginRegistration, WeightedAverageEuler::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<WeightedAverageEuler>(fnPlugin), errorMessage);
 
+	// ------ EXPRESSION ------
+	errorMessage.format(kErrorPluginRegistration, FusedExpression::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<FusedExpression>(fnPlugin), errorMessage);
+
+	errorMessage.format(kErrorPluginRegistration, FusedExpression_CollapseCommand::kCommandName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerCommand<FusedExpression_CollapseCommand>(fnPlugin, true /* syntax */), errorMessage);
+
 	// ------ INTERPOLATE ------
+	errorMessage.format(kErrorPluginRegistration, EaseArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<EaseArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Lerp::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Lerp>(fnPlugin), errorMessage);
 
@@ -1622,30 +1715,57 @@ MStatus initializePlugin(MObject plugin)
 	errorMessage.format(kErrorPluginRegistration, Acos::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Acos>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, AcosArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<AcosArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Asin::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Asin>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, AsinArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<AsinArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Atan::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Atan>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, AtanArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<AtanArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Atan2::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Atan2>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, Atan2Array::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Atan2Array>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, CartesianToPolar::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<CartesianToPolar>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, CartesianToPolarArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<CartesianToPolarArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Cos::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Cos>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, CosArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<CosArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, PolarToCartesian::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<PolarToCartesian>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, PolarToCartesianArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<PolarToCartesianArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Sin::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Sin>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, SinArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<SinArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginRegistration, Tan::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<Tan>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginRegistration, TanArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<TanArray>(fnPlugin), errorMessage);
+
 	// ------ VECTOR ------
 	errorMessage.format(kErrorPluginRegistration, AddVector::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::registerNode<AddVector>(fnPlugin), errorMessage);
@@ -1967,7 +2087,17 @@ MStatus uninitializePlugin(MObject plugin)
 	errorMessage.format(kErrorPluginDeregistration, WeightedAverageEuler::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<WeightedAverageEuler>(fnPlugin), errorMessage);
 
+	// ------ EXPRESSION ------
+	errorMessage.format(kErrorPluginDeregistration, FusedExpression_CollapseCommand::kCommandName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterCommand<FusedExpression_CollapseCommand>(fnPlugin), errorMessage);
+
+	errorMessage.format(kErrorPluginDeregistration, FusedExpression::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<FusedExpression>(fnPlugin), errorMessage);
+
 	// ------ INTERPOLATE ------
+	errorMessage.format(kErrorPluginDeregistration, EaseArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<EaseArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Lerp::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Lerp>(fnPlugin), errorMessage);
 
@@ -2179,30 +2309,57 @@ MStatus uninitializePlugin(MObject plugin)
 	errorMessage.format(kErrorPluginDeregistration, Acos::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Acos>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, AcosArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<AcosArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Asin::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Asin>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, AsinArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<AsinArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Atan::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Atan>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, AtanArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<AtanArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Atan2::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Atan2>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, Atan2Array::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Atan2Array>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, CartesianToPolar::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<CartesianToPolar>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, CartesianToPolarArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<CartesianToPolarArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Cos::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Cos>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, CosArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<CosArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, PolarToCartesian::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<PolarToCartesian>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, PolarToCartesianArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<PolarToCartesianArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Sin::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Sin>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, SinArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<SinArray>(fnPlugin), errorMessage);
+
 	errorMessage.format(kErrorPluginDeregistration, Tan::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<Tan>(fnPlugin), errorMessage);
 
+	errorMessage.format(kErrorPluginDeregistration, TanArray::kTypeName);
+	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<TanArray>(fnPlugin), errorMessage);
+
 	// ------ VECTOR ------
 	errorMessage.format(kErrorPluginDeregistration, AddVector::kTypeName);
 	MRS_CHECK_ERROR_RETURN_MSTATUS(MRS::deregisterNode<AddVector>(fnPlugin), errorMessage);
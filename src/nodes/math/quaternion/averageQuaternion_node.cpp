@@ -7,6 +7,7 @@ AverageQuaternion::~AverageQuaternion() {}
 
 // ------ Attr ------
 MObject AverageQuaternion::inputAttr;
+MObject AverageQuaternion::nlerpToleranceAttr;
 MObject AverageQuaternion::outputAttr;
 MObject AverageQuaternion::outputXAttr;
 MObject AverageQuaternion::outputYAttr;
@@ -25,12 +26,16 @@ MStatus AverageQuaternion::initialize()
 	MQuaternion output;
 
 	createPluginDataArrayAttribute<QuaternionArrayData, MQuaternion>(inputAttr, "input", "input", inputs, kDefaultPreset | kKeyable);
+	createAngleAttribute(nlerpToleranceAttr, "nlerpTolerance", "nlerpTolerance", MAngle(0.0), kDefaultPreset | kKeyable);
+	setMin(nlerpToleranceAttr, MAngle(0.0));
 	createQuaternionAttribute(outputAttr, outputXAttr, outputYAttr, outputZAttr, outputWAttr, "output", "output", output, kReadOnlyPreset);
 
 	addAttribute(inputAttr);
+	addAttribute(nlerpToleranceAttr);
 	addAttribute(outputAttr);
 
 	attributeAffects(inputAttr, outputAttr);
+	attributeAffects(nlerpToleranceAttr, outputAttr);
 
 	return MStatus::kSuccess;
 }
@@ -41,8 +46,9 @@ MStatus AverageQuaternion::compute(const MPlug& plug, MDataBlock& dataBlock)
 		return MStatus::kUnknownParameter;
 
 	std::vector<MQuaternion> inputs = inputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, inputAttr);
+	double nlerpTolerance = inputAngleValue(dataBlock, nlerpToleranceAttr).asRadians();
 
-	outputQuaternionValue(dataBlock, outputAttr, outputXAttr, outputYAttr, outputZAttr, outputWAttr, MRS::averageQuaternion(inputs));
+	outputQuaternionValue(dataBlock, outputAttr, outputXAttr, outputYAttr, outputZAttr, outputWAttr, MRS::averageQuaternion(inputs, nlerpTolerance));
 
 	return MStatus::kSuccess;
 }
@@ -40,8 +40,8 @@ MStatus MultiplyQuaternionArray::compute(const MPlug& plug, MDataBlock& dataBloc
 	if (plug != outputXAttr && plug != outputYAttr && plug != outputZAttr && plug != outputWAttr && plug != outputAttr)
 		return MStatus::kUnknownParameter;
 
-	std::vector<MQuaternion> inputs = inputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, inputAttr);
-	size_t count = inputs.size();
+	MRS::DataArrayView<QuaternionArrayData> inputs = inputPluginDataArrayView<QuaternionArrayData>(dataBlock, inputAttr);
+	unsigned int count = inputs.length();
 
 	MQuaternion qAverage = MQuaternion::identity;
 	if (count)
@@ -8,6 +8,7 @@ WeightedAverageQuaternion::~WeightedAverageQuaternion() {}
 // ------ Attr ------
 MObject WeightedAverageQuaternion::inputAttr;
 MObject WeightedAverageQuaternion::weightAttr;
+MObject WeightedAverageQuaternion::nlerpToleranceAttr;
 MObject WeightedAverageQuaternion::outputAttr;
 MObject WeightedAverageQuaternion::outputXAttr;
 MObject WeightedAverageQuaternion::outputYAttr;
@@ -28,14 +29,18 @@ MStatus WeightedAverageQuaternion::initialize()
 
 	createPluginDataArrayAttribute<QuaternionArrayData, MQuaternion>(inputAttr, "input", "input", inputs, kDefaultPreset | kKeyable);
 	createDoubleDataArrayAttribute(weightAttr, "weight", "weight", weights, kDefaultPreset | kKeyable);
+	createAngleAttribute(nlerpToleranceAttr, "nlerpTolerance", "nlerpTolerance", MAngle(0.0), kDefaultPreset | kKeyable);
+	setMin(nlerpToleranceAttr, MAngle(0.0));
 	createQuaternionAttribute(outputAttr, outputXAttr, outputYAttr, outputZAttr, outputWAttr, "output", "output", output, kReadOnlyPreset);
 
 	addAttribute(inputAttr);
 	addAttribute(weightAttr);
+	addAttribute(nlerpToleranceAttr);
 	addAttribute(outputAttr);
 
 	attributeAffects(inputAttr, outputAttr);
 	attributeAffects(weightAttr, outputAttr);
+	attributeAffects(nlerpToleranceAttr, outputAttr);
 
 	return MStatus::kSuccess;
 }
@@ -47,10 +52,11 @@ MStatus WeightedAverageQuaternion::compute(const MPlug& plug, MDataBlock& dataBl
 
 	std::vector<MQuaternion> inputs = inputPluginDataArrayValue<QuaternionArrayData, MQuaternion>(dataBlock, inputAttr);
 	std::vector<double> weights = inputDoubleDataArrayValue(dataBlock, weightAttr);
+	double nlerpTolerance = inputAngleValue(dataBlock, nlerpToleranceAttr).asRadians();
 	size_t count = inputs.size();
 	weights.resize(count, 1.0);
 
-	outputQuaternionValue(dataBlock, outputAttr, outputXAttr, outputYAttr, outputZAttr, outputWAttr, MRS::averageWeightedQuaternion(inputs, weights));
+	outputQuaternionValue(dataBlock, outputAttr, outputXAttr, outputYAttr, outputZAttr, outputWAttr, MRS::averageWeightedQuaternion(inputs, weights, nlerpTolerance));
 
 	return MStatus::kSuccess;
 }
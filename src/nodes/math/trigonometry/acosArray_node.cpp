@@ -0,0 +1,59 @@
+#include "acosArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+AcosArray::AcosArray() {}
+AcosArray::~AcosArray() {}
+
+// ------ Attr ------
+MObject AcosArray::inputAttr;
+MObject AcosArray::outputAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType AcosArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus AcosArray::initialize()
+{
+	std::vector<double> doubleArray;
+	std::vector<MAngle> angleArray;
+
+	createDoubleDataArrayAttribute(inputAttr, "input", "input", doubleArray, kDefaultPreset | kKeyable);
+	createPluginDataArrayAttribute<AngleArrayData, MAngle>(outputAttr, "output", "output", angleArray, kReadOnlyPreset);
+
+	addAttribute(inputAttr);
+	addAttribute(outputAttr);
+
+	attributeAffects(inputAttr, outputAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus AcosArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAttr)
+		return MStatus::kUnknownParameter;
+
+	// The inputs are copied on this thread as the data function sets must not be accessed by the workers
+	inputDoubleDataArrayValue(dataBlock, inputAttr, m_input);
+	unsigned int count = (unsigned int)m_input.size();
+
+	// Angles are stored in radians and are written by the kernel directly
+	double* angles = outputPluginDataArrayView<AngleArrayData>(dataBlock, outputAttr, count);
+
+	MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		double values[MRS::kSimdMathGrainSize];
+		// Values are clamped to the domain, as per the limits of the single value node
+		for (unsigned int i = begin; i < end; ++i)
+			values[i - begin] = MRS::clamp(m_input[i], -1.0, 1.0);
+
+		MRS::acosArray(values, end - begin, angles + begin);
+	});
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
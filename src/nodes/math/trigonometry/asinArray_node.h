@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+
+#include <maya/MAngle.h>
+#include <maya/MDataBlock.h>
+#include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MObject.h>
+#include <maya/MPlug.h>
+#include <maya/MPxNode.h>
+#include <maya/MStatus.h>
+#include <maya/MString.h>
+#include <maya/MTypeId.h>
+
+#include "data/angleArray_data.h"
+#include "utils/math_utils.h"
+#include "utils/node_utils.h"
+#include "utils/simd_math_utils.h"
+#include "utils/thread_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+class AsinArray : public MPxNode, MRS::NodeHelper
+{
+public:
+	AsinArray();
+	~AsinArray();
+
+	// ------ Const ------
+	static const MTypeId kTypeId;
+	static const MString kTypeName;
+
+	// ------ MPxNode ------
+	SchedulingType schedulingType() const override;
+	static MStatus initialize();
+	MStatus compute(const MPlug &plug, MDataBlock &dataBlock) override;
+
+	// ------ Attr ------
+	static MObject inputAttr;
+	static MObject outputAttr;
+
+private:
+	// ------ Data ------
+	std::vector<double> m_input;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
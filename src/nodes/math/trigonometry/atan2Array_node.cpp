@@ -0,0 +1,68 @@
+#include "atan2Array_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+Atan2Array::Atan2Array() {}
+Atan2Array::~Atan2Array() {}
+
+// ------ Attr ------
+MObject Atan2Array::yAttr;
+MObject Atan2Array::xAttr;
+MObject Atan2Array::outputAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType Atan2Array::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus Atan2Array::initialize()
+{
+	std::vector<double> doubleArray;
+	std::vector<MAngle> angleArray;
+
+	createDoubleDataArrayAttribute(yAttr, "y", "y", doubleArray, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(xAttr, "x", "x", doubleArray, kDefaultPreset | kKeyable);
+	createPluginDataArrayAttribute<AngleArrayData, MAngle>(outputAttr, "output", "output", angleArray, kReadOnlyPreset);
+
+	addAttribute(yAttr);
+	addAttribute(xAttr);
+	addAttribute(outputAttr);
+
+	attributeAffects(yAttr, outputAttr);
+	attributeAffects(xAttr, outputAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus Atan2Array::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAttr)
+		return MStatus::kUnknownParameter;
+
+	// The inputs are copied on this thread as the data function sets must not be accessed by the workers
+	inputDoubleDataArrayValue(dataBlock, yAttr, m_y);
+	inputDoubleDataArrayValue(dataBlock, xAttr, m_x);
+	// Surplus elements of the longer array are ignored
+	unsigned int count = (unsigned int)std::min(m_y.size(), m_x.size());
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		if (MRS::isEqual(m_y[i], 0.0) && MRS::isEqual(m_x[i], 0.0))
+		{
+			MGlobal::displayError("Domain error: x and y coordinates cannot both equal 0 as proportion y/x is undefined.");
+			return MStatus::kFailure;
+		}
+	}
+
+	double* angles = outputPluginDataArrayView<AngleArrayData>(dataBlock, outputAttr, count);
+
+	MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		MRS::atan2Array(&m_y[begin], &m_x[begin], end - begin, angles + begin);
+	});
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "atanArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+AtanArray::AtanArray() {}
+AtanArray::~AtanArray() {}
+
+// ------ Attr ------
+MObject AtanArray::inputAttr;
+MObject AtanArray::outputAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType AtanArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus AtanArray::initialize()
+{
+	std::vector<double> doubleArray;
+	std::vector<MAngle> angleArray;
+
+	createDoubleDataArrayAttribute(inputAttr, "input", "input", doubleArray, kDefaultPreset | kKeyable);
+	createPluginDataArrayAttribute<AngleArrayData, MAngle>(outputAttr, "output", "output", angleArray, kReadOnlyPreset);
+
+	addAttribute(inputAttr);
+	addAttribute(outputAttr);
+
+	attributeAffects(inputAttr, outputAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus AtanArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAttr)
+		return MStatus::kUnknownParameter;
+
+	// The inputs are copied on this thread as the data function sets must not be accessed by the workers
+	inputDoubleDataArrayValue(dataBlock, inputAttr, m_input);
+	unsigned int count = (unsigned int)m_input.size();
+
+	// Angles are stored in radians and are written by the kernel directly
+	double* angles = outputPluginDataArrayView<AngleArrayData>(dataBlock, outputAttr, count);
+
+	MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		MRS::atanArray(&m_input[begin], end - begin, angles + begin);
+	});
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
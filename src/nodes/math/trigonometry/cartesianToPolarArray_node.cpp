@@ -0,0 +1,88 @@
+#include "cartesianToPolarArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianToPolarArray::CartesianToPolarArray() {}
+CartesianToPolarArray::~CartesianToPolarArray() {}
+
+// ------ Attr ------
+MObject CartesianToPolarArray::xAttr;
+MObject CartesianToPolarArray::yAttr;
+MObject CartesianToPolarArray::outputAngleAttr;
+MObject CartesianToPolarArray::outputRadiusAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType CartesianToPolarArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus CartesianToPolarArray::initialize()
+{
+	std::vector<double> doubleArray;
+	std::vector<MAngle> angleArray;
+
+	createDoubleDataArrayAttribute(xAttr, "x", "x", doubleArray, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(yAttr, "y", "y", doubleArray, kDefaultPreset | kKeyable);
+	createPluginDataArrayAttribute<AngleArrayData, MAngle>(outputAngleAttr, "outputAngle", "outputAngle", angleArray, kReadOnlyPreset);
+	createDoubleDataArrayAttribute(outputRadiusAttr, "outputRadius", "outputRadius", doubleArray, kReadOnlyPreset);
+
+	addAttribute(xAttr);
+	addAttribute(yAttr);
+	addAttribute(outputAngleAttr);
+	addAttribute(outputRadiusAttr);
+
+	attributeAffects(xAttr, outputAngleAttr);
+	attributeAffects(yAttr, outputAngleAttr);
+	attributeAffects(xAttr, outputRadiusAttr);
+	attributeAffects(yAttr, outputRadiusAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus CartesianToPolarArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAngleAttr && plug != outputRadiusAttr)
+		return MStatus::kUnknownParameter;
+
+	// The inputs are copied on this thread as the data function sets must not be accessed by the workers
+	inputDoubleDataArrayValue(dataBlock, xAttr, m_x);
+	inputDoubleDataArrayValue(dataBlock, yAttr, m_y);
+	// Surplus elements of the longer array are ignored
+	unsigned int count = (unsigned int)std::min(m_x.size(), m_y.size());
+
+	if (plug == outputAngleAttr)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			if (MRS::isEqual(m_y[i], 0.0) && MRS::isEqual(m_x[i], 0.0))
+			{
+				MGlobal::displayError("Domain error: x and y coordinates cannot both equal 0 as proportion y/x is undefined.");
+				return MStatus::kFailure;
+			}
+		}
+
+		double* angles = outputPluginDataArrayView<AngleArrayData>(dataBlock, outputAngleAttr, count);
+
+		MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+		{
+			MRS::atan2Array(&m_y[begin], &m_x[begin], end - begin, angles + begin);
+		});
+	}
+	else
+	{
+		m_radius.resize(count);
+
+		MRS::parallelFor(0, count, MRS::kDefaultGrainSize, [&](unsigned int begin, unsigned int end)
+		{
+			for (unsigned int i = begin; i < end; ++i)
+				m_radius[i] = std::sqrt(m_x[i] * m_x[i] + m_y[i] * m_y[i]);
+		});
+
+		outputDoubleDataArrayValue(dataBlock, outputRadiusAttr, m_radius);
+	}
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
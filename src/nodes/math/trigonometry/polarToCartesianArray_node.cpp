@@ -0,0 +1,78 @@
+#include "polarToCartesianArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+PolarToCartesianArray::PolarToCartesianArray() {}
+PolarToCartesianArray::~PolarToCartesianArray() {}
+
+// ------ Attr ------
+MObject PolarToCartesianArray::angleAttr;
+MObject PolarToCartesianArray::radiusAttr;
+MObject PolarToCartesianArray::outputXAttr;
+MObject PolarToCartesianArray::outputYAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType PolarToCartesianArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus PolarToCartesianArray::initialize()
+{
+	std::vector<MAngle> angleArray;
+	std::vector<double> doubleArray;
+
+	createPluginDataArrayAttribute<AngleArrayData, MAngle>(angleAttr, "angle", "angle", angleArray, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(radiusAttr, "radius", "radius", doubleArray, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(outputXAttr, "outputX", "outputX", doubleArray, kReadOnlyPreset);
+	createDoubleDataArrayAttribute(outputYAttr, "outputY", "outputY", doubleArray, kReadOnlyPreset);
+
+	addAttribute(angleAttr);
+	addAttribute(radiusAttr);
+	addAttribute(outputXAttr);
+	addAttribute(outputYAttr);
+
+	attributeAffects(angleAttr, outputXAttr);
+	attributeAffects(radiusAttr, outputXAttr);
+	attributeAffects(angleAttr, outputYAttr);
+	attributeAffects(radiusAttr, outputYAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus PolarToCartesianArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputXAttr && plug != outputYAttr)
+		return MStatus::kUnknownParameter;
+
+	MRS::DataArrayView<AngleArrayData> angleValues = inputPluginDataArrayView<AngleArrayData>(dataBlock, angleAttr);
+	const double* angles = angleValues.values();
+	// The radii are copied on this thread as the data function sets must not be accessed by the workers
+	inputDoubleDataArrayValue(dataBlock, radiusAttr, m_radius);
+	// Surplus elements of the longer array are ignored
+	unsigned int count = std::min(angleValues.length(), (unsigned int)m_radius.size());
+
+	// Both outputs are computed together as the sine and cosine share a single argument reduction
+	m_outputX.resize(count);
+	m_outputY.resize(count);
+
+	MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		double sinValues[MRS::kSimdMathGrainSize];
+		double cosValues[MRS::kSimdMathGrainSize];
+		MRS::sinCosArray(angles + begin, end - begin, sinValues, cosValues);
+
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			m_outputX[i] = cosValues[i - begin] * m_radius[i];
+			m_outputY[i] = sinValues[i - begin] * m_radius[i];
+		}
+	});
+
+	outputDoubleDataArrayValue(dataBlock, outputXAttr, m_outputX);
+	outputDoubleDataArrayValue(dataBlock, outputYAttr, m_outputY);
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
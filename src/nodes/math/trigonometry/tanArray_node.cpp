@@ -0,0 +1,57 @@
+#include "tanArray_node.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+TanArray::TanArray() {}
+TanArray::~TanArray() {}
+
+// ------ Attr ------
+MObject TanArray::inputAttr;
+MObject TanArray::outputAttr;
+
+// ------ MPxNode ------
+MPxNode::SchedulingType TanArray::schedulingType() const
+{
+	return SchedulingType::kParallel;
+}
+
+MStatus TanArray::initialize()
+{
+	std::vector<MAngle> angleArray;
+	std::vector<double> doubleArray;
+
+	createPluginDataArrayAttribute<AngleArrayData, MAngle>(inputAttr, "input", "input", angleArray, kDefaultPreset | kKeyable);
+	createDoubleDataArrayAttribute(outputAttr, "output", "output", doubleArray, kReadOnlyPreset);
+
+	addAttribute(inputAttr);
+	addAttribute(outputAttr);
+
+	attributeAffects(inputAttr, outputAttr);
+
+	return MStatus::kSuccess;
+}
+
+MStatus TanArray::compute(const MPlug& plug, MDataBlock& dataBlock)
+{
+	if (plug != outputAttr)
+		return MStatus::kUnknownParameter;
+
+	// Angles are stored in radians and are passed to the kernel directly
+	MRS::DataArrayView<AngleArrayData> inputs = inputPluginDataArrayView<AngleArrayData>(dataBlock, inputAttr);
+	const double* angles = inputs.values();
+	unsigned int count = inputs.length();
+
+	// Results are written to the node buffer by the workers and given to the output on this thread
+	m_output.resize(count);
+
+	MRS::parallelFor(0, count, MRS::kSimdMathGrainSize, [&](unsigned int begin, unsigned int end)
+	{
+		MRS::tanArray(angles + begin, end - begin, &m_output[begin]);
+	});
+
+	outputDoubleDataArrayValue(dataBlock, outputAttr, m_output);
+
+	return MStatus::kSuccess;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -13,44 +13,195 @@ namespace MRS {
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 // ------ Helpers ------
+// Values are parsed once directly from the character buffer, the entire string must be consumed for the parse to succeed
 MStatus parseMString(const MString& str, short& outValue)
 {
-	if (str.isShort())
-	{
-		outValue = str.asShort();
-		return MStatus::kSuccess;
-	}
-	return MStatus::kFailure;
+	const char* begin = str.asChar();
+	char* end;
+	errno = 0;
+	long value = std::strtol(begin, &end, 10);
+	if (end == begin || *end != '\0' || errno == ERANGE || value < SHRT_MIN || value > SHRT_MAX)
+		return MStatus::kFailure;
+
+	outValue = (short)value;
+	return MStatus::kSuccess;
 }
 
 MStatus parseMString(const MString& str, int& outValue)
 {
-	if (str.isInt())
-	{
-		outValue = str.asInt();
-		return MStatus::kSuccess;
-	}
-	return MStatus::kFailure;
+	const char* begin = str.asChar();
+	char* end;
+	errno = 0;
+	long value = std::strtol(begin, &end, 10);
+	if (end == begin || *end != '\0' || errno == ERANGE || value < INT_MIN || value > INT_MAX)
+		return MStatus::kFailure;
+
+	outValue = (int)value;
+	return MStatus::kSuccess;
 }
 
 MStatus parseMString(const MString& str, float& outValue)
 {
-	if (str.isFloat())
+	const char* begin = str.asChar();
+	char* end;
+	float value = std::strtof(begin, &end);
+	if (end == begin || *end != '\0')
+		return MStatus::kFailure;
+
+	outValue = value;
+	return MStatus::kSuccess;
+}
+
+MStatus parseMString(const MString& str, double& outValue)
+{
+	const char* begin = str.asChar();
+	char* end;
+	double value = std::strtod(begin, &end);
+	if (end == begin || *end != '\0')
+		return MStatus::kFailure;
+
+	outValue = value;
+	return MStatus::kSuccess;
+}
+
+// Integers are written in full, floating point values match the default formatting of the stream (ie. %g with the stream precision)
+int formatValue(char* buffer, size_t bufferSize, short value, int precision)
+{
+	(void)precision;
+	return std::snprintf(buffer, bufferSize, "%d ", (int)value);
+}
+
+int formatValue(char* buffer, size_t bufferSize, int value, int precision)
+{
+	(void)precision;
+	return std::snprintf(buffer, bufferSize, "%d ", value);
+}
+
+int formatValue(char* buffer, size_t bufferSize, float value, int precision)
+{
+	return std::snprintf(buffer, bufferSize, "%.*g ", precision, (double)value);
+}
+
+int formatValue(char* buffer, size_t bufferSize, double value, int precision)
+{
+	return std::snprintf(buffer, bufferSize, "%.*g ", precision, value);
+}
+
+bool isLittleEndian()
+{
+	const uint16_t probe = 1;
+	return *(const uint8_t*)&probe == 1;
+}
+
+void swapByteOrder(char* data, size_t valueCount, size_t valueSize)
+{
+	for (size_t i = 0; i < valueCount; ++i)
+		std::reverse(data + i * valueSize, data + (i + 1) * valueSize);
+}
+
+/*	Description
+	-----------
+	Bytes of equal significance are grouped across all values so that the slowly changing high order bytes form long runs
+	The grouped bytes are then run length encoded using control bytes in the style of PackBits
+	- A control byte c < 128 is followed by c + 1 literal bytes
+	- A control byte c >= 128 is followed by a single byte which is repeated c - 125 times (ie. runs of 3 to 130 bytes)    */
+void encodeShuffledRunLength(const char* data, size_t valueCount, size_t valueSize, std::vector<char>& outEncoded)
+{
+	const size_t kMaxLiteral = 128;
+	const size_t kMinRun = 3;
+	const size_t kMaxRun = 130;
+
+	size_t totalSize = valueCount * valueSize;
+	outEncoded.clear();
+	outEncoded.reserve(totalSize + totalSize / kMaxLiteral + 1);
+
+	std::vector<char> shuffled(totalSize);
+	for (size_t b = 0; b < valueSize; ++b)
+	{
+		char* plane = shuffled.data() + b * valueCount;
+		for (size_t i = 0; i < valueCount; ++i)
+			plane[i] = data[i * valueSize + b];
+	}
+
+	size_t i = 0;
+	size_t literalBegin = 0;
+	while (i < totalSize)
+	{
+		size_t run = 1;
+		while (i + run < totalSize && run < kMaxRun && shuffled[i + run] == shuffled[i])
+			++run;
+
+		if (run >= kMinRun)
+		{
+			// Flush pending literals before the run
+			while (literalBegin < i)
+			{
+				size_t count = std::min(kMaxLiteral, i - literalBegin);
+				outEncoded.push_back((char)(count - 1));
+				outEncoded.insert(outEncoded.end(), shuffled.begin() + literalBegin, shuffled.begin() + literalBegin + count);
+				literalBegin += count;
+			}
+
+			outEncoded.push_back((char)(run + 125));
+			outEncoded.push_back(shuffled[i]);
+			i += run;
+			literalBegin = i;
+		}
+		else
+			i += run;
+	}
+
+	while (literalBegin < totalSize)
 	{
-		outValue = str.asFloat();
-		return MStatus::kSuccess;
+		size_t count = std::min(kMaxLiteral, totalSize - literalBegin);
+		outEncoded.push_back((char)(count - 1));
+		outEncoded.insert(outEncoded.end(), shuffled.begin() + literalBegin, shuffled.begin() + literalBegin + count);
+		literalBegin += count;
 	}
-	return MStatus::kFailure;
 }
 
-MStatus parseMString(const MString& str, double& outValue)
+bool decodeShuffledRunLength(const char* encoded, size_t encodedSize, size_t valueCount, size_t valueSize, char* outData)
 {
-	if (str.isDouble())
+	size_t totalSize = valueCount * valueSize;
+	std::vector<char> shuffled(totalSize);
+
+	size_t in = 0;
+	size_t out = 0;
+	while (in < encodedSize)
 	{
-		outValue = str.asDouble();
-		return MStatus::kSuccess;
+		unsigned int control = (unsigned char)encoded[in++];
+		if (control < 128)
+		{
+			size_t count = control + 1;
+			if (in + count > encodedSize || out + count > totalSize)
+				return false;
+
+			std::memcpy(shuffled.data() + out, encoded + in, count);
+			in += count;
+			out += count;
+		}
+		else
+		{
+			size_t count = control - 125;
+			if (in >= encodedSize || out + count > totalSize)
+				return false;
+
+			std::memset(shuffled.data() + out, encoded[in++], count);
+			out += count;
+		}
+	}
+
+	if (out != totalSize)
+		return false;
+
+	for (size_t b = 0; b < valueSize; ++b)
+	{
+		const char* plane = shuffled.data() + b * valueCount;
+		for (size_t i = 0; i < valueCount; ++i)
+			outData[i * valueSize + b] = plane[i];
 	}
-	return MStatus::kFailure;
+
+	return true;
 }
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
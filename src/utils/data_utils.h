@@ -6,9 +6,19 @@
 
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <istream>
+#include <memory>
 #include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include <maya/MArgList.h>
 #include <maya/MPxData.h>
@@ -27,10 +37,25 @@ MStatus parseMString(const MString& str, int& outValue);
 MStatus parseMString(const MString& str, float& outValue);
 MStatus parseMString(const MString& str, double& outValue);
 
+// Writes a single value followed by a space, returns the number of characters written (excluding the null terminator)
+int formatValue(char* buffer, size_t bufferSize, short value, int precision);
+int formatValue(char* buffer, size_t bufferSize, int value, int precision);
+int formatValue(char* buffer, size_t bufferSize, float value, int precision);
+int formatValue(char* buffer, size_t bufferSize, double value, int precision);
+
+bool isLittleEndian();
+void swapByteOrder(char* data, size_t valueCount, size_t valueSize);
+
+// Lossless encoding used for large binary arrays, see the definition for details of the format
+void encodeShuffledRunLength(const char* data, size_t valueCount, size_t valueSize, std::vector<char>& outEncoded);
+bool decodeShuffledRunLength(const char* encoded, size_t encodedSize, size_t valueCount, size_t valueSize, char* outData);
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 // Provides overrides of MPxData methods which form a standard interface to be used with custom data types whose components are any single/multi-value data structures
 // Instantiation is reserved for derived classes, therefore it can be assumed that methods are invoked from a derived object (or a pointer/reference with a dynamic type)
+// Values are held in an immutable buffer which is shared between instances by copy() and only reallocated when an instance with a shared buffer is written to
+// Derived classes are expected to provide a static element(const TData*) method which constructs an element from Size consecutive values (see DataArrayView)
 template<typename TElement, typename TData, unsigned int Size>
 class DataArrayHelper : public MPxData
 {
@@ -47,6 +72,11 @@ class DataArrayHelper : public MPxData
 	//	"DataArrayHelper : template is valid for 'Size' parameter greater than 1 (ie. multi-value arrays)");
 
 public:
+	typedef TElement ElementType;
+	typedef TData ValueType;
+	typedef std::vector<TData> Buffer;
+	static const unsigned int kSize = Size;
+
 	// ------ Helpers ------
 	// Choosing to use an out-parameter in case we are dealing with large arrays which we don't want to reallocate
 	virtual void getArray(std::vector<TElement>& outArray) const = 0;
@@ -55,11 +85,29 @@ public:
 
 	virtual unsigned int length() const
 	{
-		return (unsigned int)m_data.size();
+		return (unsigned int)m_data->size();
+	}
+
+	// The returned pointer shares ownership of the buffer, its values will not change if this instance is subsequently written to
+	const std::shared_ptr<const Buffer>& buffer() const
+	{
+		return m_data;
+	}
+
+	// Shares an existing buffer without copying its values, the buffer must hold a multiple of Size values
+	void setBuffer(const std::shared_ptr<const Buffer>& buffer)
+	{
+		m_data = buffer ? buffer : emptyBuffer();
+	}
+
+	// Returns Size values per element of an unshared buffer holding the given number of elements, the caller is expected to overwrite every value (see overwriteData)
+	TData* overwriteValues(unsigned int length)
+	{
+		return overwriteData((size_t)length * Size).data();
 	}
 
 	// ------ MPxData ------
-	// Copies the underlying data between instances (eg. when an input and output attribute are connected)
+	// Shares the underlying data between instances (eg. when an input and output attribute are connected)
 	void copy(const MPxData& other) override
 	{
 		// typeId is pure virtual and will be called from the derived class
@@ -67,13 +115,7 @@ public:
 		{
 			// The MPxData reference retains a dynamic type (the inheriting class) to which accessor calls will be dispatched (casting will only change the static type)
 			const DataArrayHelper<TElement, TData, Size>& otherData = (const DataArrayHelper<TElement, TData, Size>&)other;
-			// Access the base class, else the virtual override will be called if it exists
-			m_data.resize(otherData.DataArrayHelper<TElement, TData, Size>::length());
-			std::copy(
-				otherData.m_data.begin(),
-				otherData.m_data.end(),
-				m_data.begin()
-			);
+			m_data = otherData.m_data;
 		}
 	}
 
@@ -100,7 +142,7 @@ public:
 
 		if (status && (arrayAsTuples || arrayAsValues))
 		{
-			m_data.resize(numValues);
+			Buffer& data = overwriteData(numValues);
 			unsigned int valuesParsed = 0;
 
 			if (numArrays > 0)
@@ -110,18 +152,9 @@ public:
 				{
 					for (unsigned int i = 0; i < numArgs; i++)
 					{
-						MString arg = args.asString(lastParsedIndex++, &status);
-
+						status = parseArgument(args, lastParsedIndex++, data[i]);
 						if (status)
-						{
-							TData value;
-							status = parseMString(arg, value);
-							if (status)
-							{
-								m_data[i] = value;
-								valuesParsed++;
-							}
-						}
+							valuesParsed++;
 					}
 				}
 				else
@@ -141,7 +174,7 @@ public:
 								status = parseMString(str, value);
 								if (status)
 								{
-									m_data[(i * Size) + j] = value;
+									data[(i * Size) + j] = value;
 									valuesParsed++;
 								}
 							}
@@ -157,103 +190,286 @@ public:
 		return MStatus::kFailure;
 	}
 
-	// Parses values individually with the first value representing the integer number of arrays
+	// Reads the header and values written by writeBinary, data written before the header was introduced is also supported (see BinaryHeader)
 	// Invoked for file open binary (.mb) operations
 	MStatus readBinary(std::istream& in, unsigned int length) override
 	{
-		MStatus status;
+		if (length < sizeof(uint32_t))
+			return MStatus::kFailure;
 
-		if (length == 0)
+		uint32_t first;
+		in.read((char*)&first, sizeof(uint32_t));
+		if (in.fail())
 			return MStatus::kFailure;
 
-		unsigned int numArrays;
-		in.read((char*)&numArrays, sizeof(int));
+		// The legacy layout is the number of arrays followed by the native values, its length is therefore known exactly
+		// A magic number read in the opposite byte order identifies a header written by a machine of the opposite endianness
+		uint64_t legacyLength = sizeof(uint32_t) + (uint64_t)first * Size * sizeof(TData);
+		bool isSwapped = first == kSwappedBinaryMagic;
+		if ((first != kBinaryMagic && !isSwapped) || legacyLength == length)
+		{
+			if (legacyLength > length)
+				return MStatus::kFailure;
 
-		if (in.fail()) 
-			status = MStatus::kFailure;
-		else
+			Buffer& data = overwriteData((size_t)first * Size);
+			return readBinaryValues(in, data, data.size() * sizeof(TData)) ? MStatus::kSuccess : MStatus::kFailure;
+		}
+
+		if (length < sizeof(BinaryHeader))
+			return MStatus::kFailure;
+
+		BinaryHeader header;
+		header.magic = first;
+		in.read((char*)&header + sizeof(uint32_t), sizeof(BinaryHeader) - sizeof(uint32_t));
+		if (in.fail())
+			return MStatus::kFailure;
+
+		// The single byte fields are order independent, only the counts need to be swapped before they are used
+		if (isSwapped)
 		{
-			unsigned int numValues = numArrays * Size;
-			m_data.resize(numValues);
+			swapByteOrder((char*)&header.numArrays, 1, sizeof(uint32_t));
+			swapByteOrder((char*)&header.payloadSize, 1, sizeof(uint32_t));
+		}
 
-			for (unsigned int i = 0; i < numValues; i++)
-			{
-				in.read((char*)&m_data[i], sizeof(TData));
+		if (header.version > kBinaryVersion || header.valueSize != sizeof(TData) || 
+			length < sizeof(BinaryHeader) + (uint64_t)header.payloadSize)
+			return MStatus::kFailure;
 
-				if (in.fail())
-					return MStatus::kFailure;
-			}
+		size_t numValues = (size_t)header.numArrays * Size;
+		Buffer& data = overwriteData(numValues);
+
+		if (header.encoding == kRawEncoding)
+		{
+			if (header.payloadSize != numValues * sizeof(TData) || !readBinaryValues(in, data, header.payloadSize))
+				return MStatus::kFailure;
 		}
+		else if (header.encoding == kShuffledRunLengthEncoding)
+		{
+			std::vector<char> encoded(header.payloadSize);
+			in.read(encoded.data(), header.payloadSize);
+			if (in.fail() || !decodeShuffledRunLength(encoded.data(), encoded.size(), numValues, sizeof(TData), (char*)data.data()))
+				return MStatus::kFailure;
+		}
+		else
+			return MStatus::kFailure;
 
-		return status;
+		// The encoding operates on bytes in the order they were written, therefore values are swapped once they have been decoded
+		if (isSwapped || header.isLittleEndian != (uint8_t)isLittleEndian())
+			swapByteOrder((char*)data.data(), numValues, sizeof(TData));
+
+		return MStatus::kSuccess;
 	}
 
 	// Writes out the number of arrays constituting the custom data structure then each value from each array delineated by a space
+	// Values are formatted into a single buffer which is written to the stream in one operation
 	// Invoked for file save ASCII (.ma) operations
 	MStatus writeASCII(std::ostream &out) override
 	{
-		MStatus status;
-
-		unsigned int numValues = this->DataArrayHelper<TElement, TData, Size>::length();
+		const Buffer& data = *m_data;
+		unsigned int numValues = (unsigned int)data.size();
 		unsigned int numArrays = numValues / Size;
+		int precision = (int)out.precision();
 
-		out << numArrays << " ";
+		std::string buffer;
+		buffer.reserve((size_t)numValues * (precision + 8) + 16);
+		buffer += std::to_string(numArrays);
+		buffer += ' ';
 
-		if (out.fail())
-			status = MStatus::kFailure;
-		else 
+		char text[64];
+		for (unsigned int i = 0; i < numValues; i++)
 		{
-			for (unsigned int i = 0; i < numValues; i++)
-			{
-				out << m_data[i] << " ";
+			int count = formatValue(text, sizeof(text), data[i], precision);
+			if (count < 0 || count >= (int)sizeof(text))
+				return MStatus::kFailure;
 
-				if (out.fail())
-				{
-					status = MStatus::kFailure;
-					break;
-				}
-			}
+			buffer.append(text, count);
 		}
 
-		return status;
+		out.write(buffer.data(), buffer.size());
+
+		return out.fail() ? MStatus::kFailure : MStatus::kSuccess;
 	}
 
-	// This is a direct reflection of readBinary, writing out the number of arrays then each value held by the data member
+	// Writes a header followed by the values held by the data member as a single block
+	// Large arrays are encoded if doing so reduces the size of the block by at least a quarter
 	// Invoked for file save binary (.mb) operations
 	MStatus writeBinary(std::ostream &out) override
 	{
-		MStatus status;
-
-		unsigned int numValues = this->DataArrayHelper<TElement, TData, Size>::length();
-		unsigned int numArrays = numValues / Size;
-
-		out.write((char*)&numArrays, sizeof(int));
-
-		if (out.fail())
-			status = MStatus::kFailure;
-		else 
+		const Buffer& data = *m_data;
+		size_t numValues = data.size();
+		size_t rawSize = numValues * sizeof(TData);
+
+		BinaryHeader header;
+		header.magic = kBinaryMagic;
+		header.version = kBinaryVersion;
+		header.isLittleEndian = (uint8_t)isLittleEndian();
+		header.encoding = kRawEncoding;
+		header.valueSize = (uint8_t)sizeof(TData);
+		header.numArrays = (uint32_t)(numValues / Size);
+		header.payloadSize = (uint32_t)rawSize;
+
+		const char* payload = (const char*)data.data();
+		std::vector<char> encoded;
+		if (numValues >= kEncodingMinValues)
 		{
-			for (unsigned int i = 0; i < numValues; i++)
+			encodeShuffledRunLength(payload, numValues, sizeof(TData), encoded);
+			if (encoded.size() * 4 <= rawSize * 3)
 			{
-				out.write((char*)&m_data[i], sizeof(TData));
-
-				if (out.fail())
-				{
-					status = MStatus::kFailure;
-					break;
-				}
+				header.encoding = kShuffledRunLengthEncoding;
+				header.payloadSize = (uint32_t)encoded.size();
+				payload = encoded.data();
 			}
 		}
 
-		return status;
+		out.write((const char*)&header, sizeof(BinaryHeader));
+		out.write(payload, header.payloadSize);
+
+		return out.fail() ? MStatus::kFailure : MStatus::kSuccess;
 	}
 
 protected:
-	DataArrayHelper() {}
+	DataArrayHelper() : m_data(emptyBuffer()) {}
 	~DataArrayHelper() {}
 
+	// ------ Helpers ------
+	/*	Returns a buffer of numValues values which is not shared with any other instance or view
+		The values are unspecified, the caller is expected to overwrite each of them before the buffer is shared
+		Any previously shared buffer is left untouched, so there is no need to copy its values    */
+	Buffer& overwriteData(size_t numValues)
+	{
+		// A count of one cannot be raised by another thread as there are no other owners to copy from
+		if (m_data.use_count() != 1)
+			m_data = std::make_shared<Buffer>(numValues);
+
+		// Every buffer is allocated as non-const, the const qualifier only guards shared instances
+		Buffer& data = const_cast<Buffer&>(*m_data);
+		data.resize(numValues);
+		return data;
+	}
+
 	// ------ Data ------
-	std::vector<TData> m_data;
+	std::shared_ptr<const Buffer> m_data;
+
+private:
+	/*	Binary layout
+		-------------
+		The header is followed by payloadSize bytes, which are either the raw values or the values encoded by encodeShuffledRunLength
+		The header and values are stored in the byte order of the machine which wrote them and are swapped on read if the order differs
+		The byte order is detected from the magic number, isLittleEndian records the same information for readers which inspect the header directly
+		Files written before the header was introduced contain only the number of arrays followed by the raw values
+		The legacy layout is detected by the absence of the magic number or by a length which matches the legacy layout exactly    */
+	struct BinaryHeader
+	{
+		uint32_t magic;
+		uint8_t version;
+		uint8_t isLittleEndian;
+		uint8_t encoding;
+		uint8_t valueSize;
+		uint32_t numArrays;
+		uint32_t payloadSize;
+	};
+
+	static_assert(sizeof(BinaryHeader) == 16, "DataArrayHelper : BinaryHeader must not contain padding");
+
+	enum BinaryEncoding : uint8_t
+	{
+		kRawEncoding = 0,
+		kShuffledRunLengthEncoding = 1,
+	};
+
+	static const uint32_t kBinaryMagic = 0x4153524D; // "MRSA" when stored little endian
+	static const uint32_t kSwappedBinaryMagic = 0x4D525341;
+	static const uint8_t kBinaryVersion = 1;
+	static const size_t kEncodingMinValues = 1 << 14;
+
+	// ------ Helpers ------
+	static const std::shared_ptr<const Buffer>& emptyBuffer()
+	{
+		static const std::shared_ptr<const Buffer> empty = std::make_shared<Buffer>();
+		return empty;
+	}
+
+	static bool readBinaryValues(std::istream& in, Buffer& data, size_t byteCount)
+	{
+		in.read((char*)data.data(), byteCount);
+		return !in.fail();
+	}
+
+	static MStatus parseArgument(const MArgList& args, unsigned int index, short& outValue)
+	{
+		MStatus status;
+		int value = args.asInt(index, &status);
+		if (status && (value < SHRT_MIN || value > SHRT_MAX))
+			return MStatus::kFailure;
+
+		outValue = (short)value;
+		return status;
+	}
+
+	static MStatus parseArgument(const MArgList& args, unsigned int index, int& outValue)
+	{
+		MStatus status;
+		outValue = args.asInt(index, &status);
+		return status;
+	}
+
+	static MStatus parseArgument(const MArgList& args, unsigned int index, float& outValue)
+	{
+		MStatus status;
+		outValue = (float)args.asDouble(index, &status);
+		return status;
+	}
+
+	static MStatus parseArgument(const MArgList& args, unsigned int index, double& outValue)
+	{
+		MStatus status;
+		outValue = args.asDouble(index, &status);
+		return status;
+	}
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Read-only typed view of the values held by a DataArrayHelper derived data object
+	Elements are constructed on access via TDataPlugin::element, therefore consumers do not need to materialize a separate std::vector of elements
+	The view shares ownership of the buffer, it remains valid and unchanged if the data object is subsequently written to or destroyed    */
+
+template<typename TDataPlugin>
+class DataArrayView
+{
+public:
+	typedef typename TDataPlugin::ElementType ElementType;
+	typedef typename TDataPlugin::ValueType ValueType;
+	typedef typename TDataPlugin::Buffer Buffer;
+	static const unsigned int kSize = TDataPlugin::kSize;
+
+	DataArrayView() : m_buffer(), m_values(nullptr), m_length(0) {}
+
+	explicit DataArrayView(const TDataPlugin& data) : m_buffer(data.buffer())
+	{
+		m_values = m_buffer->data();
+		m_length = (unsigned int)(m_buffer->size() / kSize);
+	}
+
+	unsigned int length() const { return m_length; }
+	bool empty() const { return m_length == 0; }
+
+	ElementType operator[](unsigned int index) const
+	{
+		return TDataPlugin::element(m_values + (size_t)index * kSize);
+	}
+
+	// Returns kSize consecutive values per element
+	const ValueType* values() const { return m_values; }
+
+	const std::shared_ptr<const Buffer>& buffer() const { return m_buffer; }
+
+private:
+	std::shared_ptr<const Buffer> m_buffer;
+	const ValueType* m_values;
+	unsigned int m_length;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,1019 @@
+#include "expression_utils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+#include <maya/MMatrix.h>
+#include <maya/MPoint.h>
+#include <maya/MQuaternion.h>
+#include <maya/MVector.h>
+
+#include "math_utils.h"
+#include "matrix_utils.h"
+#include "vector_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// ------ Helpers ------
+
+namespace {
+
+typedef ExpressionProgram::OpCode OpCode;
+typedef ExpressionProgram::ValueType ValueType;
+
+const ValueType S = ExpressionProgram::kScalar;
+const ValueType V = ExpressionProgram::kVector;
+const ValueType M = ExpressionProgram::kMatrix;
+const ValueType Q = ExpressionProgram::kQuaternion;
+
+const unsigned int kValueTypeCount = 4;
+
+const double kPi = 3.14159265358979323846;
+const unsigned int kMaxRecursion = 256;
+
+struct FunctionSignature
+{
+	const char* name;
+	unsigned int arity;
+	ValueType args[16];
+	ValueType result;
+	OpCode op;
+};
+
+const FunctionSignature kFunctions[] = {
+	{ "abs", 1, { S }, S, ExpressionProgram::kAbsolute },
+	{ "min", 2, { S, S }, S, ExpressionProgram::kMin },
+	{ "max", 2, { S, S }, S, ExpressionProgram::kMax },
+	{ "clamp", 3, { S, S, S }, S, ExpressionProgram::kClamp },
+	{ "remap", 5, { S, S, S, S, S }, S, ExpressionProgram::kRemap },
+	{ "lerp", 3, { S, S, S }, S, ExpressionProgram::kLerp },
+	{ "lerp", 3, { V, V, S }, V, ExpressionProgram::kLerpVector },
+	{ "smoothstep", 3, { S, S, S }, S, ExpressionProgram::kSmoothstep },
+	{ "smoothstep", 3, { V, V, S }, V, ExpressionProgram::kSmoothstepVector },
+	{ "pow", 2, { S, S }, S, ExpressionProgram::kPower },
+	{ "sqrt", 1, { S }, S, ExpressionProgram::kSquareRoot },
+	{ "floor", 1, { S }, S, ExpressionProgram::kFloor },
+	{ "ceil", 1, { S }, S, ExpressionProgram::kCeil },
+	{ "round", 1, { S }, S, ExpressionProgram::kRound },
+	{ "sin", 1, { S }, S, ExpressionProgram::kSin },
+	{ "cos", 1, { S }, S, ExpressionProgram::kCos },
+	{ "tan", 1, { S }, S, ExpressionProgram::kTan },
+	{ "asin", 1, { S }, S, ExpressionProgram::kAsin },
+	{ "acos", 1, { S }, S, ExpressionProgram::kAcos },
+	{ "atan", 1, { S }, S, ExpressionProgram::kAtan },
+	{ "atan2", 2, { S, S }, S, ExpressionProgram::kAtan2 },
+	{ "vec", 3, { S, S, S }, V, ExpressionProgram::kMakeVector },
+	{ "dot", 2, { V, V }, S, ExpressionProgram::kDotProduct },
+	{ "cross", 2, { V, V }, V, ExpressionProgram::kCrossProduct },
+	{ "length", 1, { V }, S, ExpressionProgram::kVectorLength },
+	{ "normalize", 1, { V }, V, ExpressionProgram::kNormalizeVector },
+	{ "mat", 16, { S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S }, M, ExpressionProgram::kMakeMatrix },
+	{ "transformPoint", 2, { V, M }, V, ExpressionProgram::kTransformPoint },
+	{ "transformVector", 2, { V, M }, V, ExpressionProgram::kTransformVector },
+	{ "translation", 1, { M }, V, ExpressionProgram::kExtractTranslation },
+	{ "scale", 1, { M }, V, ExpressionProgram::kExtractScale },
+	{ "rotation", 1, { M }, Q, ExpressionProgram::kExtractQuaternion },
+	{ "basisX", 2, { M, S }, V, ExpressionProgram::kExtractBasisX },
+	{ "basisY", 2, { M, S }, V, ExpressionProgram::kExtractBasisY },
+	{ "basisZ", 2, { M, S }, V, ExpressionProgram::kExtractBasisZ },
+	{ "translationMatrix", 1, { M }, M, ExpressionProgram::kExtractTranslationMatrix },
+	{ "rotationMatrix", 1, { M }, M, ExpressionProgram::kExtractRotationMatrix },
+	{ "scaleMatrix", 1, { M }, M, ExpressionProgram::kExtractScaleMatrix },
+	{ "preTranslate", 2, { M, V }, M, ExpressionProgram::kPreTranslate },
+	{ "postTranslate", 2, { M, V }, M, ExpressionProgram::kPostTranslate },
+	{ "preScale", 2, { M, V }, M, ExpressionProgram::kPreScale },
+	{ "postScale", 2, { M, V }, M, ExpressionProgram::kPostScale },
+	{ "preRotateX", 2, { M, S }, M, ExpressionProgram::kPreRotateX },
+	{ "preRotateY", 2, { M, S }, M, ExpressionProgram::kPreRotateY },
+	{ "preRotateZ", 2, { M, S }, M, ExpressionProgram::kPreRotateZ },
+	{ "postRotateX", 2, { M, S }, M, ExpressionProgram::kPostRotateX },
+	{ "postRotateY", 2, { M, S }, M, ExpressionProgram::kPostRotateY },
+	{ "postRotateZ", 2, { M, S }, M, ExpressionProgram::kPostRotateZ },
+	{ "quat", 4, { S, S, S, S }, Q, ExpressionProgram::kMakeQuaternion },
+	{ "matrix", 1, { Q }, M, ExpressionProgram::kQuaternionToMatrix },
+	{ "rotate", 2, { V, Q }, V, ExpressionProgram::kRotateVector },
+};
+
+// Indexed by value type
+const OpCode kLoadOps[kValueTypeCount] = { ExpressionProgram::kLoadScalar, ExpressionProgram::kLoadVector, ExpressionProgram::kLoadMatrix,
+	ExpressionProgram::kLoadQuaternion };
+
+
+bool isIdentifier(const std::string& name)
+{
+	if (name.empty() || !(std::isalpha((unsigned char)name[0]) || name[0] == '_'))
+		return false;
+
+	for (char c : name)
+	{
+		if (!(std::isalnum((unsigned char)c) || c == '_'))
+			return false;
+	}
+
+	return true;
+}
+
+/*	Description
+	-----------
+	Recursive descent parser which emits instructions as each production is reduced
+	The type of every sub-expression is returned by its production so that typed opcodes can be selected without an intermediate tree
+	The stack depth is tracked alongside emission so that evaluation can use a fixed size stack    */
+
+class Compiler
+{
+public:
+	Compiler(const std::string& source, const std::vector<std::string>& scalarNames, const std::vector<std::string>& vectorNames,
+		const std::vector<std::string>& matrixNames, const std::vector<std::string>& quaternionNames,
+		std::vector<ExpressionProgram::Instruction>& instructions, std::vector<double>& constants) :
+		m_source{ source },
+		m_names{ &scalarNames, &vectorNames, &matrixNames, &quaternionNames },
+		m_instructions{ instructions },
+		m_constants{ constants },
+		m_position{ 0 },
+		m_depth{ 0 },
+		m_maxDepth{ 0 },
+		m_recursion{ 0 } {}
+
+	bool compile(ValueType& outResultType, std::string& outError)
+	{
+		if (!validateNames())
+		{
+			outError = m_error;
+			return false;
+		}
+
+		skipWhitespace();
+		if (m_position == m_source.size())
+		{
+			outError = "Expression is empty";
+			return false;
+		}
+
+		ValueType type;
+		if (!parseExpression(type))
+		{
+			outError = m_error;
+			return false;
+		}
+
+		skipWhitespace();
+		if (m_position != m_source.size())
+		{
+			setError("Unexpected character \"" + std::string(1, m_source[m_position]) + "\"");
+			outError = m_error;
+			return false;
+		}
+
+		outResultType = type;
+		return true;
+	}
+
+private:
+	// ------ Emission ------
+
+	bool emit(OpCode op, unsigned int pops, uint32_t operand = 0)
+	{
+		m_instructions.push_back({ op, operand });
+		m_depth = m_depth - pops + 1;
+		m_maxDepth = std::max(m_maxDepth, m_depth);
+
+		if (m_maxDepth > ExpressionProgram::kMaxStackDepth)
+		{
+			setError("Expression exceeds the maximum nesting depth");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool emitConstant(double value)
+	{
+		m_constants.push_back(value);
+		return emit(ExpressionProgram::kPushConstant, 0, (uint32_t)m_constants.size() - 1);
+	}
+
+	// ------ Lexing ------
+
+	void skipWhitespace()
+	{
+		while (m_position < m_source.size() && std::isspace((unsigned char)m_source[m_position]))
+			++m_position;
+	}
+
+	bool accept(char c)
+	{
+		skipWhitespace();
+		if (m_position < m_source.size() && m_source[m_position] == c)
+		{
+			++m_position;
+			return true;
+		}
+
+		return false;
+	}
+
+	bool expect(char c)
+	{
+		if (accept(c))
+			return true;
+
+		setError("Expected \"" + std::string(1, c) + "\"");
+		return false;
+	}
+
+	std::string parseIdentifier()
+	{
+		size_t start = m_position;
+		while (m_position < m_source.size() && (std::isalnum((unsigned char)m_source[m_position]) || m_source[m_position] == '_'))
+			++m_position;
+
+		return m_source.substr(start, m_position - start);
+	}
+
+	void setError(const std::string& message)
+	{
+		if (m_error.empty())
+			m_error = message + " at column " + std::to_string(std::min(m_position, m_source.size()) + 1);
+	}
+
+	bool validateNames()
+	{
+		std::vector<const std::string*> names;
+		for (const std::vector<std::string>* typeNames : m_names)
+		{
+			for (const std::string& name : *typeNames)
+				names.push_back(&name);
+		}
+
+		for (size_t i = 0; i < names.size(); ++i)
+		{
+			if (!isIdentifier(*names[i]))
+			{
+				m_error = "Input name \"" + *names[i] + "\" is not a valid identifier";
+				return false;
+			}
+
+			for (size_t j = 0; j < i; ++j)
+			{
+				if (*names[i] == *names[j])
+				{
+					m_error = "Input name \"" + *names[i] + "\" is defined more than once";
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	// ------ Productions ------
+
+	bool parseExpression(ValueType& outType)
+	{
+		if (!parseTerm(outType))
+			return false;
+
+		while (true)
+		{
+			bool isAdd = accept('+');
+			if (!isAdd && !accept('-'))
+				return true;
+
+			ValueType rhsType;
+			if (!parseTerm(rhsType))
+				return false;
+
+			if (outType != rhsType)
+			{
+				setError("Cannot add or subtract values of different types");
+				return false;
+			}
+
+			if (outType != S && outType != V)
+			{
+				setError("Cannot add or subtract matrices or quaternions");
+				return false;
+			}
+
+			OpCode op = outType == S ? (isAdd ? ExpressionProgram::kAdd : ExpressionProgram::kSubtract) :
+				(isAdd ? ExpressionProgram::kAddVector : ExpressionProgram::kSubtractVector);
+			if (!emit(op, 2))
+				return false;
+		}
+	}
+
+	bool parseTerm(ValueType& outType)
+	{
+		if (!parseUnary(outType))
+			return false;
+
+		while (true)
+		{
+			bool isMultiply = accept('*');
+			if (!isMultiply && !accept('/'))
+				return true;
+
+			ValueType rhsType;
+			if (!parseUnary(rhsType))
+				return false;
+
+			OpCode op;
+			if (isMultiply)
+			{
+				if (outType == S && rhsType == S)
+					op = ExpressionProgram::kMultiply;
+				else if (outType == V && rhsType == S)
+					op = ExpressionProgram::kMultiplyVector;
+				else if (outType == S && rhsType == V)
+					op = ExpressionProgram::kMultiplyScalarVector;
+				else if (outType == M && rhsType == M)
+					op = ExpressionProgram::kMultiplyMatrix;
+				else if (outType == Q && rhsType == Q)
+					op = ExpressionProgram::kMultiplyQuaternion;
+				else if (outType == V && rhsType == V)
+				{
+					setError("Cannot multiply two vectors, use dot() or cross()");
+					return false;
+				}
+				else
+				{
+					setError("Cannot multiply these types, use transformPoint(), transformVector() or rotate() to transform a vector");
+					return false;
+				}
+
+				outType = outType == S ? rhsType : outType;
+			}
+			else
+			{
+				if (rhsType == V)
+				{
+					setError("Cannot divide by a vector");
+					return false;
+				}
+
+				if (outType == M || outType == Q || rhsType != S)
+				{
+					setError("Only scalars and vectors can be divided by a scalar");
+					return false;
+				}
+
+				op = outType == S ? ExpressionProgram::kDivide : ExpressionProgram::kDivideVector;
+			}
+
+			if (!emit(op, 2))
+				return false;
+		}
+	}
+
+	// Every recursive production passes through here, bounding recursion guards against overflowing the native stack
+	bool parseUnary(ValueType& outType)
+	{
+		if (++m_recursion > kMaxRecursion)
+		{
+			setError("Expression exceeds the maximum nesting depth");
+			return false;
+		}
+
+		bool isValid;
+		if (accept('+'))
+			isValid = parseUnary(outType);
+		else if (accept('-'))
+		{
+			isValid = parseUnary(outType);
+			if (isValid && (outType == M || outType == Q))
+			{
+				setError("Cannot negate a matrix or quaternion");
+				isValid = false;
+			}
+
+			isValid = isValid && emit(outType == S ? ExpressionProgram::kNegate : ExpressionProgram::kNegateVector, 1);
+		}
+		else
+			isValid = parsePostfix(outType);
+
+		--m_recursion;
+		return isValid;
+	}
+
+	bool parsePostfix(ValueType& outType)
+	{
+		if (!parsePrimary(outType))
+			return false;
+
+		while (accept('.'))
+		{
+			if (outType != V && outType != Q)
+			{
+				setError("Component access requires a vector or quaternion");
+				return false;
+			}
+
+			std::string component = parseIdentifier();
+			uint32_t index;
+			if (component == "x")
+				index = 0;
+			else if (component == "y")
+				index = 1;
+			else if (component == "z")
+				index = 2;
+			else if (component == "w" && outType == Q)
+				index = 3;
+			else
+			{
+				setError(outType == V ? "Expected component \"x\", \"y\" or \"z\"" : "Expected component \"x\", \"y\", \"z\" or \"w\"");
+				return false;
+			}
+
+			if (!emit(ExpressionProgram::kComponent, 1, index))
+				return false;
+
+			outType = S;
+		}
+
+		return true;
+	}
+
+	bool parsePrimary(ValueType& outType)
+	{
+		skipWhitespace();
+		if (m_position == m_source.size())
+		{
+			setError("Unexpected end of expression");
+			return false;
+		}
+
+		char c = m_source[m_position];
+
+		if (accept('('))
+		{
+			if (!parseExpression(outType))
+				return false;
+
+			return expect(')');
+		}
+
+		if (std::isdigit((unsigned char)c) || c == '.')
+		{
+			const char* begin = m_source.c_str() + m_position;
+			char* end = nullptr;
+			double value = std::strtod(begin, &end);
+			if (end == begin)
+			{
+				setError("Invalid number");
+				return false;
+			}
+
+			m_position += end - begin;
+			outType = S;
+			return emitConstant(value);
+		}
+
+		if (std::isalpha((unsigned char)c) || c == '_')
+		{
+			std::string name = parseIdentifier();
+
+			if (accept('('))
+				return parseCall(name, outType);
+
+			for (unsigned int type = 0; type < kValueTypeCount; ++type)
+			{
+				const std::vector<std::string>& typeNames = *m_names[type];
+				for (size_t i = 0; i < typeNames.size(); ++i)
+				{
+					if (typeNames[i] == name)
+					{
+						outType = (ValueType)type;
+						return emit(kLoadOps[type], 0, (uint32_t)i);
+					}
+				}
+			}
+
+			if (name == "pi")
+			{
+				outType = S;
+				return emitConstant(kPi);
+			}
+
+			setError("Unknown input \"" + name + "\"");
+			return false;
+		}
+
+		setError("Unexpected character \"" + std::string(1, c) + "\"");
+		return false;
+	}
+
+	bool parseCall(const std::string& name, ValueType& outType)
+	{
+		std::vector<ValueType> argTypes;
+		if (!accept(')'))
+		{
+			do
+			{
+				ValueType argType;
+				if (!parseExpression(argType))
+					return false;
+
+				argTypes.push_back(argType);
+			} while (accept(','));
+
+			if (!expect(')'))
+				return false;
+		}
+
+		bool isKnown = false;
+		for (const FunctionSignature& signature : kFunctions)
+		{
+			if (name != signature.name)
+				continue;
+
+			isKnown = true;
+			if (signature.arity != argTypes.size())
+				continue;
+
+			bool isMatch = true;
+			for (unsigned int i = 0; i < signature.arity; ++i)
+				isMatch = isMatch && signature.args[i] == argTypes[i];
+
+			if (isMatch)
+			{
+				outType = signature.result;
+				return emit(signature.op, signature.arity);
+			}
+		}
+
+		setError(isKnown ? "Invalid arguments for function \"" + name + "\"" : "Unknown function \"" + name + "\"");
+		return false;
+	}
+
+	const std::string& m_source;
+	// Indexed by value type
+	const std::vector<std::string>* m_names[kValueTypeCount];
+	std::vector<ExpressionProgram::Instruction>& m_instructions;
+	std::vector<double>& m_constants;
+	std::string m_error;
+	size_t m_position;
+	unsigned int m_depth;
+	unsigned int m_maxDepth;
+	unsigned int m_recursion;
+};
+
+// ------ Conversion ------
+
+// Stack slots hold matrices in row major order and quaternions in the order (x, y, z, w)
+MVector toVector(const double* slot)
+{
+	return MVector{ slot[0], slot[1], slot[2] };
+}
+
+void fromVector(const MVector& vector, double* outSlot)
+{
+	outSlot[0] = vector.x;
+	outSlot[1] = vector.y;
+	outSlot[2] = vector.z;
+}
+
+MMatrix toMatrix(const double* slot)
+{
+	MMatrix matrix;
+	std::copy(slot, slot + 16, &matrix.matrix[0][0]);
+	return matrix;
+}
+
+void fromMatrix(const MMatrix& matrix, double* outSlot)
+{
+	std::copy(&matrix.matrix[0][0], &matrix.matrix[0][0] + 16, outSlot);
+}
+
+MQuaternion toQuaternion(const double* slot)
+{
+	return MQuaternion{ slot[0], slot[1], slot[2], slot[3] };
+}
+
+void fromQuaternion(const MQuaternion& quaternion, double* outSlot)
+{
+	outSlot[0] = quaternion.x;
+	outSlot[1] = quaternion.y;
+	outSlot[2] = quaternion.z;
+	outSlot[3] = quaternion.w;
+}
+
+} // namespace
+
+// ------ ExpressionProgram ------
+
+ExpressionProgram::ExpressionProgram() :
+	m_resultType{ kScalar },
+	m_isValid{ false } {}
+
+bool ExpressionProgram::compile(const std::string& source, const std::vector<std::string>& scalarNames, const std::vector<std::string>& vectorNames,
+	const std::vector<std::string>& matrixNames, const std::vector<std::string>& quaternionNames, std::string& outError)
+{
+	clear();
+
+	Compiler compiler{ source, scalarNames, vectorNames, matrixNames, quaternionNames, m_instructions, m_constants };
+	m_isValid = compiler.compile(m_resultType, outError);
+	if (!m_isValid)
+		clear();
+
+	return m_isValid;
+}
+
+void ExpressionProgram::clear()
+{
+	m_instructions.clear();
+	m_constants.clear();
+	m_resultType = kScalar;
+	m_isValid = false;
+}
+
+bool ExpressionProgram::isValid() const
+{
+	return m_isValid;
+}
+
+ExpressionProgram::ValueType ExpressionProgram::resultType() const
+{
+	return m_resultType;
+}
+
+const char* ExpressionProgram::errorMessage(EvaluationError error)
+{
+	switch (error)
+	{
+		case kDivisionByZero:
+			return "Undefined division by zero!";
+		case kUndefinedAtan2:
+			return "Undefined atan2(0, 0)!";
+		default:
+			return "";
+	}
+}
+
+unsigned int ExpressionProgram::valueSize(ValueType type)
+{
+	switch (type)
+	{
+		case kVector:
+			return 3;
+		case kMatrix:
+			return 16;
+		case kQuaternion:
+			return 4;
+		default:
+			return 1;
+	}
+}
+
+/*	Description
+	-----------
+	Every stack slot holds kMaxValueSize doubles, each instruction only reads and writes the values of its operand and result types
+	Operands are referenced from the top of the stack, the result of each instruction is written into its first operand slot
+	Instructions whose node evaluates through a Maya type (ie. vector scaling, lerp, normalize, length, dot, cross, matrices and quaternions) use the same type and utilities
+	Hand written arithmetic is limited to operations which the nodes also write out by hand, so that every result is identical    */
+
+ExpressionProgram::EvaluationError ExpressionProgram::evaluate(const double* scalars, const double* vectors, const double* matrices, const double* quaternions,
+	double* outResult) const
+{
+	assert(m_isValid);
+
+	double stack[kMaxStackDepth][kMaxValueSize];
+	unsigned int top = 0;
+
+	for (const Instruction& instruction : m_instructions)
+	{
+		switch (instruction.op)
+		{
+			// ------ Operands ------
+			case kPushConstant:
+				stack[top++][0] = m_constants[instruction.operand];
+				break;
+			case kLoadScalar:
+				stack[top++][0] = scalars[instruction.operand];
+				break;
+			case kLoadVector:
+			{
+				const double* v = vectors + 3 * instruction.operand;
+				stack[top][0] = v[0];
+				stack[top][1] = v[1];
+				stack[top][2] = v[2];
+				++top;
+				break;
+			}
+			case kLoadMatrix:
+				std::copy(matrices + 16 * instruction.operand, matrices + 16 * (instruction.operand + 1), stack[top++]);
+				break;
+			case kLoadQuaternion:
+				std::copy(quaternions + 4 * instruction.operand, quaternions + 4 * (instruction.operand + 1), stack[top++]);
+				break;
+			case kComponent:
+				stack[top - 1][0] = stack[top - 1][instruction.operand];
+				break;
+
+			// ------ Scalar ------
+			case kAdd:
+				--top;
+				stack[top - 1][0] += stack[top][0];
+				break;
+			case kSubtract:
+				--top;
+				stack[top - 1][0] -= stack[top][0];
+				break;
+			case kMultiply:
+				--top;
+				stack[top - 1][0] *= stack[top][0];
+				break;
+			case kDivide:
+				--top;
+				if (MRS::isEqual(stack[top][0], 0.0))
+					return kDivisionByZero;
+				stack[top - 1][0] /= stack[top][0];
+				break;
+			case kNegate:
+				stack[top - 1][0] = -stack[top - 1][0];
+				break;
+			case kAbsolute:
+				stack[top - 1][0] = std::abs(stack[top - 1][0]);
+				break;
+			case kMin:
+				--top;
+				stack[top - 1][0] = std::min(stack[top - 1][0], stack[top][0]);
+				break;
+			case kMax:
+				--top;
+				stack[top - 1][0] = std::max(stack[top - 1][0], stack[top][0]);
+				break;
+			case kClamp:
+				top -= 2;
+				stack[top - 1][0] = MRS::clamp(stack[top - 1][0], stack[top][0], stack[top + 1][0]);
+				break;
+			case kRemap:
+				top -= 4;
+				stack[top - 1][0] = MRS::remap(stack[top - 1][0], stack[top][0], stack[top + 1][0], stack[top + 2][0], stack[top + 3][0]);
+				break;
+			case kLerp:
+			{
+				top -= 2;
+				double a = stack[top - 1][0];
+				double t = stack[top + 1][0];
+				stack[top - 1][0] = a + (stack[top][0] - a) * t;
+				break;
+			}
+			case kSmoothstep:
+			{
+				top -= 2;
+				double a = stack[top - 1][0];
+				double t = stack[top + 1][0];
+				t = t * t * (3 - 2 * t);
+				stack[top - 1][0] = a + (stack[top][0] - a) * t;
+				break;
+			}
+			case kPower:
+				--top;
+				stack[top - 1][0] = std::pow(stack[top - 1][0], stack[top][0]);
+				break;
+			case kSquareRoot:
+				stack[top - 1][0] = std::sqrt(stack[top - 1][0]);
+				break;
+			case kFloor:
+				stack[top - 1][0] = std::floor(stack[top - 1][0]);
+				break;
+			case kCeil:
+				stack[top - 1][0] = std::ceil(stack[top - 1][0]);
+				break;
+			case kRound:
+				stack[top - 1][0] = std::round(stack[top - 1][0]);
+				break;
+			case kSin:
+				stack[top - 1][0] = std::sin(stack[top - 1][0]);
+				break;
+			case kCos:
+				stack[top - 1][0] = std::cos(stack[top - 1][0]);
+				break;
+			case kTan:
+				stack[top - 1][0] = std::tan(stack[top - 1][0]);
+				break;
+			case kAsin:
+				stack[top - 1][0] = std::asin(stack[top - 1][0]);
+				break;
+			case kAcos:
+				stack[top - 1][0] = std::acos(stack[top - 1][0]);
+				break;
+			case kAtan:
+				stack[top - 1][0] = std::atan(stack[top - 1][0]);
+				break;
+			case kAtan2:
+			{
+				--top;
+				double y = stack[top - 1][0];
+				double x = stack[top][0];
+				if (MRS::isEqual(y, 0.0) && MRS::isEqual(x, 0.0))
+					return kUndefinedAtan2;
+				stack[top - 1][0] = std::atan2(y, x);
+				break;
+			}
+
+			// ------ Vector ------
+			case kAddVector:
+				--top;
+				for (unsigned int i = 0; i < 3; ++i)
+					stack[top - 1][i] += stack[top][i];
+				break;
+			case kSubtractVector:
+				--top;
+				for (unsigned int i = 0; i < 3; ++i)
+					stack[top - 1][i] -= stack[top][i];
+				break;
+			case kMultiplyVector:
+				--top;
+				fromVector(toVector(stack[top - 1]) * stack[top][0], stack[top - 1]);
+				break;
+			case kMultiplyScalarVector:
+				--top;
+				fromVector(toVector(stack[top]) * stack[top - 1][0], stack[top - 1]);
+				break;
+			case kDivideVector:
+				--top;
+				fromVector(toVector(stack[top - 1]) / stack[top][0], stack[top - 1]);
+				break;
+			case kNegateVector:
+				for (unsigned int i = 0; i < 3; ++i)
+					stack[top - 1][i] = -stack[top - 1][i];
+				break;
+			case kLerpVector:
+			case kSmoothstepVector:
+			{
+				top -= 2;
+				double t = stack[top + 1][0];
+				if (instruction.op == kSmoothstepVector)
+					t = t * t * (3 - 2 * t);
+				MVector a = toVector(stack[top - 1]);
+				fromVector(a + (toVector(stack[top]) - a) * t, stack[top - 1]);
+				break;
+			}
+			case kMakeVector:
+				top -= 2;
+				stack[top - 1][1] = stack[top][0];
+				stack[top - 1][2] = stack[top + 1][0];
+				break;
+			case kDotProduct:
+				--top;
+				stack[top - 1][0] = toVector(stack[top - 1]) * toVector(stack[top]);
+				break;
+			case kCrossProduct:
+				--top;
+				fromVector(toVector(stack[top - 1]) ^ toVector(stack[top]), stack[top - 1]);
+				break;
+			case kVectorLength:
+				stack[top - 1][0] = toVector(stack[top - 1]).length();
+				break;
+			case kNormalizeVector:
+				fromVector(toVector(stack[top - 1]).normal(), stack[top - 1]);
+				break;
+
+			// ------ Matrix ------
+			case kMultiplyMatrix:
+				--top;
+				fromMatrix(toMatrix(stack[top - 1]) * toMatrix(stack[top]), stack[top - 1]);
+				break;
+			case kMakeMatrix:
+				top -= 15;
+				for (unsigned int i = 1; i < 16; ++i)
+					stack[top - 1][i] = stack[top - 1 + i][0];
+				break;
+			case kTransformPoint:
+			{
+				--top;
+				// The homogeneous point is converted back to a vector as per the output of MultiplyPointByMatrix
+				MVector point = MPoint(toVector(stack[top - 1])) * toMatrix(stack[top]);
+				fromVector(point, stack[top - 1]);
+				break;
+			}
+			case kTransformVector:
+				--top;
+				fromVector(toVector(stack[top - 1]) * toMatrix(stack[top]), stack[top - 1]);
+				break;
+			case kExtractTranslation:
+				fromVector(MRS::extractTranslation(toMatrix(stack[top - 1])), stack[top - 1]);
+				break;
+			case kExtractScale:
+				fromVector(MRS::extractScale(toMatrix(stack[top - 1])), stack[top - 1]);
+				break;
+			case kExtractQuaternion:
+				fromQuaternion(MRS::extractQuaternionRotation(toMatrix(stack[top - 1])), stack[top - 1]);
+				break;
+			case kExtractBasisX:
+			case kExtractBasisY:
+			case kExtractBasisZ:
+			{
+				--top;
+				unsigned int row = instruction.op - kExtractBasisX;
+				MVector basis = toVector(stack[top - 1] + 4 * row);
+				if (stack[top][0] != 0.0)
+					basis.normalize();
+				fromVector(basis, stack[top - 1]);
+				break;
+			}
+			case kExtractTranslationMatrix:
+				fromMatrix(MRS::extractTranslationMatrix(toMatrix(stack[top - 1])), stack[top - 1]);
+				break;
+			case kExtractRotationMatrix:
+				fromMatrix(MRS::extractRotationMatrix(toMatrix(stack[top - 1])), stack[top - 1]);
+				break;
+			case kExtractScaleMatrix:
+				fromMatrix(MRS::extractScaleMatrix(toMatrix(stack[top - 1])), stack[top - 1]);
+				break;
+			case kPreTranslate:
+			case kPostTranslate:
+			case kPreScale:
+			case kPostScale:
+			{
+				--top;
+				MMatrix matrix = toMatrix(stack[top - 1]);
+				MVector vector = toVector(stack[top]);
+				MRS::Matrix44<double> transformed(matrix.matrix);
+				if (instruction.op == kPreTranslate)
+					transformed = transformed.preTranslate(&vector.x);
+				else if (instruction.op == kPostTranslate)
+					transformed = transformed.postTranslate(&vector.x);
+				else if (instruction.op == kPreScale)
+					transformed = transformed.preScale(&vector.x);
+				else
+					transformed = transformed.postScale(&vector.x);
+				transformed.get(matrix);
+				fromMatrix(matrix, stack[top - 1]);
+				break;
+			}
+			case kPreRotateX:
+			case kPreRotateY:
+			case kPreRotateZ:
+			case kPostRotateX:
+			case kPostRotateY:
+			case kPostRotateZ:
+			{
+				--top;
+				MMatrix matrix = toMatrix(stack[top - 1]);
+				double angle = stack[top][0];
+				MRS::Matrix44<double> transformed(matrix.matrix);
+				switch (instruction.op)
+				{
+					case kPreRotateX:
+						transformed = transformed.preRotateInX(angle);
+						break;
+					case kPreRotateY:
+						transformed = transformed.preRotateInY(angle);
+						break;
+					case kPreRotateZ:
+						transformed = transformed.preRotateInZ(angle);
+						break;
+					case kPostRotateX:
+						transformed = transformed.postRotateInX(angle);
+						break;
+					case kPostRotateY:
+						transformed = transformed.postRotateInY(angle);
+						break;
+					default:
+						transformed = transformed.postRotateInZ(angle);
+						break;
+				}
+				transformed.get(matrix);
+				fromMatrix(matrix, stack[top - 1]);
+				break;
+			}
+
+			// ------ Quaternion ------
+			case kMultiplyQuaternion:
+				--top;
+				fromQuaternion(toQuaternion(stack[top - 1]) * toQuaternion(stack[top]), stack[top - 1]);
+				break;
+			case kMakeQuaternion:
+				top -= 3;
+				for (unsigned int i = 1; i < 4; ++i)
+					stack[top - 1][i] = stack[top - 1 + i][0];
+				break;
+			case kQuaternionToMatrix:
+				fromMatrix(toQuaternion(stack[top - 1]).asMatrix(), stack[top - 1]);
+				break;
+			case kRotateVector:
+				--top;
+				fromVector(MRS::rotateVectorByQuaternion(toVector(stack[top - 1]), toQuaternion(stack[top])), stack[top - 1]);
+				break;
+		}
+	}
+
+	assert(top == 1);
+	std::copy(stack[0], stack[0] + valueSize(m_resultType), outResult);
+
+	return kNoError;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,186 @@
+// Contains a compiler and stack machine for evaluating fused math expressions
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Compiles an expression over named scalar, vector, matrix and quaternion inputs into a flat, statically typed bytecode program
+	Types are resolved during compilation, evaluation is a single pass over the instructions using a fixed size stack
+
+	Grammar
+	-------
+	expression  := term (("+" | "-") term)*
+	term        := unary (("*" | "/") unary)*
+	unary       := ("-" | "+") unary | postfix
+	postfix     := primary ("." ("x" | "y" | "z" | "w"))*
+	primary     := number | "pi" | input | function "(" expression ("," expression)* ")" | "(" expression ")"
+
+	Functions
+	---------
+	abs, min, max, clamp, remap, lerp, smoothstep, pow, sqrt, floor, ceil, round
+	sin, cos, tan, asin, acos, atan, atan2(y, x)
+	vec(x, y, z), dot, cross, length, normalize
+	mat(m00, m01, ..., m33), translation, scale, rotation, basisX, basisY, basisZ, translationMatrix, rotationMatrix, scaleMatrix
+	transformPoint(v, m), transformVector(v, m), preTranslate, postTranslate, preScale, postScale, preRotateX, postRotateX (and likewise for Y and Z)
+	quat(x, y, z, w), matrix(q), rotate(v, q)
+	lerp and smoothstep also accept a pair of vectors with a scalar weight
+	The normalize argument of basisX, basisY and basisZ is treated as a boolean, ie. the basis is normalized if it is non-zero
+
+	Considerations
+	--------------
+	Every operator and function reproduces the compute of the equivalent math node so that a collapsed graph yields identical results
+	Scalar division and atan2 report the same failures as the Divide, Reciprocal and Atan2 nodes, vector division matches DivideVector and is unchecked
+	Matrices and quaternions multiply with "*" as per MultiplyMatrix and MultiplyQuaternion, they do not support any other operator
+	Angles are treated as scalars in radians, the caller is responsible for routing a result to an angle output    */
+
+class ExpressionProgram
+{
+public:
+	enum ValueType : uint8_t
+	{
+		kScalar = 0,
+		kVector = 1,
+		kMatrix = 2,
+		kQuaternion = 3,
+	};
+
+	enum EvaluationError : uint8_t
+	{
+		kNoError = 0,
+		kDivisionByZero = 1,
+		kUndefinedAtan2 = 2,
+	};
+
+	ExpressionProgram();
+
+	// Returns false and populates outError if the expression is invalid, the previous program is discarded in either case
+	bool compile(const std::string& source, const std::vector<std::string>& scalarNames, const std::vector<std::string>& vectorNames,
+		const std::vector<std::string>& matrixNames, const std::vector<std::string>& quaternionNames, std::string& outError);
+	void clear();
+
+	bool isValid() const;
+	ValueType resultType() const;
+
+	/*	Args
+		----
+		scalars : One value per compiled scalar name
+		vectors : Three consecutive values per compiled vector name
+		matrices : Sixteen consecutive values per compiled matrix name, in row major order
+		quaternions : Four consecutive values per compiled quaternion name, in the order (x, y, z, w)
+		outResult : kMaxValueSize values, only the number of values given by valueSize() for the result type are written    */
+	EvaluationError evaluate(const double* scalars, const double* vectors, const double* matrices, const double* quaternions, double* outResult) const;
+
+	static const char* errorMessage(EvaluationError error);
+	// Returns the number of doubles which hold a value of the given type
+	static unsigned int valueSize(ValueType type);
+
+	static const unsigned int kMaxStackDepth = 64;
+	static const unsigned int kMaxValueSize = 16;
+
+	enum OpCode : uint8_t
+	{
+		// Operand indexes into the constant pool or inputs
+		kPushConstant,
+		kLoadScalar,
+		kLoadVector,
+		kLoadMatrix,
+		kLoadQuaternion,
+		kComponent,
+		// Scalar
+		kAdd,
+		kSubtract,
+		kMultiply,
+		kDivide,
+		kNegate,
+		kAbsolute,
+		kMin,
+		kMax,
+		kClamp,
+		kRemap,
+		kLerp,
+		kSmoothstep,
+		kPower,
+		kSquareRoot,
+		kFloor,
+		kCeil,
+		kRound,
+		kSin,
+		kCos,
+		kTan,
+		kAsin,
+		kAcos,
+		kAtan,
+		kAtan2,
+		// Vector
+		kAddVector,
+		kSubtractVector,
+		kMultiplyVector,
+		kMultiplyScalarVector,
+		kDivideVector,
+		kNegateVector,
+		kLerpVector,
+		kSmoothstepVector,
+		kMakeVector,
+		kDotProduct,
+		kCrossProduct,
+		kVectorLength,
+		kNormalizeVector,
+		// Matrix
+		kMultiplyMatrix,
+		kMakeMatrix,
+		kTransformPoint,
+		kTransformVector,
+		kExtractTranslation,
+		kExtractScale,
+		kExtractQuaternion,
+		kExtractBasisX,
+		kExtractBasisY,
+		kExtractBasisZ,
+		kExtractTranslationMatrix,
+		kExtractRotationMatrix,
+		kExtractScaleMatrix,
+		kPreTranslate,
+		kPostTranslate,
+		kPreScale,
+		kPostScale,
+		kPreRotateX,
+		kPreRotateY,
+		kPreRotateZ,
+		kPostRotateX,
+		kPostRotateY,
+		kPostRotateZ,
+		// Quaternion
+		kMultiplyQuaternion,
+		kMakeQuaternion,
+		kQuaternionToMatrix,
+		kRotateVector,
+	};
+
+	struct Instruction
+	{
+		OpCode op;
+		uint32_t operand;
+	};
+
+private:
+	std::vector<Instruction> m_instructions;
+	std::vector<double> m_constants;
+	ValueType m_resultType;
+	bool m_isValid;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -6,7 +6,6 @@
 #include <cassert>
 #include <cmath>
 #include <limits>
-#include <unordered_map>
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -94,17 +93,21 @@ double inOutExpoInterp(double a, double b, double t);
 
 double inOutCircInterp(double a, double b, double t);
 
-// An easing function can be retrieved from the map as follows:
-// double (*easingFunc)(double, double, double) = MRS::easingFuncMap.find(easing)->second;
-static const std::unordered_map<Easing, double(*)(double, double, double)> easingFuncMap = {
-	{kLinear, &lerp}, {kInSine, &inSineInterp}, {kInQuad, &inQuadInterp}, {kInCubic, &inCubicInterp},
-	{kInQuart, &inQuartInterp}, {kInQuint, &inQuintInterp}, {kInExpo, &inExpoInterp}, {kInCirc, &inCircInterp},
-	{kOutSine, &outSineInterp}, {kOutQuad, &outQuadInterp}, {kOutCubic, &outCubicInterp},
-	{kOutQuart, &outQuartInterp}, {kOutQuint, &outQuintInterp}, {kOutExpo, &outExpoInterp}, {kOutCirc, &outCircInterp},
-	{kInOutSine, &inOutSineInterp}, {kInOutQuad, &inOutQuadInterp}, {kInOutCubic, &inOutCubicInterp},
-	{kInOutQuart, &inOutQuartInterp}, {kInOutQuint, &inOutQuintInterp}, {kInOutExpo, &inOutExpoInterp}, {kInOutCirc, &inOutCircInterp},
+typedef double (*EasingFunction)(double a, double b, double t);
+
+// The table is ordered as per the Easing enum, an easing function can therefore be retrieved by indexing with the easing value:
+// MRS::EasingFunction easingFunc = MRS::easingFunctions[easing];
+constexpr EasingFunction easingFunctions[] = {
+	&lerp, &inSineInterp, &inQuadInterp, &inCubicInterp,
+	&inQuartInterp, &inQuintInterp, &inExpoInterp, &inCircInterp,
+	&outSineInterp, &outQuadInterp, &outCubicInterp,
+	&outQuartInterp, &outQuintInterp, &outExpoInterp, &outCircInterp,
+	&inOutSineInterp, &inOutQuadInterp, &inOutCubicInterp,
+	&inOutQuartInterp, &inOutQuintInterp, &inOutExpoInterp, &inOutCircInterp,
 };
 
+static_assert(sizeof(easingFunctions) / sizeof(EasingFunction) == kInOutCirc + 1, "easingFunctions : table must contain a function for every Easing value");
+
 // ------ Misc ------
 
 bool isEqual(double a, double b);
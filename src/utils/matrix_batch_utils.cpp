@@ -0,0 +1,151 @@
+#include "matrix_batch_utils.h"
+
+#include <algorithm>
+
+#include "matrix_batch_utils_kernels.h"
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+/*	Returns the kernels for the highest instruction set supported by the current machine
+	The selection is made once, the function pointers are then shared by every call    */
+const MatrixBatchKernels& getMatrixBatchKernels()
+{
+	static const MatrixBatchKernels baseKernels = makeMatrixBatchKernels<BasePack>();
+	static const bool isAVX2Enabled = getSimdLevel() == kSimdAVX2 && isMatrixBatchAVX2Compiled();
+
+	return isAVX2Enabled ? getMatrixBatchKernelsAVX2() : baseKernels;
+}
+
+// ------ Conversion ------
+
+// The kernels receive the Maya types as arrays of doubles (see matrix_batch_utils_kernels.h), each type must therefore hold nothing but its components
+static_assert(sizeof(MMatrix) == 16 * sizeof(double), "matrix_batch_utils : MMatrix must hold 16 consecutive doubles");
+static_assert(sizeof(MVector) == 3 * sizeof(double), "matrix_batch_utils : MVector must hold 3 consecutive doubles");
+static_assert(sizeof(MQuaternion) == 4 * sizeof(double), "matrix_batch_utils : MQuaternion must hold 4 consecutive doubles");
+static_assert(MEulerRotation::kXYZ == 0 && MEulerRotation::kZYX == kEulerOrderCount - 1, "matrix_batch_utils : rotation orders must index kEulerAxes");
+
+// Each function returns the components of the element at the given index, or nullptr if the array is missing
+const double* components(const MMatrix* matrices, unsigned int index = 0) { return matrices ? &matrices[index].matrix[0][0] : nullptr; }
+double* components(MMatrix* matrices, unsigned int index = 0) { return matrices ? &matrices[index].matrix[0][0] : nullptr; }
+const double* components(const MVector* vectors, unsigned int index = 0) { return vectors ? &vectors[index].x : nullptr; }
+double* components(MVector* vectors, unsigned int index = 0) { return vectors ? &vectors[index].x : nullptr; }
+const double* components(const MQuaternion* quaternions, unsigned int index = 0) { return quaternions ? &quaternions[index].x : nullptr; }
+double* components(MQuaternion* quaternions, unsigned int index = 0) { return quaternions ? &quaternions[index].x : nullptr; }
+
+} // anonymous
+
+// ------ Multiplication ------
+
+void multiplyMatrixBatch(const MMatrix* lhs, const MMatrix* rhs, unsigned int count, MMatrix* outMatrices)
+{
+	getMatrixBatchKernels().multiply(components(lhs), components(rhs), count, components(outMatrices));
+}
+
+void multiplyMatrixBatch(const MMatrix* lhs, const MMatrix& rhs, unsigned int count, MMatrix* outMatrices)
+{
+	getMatrixBatchKernels().multiplyBroadcast(components(lhs), &rhs.matrix[0][0], count, components(outMatrices));
+}
+
+void multiplyMatrixSequence(const MMatrix* matrices, unsigned int count, MMatrix& inOutProduct)
+{
+	getMatrixBatchKernels().multiplySequence(components(matrices), count, &inOutProduct.matrix[0][0]);
+}
+
+// ------ Compose ------
+
+void composeMatrixBatch(const MVector* translation, const MQuaternion* rotation, const MVector* scale, unsigned int count, MMatrix* outMatrices)
+{
+	getMatrixBatchKernels().composeQuaternion(components(translation), components(rotation), components(scale), count, components(outMatrices));
+}
+
+// The rotations are staged as angles and orders in blocks of kMatrixBatchGrainSize
+void composeMatrixBatch(const MVector* translation, const MEulerRotation* rotation, const MVector* scale, unsigned int count, MMatrix* outMatrices)
+{
+	const MatrixBatchKernels& kernels = getMatrixBatchKernels();
+
+	if (!rotation)
+	{
+		kernels.composeEuler(components(translation), nullptr, nullptr, components(scale), count, components(outMatrices));
+		return;
+	}
+
+	double angles[kMatrixBatchGrainSize * 3];
+	unsigned int rotationOrders[kMatrixBatchGrainSize];
+
+	for (unsigned int first = 0; first < count; first += kMatrixBatchGrainSize)
+	{
+		unsigned int blockCount = std::min(kMatrixBatchGrainSize, count - first);
+		for (unsigned int i = 0; i < blockCount; ++i)
+		{
+			const MEulerRotation& euler = rotation[first + i];
+			angles[i * 3] = euler.x;
+			angles[i * 3 + 1] = euler.y;
+			angles[i * 3 + 2] = euler.z;
+			rotationOrders[i] = euler.order;
+		}
+
+		kernels.composeEuler(components(translation, first), angles, rotationOrders, components(scale, first), blockCount, components(outMatrices, first));
+	}
+}
+
+// ------ Decompose ------
+
+void decomposeMatrixBatch(const MMatrix* matrices, unsigned int count, MVector* outTranslation, MQuaternion* outRotation, MVector* outScale)
+{
+	getMatrixBatchKernels().decompose(components(matrices), nullptr, count, components(outTranslation), components(outRotation), nullptr, components(outScale));
+}
+
+// The rotation orders and angles are staged in blocks of kMatrixBatchGrainSize
+void decomposeMatrixBatch(const MMatrix* matrices, const MEulerRotation::RotationOrder* rotationOrders, unsigned int count,
+	MVector* outTranslation, MQuaternion* outQuaternion, MEulerRotation* outEuler, MVector* outScale)
+{
+	const MatrixBatchKernels& kernels = getMatrixBatchKernels();
+
+	if (!outEuler)
+	{
+		kernels.decompose(components(matrices), nullptr, count, components(outTranslation), components(outQuaternion), nullptr, components(outScale));
+		return;
+	}
+
+	double angles[kMatrixBatchGrainSize * 3];
+	unsigned int orders[kMatrixBatchGrainSize];
+
+	for (unsigned int first = 0; first < count; first += kMatrixBatchGrainSize)
+	{
+		unsigned int blockCount = std::min(kMatrixBatchGrainSize, count - first);
+		for (unsigned int i = 0; i < blockCount; ++i)
+			orders[i] = rotationOrders ? rotationOrders[first + i] : MEulerRotation::kXYZ;
+
+		kernels.decompose(components(matrices, first), orders, blockCount,
+			components(outTranslation, first), components(outQuaternion, first), angles, components(outScale, first));
+
+		for (unsigned int i = 0; i < blockCount; ++i)
+			outEuler[first + i] = MEulerRotation{ angles[i * 3], angles[i * 3 + 1], angles[i * 3 + 2], (MEulerRotation::RotationOrder)orders[i] };
+	}
+}
+
+// ------ Extract ------
+
+void extractScaleBatch(const MMatrix* matrices, unsigned int count, MVector* outScale)
+{
+	getMatrixBatchKernels().decompose(components(matrices), nullptr, count, nullptr, nullptr, nullptr, components(outScale));
+}
+
+void extractRotationMatrixBatch(const MMatrix* matrices, unsigned int count, MMatrix* outMatrices)
+{
+	getMatrixBatchKernels().extractRotationMatrix(components(matrices), count, components(outMatrices));
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,63 @@
+// Contains a set of vectorized functions which compose, decompose and multiply arrays of matrices
+// Each function selects a kernel for the highest instruction set supported by the current machine (see simd_utils.h)
+
+#pragma once
+
+#include <maya/MEulerRotation.h>
+#include <maya/MMatrix.h>
+#include <maya/MQuaternion.h>
+#include <maya/MVector.h>
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	The functions below are batch equivalents of the per-matrix functions of matrix_utils.h, several matrices are processed per instruction
+	- Input and output arrays must contain at least count elements, an output array may alias the input array it is computed from
+	- Optional arrays may be nullptr, a missing output is not computed and a missing input takes the value of the identity transform
+	- Results match the per-matrix functions to within a few ulps, as the AVX2 kernels use fused multiply-add and the vectorized trigonometry of simd_math_utils.h
+	- Euler rotations are decomposed with the second angle in the range [-pi / 2, pi / 2], in gimbal lock the third angle is zero    */
+
+// Callers which distribute an array over threads should pass at most this many matrices per call, allowing inputs to be staged in a fixed size buffer
+const unsigned int kMatrixBatchGrainSize = 128;
+
+// ------ Multiplication ------
+
+// Computes outMatrices[i] = lhs[i] * rhs[i]
+void multiplyMatrixBatch(const MMatrix* lhs, const MMatrix* rhs, unsigned int count, MMatrix* outMatrices);
+
+// Computes outMatrices[i] = lhs[i] * rhs, the right hand matrix is shared by every product (eg. transforming local frames into world space)
+void multiplyMatrixBatch(const MMatrix* lhs, const MMatrix& rhs, unsigned int count, MMatrix* outMatrices);
+
+// Post-multiplies the product by each matrix in turn, ie. inOutProduct = inOutProduct * matrices[0] * ... * matrices[count - 1]
+void multiplyMatrixSequence(const MMatrix* matrices, unsigned int count, MMatrix& inOutProduct);
+
+// ------ Compose ------
+
+void composeMatrixBatch(const MVector* translation, const MQuaternion* rotation, const MVector* scale, unsigned int count, MMatrix* outMatrices);
+
+void composeMatrixBatch(const MVector* translation, const MEulerRotation* rotation, const MVector* scale, unsigned int count, MMatrix* outMatrices);
+
+// ------ Decompose ------
+
+void decomposeMatrixBatch(const MMatrix* matrices, unsigned int count, MVector* outTranslation, MQuaternion* outRotation, MVector* outScale);
+
+// Euler rotations are decomposed using the corresponding rotation order, if rotationOrders is nullptr each rotation is decomposed using kXYZ
+void decomposeMatrixBatch(const MMatrix* matrices, const MEulerRotation::RotationOrder* rotationOrders, unsigned int count,
+	MVector* outTranslation, MQuaternion* outQuaternion, MEulerRotation* outEuler, MVector* outScale);
+
+// ------ Extract ------
+
+void extractScaleBatch(const MMatrix* matrices, unsigned int count, MVector* outScale);
+
+void extractRotationMatrixBatch(const MMatrix* matrices, unsigned int count, MMatrix* outMatrices);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,48 @@
+// This translation unit is compiled with AVX2 and FMA enabled (see CMakeLists.txt)
+// Nothing defined here may be called unless getSimdLevel() has returned kSimdAVX2
+
+#include "matrix_batch_utils_kernels.h"
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if defined(MRS_SIMD_X86) && defined(__AVX2__)
+
+const MatrixBatchKernels& getMatrixBatchKernelsAVX2()
+{
+	static const MatrixBatchKernels kernels = makeMatrixBatchKernels<AVX2Pack>();
+	return kernels;
+}
+
+bool isMatrixBatchAVX2Compiled()
+{
+	return true;
+}
+
+#else
+
+// The compiler has not been configured for AVX2, the dispatcher will never select this path
+const MatrixBatchKernels& getMatrixBatchKernelsAVX2()
+{
+	assert(false);
+	static const MatrixBatchKernels kernels = MatrixBatchKernels();
+	return kernels;
+}
+
+bool isMatrixBatchAVX2Compiled()
+{
+	return false;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,537 @@
+// Contains the vectorized kernels used by the batch functions of matrix_batch_utils.h
+// This header is internal to the utils library, each translation unit instantiates the kernels with its own vector type
+// The vector types must be declared within an anonymous namespace so that instantiations compiled with different instruction sets never merge at link time
+// The kernels are restricted to raw arrays and the helpers of simd_utils_packs.h, see the considerations of that header
+
+#pragma once
+
+#include <cassert>
+#include <cfloat>
+
+#include "simd_math_utils_kernels.h"
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Batch functions which are instantiated by each translation unit, see matrix_batch_utils.h for a description of each function
+	Each element is passed as consecutive doubles, matrices hold 16 values in row major order, vectors hold (x, y, z) and quaternions hold (x, y, z, w)
+	Euler rotations are passed as (x, y, z) angles along with an array of rotation orders, the baseline translation unit converts from and to the Maya types    */
+struct MatrixBatchKernels
+{
+	void (*multiply)(const double* lhs, const double* rhs, unsigned int count, double* outMatrices);
+	void (*multiplyBroadcast)(const double* lhs, const double* rhs, unsigned int count, double* outMatrices);
+	void (*multiplySequence)(const double* matrices, unsigned int count, double* inOutProduct);
+	void (*composeQuaternion)(const double* translation, const double* rotation, const double* scale, unsigned int count, double* outMatrices);
+	void (*composeEuler)(const double* translation, const double* angles, const unsigned int* rotationOrders, const double* scale, unsigned int count, double* outMatrices);
+	void (*decompose)(const double* matrices, const unsigned int* rotationOrders, unsigned int count,
+		double* outTranslation, double* outQuaternion, double* outAngles, double* outScale);
+	void (*extractRotationMatrix)(const double* matrices, unsigned int count, double* outMatrices);
+};
+
+// Defined by a translation unit compiled with AVX2 and FMA enabled, must only be used if getSimdLevel() returns kSimdAVX2
+const MatrixBatchKernels& getMatrixBatchKernelsAVX2();
+// Returns false if the above translation unit was built without AVX2 enabled (eg. an unsupported compiler configuration)
+bool isMatrixBatchAVX2Compiled();
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	The multiplication kernels hold a row of the right hand matrix in one or more vectors and accumulate each row of the product from the broadcast left hand elements
+	The remaining kernels process groups of matrices, each lane of the vector type holds the data for a single matrix (structure of arrays)
+	- The elements of each matrix are gathered into lane-major storage so that each element can be loaded directly into a register
+	- If the number of matrices is not a multiple of the width, the surplus lanes duplicate the last matrix and their results are discarded
+
+	Euler rotations of every order are handled by the same sequence of operations
+	- The axes of the rotation order (i, j, k) are mapped onto (x, y, z) by permuting the rows and columns of the rotation basis, ie. R'[a][b] = R[i(a)][i(b)]
+	- An XYZ rotation is then composed or decomposed from the permuted basis
+	- An odd permutation reverses the handedness of the permuted basis, which is equivalent to negating each angle
+
+	The vector types are declared in simd_utils_packs.h, which describes the operations each type must provide    */
+
+// ------ Constants ------
+
+// Axes of each rotation order in the order they are applied, indexed by MEulerRotation::RotationOrder
+const unsigned int kEulerOrderCount = 6;
+const unsigned int kEulerAxes[kEulerOrderCount][3] = { { 0, 1, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 0, 2, 1 }, { 1, 0, 2 }, { 2, 1, 0 } };
+// Sign applied to the angles of the permuted rotation, the last three orders are odd permutations of the axes
+const double kEulerParity[kEulerOrderCount] = { 1.0, 1.0, 1.0, -1.0, -1.0, -1.0 };
+// Used in place of a missing quaternion rotation
+const double kIdentityQuaternion[4] = { 0.0, 0.0, 0.0, 1.0 };
+// A decomposition is considered to be in gimbal lock when the cosine of the second angle falls below this value
+const double kEulerGimbalTolerance = 16.0 * DBL_EPSILON;
+
+// ------ Helpers ------
+
+// Holds the rows of a right hand matrix, each row is split into 4 / width vectors
+template <typename Pack>
+struct MatrixRows
+{
+	static_assert(4 % Pack::width == 0, "MatrixRows : the width of the vector type must divide the number of columns");
+
+	Pack rows[4][4 / Pack::width];
+};
+
+template <typename Pack>
+static void loadMatrixRows(const double* matrix, MatrixRows<Pack>& outRows)
+{
+	for (unsigned int row = 0; row < 4; ++row)
+		for (unsigned int column = 0; column < 4; column += Pack::width)
+			outRows.rows[row][column / Pack::width] = Pack::load(matrix + row * 4 + column);
+}
+
+/*	Computes out = lhs * rhs for row-major arrays of 16 elements, the arrays may alias
+	Each row of the product is accumulated in column order, matching the summation order of MMatrix::operator*    */
+template <typename Pack>
+static void multiplyMatrix(const double* lhs, const MatrixRows<Pack>& rhs, double* out)
+{
+	double product[16];
+	for (unsigned int column = 0; column < 4; column += Pack::width)
+	{
+		unsigned int part = column / Pack::width;
+		for (unsigned int row = 0; row < 4; ++row)
+		{
+			const double* lhsRow = lhs + row * 4;
+			Pack sum = Pack::set1(lhsRow[0]) * rhs.rows[0][part];
+			sum = fmadd(Pack::set1(lhsRow[1]), rhs.rows[1][part], sum);
+			sum = fmadd(Pack::set1(lhsRow[2]), rhs.rows[2][part], sum);
+			sum = fmadd(Pack::set1(lhsRow[3]), rhs.rows[3][part], sum);
+			sum.store(product + row * 4 + column);
+		}
+	}
+
+	copyValues(product, 16, out);
+}
+
+template <typename Pack>
+static void multiplyMatrix(const double* lhs, const double* rhs, double* out)
+{
+	MatrixRows<Pack> rhsRows;
+	loadMatrixRows(rhs, rhsRows);
+	multiplyMatrix(lhs, rhsRows, out);
+}
+
+// Transposes the upper 3x3 of each matrix in the group into vectors, surplus lanes duplicate the last matrix
+template <typename Pack>
+static void gatherBasis(const double* matrices, unsigned int laneCount, Pack (&outBasis)[3][3])
+{
+	double lanes[3][3][Pack::width];
+	for (unsigned int lane = 0; lane < Pack::width; ++lane)
+	{
+		const double* matrix = matrices + minCount(lane, laneCount - 1) * 16;
+		for (unsigned int row = 0; row < 3; ++row)
+			for (unsigned int column = 0; column < 3; ++column)
+				lanes[row][column][lane] = matrix[row * 4 + column];
+	}
+
+	for (unsigned int row = 0; row < 3; ++row)
+		for (unsigned int column = 0; column < 3; ++column)
+			outBasis[row][column] = Pack::load(lanes[row][column]);
+}
+
+// Stores each vector into lane-major storage
+template <typename Pack>
+static void storeBasis(const Pack (&basis)[3][3], double (&outLanes)[3][3][Pack::width])
+{
+	for (unsigned int row = 0; row < 3; ++row)
+		for (unsigned int column = 0; column < 3; ++column)
+			basis[row][column].store(outLanes[row][column]);
+}
+
+/*	Writes the composed transform of each lane, ie. S * R * T
+	The rotation lanes hold the unpermuted basis, missing translation and scale values are treated as zero and one respectively    */
+template <unsigned int Width>
+static void scatterTransforms(const double (&rotationLanes)[3][3][Width], const double* translation, const double* scale,
+	unsigned int laneCount, double* outMatrices)
+{
+	for (unsigned int lane = 0; lane < laneCount; ++lane)
+	{
+		double* matrix = outMatrices + lane * 16;
+		for (unsigned int row = 0; row < 3; ++row)
+		{
+			double rowScale = scale ? scale[lane * 3 + row] : 1.0;
+			matrix[row * 4] = rotationLanes[row][0][lane] * rowScale;
+			matrix[row * 4 + 1] = rotationLanes[row][1][lane] * rowScale;
+			matrix[row * 4 + 2] = rotationLanes[row][2][lane] * rowScale;
+			matrix[row * 4 + 3] = 0.0;
+		}
+
+		matrix[12] = translation ? translation[lane * 3] : 0.0;
+		matrix[13] = translation ? translation[lane * 3 + 1] : 0.0;
+		matrix[14] = translation ? translation[lane * 3 + 2] : 0.0;
+		matrix[15] = 1.0;
+	}
+}
+
+/*	Computes the signed scale of each basis as per extractScale()
+	The scale is given by the length of each row, the z scale is negated if the determinant indicates a reflection    */
+template <typename Pack>
+static void scalePack(const Pack (&basis)[3][3], Pack (&outScale)[3])
+{
+	for (unsigned int row = 0; row < 3; ++row)
+		outScale[row] = sqrt(fmadd(basis[row][2], basis[row][2], fmadd(basis[row][1], basis[row][1], basis[row][0] * basis[row][0])));
+
+	// (x ^ y) * z evaluated as per MMatrix::det3x3()
+	Pack determinant = basis[0][0] * (basis[1][1] * basis[2][2] - basis[2][1] * basis[1][2])
+		- basis[0][1] * (basis[1][0] * basis[2][2] - basis[2][0] * basis[1][2])
+		+ basis[0][2] * (basis[1][0] * basis[2][1] - basis[2][0] * basis[1][1]);
+
+	outScale[2] = select(lessThan(determinant, Pack::set1(0.0)), Pack::set1(0.0) - outScale[2], outScale[2]);
+}
+
+// Removes the scale from each row of the basis, a row whose scale is equal to zero (see MRS::isEqual) is set to a zero vector
+template <typename Pack>
+static void normalizeBasisPack(const Pack (&basis)[3][3], const Pack (&scale)[3], Pack (&outRotation)[3][3])
+{
+	Pack zero = Pack::set1(0.0);
+	Pack epsilon = Pack::set1(DBL_EPSILON);
+
+	for (unsigned int row = 0; row < 3; ++row)
+	{
+		Pack isZero = lessThan(abs(scale[row]), epsilon);
+		Pack multiplier = select(isZero, zero, Pack::set1(1.0) / select(isZero, Pack::set1(1.0), scale[row]));
+		for (unsigned int column = 0; column < 3; ++column)
+			outRotation[row][column] = basis[row][column] * multiplier;
+	}
+}
+
+// Computes the quaternion of each rotation basis as per extractQuaternionRotation()
+template <typename Pack>
+static void quaternionPack(const Pack (&rotation)[3][3], Pack& outX, Pack& outY, Pack& outZ, Pack& outW)
+{
+	Pack zero = Pack::set1(0.0);
+	Pack one = Pack::set1(1.0);
+	Pack half = Pack::set1(0.5);
+	Pack negativeOne = Pack::set1(-1.0);
+
+	outW = sqrt(max(one + rotation[0][0] + rotation[1][1] + rotation[2][2], zero)) * half;
+	outX = sqrt(max(one + rotation[0][0] - rotation[1][1] - rotation[2][2], zero)) * half;
+	outY = sqrt(max(one - rotation[0][0] + rotation[1][1] - rotation[2][2], zero)) * half;
+	outZ = sqrt(max(one - rotation[0][0] - rotation[1][1] + rotation[2][2], zero)) * half;
+	outX = copySign(outX, negativeOne * (rotation[2][1] - rotation[1][2]));
+	outY = copySign(outY, negativeOne * (rotation[0][2] - rotation[2][0]));
+	outZ = copySign(outZ, negativeOne * (rotation[1][0] - rotation[0][1]));
+}
+
+/*	Computes the XYZ angles of each rotation basis, ie. R = Rx * Ry * Rz
+	The second angle is returned in the range [-pi / 2, pi / 2], in gimbal lock the third angle is zero and the first angle holds the combined rotation    */
+template <typename Pack>
+static void eulerXYZPack(const Pack (&rotation)[3][3], Pack& outX, Pack& outY, Pack& outZ)
+{
+	Pack zero = Pack::set1(0.0);
+	Pack cosY = sqrt(fmadd(rotation[0][1], rotation[0][1], rotation[0][0] * rotation[0][0]));
+	Pack isGimbalLock = lessThan(cosY, Pack::set1(kEulerGimbalTolerance));
+
+	outX = atan2Pack(select(isGimbalLock, zero - rotation[2][1], rotation[1][2]), select(isGimbalLock, rotation[1][1], rotation[2][2]));
+	outY = atan2Pack(zero - rotation[0][2], cosY);
+	outZ = select(isGimbalLock, zero, atan2Pack(rotation[0][1], rotation[0][0]));
+}
+
+// Computes the rotation basis of each set of XYZ angles, ie. R = Rx * Ry * Rz
+template <typename Pack>
+static void rotationXYZPack(const Pack& x, const Pack& y, const Pack& z, Pack (&outRotation)[3][3])
+{
+	Pack sinX, cosX, sinY, cosY, sinZ, cosZ;
+	sinCosPack(x, sinX, cosX);
+	sinCosPack(y, sinY, cosY);
+	sinCosPack(z, sinZ, cosZ);
+
+	Pack sinXSinY = sinX * sinY;
+	Pack cosXSinY = cosX * sinY;
+
+	outRotation[0][0] = cosY * cosZ;
+	outRotation[0][1] = cosY * sinZ;
+	outRotation[0][2] = Pack::set1(0.0) - sinY;
+	outRotation[1][0] = sinXSinY * cosZ - cosX * sinZ;
+	outRotation[1][1] = sinXSinY * sinZ + cosX * cosZ;
+	outRotation[1][2] = sinX * cosY;
+	outRotation[2][0] = cosXSinY * cosZ + sinX * sinZ;
+	outRotation[2][1] = cosXSinY * sinZ - sinX * cosZ;
+	outRotation[2][2] = cosX * cosY;
+}
+
+// ------ Kernels ------
+
+template <typename Pack>
+static void multiplyMatrixKernel(const double* lhs, const double* rhs, unsigned int count, double* outMatrices)
+{
+	for (unsigned int i = 0; i < count; ++i)
+		multiplyMatrix<Pack>(lhs + i * 16, rhs + i * 16, outMatrices + i * 16);
+}
+
+// The rows of the right hand matrix are loaded once and shared by every product
+template <typename Pack>
+static void multiplyMatrixBroadcastKernel(const double* lhs, const double* rhs, unsigned int count, double* outMatrices)
+{
+	MatrixRows<Pack> rhsRows;
+	loadMatrixRows(rhs, rhsRows);
+
+	for (unsigned int i = 0; i < count; ++i)
+		multiplyMatrix<Pack>(lhs + i * 16, rhsRows, outMatrices + i * 16);
+}
+
+// The product is accumulated serially, each multiplication is vectorized
+template <typename Pack>
+static void multiplyMatrixSequenceKernel(const double* matrices, unsigned int count, double* inOutProduct)
+{
+	for (unsigned int i = 0; i < count; ++i)
+		multiplyMatrix<Pack>(inOutProduct, matrices + i * 16, inOutProduct);
+}
+
+/*	Composes each transform from a quaternion rotation as per composeMatrix()
+	The quaternion is normalized so that the basis is orthonormal, a zero quaternion is treated as the identity    */
+template <typename Pack>
+static void composeQuaternionKernel(const double* translation, const double* rotation, const double* scale, unsigned int count, double* outMatrices)
+{
+	const unsigned int width = Pack::width;
+	double quaternionLanes[4][width];
+	double rotationLanes[3][3][width];
+
+	for (unsigned int first = 0; first < count; first += width)
+	{
+		unsigned int laneCount = minCount(width, count - first);
+
+		// --- Gather ---
+		for (unsigned int lane = 0; lane < width; ++lane)
+		{
+			unsigned int index = first + minCount(lane, laneCount - 1);
+			const double* quaternion = rotation ? rotation + index * 4 : kIdentityQuaternion;
+			quaternionLanes[0][lane] = quaternion[0];
+			quaternionLanes[1][lane] = quaternion[1];
+			quaternionLanes[2][lane] = quaternion[2];
+			quaternionLanes[3][lane] = quaternion[3];
+		}
+
+		Pack x = Pack::load(quaternionLanes[0]);
+		Pack y = Pack::load(quaternionLanes[1]);
+		Pack z = Pack::load(quaternionLanes[2]);
+		Pack w = Pack::load(quaternionLanes[3]);
+
+		// --- Rotation ---
+		Pack zero = Pack::set1(0.0);
+		Pack one = Pack::set1(1.0);
+		Pack lengthSquared = fmadd(w, w, fmadd(z, z, fmadd(y, y, x * x)));
+		Pack isZero = equal(lengthSquared, zero);
+		Pack s = select(isZero, zero, Pack::set1(2.0) / select(isZero, one, lengthSquared));
+
+		Pack xs = x * s, ys = y * s, zs = z * s;
+		Pack wx = w * xs, wy = w * ys, wz = w * zs;
+		Pack xx = x * xs, xy = x * ys, xz = x * zs;
+		Pack yy = y * ys, yz = y * zs, zz = z * zs;
+
+		Pack basis[3][3];
+		basis[0][0] = one - (yy + zz);
+		basis[0][1] = xy + wz;
+		basis[0][2] = xz - wy;
+		basis[1][0] = xy - wz;
+		basis[1][1] = one - (xx + zz);
+		basis[1][2] = yz + wx;
+		basis[2][0] = xz + wy;
+		basis[2][1] = yz - wx;
+		basis[2][2] = one - (xx + yy);
+
+		// --- Scatter ---
+		storeBasis(basis, rotationLanes);
+		scatterTransforms(rotationLanes, translation ? translation + first * 3 : nullptr, scale ? scale + first * 3 : nullptr, laneCount, outMatrices + first * 16);
+	}
+}
+
+/*	Composes each transform from an euler rotation as per composeMatrix(), the order of each rotation is respected
+	Missing angles are treated as zero, a missing rotation order is treated as kXYZ    */
+template <typename Pack>
+static void composeEulerKernel(const double* translation, const double* angles, const unsigned int* rotationOrders, const double* scale,
+	unsigned int count, double* outMatrices)
+{
+	const unsigned int width = Pack::width;
+	double angleLanes[3][width];
+	double permutedLanes[3][3][width];
+	double rotationLanes[3][3][width];
+
+	for (unsigned int first = 0; first < count; first += width)
+	{
+		unsigned int laneCount = minCount(width, count - first);
+
+		// --- Gather ---
+		// The angles are permuted such that the first applied axis is held by the x lanes
+		for (unsigned int lane = 0; lane < width; ++lane)
+		{
+			unsigned int index = first + minCount(lane, laneCount - 1);
+			unsigned int order = rotationOrders ? rotationOrders[index] : 0;
+			assert(order < kEulerOrderCount);
+			const unsigned int* axes = kEulerAxes[order];
+			double parity = kEulerParity[order];
+			angleLanes[0][lane] = angles ? angles[index * 3 + axes[0]] * parity : 0.0;
+			angleLanes[1][lane] = angles ? angles[index * 3 + axes[1]] * parity : 0.0;
+			angleLanes[2][lane] = angles ? angles[index * 3 + axes[2]] * parity : 0.0;
+		}
+
+		// --- Rotation ---
+		Pack basis[3][3];
+		rotationXYZPack(Pack::load(angleLanes[0]), Pack::load(angleLanes[1]), Pack::load(angleLanes[2]), basis);
+		storeBasis(basis, permutedLanes);
+
+		// --- Scatter ---
+		for (unsigned int lane = 0; lane < laneCount; ++lane)
+		{
+			const unsigned int* axes = kEulerAxes[rotationOrders ? rotationOrders[first + lane] : 0];
+			for (unsigned int row = 0; row < 3; ++row)
+				for (unsigned int column = 0; column < 3; ++column)
+					rotationLanes[axes[row]][axes[column]][lane] = permutedLanes[row][column][lane];
+		}
+
+		scatterTransforms(rotationLanes, translation ? translation + first * 3 : nullptr, scale ? scale + first * 3 : nullptr, laneCount, outMatrices + first * 16);
+	}
+}
+
+/*	Decomposes each matrix as per decomposeMatrix(), any output may be nullptr if it is not required
+	The rotation basis is only normalized once and is shared by both rotation types, a missing rotation order is treated as kXYZ
+	The angles are written in (x, y, z) order for the rotation order of each matrix    */
+template <typename Pack>
+static void decomposeMatrixKernel(const double* matrices, const unsigned int* rotationOrders, unsigned int count,
+	double* outTranslation, double* outQuaternion, double* outAngles, double* outScale)
+{
+	const unsigned int width = Pack::width;
+	double scaleLanes[3][width];
+	double quaternionLanes[4][width];
+	double rotationLanes[3][3][width];
+	double permutedLanes[3][3][width];
+	double angleLanes[3][width];
+
+	if (outTranslation)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			copyValues(matrices + i * 16 + 12, 3, outTranslation + i * 3);
+	}
+
+	if (!outQuaternion && !outAngles && !outScale)
+		return;
+
+	for (unsigned int first = 0; first < count; first += width)
+	{
+		unsigned int laneCount = minCount(width, count - first);
+
+		// --- Scale ---
+		Pack basis[3][3];
+		Pack scale[3];
+		gatherBasis(matrices + first * 16, laneCount, basis);
+		scalePack(basis, scale);
+
+		if (outScale)
+		{
+			for (unsigned int row = 0; row < 3; ++row)
+				scale[row].store(scaleLanes[row]);
+
+			for (unsigned int lane = 0; lane < laneCount; ++lane)
+				for (unsigned int row = 0; row < 3; ++row)
+					outScale[(first + lane) * 3 + row] = scaleLanes[row][lane];
+		}
+
+		if (!outQuaternion && !outAngles)
+			continue;
+
+		Pack rotation[3][3];
+		normalizeBasisPack(basis, scale, rotation);
+
+		// --- Quaternion ---
+		if (outQuaternion)
+		{
+			Pack x, y, z, w;
+			quaternionPack(rotation, x, y, z, w);
+			x.store(quaternionLanes[0]);
+			y.store(quaternionLanes[1]);
+			z.store(quaternionLanes[2]);
+			w.store(quaternionLanes[3]);
+
+			for (unsigned int lane = 0; lane < laneCount; ++lane)
+				for (unsigned int component = 0; component < 4; ++component)
+					outQuaternion[(first + lane) * 4 + component] = quaternionLanes[component][lane];
+		}
+
+		// --- Euler ---
+		if (outAngles)
+		{
+			storeBasis(rotation, rotationLanes);
+
+			for (unsigned int lane = 0; lane < width; ++lane)
+			{
+				unsigned int index = first + minCount(lane, laneCount - 1);
+				unsigned int order = rotationOrders ? rotationOrders[index] : 0;
+				assert(order < kEulerOrderCount);
+				const unsigned int* axes = kEulerAxes[order];
+				for (unsigned int row = 0; row < 3; ++row)
+					for (unsigned int column = 0; column < 3; ++column)
+						permutedLanes[row][column][lane] = rotationLanes[axes[row]][axes[column]][lane];
+			}
+
+			Pack permuted[3][3];
+			for (unsigned int row = 0; row < 3; ++row)
+				for (unsigned int column = 0; column < 3; ++column)
+					permuted[row][column] = Pack::load(permutedLanes[row][column]);
+
+			Pack x, y, z;
+			eulerXYZPack(permuted, x, y, z);
+			x.store(angleLanes[0]);
+			y.store(angleLanes[1]);
+			z.store(angleLanes[2]);
+
+			for (unsigned int lane = 0; lane < laneCount; ++lane)
+			{
+				unsigned int order = rotationOrders ? rotationOrders[first + lane] : 0;
+				const unsigned int* axes = kEulerAxes[order];
+				double parity = kEulerParity[order];
+
+				double* angles = outAngles + (first + lane) * 3;
+				angles[axes[0]] = angleLanes[0][lane] * parity;
+				angles[axes[1]] = angleLanes[1][lane] * parity;
+				angles[axes[2]] = angleLanes[2][lane] * parity;
+			}
+		}
+	}
+}
+
+// Extracts the rotation matrix of each transform as per extractRotationMatrix()
+template <typename Pack>
+static void extractRotationMatrixKernel(const double* matrices, unsigned int count, double* outMatrices)
+{
+	const unsigned int width = Pack::width;
+	double rotationLanes[3][3][width];
+
+	for (unsigned int first = 0; first < count; first += width)
+	{
+		unsigned int laneCount = minCount(width, count - first);
+
+		Pack basis[3][3];
+		Pack scale[3];
+		Pack rotation[3][3];
+		gatherBasis(matrices + first * 16, laneCount, basis);
+		scalePack(basis, scale);
+		normalizeBasisPack(basis, scale, rotation);
+
+		storeBasis(rotation, rotationLanes);
+		scatterTransforms(rotationLanes, nullptr, nullptr, laneCount, outMatrices + first * 16);
+	}
+}
+
+template <typename Pack>
+static MatrixBatchKernels makeMatrixBatchKernels()
+{
+	MatrixBatchKernels kernels;
+	kernels.multiply = &multiplyMatrixKernel<Pack>;
+	kernels.multiplyBroadcast = &multiplyMatrixBroadcastKernel<Pack>;
+	kernels.multiplySequence = &multiplyMatrixSequenceKernel<Pack>;
+	kernels.composeQuaternion = &composeQuaternionKernel<Pack>;
+	kernels.composeEuler = &composeEulerKernel<Pack>;
+	kernels.decompose = &decomposeMatrixKernel<Pack>;
+	kernels.extractRotationMatrix = &extractRotationMatrixKernel<Pack>;
+	return kernels;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
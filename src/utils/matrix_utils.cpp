@@ -28,36 +28,15 @@ MFloatMatrix matrixFromVectors(const MFloatVector& x, const MFloatVector& y, con
 	return ret;
 }
 
-MMatrix composeMatrix(const MVector& translation, const MQuaternion& rotation, const MVector& scale)
-{
-	MTransformationMatrix transform;
-	transform.setTranslation(translation, MSpace::kTransform);
-	transform.setRotationQuaternion(rotation.x, rotation.y, rotation.z, rotation.w);
-	transform.setScale(&scale.x, MSpace::kTransform);
-	return transform.asMatrix();
-}
-
-MMatrix composeMatrix(const MVector& translation, const MEulerRotation& rotation, const MVector& scale)
-{
-	MTransformationMatrix transform;
-	transform.setTranslation(translation, MSpace::kTransform);
-	transform.setRotation(&rotation.x, (MTransformationMatrix::RotationOrder)(rotation.order + 1));
-	transform.setScale(&scale.x, MSpace::kTransform);
-	return transform.asMatrix();
-}
+namespace {
 
-// When all transformations are required, decomposing as a single operation is most efficient
-void decomposeMatrix(const MMatrix& matrix, MVector& outTranslation, MQuaternion& outRotation, MVector& outScale)
+// Removes the given scale from the basis vectors of the matrix, an axis with zero scale is left as a zero vector
+MMatrix normalizeRotationBasis(const MMatrix& matrix, const MVector& scale)
 {
-	outTranslation = extractTranslation(matrix);
-	outScale = extractScale(matrix);
-
-	// By manually extracting the rotation, we can avoid repeating the scaling ops which were just completed
-	// MTransformationMatrix::rotation() would need to recompute the scale in order to normalize the basis as below
 	MMatrix rotMatrix;
-	if (!MRS::isEqual(outScale.x, 0.0))
+	if (!MRS::isEqual(scale.x, 0.0))
 	{
-		double mult = 1.0 / outScale.x;
+		double mult = 1.0 / scale.x;
 		rotMatrix[0][0] = matrix[0][0] * mult;
 		rotMatrix[0][1] = matrix[0][1] * mult;
 		rotMatrix[0][2] = matrix[0][2] * mult;
@@ -65,9 +44,9 @@ void decomposeMatrix(const MMatrix& matrix, MVector& outTranslation, MQuaternion
 	else
 		rotMatrix[0][0] = 0.0;
 
-	if (!MRS::isEqual(outScale.y, 0.0))
+	if (!MRS::isEqual(scale.y, 0.0))
 	{
-		double mult = 1.0 / outScale.y;
+		double mult = 1.0 / scale.y;
 		rotMatrix[1][0] = matrix[1][0] * mult;
 		rotMatrix[1][1] = matrix[1][1] * mult;
 		rotMatrix[1][2] = matrix[1][2] * mult;
@@ -75,9 +54,9 @@ void decomposeMatrix(const MMatrix& matrix, MVector& outTranslation, MQuaternion
 	else
 		rotMatrix[1][1] = 0.0;
 
-	if (!MRS::isEqual(outScale.z, 0.0))
+	if (!MRS::isEqual(scale.z, 0.0))
 	{
-		double mult = 1.0 / outScale.z;
+		double mult = 1.0 / scale.z;
 		rotMatrix[2][0] = matrix[2][0] * mult;
 		rotMatrix[2][1] = matrix[2][1] * mult;
 		rotMatrix[2][2] = matrix[2][2] * mult;
@@ -85,54 +64,77 @@ void decomposeMatrix(const MMatrix& matrix, MVector& outTranslation, MQuaternion
 	else
 		rotMatrix[2][2] = 0.0;
 
-	outRotation.w = std::sqrt(std::max(0.0, 1.0 + rotMatrix[0][0] + rotMatrix[1][1] + rotMatrix[2][2])) * 0.5;
-	outRotation.x = std::sqrt(std::max(0.0, 1.0 + rotMatrix[0][0] - rotMatrix[1][1] - rotMatrix[2][2])) * 0.5;
-	outRotation.y = std::sqrt(std::max(0.0, 1.0 - rotMatrix[0][0] + rotMatrix[1][1] - rotMatrix[2][2])) * 0.5;
-	outRotation.z = std::sqrt(std::max(0.0, 1.0 - rotMatrix[0][0] - rotMatrix[1][1] + rotMatrix[2][2])) * 0.5;
-	outRotation.x = std::copysign(outRotation.x, -1 * (rotMatrix[2][1] - rotMatrix[1][2]));
-	outRotation.y = std::copysign(outRotation.y, -1 * (rotMatrix[0][2] - rotMatrix[2][0]));
-	outRotation.z = std::copysign(outRotation.z, -1 * (rotMatrix[1][0] - rotMatrix[0][1]));
+	return rotMatrix;
 }
 
-void decomposeMatrix(const MMatrix& matrix, MEulerRotation::RotationOrder rotationOrder, MVector& outTranslation, MEulerRotation& outRotation, MVector& outScale)
+// Rotation conversion: https://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
+MQuaternion quaternionFromRotationMatrix(const MMatrix& rotMatrix)
+{
+	MQuaternion output;
+	output.w = std::sqrt(std::max(0.0, 1.0 + rotMatrix[0][0] + rotMatrix[1][1] + rotMatrix[2][2])) * 0.5;
+	output.x = std::sqrt(std::max(0.0, 1.0 + rotMatrix[0][0] - rotMatrix[1][1] - rotMatrix[2][2])) * 0.5;
+	output.y = std::sqrt(std::max(0.0, 1.0 - rotMatrix[0][0] + rotMatrix[1][1] - rotMatrix[2][2])) * 0.5;
+	output.z = std::sqrt(std::max(0.0, 1.0 - rotMatrix[0][0] - rotMatrix[1][1] + rotMatrix[2][2])) * 0.5;
+	output.x = std::copysign(output.x, -1 * (rotMatrix[2][1] - rotMatrix[1][2]));
+	output.y = std::copysign(output.y, -1 * (rotMatrix[0][2] - rotMatrix[2][0]));
+	output.z = std::copysign(output.z, -1 * (rotMatrix[1][0] - rotMatrix[0][1]));
+
+	return output;
+}
+
+} // anonymous
+
+MMatrix composeMatrix(const MVector& translation, const MQuaternion& rotation, const MVector& scale)
+{
+	MTransformationMatrix transform;
+	transform.setTranslation(translation, MSpace::kTransform);
+	transform.setRotationQuaternion(rotation.x, rotation.y, rotation.z, rotation.w);
+	transform.setScale(&scale.x, MSpace::kTransform);
+	return transform.asMatrix();
+}
+
+MMatrix composeMatrix(const MVector& translation, const MEulerRotation& rotation, const MVector& scale)
+{
+	MTransformationMatrix transform;
+	transform.setTranslation(translation, MSpace::kTransform);
+	transform.setRotation(&rotation.x, (MTransformationMatrix::RotationOrder)(rotation.order + 1));
+	transform.setScale(&scale.x, MSpace::kTransform);
+	return transform.asMatrix();
+}
+
+// When all transformations are required, decomposing as a single operation is most efficient
+void decomposeMatrix(const MMatrix& matrix, MVector& outTranslation, MQuaternion& outRotation, MVector& outScale)
 {
 	outTranslation = extractTranslation(matrix);
 	outScale = extractScale(matrix);
 
-	MMatrix rotMatrix;
-	if (!MRS::isEqual(outScale.x, 0.0))
-	{
-		double mult = 1.0 / outScale.x;
-		rotMatrix[0][0] = matrix[0][0] * mult;
-		rotMatrix[0][1] = matrix[0][1] * mult;
-		rotMatrix[0][2] = matrix[0][2] * mult;
-	}
-	else
-		rotMatrix[0][0] = 0.0;
-
-	if (!MRS::isEqual(outScale.y, 0.0))
-	{
-		double mult = 1.0 / outScale.y;
-		rotMatrix[1][0] = matrix[1][0] * mult;
-		rotMatrix[1][1] = matrix[1][1] * mult;
-		rotMatrix[1][2] = matrix[1][2] * mult;
-	}
-	else
-		rotMatrix[1][1] = 0.0;
+	// By manually extracting the rotation, we can avoid repeating the scaling ops which were just completed
+	// MTransformationMatrix::rotation() would need to recompute the scale in order to normalize the basis
+	MMatrix rotMatrix = normalizeRotationBasis(matrix, outScale);
+	outRotation = quaternionFromRotationMatrix(rotMatrix);
+}
 
-	if (!MRS::isEqual(outScale.z, 0.0))
-	{
-		double mult = 1.0 / outScale.z;
-		rotMatrix[2][0] = matrix[2][0] * mult;
-		rotMatrix[2][1] = matrix[2][1] * mult;
-		rotMatrix[2][2] = matrix[2][2] * mult;
-	}
-	else
-		rotMatrix[2][2] = 0.0;
+void decomposeMatrix(const MMatrix& matrix, MEulerRotation::RotationOrder rotationOrder, MVector& outTranslation, MEulerRotation& outRotation, MVector& outScale)
+{
+	outTranslation = extractTranslation(matrix);
+	outScale = extractScale(matrix);
 
+	MMatrix rotMatrix = normalizeRotationBasis(matrix, outScale);
 	outRotation = MEulerRotation::decompose(rotMatrix, rotationOrder);
 }
 
+// Used when both rotation types are required, the rotation basis is only normalized once and is shared by both extractions
+void decomposeMatrix(const MMatrix& matrix, MEulerRotation::RotationOrder rotationOrder, MVector& outTranslation, MQuaternion& outQuaternion, 
+	MEulerRotation& outEuler, MVector& outScale)
+{
+	outTranslation = extractTranslation(matrix);
+	outScale = extractScale(matrix);
+
+	MMatrix rotMatrix = normalizeRotationBasis(matrix, outScale);
+	outQuaternion = quaternionFromRotationMatrix(rotMatrix);
+	outEuler = MEulerRotation::decompose(rotMatrix, rotationOrder);
+}
+
 // Rotational matrix is orthonormal, therefore scale is determined by the length of each vector in the composition
 // Negative scaling in any single axis will always be extracted into the z-axis
 // Negative scaling in any two axes will be treated as a rotation around the third axis
@@ -197,40 +199,8 @@ MFloatVector extractScale(const MFloatMatrix& matrix)
 // Rotational matrix is orthonormal, therefore normalizing each basis in the composition will remove the effects of scaling
 MMatrix extractRotationMatrix(const MMatrix& matrix)
 {
-	MMatrix rotMatrix;
 	MVector scale = extractScale(matrix);
-
-	if (!MRS::isEqual(scale.x, 0.0))
-	{
-		double mult = 1.0 / scale.x;
-		rotMatrix[0][0] = matrix[0][0] * mult; 
-		rotMatrix[0][1] = matrix[0][1] * mult;
-		rotMatrix[0][2] = matrix[0][2] * mult;
-	}
-	else
-		rotMatrix[0][0] = 0.0;
-
-	if (!MRS::isEqual(scale.y, 0.0))
-	{
-		double mult = 1.0 / scale.y;
-		rotMatrix[1][0] = matrix[1][0] * mult;
-		rotMatrix[1][1] = matrix[1][1] * mult;
-		rotMatrix[1][2] = matrix[1][2] * mult;
-	}
-	else
-		rotMatrix[1][1] = 0.0;
-
-	if (!MRS::isEqual(scale.z, 0.0))
-	{
-		double mult = 1.0 / scale.z;
-		rotMatrix[2][0] = matrix[2][0] * mult;
-		rotMatrix[2][1] = matrix[2][1] * mult;
-		rotMatrix[2][2] = matrix[2][2] * mult;
-	}
-	else
-		rotMatrix[2][2] = 0.0;
-
-	return rotMatrix;
+	return normalizeRotationBasis(matrix, scale);
 }
 
 MFloatMatrix extractRotationMatrix(const MFloatMatrix& matrix)
@@ -285,18 +255,8 @@ MEulerRotation extractEulerRotation(const MMatrix& matrix, MEulerRotation::Rotat
 // Rotation conversion: https://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
 MQuaternion extractQuaternionRotation(const MMatrix& matrix)
 {
-	MQuaternion output;
 	MMatrix rotMatrix = extractRotationMatrix(matrix);
-
-	output.w = std::sqrt(std::max(0.0, 1.0 + rotMatrix[0][0] + rotMatrix[1][1] + rotMatrix[2][2])) * 0.5;
-	output.x = std::sqrt(std::max(0.0, 1.0 + rotMatrix[0][0] - rotMatrix[1][1] - rotMatrix[2][2])) * 0.5;
-	output.y = std::sqrt(std::max(0.0, 1.0 - rotMatrix[0][0] + rotMatrix[1][1] - rotMatrix[2][2])) * 0.5;
-	output.z = std::sqrt(std::max(0.0, 1.0 - rotMatrix[0][0] - rotMatrix[1][1] + rotMatrix[2][2])) * 0.5;
-	output.x = std::copysign(output.x, -1 * (rotMatrix[2][1] - rotMatrix[1][2]));
-	output.y = std::copysign(output.y, -1 * (rotMatrix[0][2] - rotMatrix[2][0]));
-	output.z = std::copysign(output.z, -1 * (rotMatrix[1][0] - rotMatrix[0][1]));
-
-	return output;
+	return quaternionFromRotationMatrix(rotMatrix);
 }
 
 MMatrix extractTranslationMatrix(const MMatrix& matrix, MSpace::Space space)
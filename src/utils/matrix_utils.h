@@ -37,6 +37,9 @@ void decomposeMatrix(const MMatrix& matrix, MVector& outTranslation, MQuaternion
 
 void decomposeMatrix(const MMatrix& matrix, MEulerRotation::RotationOrder rotationOrder, MVector& outTranslation, MEulerRotation& outRotation, MVector& outScale);
 
+void decomposeMatrix(const MMatrix& matrix, MEulerRotation::RotationOrder rotationOrder, MVector& outTranslation, MQuaternion& outQuaternion, 
+	MEulerRotation& outEuler, MVector& outScale);
+
 MMatrix extractScaleMatrix(const MMatrix& matrix);
 
 MFloatMatrix extractScaleMatrix(const MFloatMatrix& matrix);
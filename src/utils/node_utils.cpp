@@ -12,6 +12,56 @@
 
 namespace MRS {
 
+namespace {
+
+/*	Elements are accessed through the function set held by the caller, which indexes the storage of the data object directly
+	Copying an array out of the function set (eg. returning MFnXxxArrayData::array() by value) is not guaranteed to be elided and would produce a deep copy
+	An empty data object is attached if the handle does not hold data of the expected type, so that length() is always valid    */
+template<typename TFnData, typename TArray>
+void inputDataArrayView(MDataHandle& inHandle, TFnData& outFnData)
+{
+	MObject dataObj = inHandle.data();
+	if (dataObj.isNull() || !outFnData.setObject(dataObj))
+		outFnData.create(TArray());
+}
+
+// Elements are copied through a view on the calling thread, the buffer is resized rather than cleared so that its capacity is retained
+template<typename TFnData, typename TArray, typename TValue>
+void inputDataArrayValue(MDataHandle& inHandle, std::vector<TValue>& values)
+{
+	TFnData fnData;
+	inputDataArrayView<TFnData, TArray>(inHandle, fnData);
+	unsigned int length = fnData.length();
+	values.resize(length);
+
+	for (unsigned int i = 0; i < length; ++i)
+		values[i] = fnData[i];
+}
+
+/*	Output data objects follow the same ownership rule for typed and plugin data (see outputPluginDataArrayValue and outputPluginDataArrayView)
+	- The data object held by an output handle belongs to the node, Maya copies data objects when a value propagates to another plug (see DataArrayHelper::copy)
+	- The held object is therefore written in place, a new object is only created if the handle is empty or holds an incompatible type
+	- Storage which is shared between data objects (ie. the plugin data buffers) is detached before it is written, typed data does not share storage
+	Typed data can only be resized by assigning an array, an allocation is therefore made whenever the length changes    */
+template<typename TFnData, typename TArray>
+void outputDataArrayView(MDataHandle& outHandle, unsigned int length, TFnData& outFnData)
+{
+	MObject dataObj = outHandle.data();
+	if (dataObj.isNull() || !outFnData.setObject(dataObj))
+		dataObj = outFnData.create(TArray(length));
+	else if (outFnData.length() != length)
+		outFnData.set(TArray(length));
+
+	outHandle.setMObject(dataObj);
+	outHandle.setClean();
+
+	// The handle may store its own reference to the data, attach to whichever object it will hand out
+	dataObj = outHandle.data();
+	outFnData.setObject(dataObj);
+}
+
+} // anonymous
+
 // ------ Create --------------------------------------------------------------------------------------------------------------------------------------------------
 
 // ------ MFnNumericAttribute ------
@@ -143,7 +193,7 @@ void NodeHelper::createMessageAttribute(MObject& outAttr, const char* longName,
 // ------ MFnEnumAttribute ------
 
 /*	This is a pre-defined enum attribute, providing the user with a range of easing options
-	The selected option can be used to retrieve an interpolation function from the MRS::easingFuncMap
+	The selected option can be used to retrieve an interpolation function from the MRS::easingFunctions table
 
 	linear			(0)		Linear interpolation, constant velocity
 	inSine			(1)		Sinusoidal easing in, accelerating from zero velocity
@@ -389,6 +439,15 @@ void NodeHelper::createMeshAttribute(MObject& outAttr, const char* longName, con
 	setAttributeFlags(fnAttr, flags);
 }
 
+void NodeHelper::createStringAttribute(MObject& outAttr, const char* longName, const char* shortName, const MString& value, int32_t flags)
+{
+	MFnStringData fnData;
+	MFnTypedAttribute fnAttr;
+	MObject dataObj = fnData.create(value);
+	outAttr = fnAttr.create(longName, shortName, MFnData::kString, dataObj);
+	setAttributeFlags(fnAttr, flags);
+}
+
 // ------ MRampAttribute ------
 
 // Note, an intial value should be added in MPxNode::postConstructor() to avoid errors in the Attribute Editor
@@ -464,46 +523,61 @@ std::vector<bool> NodeHelper::inputBoolArrayValue(MDataBlock& dataBlock, const M
 std::vector<int> NodeHelper::inputIntArrayValue(MDataBlock& dataBlock, const MObject& attr)
 {
 	std::vector<int> values;
+	inputIntArrayValue(dataBlock, attr, values);
+	return values;
+}
+
+void NodeHelper::inputIntArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<int>& values)
+{
 	MArrayDataHandle inArrayHandle = dataBlock.inputArrayValue(attr);
+	unsigned int count = inArrayHandle.elementCount();
 
-	values.reserve(inArrayHandle.elementCount());
-	for (unsigned int i = 0; i < inArrayHandle.elementCount(); i++)
+	values.resize(count);
+	for (unsigned int i = 0; i < count; i++)
 	{
-		values.push_back(inArrayHandle.inputValue().asInt());
+		values[i] = inArrayHandle.inputValue().asInt();
 		inArrayHandle.next();
 	}
-
-	return values;
 }
 
 std::vector<float> NodeHelper::inputFloatArrayValue(MDataBlock& dataBlock, const MObject& attr)
 {
 	std::vector<float> values;
+	inputFloatArrayValue(dataBlock, attr, values);
+	return values;
+}
+
+void NodeHelper::inputFloatArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<float>& values)
+{
 	MArrayDataHandle inArrayHandle = dataBlock.inputArrayValue(attr);
+	unsigned int count = inArrayHandle.elementCount();
 
-	values.reserve(inArrayHandle.elementCount());
-	for (unsigned int i = 0; i < inArrayHandle.elementCount(); i++)
+	values.resize(count);
+	for (unsigned int i = 0; i < count; i++)
 	{
-		values.push_back(inArrayHandle.inputValue().asFloat());
+		values[i] = inArrayHandle.inputValue().asFloat();
 		inArrayHandle.next();
 	}
-
-	return values;
 }
 
 std::vector<double> NodeHelper::inputDoubleArrayValue(MDataBlock& dataBlock, const MObject& attr)
 {
 	std::vector<double> values;
+	inputDoubleArrayValue(dataBlock, attr, values);
+	return values;
+}
+
+void NodeHelper::inputDoubleArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<double>& values)
+{
 	MArrayDataHandle inArrayHandle = dataBlock.inputArrayValue(attr);
+	unsigned int count = inArrayHandle.elementCount();
 
-	values.reserve(inArrayHandle.elementCount());
-	for (unsigned int i = 0; i < inArrayHandle.elementCount(); i++)
+	values.resize(count);
+	for (unsigned int i = 0; i < count; i++)
 	{
-		values.push_back(inArrayHandle.inputValue().asDouble());
+		values[i] = inArrayHandle.inputValue().asDouble();
 		inArrayHandle.next();
 	}
-
-	return values;
 }
 
 std::vector<MFloatVector> NodeHelper::inputFloatVectorArrayValue(MDataBlock& dataBlock, const MObject& attr)
@@ -524,16 +598,21 @@ std::vector<MFloatVector> NodeHelper::inputFloatVectorArrayValue(MDataBlock& dat
 std::vector<MVector> NodeHelper::inputVectorArrayValue(MDataBlock& dataBlock, const MObject& attr)
 {
 	std::vector<MVector> values;
+	inputVectorArrayValue(dataBlock, attr, values);
+	return values;
+}
+
+void NodeHelper::inputVectorArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MVector>& values)
+{
 	MArrayDataHandle inArrayHandle = dataBlock.inputArrayValue(attr);
+	unsigned int count = inArrayHandle.elementCount();
 
-	values.reserve(inArrayHandle.elementCount());
-	for (unsigned int i = 0; i < inArrayHandle.elementCount(); i++)
+	values.resize(count);
+	for (unsigned int i = 0; i < count; i++)
 	{
-		values.push_back(inArrayHandle.inputValue().asVector());
+		values[i] = inArrayHandle.inputValue().asVector();
 		inArrayHandle.next();
 	}
-
-	return values;
 }
 
 // ------ MFnUnitAttribute ------
@@ -631,16 +710,21 @@ std::vector<MFloatMatrix> NodeHelper::inputFloatMatrixArrayValue(MDataBlock& dat
 std::vector<MMatrix> NodeHelper::inputMatrixArrayValue(MDataBlock& dataBlock, const MObject& attr)
 {
 	std::vector<MMatrix> values;
+	inputMatrixArrayValue(dataBlock, attr, values);
+	return values;
+}
+
+void NodeHelper::inputMatrixArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MMatrix>& values)
+{
 	MArrayDataHandle inArrayHandle = dataBlock.inputArrayValue(attr);
+	unsigned int count = inArrayHandle.elementCount();
 
-	values.reserve(inArrayHandle.elementCount());
-	for (unsigned int i = 0; i < inArrayHandle.elementCount(); i++)
+	values.resize(count);
+	for (unsigned int i = 0; i < count; i++)
 	{
-		values.push_back(inArrayHandle.inputValue().asMatrix());
+		values[i] = inArrayHandle.inputValue().asMatrix();
 		inArrayHandle.next();
 	}
-
-	return values;
 }
 
 // ------ MFnEnumAttribute ------
@@ -900,6 +984,78 @@ std::vector<MMatrix> NodeHelper::inputMatrixDataArrayValue(MDataBlock& dataBlock
 	return values;
 }
 
+void NodeHelper::inputIntDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<int>& values)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayValue<MFnIntArrayData, MIntArray>(inHandle, values);
+}
+
+void NodeHelper::inputFloatDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<float>& values)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayValue<MFnFloatArrayData, MFloatArray>(inHandle, values);
+}
+
+void NodeHelper::inputDoubleDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<double>& values)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayValue<MFnDoubleArrayData, MDoubleArray>(inHandle, values);
+}
+
+void NodeHelper::inputVectorDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MVector>& values)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayValue<MFnVectorArrayData, MVectorArray>(inHandle, values);
+}
+
+void NodeHelper::inputPointDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MPoint>& values)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayValue<MFnPointArrayData, MPointArray>(inHandle, values);
+}
+
+void NodeHelper::inputMatrixDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MMatrix>& values)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayValue<MFnMatrixArrayData, MMatrixArray>(inHandle, values);
+}
+
+void NodeHelper::inputIntDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnIntArrayData& outFnData)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayView<MFnIntArrayData, MIntArray>(inHandle, outFnData);
+}
+
+void NodeHelper::inputFloatDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnFloatArrayData& outFnData)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayView<MFnFloatArrayData, MFloatArray>(inHandle, outFnData);
+}
+
+void NodeHelper::inputDoubleDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnDoubleArrayData& outFnData)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayView<MFnDoubleArrayData, MDoubleArray>(inHandle, outFnData);
+}
+
+void NodeHelper::inputVectorDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnVectorArrayData& outFnData)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayView<MFnVectorArrayData, MVectorArray>(inHandle, outFnData);
+}
+
+void NodeHelper::inputPointDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnPointArrayData& outFnData)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayView<MFnPointArrayData, MPointArray>(inHandle, outFnData);
+}
+
+void NodeHelper::inputMatrixDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnMatrixArrayData& outFnData)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	inputDataArrayView<MFnMatrixArrayData, MMatrixArray>(inHandle, outFnData);
+}
+
 MObject NodeHelper::inputNurbsCurveValue(MDataBlock& dataBlock, const MObject& attr)
 {
 	MDataHandle inHandle = dataBlock.inputValue(attr);
@@ -918,6 +1074,12 @@ MObject NodeHelper::inputMeshValue(MDataBlock& dataBlock, const MObject& attr)
 	return inHandle.asMesh();
 }
 
+MString NodeHelper::inputStringValue(MDataBlock& dataBlock, const MObject& attr)
+{
+	MDataHandle inHandle = dataBlock.inputValue(attr);
+	return inHandle.asString();
+}
+
 
 // ------ MRampAttribute ------
 
@@ -1421,100 +1583,98 @@ void NodeHelper::outputEulerArrayValue(MDataBlock& dataBlock, const MObject& par
 // ------ MFnTypedAttribute ------
 void NodeHelper::outputIntDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<int>& values)
 {
-	unsigned int size = (int)values.size();
-	MDataHandle outHandle = dataBlock.outputValue(attr);
-	MFnIntArrayData fnData;
-	MIntArray outDataArray;
-	outDataArray.setLength(size);
+	unsigned int size = (unsigned int)values.size();
+	MFnIntArrayData fnOutData;
+	outputIntDataArrayView(dataBlock, attr, size, fnOutData);
 
 	for (unsigned int i = 0; i < size; i++)
-		outDataArray[i] = values[i];
-
-	MObject outObj = fnData.create(outDataArray);
-	outHandle.setMObject(outObj);
-	outHandle.setClean();
+		fnOutData[i] = values[i];
 }
 
 void NodeHelper::outputFloatDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<float>& values)
 {
-	{
-		unsigned int size = (int)values.size();
-		MDataHandle outHandle = dataBlock.outputValue(attr);
-		MFnFloatArrayData fnData;
-		MFloatArray outDataArray;
-		outDataArray.setLength(size);
-
-		for (unsigned int i = 0; i < size; i++)
-			outDataArray[i] = values[i];
-
-		MObject outObj = fnData.create(outDataArray);
-		outHandle.setMObject(outObj);
-		outHandle.setClean();
-	}
+	unsigned int size = (unsigned int)values.size();
+	MFnFloatArrayData fnOutData;
+	outputFloatDataArrayView(dataBlock, attr, size, fnOutData);
+
+	for (unsigned int i = 0; i < size; i++)
+		fnOutData[i] = values[i];
 }
 
 void NodeHelper::outputDoubleDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<double>& values)
 {
-	unsigned int size = (int)values.size();
-	MDataHandle outHandle = dataBlock.outputValue(attr);
-	MFnDoubleArrayData fnData;
-	MDoubleArray outDataArray;
-	outDataArray.setLength(size);
+	unsigned int size = (unsigned int)values.size();
+	MFnDoubleArrayData fnOutData;
+	outputDoubleDataArrayView(dataBlock, attr, size, fnOutData);
 
 	for (unsigned int i = 0; i < size; i++)
-		outDataArray[i] = values[i];
-
-	MObject outObj = fnData.create(outDataArray);
-	outHandle.setMObject(outObj);
-	outHandle.setClean();
+		fnOutData[i] = values[i];
 }
 
 void NodeHelper::outputVectorDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<MVector>& values)
 {
-	unsigned int size = (int)values.size();
-	MDataHandle outHandle = dataBlock.outputValue(attr);
-	MFnVectorArrayData fnData;
-	MVectorArray outDataArray;
-	outDataArray.setLength(size);
+	unsigned int size = (unsigned int)values.size();
+	MFnVectorArrayData fnOutData;
+	outputVectorDataArrayView(dataBlock, attr, size, fnOutData);
 
 	for (unsigned int i = 0; i < size; i++)
-		outDataArray[i] = values[i];
-
-	MObject outObj = fnData.create(outDataArray);
-	outHandle.setMObject(outObj);
-	outHandle.setClean();
+		fnOutData[i] = values[i];
 }
 
 void NodeHelper::outputPointDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<MPoint>& values)
 {
-	unsigned int size = (int)values.size();
-	MDataHandle outHandle = dataBlock.outputValue(attr);
-	MFnPointArrayData fnData;
-	MPointArray outDataArray;
-	outDataArray.setLength(size);
+	unsigned int size = (unsigned int)values.size();
+	MFnPointArrayData fnOutData;
+	outputPointDataArrayView(dataBlock, attr, size, fnOutData);
 
 	for (unsigned int i = 0; i < size; i++)
-		outDataArray[i] = values[i];
-
-	MObject outObj = fnData.create(outDataArray);
-	outHandle.setMObject(outObj);
-	outHandle.setClean();
+		fnOutData[i] = values[i];
 }
 
 void NodeHelper::outputMatrixDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<MMatrix>& values)
 {
-	unsigned int size = (int)values.size();
-	MDataHandle outHandle = dataBlock.outputValue(attr);
-	MFnMatrixArrayData fnData;
-	MMatrixArray outDataArray;
-	outDataArray.setLength(size);
+	unsigned int size = (unsigned int)values.size();
+	MFnMatrixArrayData fnOutData;
+	outputMatrixDataArrayView(dataBlock, attr, size, fnOutData);
 
 	for (unsigned int i = 0; i < size; i++)
-		outDataArray[i] = values[i];
+		fnOutData[i] = values[i];
+}
 
-	MObject outObj = fnData.create(outDataArray);
-	outHandle.setMObject(outObj);
-	outHandle.setClean();
+void NodeHelper::outputIntDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnIntArrayData& outFnData)
+{
+	MDataHandle outHandle = dataBlock.outputValue(attr);
+	outputDataArrayView<MFnIntArrayData, MIntArray>(outHandle, length, outFnData);
+}
+
+void NodeHelper::outputFloatDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnFloatArrayData& outFnData)
+{
+	MDataHandle outHandle = dataBlock.outputValue(attr);
+	outputDataArrayView<MFnFloatArrayData, MFloatArray>(outHandle, length, outFnData);
+}
+
+void NodeHelper::outputDoubleDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnDoubleArrayData& outFnData)
+{
+	MDataHandle outHandle = dataBlock.outputValue(attr);
+	outputDataArrayView<MFnDoubleArrayData, MDoubleArray>(outHandle, length, outFnData);
+}
+
+void NodeHelper::outputVectorDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnVectorArrayData& outFnData)
+{
+	MDataHandle outHandle = dataBlock.outputValue(attr);
+	outputDataArrayView<MFnVectorArrayData, MVectorArray>(outHandle, length, outFnData);
+}
+
+void NodeHelper::outputPointDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnPointArrayData& outFnData)
+{
+	MDataHandle outHandle = dataBlock.outputValue(attr);
+	outputDataArrayView<MFnPointArrayData, MPointArray>(outHandle, length, outFnData);
+}
+
+void NodeHelper::outputMatrixDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnMatrixArrayData& outFnData)
+{
+	MDataHandle outHandle = dataBlock.outputValue(attr);
+	outputDataArrayView<MFnMatrixArrayData, MMatrixArray>(outHandle, length, outFnData);
 }
 
 // ------ MRampAttribute ------
@@ -25,6 +25,7 @@
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnPluginData.h>
 #include <maya/MFnPointArrayData.h>
+#include <maya/MFnStringData.h>
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MFnUnitAttribute.h>
 #include <maya/MFnVectorArrayData.h>
@@ -139,6 +140,7 @@ public:
 	static void createNurbsCurveAttribute(MObject& outAttr, const char* longName, const char* shortName, int32_t flags);
 	static void createNurbsSurfaceAttribute(MObject& outAttr, const char* longName, const char* shortName, int32_t flags);
 	static void createMeshAttribute(MObject& outAttr, const char* longName, const char* shortName, int32_t flags);
+	static void createStringAttribute(MObject& outAttr, const char* longName, const char* shortName, const MString& value, int32_t flags);
 
 	// Custom data plugin
 	template<typename TDataPlugin, typename TData>
@@ -176,6 +178,12 @@ public:
 	static std::vector<MFloatVector> inputFloatVectorArrayValue(MDataBlock& dataBlock, const MObject& attr); // MFnNumericData::k3Float
 	static std::vector<MVector> inputVectorArrayValue(MDataBlock& dataBlock, const MObject& attr); // MFnNumericData::k3Double
 
+	// Overloads which populate an existing buffer, a persistent node member can be passed to avoid reallocating on each compute
+	static void inputIntArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<int>& values);
+	static void inputFloatArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<float>& values);
+	static void inputDoubleArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<double>& values);
+	static void inputVectorArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MVector>& values); // MFnNumericData::k3Double
+
 	// ------ MFnUnitAttribute ------
 	static MAngle inputAngleValue(MDataBlock& dataBlock, const MObject& attr);
 	static MDistance inputDistanceValue(MDataBlock& dataBlock, const MObject& attr);
@@ -191,6 +199,7 @@ public:
 
 	static std::vector<MFloatMatrix> inputFloatMatrixArrayValue(MDataBlock& dataBlock, const MObject& attr);
 	static std::vector<MMatrix> inputMatrixArrayValue(MDataBlock& dataBlock, const MObject& attr);
+	static void inputMatrixArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MMatrix>& values);
 
 	// ------ MFnEnumAttribute ------
 	static MRS::Easing inputEasingValue(MDataBlock& dataBlock, const MObject& attr);
@@ -223,9 +232,30 @@ public:
 	static std::vector<MVector> inputVectorDataArrayValue(MDataBlock& dataBlock, const MObject& attr);
 	static std::vector<MPoint> inputPointDataArrayValue(MDataBlock& dataBlock, const MObject& attr);
 	static std::vector<MMatrix> inputMatrixDataArrayValue(MDataBlock& dataBlock, const MObject& attr);
+
+	// Overloads which populate an existing buffer, a persistent node member can be passed to avoid reallocating on each compute
+	// The values are copied on the calling thread, therefore the buffer can be read by worker threads (see views)
+	static void inputIntDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<int>& values);
+	static void inputFloatDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<float>& values);
+	static void inputDoubleDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<double>& values);
+	static void inputVectorDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MVector>& values);
+	static void inputPointDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MPoint>& values);
+	static void inputMatrixDataArrayValue(MDataBlock& dataBlock, const MObject& attr, std::vector<MMatrix>& values);
+
+	/*	Views attach the given function set to the input data object so that its elements can be read without being copied
+		Elements should be read through the function set (length(), operator[]) and must not be modified, the view is only valid for the current compute
+		Function sets are not thread safe, a view must only be accessed from the thread which invoked compute (ie. not from a parallelFor body)    */
+	static void inputIntDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnIntArrayData& outFnData);
+	static void inputFloatDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnFloatArrayData& outFnData);
+	static void inputDoubleDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnDoubleArrayData& outFnData);
+	static void inputVectorDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnVectorArrayData& outFnData);
+	static void inputPointDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnPointArrayData& outFnData);
+	static void inputMatrixDataArrayView(MDataBlock& dataBlock, const MObject& attr, MFnMatrixArrayData& outFnData);
+
 	static MObject inputNurbsCurveValue(MDataBlock& dataBlock, const MObject& attr);
 	static MObject inputNurbsSurfaceValue(MDataBlock& dataBlock, const MObject& attr);
 	static MObject inputMeshValue(MDataBlock& dataBlock, const MObject& attr);
+	static MString inputStringValue(MDataBlock& dataBlock, const MObject& attr);
 
 	// Unlikely to need an array of data arrays..
 
@@ -243,6 +273,18 @@ public:
 		return out;
 	}
 
+	// The view shares the buffer of the input data object, elements are constructed on access rather than copied into a separate vector
+	template<typename TDataPlugin>
+	static MRS::DataArrayView<TDataPlugin> inputPluginDataArrayView(MDataBlock& dataBlock, const MObject& attr)
+	{
+		MDataHandle handle = dataBlock.inputValue(attr);
+		MObject dataObj = handle.data();
+		MFnPluginData fnData(dataObj);
+		TDataPlugin* customData = (TDataPlugin*)fnData.data();
+		
+		return customData ? MRS::DataArrayView<TDataPlugin>(*customData) : MRS::DataArrayView<TDataPlugin>();
+	}
+
 	// ------ MRampAttribute ------
 	static SeExpr2::Curve<double> inputCurveRampAttribute(MDataBlock& dataBlock, const MObject& parentAttr, MObject& positionAttr, 
 		MObject& valueAttr, MObject& interpAttr);
@@ -314,6 +356,17 @@ public:
 	static void outputPointDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<MPoint>& values);
 	static void outputMatrixDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const std::vector<MMatrix>& values);
 
+	/*	Views attach the given function set to the output data object, which is resized to the given number of elements, the handle is marked clean on return
+		The data object held by the handle is written in place and reused between computes (see the ownership rule in node_utils.cpp)
+		Every element should be written through the function set (operator[]) before the compute returns
+		Function sets are not thread safe, parallel computes should write to a node owned buffer and pass it to the output*DataArrayValue functions    */
+	static void outputIntDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnIntArrayData& outFnData);
+	static void outputFloatDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnFloatArrayData& outFnData);
+	static void outputDoubleDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnDoubleArrayData& outFnData);
+	static void outputVectorDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnVectorArrayData& outFnData);
+	static void outputPointDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnPointArrayData& outFnData);
+	static void outputMatrixDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length, MFnMatrixArrayData& outFnData);
+
 	// Unlikely to need an array of data arrays..
 
 	// Custom data plugin
@@ -329,6 +382,37 @@ public:
 		outHandle.setClean();
 	}
 
+	// Shares the buffer of the view with the output data object, no values are copied (eg. when forwarding an input)
+	// As with every output, the data object held by the handle is updated in place, only its reference to the shared buffer is replaced
+	template<typename TDataPlugin>
+	static void outputPluginDataArrayValue(MDataBlock& dataBlock, const MObject& attr, const MRS::DataArrayView<TDataPlugin>& view)
+	{
+		MDataHandle outHandle = dataBlock.outputValue(attr);
+		MObject dataObj = outHandle.data();
+		MFnPluginData fnData(dataObj);
+		TDataPlugin* customData = (TDataPlugin*)fnData.data();
+		customData->setBuffer(view.buffer());
+		outHandle.setMPxData((MPxData*)customData);
+		outHandle.setClean();
+	}
+
+	/*	Returns the values of the output data object, which is resized to the given number of elements in place
+		The buffer is reused between computes unless it is shared with another data object, in which case a new buffer is allocated (see DataArrayHelper::overwriteData)
+		Every value (kSize per element) should be written by the caller before the compute returns, the handle is marked clean on return    */
+	template<typename TDataPlugin>
+	static typename TDataPlugin::ValueType* outputPluginDataArrayView(MDataBlock& dataBlock, const MObject& attr, unsigned int length)
+	{
+		MDataHandle outHandle = dataBlock.outputValue(attr);
+		MObject dataObj = outHandle.data();
+		MFnPluginData fnData(dataObj);
+		TDataPlugin* customData = (TDataPlugin*)fnData.data();
+		typename TDataPlugin::ValueType* values = customData->overwriteValues(length);
+		outHandle.setMPxData((MPxData*)customData);
+		outHandle.setClean();
+
+		return values;
+	}
+
 	// ------ MRampAttribute ------
 	static void outputCurveRampAttribute(MDataBlock& dataBlock, const MObject& parentAttr, MObject& positionAttr, MObject& valueAttr, MObject& interpAttr,
 		std::vector<SeExpr2::Curve<double>::CV>& values);
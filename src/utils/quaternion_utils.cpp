@@ -27,65 +27,150 @@ MQuaternion quaternionMultiply(const MQuaternion& q1, const MQuaternion& q2) {
 	return result;
 }
 
-MQuaternion averageQuaternion(const std::vector<MQuaternion>& quaternions)
+namespace {
+
+const double kNormEpsilon = 1e-12;
+// The principal eigenvector is found using power iteration, the dominant eigenvalue is usually well separated for rotations being blended
+// If the iteration does not satisfy the error bound within the iteration limit, a symmetric eigensolver is used instead
+const unsigned int kMaxPowerIterations = 32;
+const double kPowerIterationTolerance = 1e-10;
+
+// Accumulated state of a single pass over the inputs, weights are optional (ie. nullptr means every weight is one)
+struct QuaternionAccumulator
 {
+	Eigen::Matrix4d outerProduct;
+	Eigen::Vector4d alignedSum;
+	double weightSum;
+	double minAlignment;
+	bool hasNegativeWeight;
+};
+
+// Only the ten unique elements of the symmetric outer product are summed, components are ordered (w, x, y, z)
+// Each quaternion is also aligned with the first input so that the sum can be used as an estimate of the average
+void accumulateQuaternions(const std::vector<MQuaternion>& quaternions, const double* weights, QuaternionAccumulator& acc)
+{
+	const MQuaternion& reference = quaternions[0];
 	size_t count = quaternions.size();
-	if (count == 0)
-		return MQuaternion::identity;
 
-	Eigen::Matrix<double, 4, 4> A = Eigen::Matrix<double, 4, 4>::Zero();
-	for (const MQuaternion& input : quaternions)
+	double ww = 0.0, wx = 0.0, wy = 0.0, wz = 0.0, xx = 0.0, xy = 0.0, xz = 0.0, yy = 0.0, yz = 0.0, zz = 0.0;
+	double sw = 0.0, sx = 0.0, sy = 0.0, sz = 0.0;
+	double weightSum = 0.0;
+	double minAlignment = 1.0;
+	bool hasNegativeWeight = false;
+
+	for (size_t i = 0; i < count; ++i)
 	{
-		Eigen::Matrix<double, 1, 4> q(1, 4);
-		q(0) = input.w;
-		q(1) = input.x;
-		q(2) = input.y;
-		q(3) = input.z;
-		A += q.transpose()*q;
+		const MQuaternion& q = quaternions[i];
+		double weight = weights ? weights[i] : 1.0;
+		double qw = q.w * weight;
+		double qx = q.x * weight;
+		double qy = q.y * weight;
+		double qz = q.z * weight;
+
+		ww += q.w * qw; wx += q.w * qx; wy += q.w * qy; wz += q.w * qz;
+		xx += q.x * qx; xy += q.x * qy; xz += q.x * qz;
+		yy += q.y * qy; yz += q.y * qz;
+		zz += q.z * qz;
+
+		double alignment = q.w * reference.w + q.x * reference.x + q.y * reference.y + q.z * reference.z;
+		double sign = alignment < 0.0 ? -1.0 : 1.0;
+		sw += sign * qw; sx += sign * qx; sy += sign * qy; sz += sign * qz;
+
+		weightSum += weight;
+		hasNegativeWeight |= weight < 0.0;
+		if (weight != 0.0)
+			minAlignment = std::min(minAlignment, std::abs(alignment));
 	}
-	A /= (double)count;
 
-	Eigen::EigenSolver<Eigen::Matrix<double, 4, 4>> es{ A };
-	Eigen::Matrix<std::complex<double>, 4, 1> mat{ es.eigenvalues() };
-	int maxEigenValueIndex;
-	mat.real().maxCoeff(&maxEigenValueIndex);
-	Eigen::Matrix<double, 4, 1> maxEigenVec{ es.eigenvectors().real().block(0, maxEigenValueIndex, 4, 1) };
+	acc.outerProduct << ww, wx, wy, wz,
+		wx, xx, xy, xz,
+		wy, xy, yy, yz,
+		wz, xz, yz, zz;
+	acc.alignedSum << sw, sx, sy, sz;
+	acc.weightSum = weightSum;
+	acc.minAlignment = minAlignment;
+	acc.hasNegativeWeight = hasNegativeWeight;
+}
 
-	return MQuaternion{ maxEigenVec(1), maxEigenVec(2), maxEigenVec(3), maxEigenVec(0) };
+// Finds the eigenvector with the largest eigenvalue, the sum of the eigenvalues (ie. the trace) is used to bound the error of the power iteration
+// If the Rayleigh quotient exceeds half the trace, the gap to the second eigenvalue is at least twice the quotient minus the trace
+Eigen::Vector4d principalEigenvector(const Eigen::Matrix4d& A, const Eigen::Vector4d& estimate, bool isPositiveSemiDefinite)
+{
+	double estimateNorm = estimate.norm();
+	if (isPositiveSemiDefinite && estimateNorm > kNormEpsilon)
+	{
+		double trace = A.trace();
+		Eigen::Vector4d v = estimate / estimateNorm;
+		for (unsigned int i = 0; i < kMaxPowerIterations; ++i)
+		{
+			Eigen::Vector4d Av = A * v;
+			double rayleigh = v.dot(Av);
+			double residual = (Av - rayleigh * v).norm();
+			double gap = 2.0 * rayleigh - trace;
+			if (gap > 0.0 && residual <= kPowerIterationTolerance * gap)
+				return v;
+
+			double norm = Av.norm();
+			if (norm <= kNormEpsilon)
+				break;
+
+			v = Av / norm;
+		}
+	}
+
+	// Eigenvalues are sorted in increasing order
+	Eigen::SelfAdjointEigenSolver<Eigen::Matrix4d> es{ A };
+	return es.eigenvectors().col(3);
 }
 
-MQuaternion averageWeightedQuaternion(const std::vector<MQuaternion>& quaternions, const std::vector<double>& weights)
+MQuaternion averageAccumulatedQuaternions(const std::vector<MQuaternion>& quaternions, const double* weights, double nlerpTolerance)
 {
-	size_t count = quaternions.size();
-	if (count == 0)
-		return MQuaternion::identity;
-	assert(count == weights.size());
+	QuaternionAccumulator acc;
+	accumulateQuaternions(quaternions, weights, acc);
 
-	double weightSum = 0.0;
-	Eigen::Matrix<double, 4, 4> A = Eigen::Matrix<double, 4, 4>::Zero();
-	for (unsigned int i = 0; i < count; ++i)
+	// The angle between two rotations is twice the angle between their quaternions
+	if (nlerpTolerance > 0.0 && !acc.hasNegativeWeight && acc.minAlignment >= std::cos(nlerpTolerance * 0.5))
 	{
-		const MQuaternion& input = quaternions[i];
-		const double& weight = weights[i];
-		Eigen::Matrix<double, 1, 4> q(1, 4);
-		q(0) = input.w;
-		q(1) = input.x;
-		q(2) = input.y;
-		q(3) = input.z;
-		A += weight * (q.transpose()*q);
-		weightSum += weight;
+		double norm = acc.alignedSum.norm();
+		if (norm > kNormEpsilon)
+		{
+			Eigen::Vector4d average = acc.alignedSum / norm;
+			return MQuaternion{ average(1), average(2), average(3), average(0) };
+		}
 	}
 
-	if (weightSum != 0.0)
-		A /= weightSum;
+	// Normalizing by a negative weight sum reverses the order of the eigenvalues
+	Eigen::Matrix4d A = acc.outerProduct;
+	if (acc.weightSum != 0.0)
+		A /= acc.weightSum;
+
+	bool isPositiveSemiDefinite = !acc.hasNegativeWeight && acc.weightSum > 0.0;
+	Eigen::Vector4d average = principalEigenvector(A, acc.alignedSum, isPositiveSemiDefinite);
+
+	const MQuaternion& reference = quaternions[0];
+	if (average(0) * reference.w + average(1) * reference.x + average(2) * reference.y + average(3) * reference.z < 0.0)
+		average = -average;
+
+	return MQuaternion{ average(1), average(2), average(3), average(0) };
+}
+
+} // anonymous
 
-	Eigen::EigenSolver<Eigen::Matrix<double, 4, 4>> es{ A };
-	Eigen::Matrix<std::complex<double>, 4, 1> mat{ es.eigenvalues() };
-	int maxEigenValueIndex;
-	mat.real().maxCoeff(&maxEigenValueIndex);
-	Eigen::Matrix<double, 4, 1> maxEigenVec{ es.eigenvectors().real().block(0, maxEigenValueIndex, 4, 1) };
+MQuaternion averageQuaternion(const std::vector<MQuaternion>& quaternions, double nlerpTolerance)
+{
+	if (quaternions.empty())
+		return MQuaternion::identity;
+
+	return averageAccumulatedQuaternions(quaternions, nullptr, nlerpTolerance);
+}
+
+MQuaternion averageWeightedQuaternion(const std::vector<MQuaternion>& quaternions, const std::vector<double>& weights, double nlerpTolerance)
+{
+	if (quaternions.empty())
+		return MQuaternion::identity;
+	assert(quaternions.size() == weights.size());
 
-	return MQuaternion{ maxEigenVec(1), maxEigenVec(2), maxEigenVec(3), maxEigenVec(0) };
+	return averageAccumulatedQuaternions(quaternions, weights.data(), nlerpTolerance);
 }
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
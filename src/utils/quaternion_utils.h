@@ -1,6 +1,8 @@
 // Contains a set of functions relating to quaternion operations
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -25,9 +27,12 @@ MQuaternion quaternionMultiply(const MQuaternion& q1, const MQuaternion& q2);
 // Based upon the following resources:
 // https://stackoverflow.com/questions/12374087/average-of-multiple-quaternions
 // https://github.com/fizyr/dr_eigen/blob/master/include/dr_eigen/average.hpp
-MQuaternion averageQuaternion(const std::vector<MQuaternion>& quaternions);
+// The average is the principal eigenvector of the symmetric outer product matrix, the sign of the result is aligned with the first input
+// If every rotation lies within nlerpTolerance radians of the first input, the normalized sum of the sign aligned inputs is returned instead
+// This approximation is cheaper to compute and is close to the true average for small angles, a tolerance of zero disables it
+MQuaternion averageQuaternion(const std::vector<MQuaternion>& quaternions, double nlerpTolerance = 0.0);
 // Function assumes the size of each input array is equal, else behaviour is undefined
-MQuaternion averageWeightedQuaternion(const std::vector<MQuaternion>& quaternions, const std::vector<double>& weights);
+MQuaternion averageWeightedQuaternion(const std::vector<MQuaternion>& quaternions, const std::vector<double>& weights, double nlerpTolerance = 0.0);
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,94 @@
+#include "simd_math_utils.h"
+
+#include "simd_math_utils_kernels.h"
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+static_assert(kEasingFunctionCount == kInOutCirc + 1, "simd_math_utils : kEasingFunctionCount must match the Easing enum");
+
+/*	Returns the kernels for the highest instruction set supported by the current machine
+	The selection is made once, the function pointers are then shared by every call    */
+const SimdMathKernels& getSimdMathKernels()
+{
+	static const SimdMathKernels baseKernels = makeSimdMathKernels<BasePack>();
+	static const bool isAVX2Enabled = getSimdLevel() == kSimdAVX2 && isSimdMathAVX2Compiled();
+
+	return isAVX2Enabled ? getSimdMathKernelsAVX2() : baseKernels;
+}
+
+} // anonymous
+
+// ------ Trigonometry ------
+
+void sinArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().sin(values, count, outValues);
+}
+
+void cosArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().cos(values, count, outValues);
+}
+
+void sinCosArray(const double* values, unsigned int count, double* outSin, double* outCos)
+{
+	getSimdMathKernels().sinCos(values, count, outSin, outCos);
+}
+
+void tanArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().tan(values, count, outValues);
+}
+
+void asinArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().asin(values, count, outValues);
+}
+
+void acosArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().acos(values, count, outValues);
+}
+
+void atanArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().atan(values, count, outValues);
+}
+
+void atan2Array(const double* y, const double* x, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().atan2(y, x, count, outValues);
+}
+
+// ------ Exponential ------
+
+void expArray(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().exp(values, count, outValues);
+}
+
+void exp2Array(const double* values, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().exp2(values, count, outValues);
+}
+
+// ------ Interpolation ------
+
+void easeArray(Easing easing, double a, double b, const double* t, unsigned int count, double* outValues)
+{
+	getSimdMathKernels().ease(static_cast<unsigned int>(easing), a, b, t, count, outValues);
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,69 @@
+// Contains a set of vectorized transcendental functions which are applied to arrays of values
+// Each function selects a kernel for the highest instruction set supported by the current machine (see simd_utils.h)
+
+#pragma once
+
+#include "math_utils.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	The functions below evaluate polynomial approximations over every element of an array, several elements are processed per instruction
+	- Input and output arrays must contain at least count elements, an output array may alias the input array it is computed from
+	- Results are deterministic for a given machine but may differ in the last bit between machines, as the AVX2 kernels use fused multiply-add
+	- Errors are the maximum observed deviation from the exact result in units of the last place (ulp), measured over several million arguments per function
+
+	Function	Domain							Max Error
+	--------	------							---------
+	sin, cos	|x| <= 1.6e6					0.8 ulp, larger arguments (including infinities) are evaluated by the standard library
+	tan			|x| <= 1.6e6					2.2 ulp
+	asin, acos	[-1, 1]							2.4 ulp, NaN outside of the domain
+	atan		all								0.8 ulp
+	atan2		all								1.6 ulp, the sign of a zero y is ignored and the coordinate (0, 0) returns 0
+	exp			[-745.13, 709.78]				1.0 ulp, arguments outside of the range return 0 or infinity
+	exp2		[-1074, 1023]					1.1 ulp, arguments outside of the range return 0 or infinity    */
+
+// Callers which distribute an array over threads should pass at most this many values per call, allowing results to be staged in a fixed size buffer
+const unsigned int kSimdMathGrainSize = 512;
+
+// ------ Trigonometry ------
+
+void sinArray(const double* values, unsigned int count, double* outValues);
+
+void cosArray(const double* values, unsigned int count, double* outValues);
+
+void sinCosArray(const double* values, unsigned int count, double* outSin, double* outCos);
+
+void tanArray(const double* values, unsigned int count, double* outValues);
+
+void asinArray(const double* values, unsigned int count, double* outValues);
+
+void acosArray(const double* values, unsigned int count, double* outValues);
+
+void atanArray(const double* values, unsigned int count, double* outValues);
+
+void atan2Array(const double* y, const double* x, unsigned int count, double* outValues);
+
+// ------ Exponential ------
+
+void expArray(const double* values, unsigned int count, double* outValues);
+
+void exp2Array(const double* values, unsigned int count, double* outValues);
+
+// ------ Interpolation ------
+
+/*	Applies the easing function over range [a, b] to each parameter t, with domain [0, 1]
+	Results match the scalar easing functions (see MRS::easingFunctions) to within a few ulps of the range
+	The circular functions are the exception as they avoid the cancellation of 1 - t^2 close to the end points, making them more accurate    */
+void easeArray(Easing easing, double a, double b, const double* t, unsigned int count, double* outValues);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
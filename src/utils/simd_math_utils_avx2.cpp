@@ -0,0 +1,48 @@
+// This translation unit is compiled with AVX2 and FMA enabled (see CMakeLists.txt)
+// Nothing defined here may be called unless getSimdLevel() has returned kSimdAVX2
+
+#include "simd_math_utils_kernels.h"
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if defined(MRS_SIMD_X86) && defined(__AVX2__)
+
+const SimdMathKernels& getSimdMathKernelsAVX2()
+{
+	static const SimdMathKernels kernels = makeSimdMathKernels<AVX2Pack>();
+	return kernels;
+}
+
+bool isSimdMathAVX2Compiled()
+{
+	return true;
+}
+
+#else
+
+// The compiler has not been configured for AVX2, the dispatcher will never select this path
+const SimdMathKernels& getSimdMathKernelsAVX2()
+{
+	assert(false);
+	static const SimdMathKernels kernels = SimdMathKernels();
+	return kernels;
+}
+
+bool isSimdMathAVX2Compiled()
+{
+	return false;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,641 @@
+// Contains the vectorized kernels used by the array functions of simd_math_utils.h
+// This header is internal to the utils library, each translation unit instantiates the kernels with its own vector type
+// The vector types must be declared within an anonymous namespace so that instantiations compiled with different instruction sets never merge at link time
+// The kernels are restricted to raw arrays and the helpers of simd_utils_packs.h, see the considerations of that header
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Array functions which are instantiated by each translation unit, see simd_math_utils.h for a description of each function
+struct SimdMathKernels
+{
+	void (*sin)(const double* values, unsigned int count, double* outValues);
+	void (*cos)(const double* values, unsigned int count, double* outValues);
+	void (*tan)(const double* values, unsigned int count, double* outValues);
+	void (*asin)(const double* values, unsigned int count, double* outValues);
+	void (*acos)(const double* values, unsigned int count, double* outValues);
+	void (*atan)(const double* values, unsigned int count, double* outValues);
+	void (*exp)(const double* values, unsigned int count, double* outValues);
+	void (*exp2)(const double* values, unsigned int count, double* outValues);
+	void (*sinCos)(const double* values, unsigned int count, double* outSin, double* outCos);
+	void (*atan2)(const double* y, const double* x, unsigned int count, double* outValues);
+	void (*ease)(unsigned int easing, double a, double b, const double* t, unsigned int count, double* outValues);
+};
+
+// The number of easing functions, the easing is passed to the kernels as an index ordered as per the Easing enum of math_utils.h
+const unsigned int kEasingFunctionCount = 22;
+
+// Defined by a translation unit compiled with AVX2 and FMA enabled, must only be used if getSimdLevel() returns kSimdAVX2
+const SimdMathKernels& getSimdMathKernelsAVX2();
+// Returns false if the above translation unit was built without AVX2 enabled (eg. an unsupported compiler configuration)
+bool isSimdMathAVX2Compiled();
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	The kernels below are templated over a vector type, each lane of which holds a single value (structure of arrays)
+	Every lane is processed by the same sequence of operations, branches are replaced by evaluating both sides and selecting the result per lane
+
+	The vector types are declared in simd_utils_packs.h, which describes the operations each type must provide    */
+
+// ------ Constants ------
+
+// Three part representation of pi / 2, the first two parts have 33 significant bits so that their product with any quadrant below 2^20 is exact
+const double kPiOver2Part1 = 1.57079632673412561417e+00;
+const double kPiOver2Part2 = 6.07710050630396597660e-11;
+const double kPiOver2Part3 = 2.02226624879595063154e-21;
+// Arguments whose magnitude exceeds this limit are evaluated by the standard library (quadrant >= 2^20)
+const double kSinCosReductionLimit = 1.6e6;
+
+// Two part representation of ln(2), the first part has 32 significant bits
+const double kLn2Part1 = 6.93147180369123816490e-01;
+const double kLn2Part2 = 1.90821492927058770002e-10;
+
+// Pairs of values for which atan(hi + lo) is known, used by the argument reduction of atan
+const double kAtanHi[4] = { 4.63647609000806093515e-01, 7.85398163397448278999e-01, 9.82793723247329054082e-01, 1.57079632679489655800e+00 };
+const double kAtanLo[4] = { 2.26987774529616870924e-17, 3.06161699786838301793e-17, 1.39033110312309984516e-17, 6.12323399573676603587e-17 };
+const double kPiLo = 1.22464679914735317723e-16;
+
+// ------ Polynomials ------
+
+/*	Minimax approximations on the reduced interval [-pi / 4, pi / 4] with an error below 2^-58 (coefficients as per fdlibm)
+	The reduced argument is represented by r + rTail, where the tail holds the rounding error of the reduction
+	Evaluated as sin(r) = r + r^3 * S(r^2) and cos(r) = 1 - r^2 / 2 + r^4 * C(r^2), the tail contributes to the first order terms only    */
+template <typename Pack>
+static Pack sinPolynomial(const Pack& r, const Pack& rTail)
+{
+	Pack z = r * r;
+	Pack v = z * r;
+	Pack p = fmadd(z, Pack::set1(1.58969099521155010221e-10), Pack::set1(-2.50507602534068634195e-08));
+	p = fmadd(z, p, Pack::set1(2.75573137070700676789e-06));
+	p = fmadd(z, p, Pack::set1(-1.98412698298579493134e-04));
+	p = fmadd(z, p, Pack::set1(8.33333333332248946124e-03));
+	return r - ((z * (Pack::set1(0.5) * rTail - v * p) - rTail) - v * Pack::set1(-1.66666666666666324348e-01));
+}
+
+template <typename Pack>
+static Pack cosPolynomial(const Pack& r, const Pack& rTail)
+{
+	Pack z = r * r;
+	Pack p = fmadd(z, Pack::set1(-1.13596475577881948265e-11), Pack::set1(2.08757232129817482790e-09));
+	p = fmadd(z, p, Pack::set1(-2.75573143513906633035e-07));
+	p = fmadd(z, p, Pack::set1(2.48015872894767294178e-05));
+	p = fmadd(z, p, Pack::set1(-1.38888888888741095749e-03));
+	p = fmadd(z, p, Pack::set1(4.16666666666666019037e-02));
+
+	// The leading terms are summed such that the rounding error of 1 - z / 2 is recovered
+	Pack halfZ = z * Pack::set1(0.5);
+	Pack w = Pack::set1(1.0) - halfZ;
+	return w + (((Pack::set1(1.0) - w) - halfZ) + (z * z * p - r * rTail));
+}
+
+/*	Minimax approximation of atan(x) on the interval [-7 / 16, 7 / 16] (coefficients as per fdlibm)
+	Returns the correction term x * A(x^2) such that atan(x) = x - x * A(x^2)    */
+template <typename Pack>
+static Pack atanCorrection(const Pack& x)
+{
+	Pack z = x * x;
+	Pack w = z * z;
+	Pack s1 = fmadd(w, Pack::set1(1.62858201153657823623e-02), Pack::set1(4.97687799461593236017e-02));
+	s1 = fmadd(w, s1, Pack::set1(6.66107313738753120669e-02));
+	s1 = fmadd(w, s1, Pack::set1(9.09088713343650656196e-02));
+	s1 = fmadd(w, s1, Pack::set1(1.42857142725034663711e-01));
+	s1 = fmadd(w, s1, Pack::set1(3.33333333333329318027e-01));
+	Pack s2 = fmadd(w, Pack::set1(-3.65315727442169155270e-02), Pack::set1(-5.83357013379057348645e-02));
+	s2 = fmadd(w, s2, Pack::set1(-7.69187620504482999495e-02));
+	s2 = fmadd(w, s2, Pack::set1(-1.11111104054623557880e-01));
+	s2 = fmadd(w, s2, Pack::set1(-1.99999999998764832476e-01));
+	return x * (z * s1 + w * s2);
+}
+
+/*	Rational approximation of exp(r) on the interval [-ln(2) / 2, ln(2) / 2] with an error below 2^-59 (coefficients as per fdlibm)
+	Evaluated as exp(r) = 1 - ((r * c) / (c - 2) - r) where c = r - r^2 * P(r^2)    */
+template <typename Pack>
+static Pack expPolynomial(const Pack& r)
+{
+	Pack z = r * r;
+	Pack p = fmadd(z, Pack::set1(4.13813679705723846039e-08), Pack::set1(-1.65339022054652515390e-06));
+	p = fmadd(z, p, Pack::set1(6.61375632143793436117e-05));
+	p = fmadd(z, p, Pack::set1(-2.77777777770155933842e-03));
+	p = fmadd(z, p, Pack::set1(1.66666666666666019037e-01));
+	Pack c = r - z * p;
+	return Pack::set1(1.0) - ((r * c) / (c - Pack::set1(2.0)) - r);
+}
+
+// ------ Functions ------
+
+/*	Computes the sine and cosine of each lane
+	The argument is reduced to r = x - q * pi / 2 where q is the nearest integer, the quadrant (q mod 4) then selects and negates the polynomials
+	Lanes whose magnitude exceeds kSinCosReductionLimit (including infinities and NaNs) cause the whole vector to be evaluated by the standard library    */
+template <typename Pack>
+static void sinCosPack(const Pack& x, Pack& outSin, Pack& outCos)
+{
+	if (!isAll(lessEqual(abs(x), Pack::set1(kSinCosReductionLimit))))
+	{
+		double lanes[Pack::width];
+		double sinLanes[Pack::width];
+		double cosLanes[Pack::width];
+		x.store(lanes);
+
+		for (unsigned int lane = 0; lane < Pack::width; ++lane)
+		{
+			sinLanes[lane] = std::sin(lanes[lane]);
+			cosLanes[lane] = std::cos(lanes[lane]);
+		}
+
+		outSin = Pack::load(sinLanes);
+		outCos = Pack::load(cosLanes);
+		return;
+	}
+
+	// The products of the quadrant with the first two parts are exact, the rounding error of the second subtraction is carried by the tail
+	Pack q = roundNearest(x * Pack::set1(2.0 / M_PI));
+	Pack r1 = fmadd(q, Pack::set1(-kPiOver2Part1), x);
+	Pack w = q * Pack::set1(kPiOver2Part2);
+	Pack r2 = r1 - w;
+	Pack tail = fmadd(q, Pack::set1(-kPiOver2Part3), (r1 - r2) - w);
+	Pack r = r2 + tail;
+	Pack rTail = tail - (r - r2);
+
+	// The fractional parts of (q / 4 - 3 / 8) are never a half, therefore rounding yields floor(q / 4) and the quadrant is exact
+	Pack quadrant = q - Pack::set1(4.0) * roundNearest(fmadd(q, Pack::set1(0.25), Pack::set1(-0.375)));
+
+	Pack s = sinPolynomial(r, rTail);
+	Pack c = cosPolynomial(r, rTail);
+
+	Pack isOdd = maskOr(equal(quadrant, Pack::set1(1.0)), equal(quadrant, Pack::set1(3.0)));
+	Pack sinResult = select(isOdd, c, s);
+	Pack cosResult = select(isOdd, s, c);
+
+	outSin = select(lessEqual(Pack::set1(2.0), quadrant), Pack::set1(0.0) - sinResult, sinResult);
+	outCos = select(maskOr(equal(quadrant, Pack::set1(1.0)), equal(quadrant, Pack::set1(2.0))), Pack::set1(0.0) - cosResult, cosResult);
+}
+
+template <typename Pack>
+static Pack sinPack(const Pack& x)
+{
+	Pack s, c;
+	sinCosPack(x, s, c);
+	return s;
+}
+
+template <typename Pack>
+static Pack cosPack(const Pack& x)
+{
+	Pack s, c;
+	sinCosPack(x, s, c);
+	return c;
+}
+
+template <typename Pack>
+static Pack tanPack(const Pack& x)
+{
+	Pack s, c;
+	sinCosPack(x, s, c);
+	return s / c;
+}
+
+/*	Computes the arctangent of each lane in the range [-pi / 2, pi / 2]
+	The magnitude is reduced into [-7 / 16, 7 / 16] using one of four identities atan(x) = atan(c) + atan((x - c) / (1 + x * c))
+	The numerator and denominator of each identity are selected per lane so that a single division is performed    */
+template <typename Pack>
+static Pack atanPack(const Pack& x)
+{
+	Pack a = abs(x);
+	Pack one = Pack::set1(1.0);
+
+	Pack isReduced0 = lessEqual(Pack::set1(7.0 / 16.0), a);
+	Pack isReduced1 = lessEqual(Pack::set1(11.0 / 16.0), a);
+	Pack isReduced2 = lessEqual(Pack::set1(19.0 / 16.0), a);
+	Pack isReduced3 = lessEqual(Pack::set1(39.0 / 16.0), a);
+
+	// atan(x) = atan(1/2) + atan((2x - 1) / (2 + x)), atan(1) + atan((x - 1) / (x + 1)), atan(3/2) + atan((x - 1.5) / (1 + 1.5x)), pi / 2 + atan(-1 / x)
+	Pack numerator = select(isReduced3, Pack::set1(-1.0),
+		select(isReduced2, a - Pack::set1(1.5),
+		select(isReduced1, a - one,
+		select(isReduced0, fmadd(a, Pack::set1(2.0), Pack::set1(-1.0)), a))));
+	Pack denominator = select(isReduced3, a,
+		select(isReduced2, fmadd(a, Pack::set1(1.5), one),
+		select(isReduced1, a + one,
+		select(isReduced0, a + Pack::set1(2.0), one))));
+	Pack hi = select(isReduced3, Pack::set1(kAtanHi[3]),
+		select(isReduced2, Pack::set1(kAtanHi[2]),
+		select(isReduced1, Pack::set1(kAtanHi[1]),
+		select(isReduced0, Pack::set1(kAtanHi[0]), Pack::set1(0.0)))));
+	Pack lo = select(isReduced3, Pack::set1(kAtanLo[3]),
+		select(isReduced2, Pack::set1(kAtanLo[2]),
+		select(isReduced1, Pack::set1(kAtanLo[1]),
+		select(isReduced0, Pack::set1(kAtanLo[0]), Pack::set1(0.0)))));
+
+	Pack reduced = numerator / denominator;
+	Pack result = hi - ((atanCorrection(reduced) - lo) - reduced);
+
+	return select(lessThan(x, Pack::set1(0.0)), Pack::set1(0.0) - result, result);
+}
+
+/*	Computes the angle of each (x, y) coordinate in the range [-pi, pi]
+	The arctangent is evaluated for the ratio min(|x|, |y|) / max(|x|, |y|) <= 1 and then reflected into the quadrant of the coordinate
+	The sign of a zero y coordinate is ignored (ie. treated as positive) and the coordinate (0, 0) returns 0    */
+template <typename Pack>
+static Pack atan2Pack(const Pack& y, const Pack& x)
+{
+	Pack zero = Pack::set1(0.0);
+	Pack ax = abs(x);
+	Pack ay = abs(y);
+
+	Pack isSteep = lessThan(ax, ay);
+	Pack numerator = select(isSteep, ax, ay);
+	Pack denominator = select(isSteep, ay, ax);
+	Pack isOrigin = equal(denominator, zero);
+	Pack angle = atanPack(select(isOrigin, zero, numerator / select(isOrigin, Pack::set1(1.0), denominator)));
+
+	angle = select(isSteep, (Pack::set1(M_PI / 2.0) - angle) + Pack::set1(kAtanLo[3]), angle);
+	angle = select(lessThan(x, zero), (Pack::set1(M_PI) - angle) + Pack::set1(kPiLo), angle);
+
+	return select(lessThan(y, zero), zero - angle, angle);
+}
+
+// Lanes outside the domain [-1, 1] return NaN
+template <typename Pack>
+static Pack asinPack(const Pack& x)
+{
+	Pack one = Pack::set1(1.0);
+	return atan2Pack(x, sqrt((one - x) * (one + x)));
+}
+
+// Lanes outside the domain [-1, 1] return NaN
+template <typename Pack>
+static Pack acosPack(const Pack& x)
+{
+	Pack one = Pack::set1(1.0);
+	return atan2Pack(sqrt((one - x) * (one + x)), x);
+}
+
+/*	Scales each lane of the value by 2^k, where k is an integral value in the range [-1076, 1025]
+	The scale is applied as two factors so that subnormal and overflowing results are rounded once by the final multiplication    */
+template <typename Pack>
+static Pack scaleByPow2(const Pack& value, const Pack& k)
+{
+	Pack k1 = roundNearest(k * Pack::set1(0.5));
+	return (value * pow2(k1)) * pow2(k - k1);
+}
+
+/*	Computes e^x for each lane
+	The argument is reduced to r = x - k * ln(2) where k is the nearest integer, such that e^x = 2^k * e^r
+	Arguments are clamped to a range whose results either overflow to infinity or underflow to zero, NaNs are propagated    */
+template <typename Pack>
+static Pack expPack(const Pack& x)
+{
+	Pack clamped = select(lessThan(Pack::set1(710.0), x), Pack::set1(710.0), x);
+	clamped = select(lessThan(clamped, Pack::set1(-746.0)), Pack::set1(-746.0), clamped);
+
+	Pack k = roundNearest(clamped * Pack::set1(1.44269504088896338700e+00));
+	Pack r = fmadd(k, Pack::set1(-kLn2Part1), clamped);
+	r = fmadd(k, Pack::set1(-kLn2Part2), r);
+
+	return scaleByPow2(expPolynomial(r), k);
+}
+
+/*	Computes 2^x for each lane
+	The argument is split into its nearest integer k and a fraction f in [-0.5, 0.5], such that 2^x = 2^k * e^(f * ln(2))    */
+template <typename Pack>
+static Pack exp2Pack(const Pack& x)
+{
+	Pack clamped = select(lessThan(Pack::set1(1025.0), x), Pack::set1(1025.0), x);
+	clamped = select(lessThan(clamped, Pack::set1(-1076.0)), Pack::set1(-1076.0), clamped);
+
+	Pack k = roundNearest(clamped);
+	Pack r = (clamped - k) * Pack::set1(6.93147180559945286227e-01);
+
+	return scaleByPow2(expPolynomial(r), k);
+}
+
+// ------ Easing ------
+
+/*	Each function reproduces the equivalent scalar easing function of math_utils.h, including its guards for the end points
+	Powers are evaluated by repeated multiplication rather than std::pow, therefore results may differ from the scalar functions by a few ulps
+	The circular functions factor 1 - t^2 as (1 - t)(1 + t), avoiding the cancellation of the scalar functions close to the end points
+	The parameter t is expected to be within the domain [0, 1]    */
+template <typename Pack>
+static Pack lerpPack(const Pack& a, const Pack& b, const Pack& x)
+{
+	return fmadd(b - a, x, a);
+}
+
+template <typename Pack>
+static Pack linearEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	return lerpPack(a, b, t);
+}
+
+template <typename Pack>
+static Pack inSineEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack x = Pack::set1(1.0) - cosPack(t * Pack::set1(M_PI / 2.0));
+	return select(equal(t, Pack::set1(1.0)), b, lerpPack(a, b, x));
+}
+
+template <typename Pack>
+static Pack inQuadEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	return lerpPack(a, b, t * t);
+}
+
+template <typename Pack>
+static Pack inCubicEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	return lerpPack(a, b, t * t * t);
+}
+
+template <typename Pack>
+static Pack inQuartEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	return lerpPack(a, b, t * t * t * t);
+}
+
+template <typename Pack>
+static Pack inQuintEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	return lerpPack(a, b, t * t * t * t * t);
+}
+
+template <typename Pack>
+static Pack inExpoEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack x = exp2Pack(fmadd(t, Pack::set1(10.0), Pack::set1(-10.0)));
+	return select(equal(t, Pack::set1(0.0)), a, lerpPack(a, b, x));
+}
+
+template <typename Pack>
+static Pack inCircEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack one = Pack::set1(1.0);
+	return lerpPack(a, b, one - sqrt((one - t) * (one + t)));
+}
+
+template <typename Pack>
+static Pack outSineEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack x = sinPack(t * Pack::set1(M_PI / 2.0));
+	return select(equal(t, Pack::set1(1.0)), b, lerpPack(a, b, x));
+}
+
+template <typename Pack>
+static Pack outQuadEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack one = Pack::set1(1.0);
+	Pack u = one - t;
+	return lerpPack(a, b, one - u * u);
+}
+
+template <typename Pack>
+static Pack outCubicEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack one = Pack::set1(1.0);
+	Pack u = one - t;
+	return lerpPack(a, b, one - u * u * u);
+}
+
+template <typename Pack>
+static Pack outQuartEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack one = Pack::set1(1.0);
+	Pack u = one - t;
+	return lerpPack(a, b, one - u * u * u * u);
+}
+
+template <typename Pack>
+static Pack outQuintEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack one = Pack::set1(1.0);
+	Pack u = one - t;
+	return lerpPack(a, b, one - u * u * u * u * u);
+}
+
+template <typename Pack>
+static Pack outExpoEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack x = Pack::set1(1.0) - exp2Pack(t * Pack::set1(-10.0));
+	return select(equal(t, Pack::set1(1.0)), b, lerpPack(a, b, x));
+}
+
+template <typename Pack>
+static Pack outCircEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	return lerpPack(a, b, sqrt((Pack::set1(2.0) - t) * t));
+}
+
+template <typename Pack>
+static Pack inOutSineEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack x = (Pack::set1(1.0) - cosPack(t * Pack::set1(M_PI))) / Pack::set1(2.0);
+	return select(equal(t, Pack::set1(1.0)), b, lerpPack(a, b, x));
+}
+
+// The polynomial in-out functions share the form t < 0.5 ? k * t^n : 1 - (2 - 2t)^n / 2
+template <typename Pack>
+static Pack inOutPolynomialEase(const Pack& a, const Pack& b, const Pack& t, const Pack& inPower, const Pack& outPower, double scale)
+{
+	Pack x = select(lessThan(t, Pack::set1(0.5)), Pack::set1(scale) * inPower, Pack::set1(1.0) - outPower / Pack::set1(2.0));
+	return lerpPack(a, b, x);
+}
+
+template <typename Pack>
+static Pack inOutQuadEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack u = fmadd(t, Pack::set1(-2.0), Pack::set1(2.0));
+	return inOutPolynomialEase(a, b, t, t * t, u * u, 2.0);
+}
+
+template <typename Pack>
+static Pack inOutCubicEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack u = fmadd(t, Pack::set1(-2.0), Pack::set1(2.0));
+	return inOutPolynomialEase(a, b, t, t * t * t, u * u * u, 4.0);
+}
+
+template <typename Pack>
+static Pack inOutQuartEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack u = fmadd(t, Pack::set1(-2.0), Pack::set1(2.0));
+	return inOutPolynomialEase(a, b, t, t * t * t * t, u * u * u * u, 8.0);
+}
+
+template <typename Pack>
+static Pack inOutQuintEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack u = fmadd(t, Pack::set1(-2.0), Pack::set1(2.0));
+	return inOutPolynomialEase(a, b, t, t * t * t * t * t, u * u * u * u * u, 16.0);
+}
+
+template <typename Pack>
+static Pack inOutExpoEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	// Both halves share a single evaluation of 2^x
+	Pack isFirstHalf = lessThan(t, Pack::set1(0.5));
+	Pack e = exp2Pack(select(isFirstHalf, fmadd(t, Pack::set1(20.0), Pack::set1(-10.0)), fmadd(t, Pack::set1(-20.0), Pack::set1(10.0))));
+	Pack x = select(isFirstHalf, e / Pack::set1(2.0), (Pack::set1(2.0) - e) / Pack::set1(2.0));
+
+	Pack result = select(equal(t, Pack::set1(1.0)), b, lerpPack(a, b, x));
+	return select(equal(t, Pack::set1(0.0)), a, result);
+}
+
+template <typename Pack>
+static Pack inOutCircEase(const Pack& a, const Pack& b, const Pack& t)
+{
+	Pack one = Pack::set1(1.0);
+	Pack u = t * Pack::set1(2.0);
+	Pack v = fmadd(t, Pack::set1(-2.0), Pack::set1(2.0));
+	Pack x = select(lessThan(t, Pack::set1(0.5)), (one - sqrt((one - u) * (one + u))) / Pack::set1(2.0), (sqrt((one - v) * (one + v)) + one) / Pack::set1(2.0));
+	return lerpPack(a, b, x);
+}
+
+// ------ Array Kernels ------
+
+/*	Applies the function to each value of the array
+	If the number of values is not a multiple of the width, the surplus lanes of the final vector duplicate the last value and their results are discarded    */
+template <typename Pack, Pack (*Function)(const Pack&)>
+static void unaryArrayKernel(const double* values, unsigned int count, double* outValues)
+{
+	const unsigned int width = Pack::width;
+	unsigned int first = 0;
+
+	for (; first + width <= count; first += width)
+		Function(Pack::load(values + first)).store(outValues + first);
+
+	if (first < count)
+	{
+		double lanes[width];
+		for (unsigned int lane = 0; lane < width; ++lane)
+			lanes[lane] = values[minCount(first + lane, count - 1)];
+
+		Function(Pack::load(lanes)).store(lanes);
+		copyValues(lanes, count - first, outValues + first);
+	}
+}
+
+template <typename Pack>
+static void sinCosArrayKernel(const double* values, unsigned int count, double* outSin, double* outCos)
+{
+	const unsigned int width = Pack::width;
+	unsigned int first = 0;
+	Pack s, c;
+
+	for (; first + width <= count; first += width)
+	{
+		sinCosPack(Pack::load(values + first), s, c);
+		s.store(outSin + first);
+		c.store(outCos + first);
+	}
+
+	if (first < count)
+	{
+		double lanes[width];
+		double cosLanes[width];
+		for (unsigned int lane = 0; lane < width; ++lane)
+			lanes[lane] = values[minCount(first + lane, count - 1)];
+
+		sinCosPack(Pack::load(lanes), s, c);
+		s.store(lanes);
+		c.store(cosLanes);
+		copyValues(lanes, count - first, outSin + first);
+		copyValues(cosLanes, count - first, outCos + first);
+	}
+}
+
+template <typename Pack>
+static void atan2ArrayKernel(const double* y, const double* x, unsigned int count, double* outValues)
+{
+	const unsigned int width = Pack::width;
+	unsigned int first = 0;
+
+	for (; first + width <= count; first += width)
+		atan2Pack(Pack::load(y + first), Pack::load(x + first)).store(outValues + first);
+
+	if (first < count)
+	{
+		double yLanes[width];
+		double xLanes[width];
+		for (unsigned int lane = 0; lane < width; ++lane)
+		{
+			yLanes[lane] = y[minCount(first + lane, count - 1)];
+			xLanes[lane] = x[minCount(first + lane, count - 1)];
+		}
+
+		atan2Pack(Pack::load(yLanes), Pack::load(xLanes)).store(yLanes);
+		copyValues(yLanes, count - first, outValues + first);
+	}
+}
+
+/*	Applies the easing function to each parameter of the array
+	The function is resolved once per call from a table which is ordered as per the Easing enum, see MRS::easingFunctions    */
+template <typename Pack>
+static void easeArrayKernel(unsigned int easing, double a, double b, const double* t, unsigned int count, double* outValues)
+{
+	typedef Pack (*EaseFunction)(const Pack&, const Pack&, const Pack&);
+	static const EaseFunction easeFunctions[] = {
+		&linearEase<Pack>, &inSineEase<Pack>, &inQuadEase<Pack>, &inCubicEase<Pack>,
+		&inQuartEase<Pack>, &inQuintEase<Pack>, &inExpoEase<Pack>, &inCircEase<Pack>,
+		&outSineEase<Pack>, &outQuadEase<Pack>, &outCubicEase<Pack>,
+		&outQuartEase<Pack>, &outQuintEase<Pack>, &outExpoEase<Pack>, &outCircEase<Pack>,
+		&inOutSineEase<Pack>, &inOutQuadEase<Pack>, &inOutCubicEase<Pack>,
+		&inOutQuartEase<Pack>, &inOutQuintEase<Pack>, &inOutExpoEase<Pack>, &inOutCircEase<Pack>,
+	};
+
+	static_assert(sizeof(easeFunctions) / sizeof(EaseFunction) == kEasingFunctionCount, "easeArrayKernel : table must contain a function for every Easing value");
+	assert(easing < kEasingFunctionCount);
+
+	const unsigned int width = Pack::width;
+	const EaseFunction function = easeFunctions[easing];
+	const Pack aPack = Pack::set1(a);
+	const Pack bPack = Pack::set1(b);
+	unsigned int first = 0;
+
+	for (; first + width <= count; first += width)
+		function(aPack, bPack, Pack::load(t + first)).store(outValues + first);
+
+	if (first < count)
+	{
+		double lanes[width];
+		for (unsigned int lane = 0; lane < width; ++lane)
+			lanes[lane] = t[minCount(first + lane, count - 1)];
+
+		function(aPack, bPack, Pack::load(lanes)).store(lanes);
+		copyValues(lanes, count - first, outValues + first);
+	}
+}
+
+template <typename Pack>
+static SimdMathKernels makeSimdMathKernels()
+{
+	SimdMathKernels kernels;
+	kernels.sin = &unaryArrayKernel<Pack, &sinPack<Pack>>;
+	kernels.cos = &unaryArrayKernel<Pack, &cosPack<Pack>>;
+	kernels.tan = &unaryArrayKernel<Pack, &tanPack<Pack>>;
+	kernels.asin = &unaryArrayKernel<Pack, &asinPack<Pack>>;
+	kernels.acos = &unaryArrayKernel<Pack, &acosPack<Pack>>;
+	kernels.atan = &unaryArrayKernel<Pack, &atanPack<Pack>>;
+	kernels.exp = &unaryArrayKernel<Pack, &expPack<Pack>>;
+	kernels.exp2 = &unaryArrayKernel<Pack, &exp2Pack<Pack>>;
+	kernels.sinCos = &sinCosArrayKernel<Pack>;
+	kernels.atan2 = &atan2ArrayKernel<Pack>;
+	kernels.ease = &easeArrayKernel<Pack>;
+	return kernels;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
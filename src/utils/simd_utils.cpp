@@ -0,0 +1,64 @@
+#include "simd_utils.h"
+
+#if defined(MRS_SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ------ Helpers -------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Queries the processor for the instruction sets used by our vectorized kernels
+	- SSE2 is part of the x86-64 baseline and will always be available on these targets
+	- AVX2 kernels are also compiled with FMA enabled, therefore both features must be present
+	- The operating system must also save the upper halves of the ymm registers on a context switch (checked via XGETBV)
+
+	The compiler builtins for GCC and Clang perform the equivalent operating system check internally    */
+static SimdLevel querySimdLevel()
+{
+#if defined(MRS_SIMD_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool hasFMA = (info[2] & (1 << 12)) != 0;
+	bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+	bool hasAVX = (info[2] & (1 << 28)) != 0;
+	bool hasAVX2 = false;
+
+	if (maxLeaf >= 7)
+	{
+		__cpuidex(info, 7, 0);
+		hasAVX2 = (info[1] & (1 << 5)) != 0;
+	}
+
+	// Bits 1 and 2 indicate that the xmm and ymm states are enabled by the operating system
+	bool hasOSSupport = hasOSXSAVE && (_xgetbv(0) & 0x6) == 0x6;
+
+	return hasAVX && hasAVX2 && hasFMA && hasOSSupport ? kSimdAVX2 : kSimdSSE2;
+#elif defined(MRS_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? kSimdAVX2 : kSimdSSE2;
+#else
+	return kSimdScalar;
+#endif
+}
+
+SimdLevel getSimdLevel()
+{
+	// Initialization of function-local statics is thread-safe
+	static const SimdLevel level = querySimdLevel();
+	return level;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,35 @@
+// Contains a set of helpers for selecting vectorized code paths at runtime
+// Kernels which use a specific instruction set must be compiled in a separate translation unit with the corresponding compiler flags
+// The functions below can then be used to determine whether it is safe to call into those kernels on the current machine
+
+#pragma once
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Defined when compiling for an x86-64 target, vectorized kernels are not available on other architectures
+#if defined(_M_X64) || defined(__x86_64__)
+#define MRS_SIMD_X86
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ------ Helpers -------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Instruction sets which are ordered such that each level implies support for all lower levels
+enum SimdLevel : short
+{
+	kSimdScalar = 0,
+	kSimdSSE2 = 1,
+	kSimdAVX2 = 2,
+};
+
+// Returns the highest instruction set supported by both the processor and operating system (the result is cached after the first call)
+SimdLevel getSimdLevel();
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,201 @@
+// Contains the vector types and helpers used to instantiate the kernels of the *_kernels.h headers and spline_utils_batch.h
+// This header is internal to the utils library, the types are declared within an anonymous namespace so that each translation unit receives its own copy
+// BasePack is available to every translation unit, AVX2Pack is only declared when the translation unit is compiled with AVX2 enabled (see CMakeLists.txt)
+
+/*	Considerations
+	--------------
+	Any inline function or template instantiation with external linkage that is emitted by a translation unit compiled with AVX2 may be encoded with AVX2 instructions
+	The linker keeps a single copy of each such function, therefore a baseline translation unit could end up calling the AVX2 encoding on a machine without AVX2
+	The kernel headers are therefore restricted to the following, so that everything they instantiate has internal linkage
+	- Raw arrays of doubles and integers, Maya types are converted by the baseline translation unit which dispatches to the kernels
+	- The vector types and helpers of this header, and kernels declared static
+	- No standard library templates (eg. std::min, std::copy) and no Maya headers    */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "simd_utils.h"
+
+#if defined(MRS_SIMD_X86)
+#include <emmintrin.h>
+#endif
+
+#if defined(MRS_SIMD_X86) && defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+/*	Description
+	-----------
+	Each type holds a fixed number of double precision lanes and provides the operations required by the kernels
+	- load(), set1(), store() and the arithmetic operators (+, -, *, /)
+	- fmadd(a, b, c) = a * b + c, the product may or may not be rounded before the addition
+	- sqrt(a), abs(a), max(a, b), copySign(a, b) and roundNearest(a) which rounds to the nearest integer, ties to even
+	- lessThan(a, b), lessEqual(a, b) and equal(a, b) which return masks whose lanes have every bit set where the comparison holds
+	- maskAnd(a, b), maskOr(a, b), select(mask, a, b) = mask ? a : b and isAll(mask) which is true if every lane of the mask is set
+	- pow2(k) = 2^k for integral k in the range [-1022, 1023]
+
+	The max of a NaN lane returns the second operand    */
+
+#if defined(MRS_SIMD_X86)
+
+// Two double precision lanes, SSE2 is part of the x86-64 baseline
+struct SSE2Pack
+{
+	enum { width = 2 };
+
+	__m128d value;
+
+	static SSE2Pack load(const double* data) { SSE2Pack pack; pack.value = _mm_loadu_pd(data); return pack; }
+	static SSE2Pack set1(double scalar) { SSE2Pack pack; pack.value = _mm_set1_pd(scalar); return pack; }
+	void store(double* data) const { _mm_storeu_pd(data, value); }
+};
+
+inline SSE2Pack makePack(__m128d value) { SSE2Pack pack; pack.value = value; return pack; }
+inline SSE2Pack operator+(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_add_pd(a.value, b.value)); }
+inline SSE2Pack operator-(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_sub_pd(a.value, b.value)); }
+inline SSE2Pack operator*(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_mul_pd(a.value, b.value)); }
+inline SSE2Pack operator/(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_div_pd(a.value, b.value)); }
+inline SSE2Pack fmadd(const SSE2Pack& a, const SSE2Pack& b, const SSE2Pack& c) { return a * b + c; }
+inline SSE2Pack sqrt(const SSE2Pack& a) { return makePack(_mm_sqrt_pd(a.value)); }
+inline SSE2Pack abs(const SSE2Pack& a) { return makePack(_mm_andnot_pd(_mm_set1_pd(-0.0), a.value)); }
+inline SSE2Pack max(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_max_pd(a.value, b.value)); }
+inline SSE2Pack copySign(const SSE2Pack& a, const SSE2Pack& b) { const __m128d signMask = _mm_set1_pd(-0.0); return makePack(_mm_or_pd(_mm_andnot_pd(signMask, a.value), _mm_and_pd(signMask, b.value))); }
+inline SSE2Pack lessThan(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_cmplt_pd(a.value, b.value)); }
+inline SSE2Pack lessEqual(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_cmple_pd(a.value, b.value)); }
+inline SSE2Pack equal(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_cmpeq_pd(a.value, b.value)); }
+inline SSE2Pack maskAnd(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_and_pd(a.value, b.value)); }
+inline SSE2Pack maskOr(const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_or_pd(a.value, b.value)); }
+inline SSE2Pack select(const SSE2Pack& mask, const SSE2Pack& a, const SSE2Pack& b) { return makePack(_mm_or_pd(_mm_and_pd(mask.value, a.value), _mm_andnot_pd(mask.value, b.value))); }
+inline bool isAll(const SSE2Pack& mask) { return _mm_movemask_pd(mask.value) == 0x3; }
+
+// SSE2 has no rounding instruction, adding and subtracting 1.5 * 2^52 rounds any magnitude below 2^51 to the nearest integer (ties to even)
+inline SSE2Pack roundNearest(const SSE2Pack& a)
+{
+	const __m128d shift = _mm_set1_pd(6755399441055744.0);
+	return makePack(_mm_sub_pd(_mm_add_pd(a.value, shift), shift));
+}
+
+// Adding 2^52 places the biased exponent (k + 1023) in the low bits of the mantissa, from where it is shifted into the exponent field
+inline SSE2Pack pow2(const SSE2Pack& k)
+{
+	__m128d biased = _mm_add_pd(k.value, _mm_set1_pd(4503599627370496.0 + 1023.0));
+	return makePack(_mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(biased), 52)));
+}
+
+typedef SSE2Pack BasePack;
+
+#else
+
+// Single lane fallback for architectures without a vectorized kernel, masks hold a value whose bits are either all set or all clear
+struct ScalarPack
+{
+	enum { width = 1 };
+
+	double value;
+
+	static ScalarPack load(const double* data) { ScalarPack pack; pack.value = *data; return pack; }
+	static ScalarPack set1(double scalar) { ScalarPack pack; pack.value = scalar; return pack; }
+	void store(double* data) const { *data = value; }
+};
+
+inline ScalarPack makePack(double value) { ScalarPack pack; pack.value = value; return pack; }
+inline ScalarPack makeMask(bool condition) { uint64_t bits = condition ? ~0ull : 0ull; ScalarPack pack; std::memcpy(&pack.value, &bits, sizeof(double)); return pack; }
+inline bool isSet(const ScalarPack& mask) { uint64_t bits; std::memcpy(&bits, &mask.value, sizeof(double)); return bits != 0; }
+inline ScalarPack operator+(const ScalarPack& a, const ScalarPack& b) { return makePack(a.value + b.value); }
+inline ScalarPack operator-(const ScalarPack& a, const ScalarPack& b) { return makePack(a.value - b.value); }
+inline ScalarPack operator*(const ScalarPack& a, const ScalarPack& b) { return makePack(a.value * b.value); }
+inline ScalarPack operator/(const ScalarPack& a, const ScalarPack& b) { return makePack(a.value / b.value); }
+inline ScalarPack fmadd(const ScalarPack& a, const ScalarPack& b, const ScalarPack& c) { return a * b + c; }
+inline ScalarPack sqrt(const ScalarPack& a) { return makePack(std::sqrt(a.value)); }
+inline ScalarPack abs(const ScalarPack& a) { return makePack(std::abs(a.value)); }
+inline ScalarPack max(const ScalarPack& a, const ScalarPack& b) { return a.value > b.value ? a : b; }
+inline ScalarPack copySign(const ScalarPack& a, const ScalarPack& b) { return makePack(std::copysign(a.value, b.value)); }
+inline ScalarPack lessThan(const ScalarPack& a, const ScalarPack& b) { return makeMask(a.value < b.value); }
+inline ScalarPack lessEqual(const ScalarPack& a, const ScalarPack& b) { return makeMask(a.value <= b.value); }
+inline ScalarPack equal(const ScalarPack& a, const ScalarPack& b) { return makeMask(a.value == b.value); }
+inline ScalarPack maskAnd(const ScalarPack& a, const ScalarPack& b) { return makeMask(isSet(a) && isSet(b)); }
+inline ScalarPack maskOr(const ScalarPack& a, const ScalarPack& b) { return makeMask(isSet(a) || isSet(b)); }
+inline ScalarPack select(const ScalarPack& mask, const ScalarPack& a, const ScalarPack& b) { return isSet(mask) ? a : b; }
+inline bool isAll(const ScalarPack& mask) { return isSet(mask); }
+inline ScalarPack roundNearest(const ScalarPack& a) { return makePack(std::nearbyint(a.value)); }
+inline ScalarPack pow2(const ScalarPack& k) { return makePack(std::ldexp(1.0, (int)k.value)); }
+
+typedef ScalarPack BasePack;
+
+#endif
+
+#if defined(MRS_SIMD_X86) && defined(__AVX2__)
+
+// Four double precision lanes
+struct AVX2Pack
+{
+	enum { width = 4 };
+
+	__m256d value;
+
+	static AVX2Pack load(const double* data) { AVX2Pack pack; pack.value = _mm256_loadu_pd(data); return pack; }
+	static AVX2Pack set1(double scalar) { AVX2Pack pack; pack.value = _mm256_set1_pd(scalar); return pack; }
+	void store(double* data) const { _mm256_storeu_pd(data, value); }
+};
+
+inline AVX2Pack makePack(__m256d value) { AVX2Pack pack; pack.value = value; return pack; }
+inline AVX2Pack operator+(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_add_pd(a.value, b.value)); }
+inline AVX2Pack operator-(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_sub_pd(a.value, b.value)); }
+inline AVX2Pack operator*(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_mul_pd(a.value, b.value)); }
+inline AVX2Pack operator/(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_div_pd(a.value, b.value)); }
+inline AVX2Pack fmadd(const AVX2Pack& a, const AVX2Pack& b, const AVX2Pack& c) { return makePack(_mm256_fmadd_pd(a.value, b.value, c.value)); }
+inline AVX2Pack sqrt(const AVX2Pack& a) { return makePack(_mm256_sqrt_pd(a.value)); }
+inline AVX2Pack abs(const AVX2Pack& a) { return makePack(_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.value)); }
+inline AVX2Pack max(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_max_pd(a.value, b.value)); }
+inline AVX2Pack copySign(const AVX2Pack& a, const AVX2Pack& b) { const __m256d signMask = _mm256_set1_pd(-0.0); return makePack(_mm256_or_pd(_mm256_andnot_pd(signMask, a.value), _mm256_and_pd(signMask, b.value))); }
+inline AVX2Pack lessThan(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_cmp_pd(a.value, b.value, _CMP_LT_OQ)); }
+inline AVX2Pack lessEqual(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_cmp_pd(a.value, b.value, _CMP_LE_OQ)); }
+inline AVX2Pack equal(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_cmp_pd(a.value, b.value, _CMP_EQ_OQ)); }
+inline AVX2Pack maskAnd(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_and_pd(a.value, b.value)); }
+inline AVX2Pack maskOr(const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_or_pd(a.value, b.value)); }
+inline AVX2Pack select(const AVX2Pack& mask, const AVX2Pack& a, const AVX2Pack& b) { return makePack(_mm256_blendv_pd(b.value, a.value, mask.value)); }
+inline bool isAll(const AVX2Pack& mask) { return _mm256_movemask_pd(mask.value) == 0xF; }
+inline AVX2Pack roundNearest(const AVX2Pack& a) { return makePack(_mm256_round_pd(a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+// Adding 2^52 places the biased exponent (k + 1023) in the low bits of the mantissa, from where it is shifted into the exponent field
+inline AVX2Pack pow2(const AVX2Pack& k)
+{
+	__m256d biased = _mm256_add_pd(k.value, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+	return makePack(_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(biased), 52)));
+}
+
+#endif
+
+// ------ Helpers ------
+
+// Used by the kernels in place of std::min, see considerations
+inline unsigned int minCount(unsigned int a, unsigned int b)
+{
+	return a < b ? a : b;
+}
+
+// Used by the kernels in place of std::copy, see considerations
+inline void copyValues(const double* values, unsigned int count, double* outValues)
+{
+	for (unsigned int i = 0; i < count; ++i)
+		outValues[i] = values[i];
+}
+
+} // anonymous
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include "spline_utils.h"
+#include "spline_utils_batch.h"
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -230,6 +233,133 @@ double Spline::naturalToArcLengthParameter(double naturalParameter, const std::v
 	return arcLengthParam;
 }
 
+/*	Description
+	-----------
+	Produces an array of values for the natural parameter t, each corresponding to a uniform increment of the arc-length
+	- The number of values will be equal to the size of the given array argument
+	- Unlike the sample based overload, the accuracy of each parameter is independent of the number of values
+
+	Args
+	----
+	table = An arc-length table which has been built for the curve    */
+void Spline::computeArcLengthParameters(const ArcLengthTable& table, std::vector<double>& outParameters)
+{
+	unsigned int sampleCount = (int)outParameters.size();
+	assert(sampleCount >= 2);
+
+	double step = 1.0 / (double)(sampleCount - 1);
+
+	outParameters[0] = 0.0;
+	for (unsigned int i = 1; i < sampleCount - 1; i++)
+		outParameters[i] = table.arcLengthToNaturalParameter(step * i);
+	outParameters[sampleCount - 1] = 1.0;
+}
+
+/*	Description
+	-----------
+	Calculates an equivalent natural parameter for the given arc-length parameter using a pre-built arc-length table
+
+	Args
+	----
+	arcLengthParameter = The arc-length parameter from which to calculate the equivalent natural parameter
+	table = An arc-length table which has been built for the curve    */
+double Spline::arcLengthToNaturalParameter(double arcLengthParameter, const ArcLengthTable& table)
+{
+	return table.arcLengthToNaturalParameter(arcLengthParameter);
+}
+
+/*	Description
+	-----------
+	Calculates an equivalent normalized arc-length for the given natural parameter using a pre-built arc-length table
+
+	Args
+	----
+	naturalParameter = The natural parameter from which to calculate the equivalent arc-length parameter
+	table = An arc-length table which has been built for the curve    */
+double Spline::naturalToArcLengthParameter(double naturalParameter, const ArcLengthTable& table)
+{
+	return table.naturalToArcLengthParameter(naturalParameter);
+}
+
+/*	Description
+	-----------
+	Produces an array of values for the natural parameter t, designed to stabalize a set of points along the curve (eg. the joints of a chain)
+	It provides the ability to stretch the curve whilst maintaining the integrity of its initial form
+
+	The stable parameters split the curve into segments, each segment is parameterized in terms of its own arc-length such that it has unit parametric speed
+	- There will be an instantaneous change in velocity at the points where two segments meet
+	- Each stable parameter is output exactly, the remaining values are distributed as evenly as possible between the segments
+	- In the case where the remaining values are not evenly divisible by the segments, the first segments will have preference and receive the extra values
+	If there are not enough values to output each stable parameter, the natural parameters will be output instead
+
+	Args
+	----
+	table = An arc-length table which has been built for the curve
+	stableParameters = Increasing natural parameters which must be held in place, range = [0, 1]    */
+void Spline::computeSplitLengthParameters(const ArcLengthTable& table, const std::vector<double>& stableParameters, 
+	std::vector<double>& outParameters)
+{
+	unsigned int sampleCount = (int)outParameters.size();
+	unsigned int segmentCount = (int)stableParameters.size() + 1;
+	assert(sampleCount >= 2);
+
+	// There are constant points at the start, end and at each of the stable parameters
+	if (sampleCount < segmentCount + 1)
+	{
+		computeNaturalParameters(outParameters);
+		return;
+	}
+
+	unsigned int remainingCount = sampleCount - segmentCount - 1;
+	unsigned int lowerIndex = 0;
+	double lowerLength = 0.0;
+	outParameters[0] = 0.0;
+
+	for (unsigned int i = 0; i < segmentCount; ++i)
+	{
+		unsigned int segmentSampleCount = (unsigned)std::ceil(remainingCount / (double)(segmentCount - i));
+		remainingCount -= segmentSampleCount;
+
+		unsigned int upperIndex = lowerIndex + segmentSampleCount + 1;
+		double upperParameter = i < segmentCount - 1 ? stableParameters[i] : 1.0;
+		double upperLength = table.naturalToArcLengthParameter(upperParameter);
+		double segmentStep = (upperLength - lowerLength) / (segmentSampleCount + 1);
+
+		for (unsigned int j = lowerIndex + 1; j < upperIndex; ++j)
+			outParameters[j] = table.arcLengthToNaturalParameter(lowerLength + segmentStep * (j - lowerIndex));
+
+		outParameters[upperIndex] = upperParameter;
+		lowerIndex = upperIndex;
+		lowerLength = upperLength;
+	}
+}
+
+/*	Description
+	-----------
+	Calculates an equivalent natural parameter for the given split-length parameter
+	The split-length domain is divided equally between the segments, the parameter is mapped to an arc-length by its proportional position within its segment
+
+	Args
+	----
+	splitLengthParameter = The split-length parameter from which to calculate the equivalent natural parameter, range = [0, 1]
+	table = An arc-length table which has been built for the curve
+	stableParameters = Increasing natural parameters which split the curve into segments, range = [0, 1]    */
+double Spline::splitLengthToNaturalParameter(double splitLengthParameter, const ArcLengthTable& table, 
+	const std::vector<double>& stableParameters)
+{
+	if (splitLengthParameter <= 0.0 || splitLengthParameter >= 1.0)
+		return std::min(std::max(splitLengthParameter, 0.0), 1.0);
+
+	unsigned int segmentCount = (int)stableParameters.size() + 1;
+	double segmentPosition = splitLengthParameter * segmentCount;
+	unsigned int segmentIndex = std::min((unsigned)segmentPosition, segmentCount - 1);
+
+	double lowerLength = segmentIndex > 0 ? table.naturalToArcLengthParameter(stableParameters[segmentIndex - 1]) : 0.0;
+	double upperLength = segmentIndex < segmentCount - 1 ? table.naturalToArcLengthParameter(stableParameters[segmentIndex]) : 1.0;
+
+	return table.arcLengthToNaturalParameter(lowerLength + (upperLength - lowerLength) * (segmentPosition - segmentIndex));
+}
+
 // ------ RMF ------
 
 /*	Description
@@ -317,6 +447,30 @@ MQuaternion Spline::computeDoubleReflectionRMF(const MVector& vPointPrevious, co
 	return qReflectionPlaneComposition;
 }
 
+// ------ Projection ------
+
+/*	Description
+	-----------
+	Finds the parameter s of the point pOrigin + s * vDirection which is closest to the given infinite line
+	Returns false if the lines are parallel, in which case every point is equally close and the output is not modified    */
+bool Spline::closestParameterOnLineToLine(const MVector& pOrigin, const MVector& vDirection, const MVector& pLineOrigin,
+	const MVector& vLineDirection, double& outParameter)
+{
+	MVector vOriginOffset = pOrigin - pLineOrigin;
+	double a = vDirection * vDirection;
+	double b = vDirection * vLineDirection;
+	double c = vLineDirection * vLineDirection;
+	double d = vDirection * vOriginOffset;
+	double e = vLineDirection * vOriginOffset;
+
+	double denominator = a * c - b * b;
+	if (denominator <= 1e-12 * a * c)
+		return false;
+
+	outParameter = (b * e - c * d) / denominator;
+	return true;
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 /*	Resources
@@ -461,444 +615,24 @@ MVector Bezier::sampleDerivative(unsigned int order, double t, const std::vector
 double Bezier::sampleCurvature(double t, const std::vector<MVector>& controlPoints)
 {
 	MVector vFirstDerivative = sampleDerivative(1, t, controlPoints);
-	MVector vSecondDerivative = sampleDerivative(2, t, controlPoints);
-	double firstLength = vFirstDerivative.length();
-
-	return (vFirstDerivative ^ vSecondDerivative).length() / (firstLength * firstLength * firstLength);
-}
-
-// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-
-/*	Resources
-	---------
-	Trigonometric Bezier equations
-	https://www.sciencedirect.com/science/article/pii/S0893965908001262
-	Closest point on curve
-	https://hal.inria.fr/file/index/docid/518379/filename/Xiao-DiaoChen2007c.pdf
-*/
-
-CubicTBezier::CubicTBezier() {}
-CubicTBezier::~CubicTBezier() {}
-
-// ------ Parameterization ------
-
-/*	Description
-	-----------
-	Produces an array of lengths (of the current size), each corresponding to a uniform increment of the natural parameter
-	- These values are used as the basis for approximating certain parameterization functions
-	- Used when a mapping between arc-length values and natural parameters is required
-	
-	Args
-	----
-	shape1 = The first parameter used to adjust the shape of the curve, range = [-1, 1]
-	shape2 = The second parameter used to adjust the shape of the curve, range = [-1, 1]    */
-void CubicTBezier::computeLengths(double shape1, double shape2, const std::vector<MVector>& controlPoints, 
-	std::vector<double>& outLengths, std::vector<MVector>* outPoints)
-{
-	unsigned int sampleCount = (int)outLengths.size();
-	assert(sampleCount >= 2);
-	assert(controlPoints.size() == 4);
-	assert(shape1 >= -1.0 && shape1 <= 1.0);
-	assert(shape2 >= -1.0 && shape2 <= 1.0);
-
-	if (outPoints)
-		outPoints->resize(sampleCount);
-
-	// Cache arc-lengths by uniformly incrementing over the curves natural parameter t
-	double step = 1.0 / (double)(sampleCount - 1);
-	double t = 0.0;
-	double tLength = 0.0;
-	outLengths[0] = 0.0;
-	MVector previousPoint = sampleCurve(0.0, shape1, shape2, controlPoints);
-	if (outPoints)
-		(*outPoints)[0] = previousPoint;
-
-	for (unsigned int i = 1; i < sampleCount; i++)
-	{
-		t += step;
-
-		MVector currentPoint = sampleCurve(t, shape1, shape2, controlPoints);
-		MVector diff = previousPoint - currentPoint;
-		if (outPoints)
-			(*outPoints)[i] = currentPoint;
-
-		tLength += diff.length();
-		outLengths[i] = tLength;
-		previousPoint = currentPoint;
-	}
-}
-
-/*	Description
-	-----------
-	This parameterization function is specific to this curve type and is designed to stabalize the mid point of the curve between control points P1 and P2
-	It provides the ability to stretch the chain (eg. arm) whilst maintaining the integrity of its initial form
-	The number of output parameters will be equal to the size of the given lengths array argument
-
-	The calculation splits the curve into two segments determined by the point on the curve closest to the point half way between control points P1 and P2
-	- We will call the natural parameter of the curve at this point tStable
-	We want to parameterize each segment of the curve in terms of its arc-length, such that each segment has unit parametric speed (uniform motion)
-	- There will be an instantaneous change in velocity at tStable where the two segments meet
-	- Each segment should be responsible for calculating half of the output parameters    */
-void CubicTBezier::computeSplitLengthParameters(double shape1, double shape2, const std::vector<MVector>& controlPoints, 
-	const std::vector<MVector>& points, const std::vector<double>& lengths, std::vector<double>& outParameters)
-{
-	unsigned int sampleCount = (int)lengths.size();
-	assert(sampleCount >= 2);
-	assert(sampleCount == points.size() == tangents.size());
-
-	outParameters.resize(sampleCount);
-	outParameters[0] = 0.0;
-
-	if (sampleCount == 2)
-	{
-		outParameters[1] = 1.0;
-		return;
-	}
-
-	// We can approximate the stable parameter by minimizing the distance to our target point
-	// We could also minimize the dot product of the displacement vector with the tangent vector: (p - q(t)) . q'(t) = 0
-	// However the latter solution becomes unstable when a small sample count is used and is more compuationally heavy (requires derivative at each point)
-	// We know the closest point will occur at close to 50% of the curves natural parameter so we will begin our search from here
-	// This also avoids the possibility of finding a local minimum instead of the global minimum for each point which is what we are looking for
-
-	// --- Closest Point Joint0 ---
-	MPoint targetPoint = controlPoints[1] + (controlPoints[2] - controlPoints[1]) / 2;
-	// This will always be larger than 0 and smaller than sampleCount-1
-	unsigned int closestIndex = sampleCount / 2;
-	MVector vDisplacement = targetPoint - points[closestIndex];
-	double closestMag = vDisplacement.length();
-	vDisplacement = targetPoint - points[closestIndex - 1];
-	double earlyMag = vDisplacement.length();
-	vDisplacement = targetPoint - points[closestIndex + 1];
-	double lateMag = vDisplacement.length();
-
-	char direction = earlyMag < closestMag ? -1 : 0;
-	direction = lateMag < closestMag ? 1 : direction;
-
-	if (direction != 0)
-	{
-		double nextMag = direction == -1 ? earlyMag : lateMag;
-		while (nextMag < closestMag)
-		{
-			closestIndex += direction;
-			closestMag = nextMag;
-
-			// Check bounds
-			if (closestIndex == 0 && direction == -1)
-				break;
-			if (closestIndex == sampleCount - 1 && direction == 1)
-				break;
-
-			vDisplacement = targetPoint - points[closestIndex + direction];
-			nextMag = vDisplacement.length();
-		}
-	}
-
-	// We can calculate, tStable = closestIndex / (sampleCount - 1)
-	// However, we can increase the accuracy by determining the skew of the current dot product in relation to the dot product before or after
-	// We are determining if the minimum occurs before or after the current index by querying whether the sign of the dot product calculations changes
-	// If the sign does not change then the minimum is not skewed, indicating the closest index is one of the end points
-	double tStable = closestIndex / (double)(sampleCount - 1);
-
-	double earlyProduct;
-	double lateProduct;
-	vDisplacement = targetPoint - points[closestIndex]; vDisplacement.normalize();
-	MVector vTangent = sampleFirstDerivative(closestIndex / (double)(sampleCount - 1), shape1, shape2, controlPoints);
-	double closestProduct = vDisplacement * vTangent;
-
-	if (closestIndex == 0)
-		earlyProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - points[closestIndex - 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex - 1)/ (double)(sampleCount - 1), shape1, shape2, controlPoints);
-		earlyProduct = vDisplacement * vTangent;
-	}
-
-	if (closestIndex == sampleCount - 1)
-		lateProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - points[closestIndex + 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex + 1) / (double)(sampleCount - 1), shape1, shape2, controlPoints);
-		lateProduct = vDisplacement * vTangent;
-	}
-
-	bool isMinimumEarly = (earlyProduct < 0 && closestProduct > 0) || (earlyProduct > 0 && closestProduct < 0);
-	bool isMinimumLate = (lateProduct < 0 && closestProduct > 0) || (lateProduct > 0 && closestProduct < 0);
-
-	if (isMinimumEarly)
-	{
-		// The minimum occurs before tStable
-		double productDelta = std::abs(earlyProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = 1.0 / (double)(sampleCount - 1);
-		tStable = tStable - step * minimumRatio;
-	}
-	else if (isMinimumLate)
-	{
-		// The minimum occurs after tStable
-		double productDelta = std::abs(lateProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = 1.0 / (double)(sampleCount - 1);
-		tStable = tStable + step * minimumRatio;
-	}
-
-	// --- Sample Distribution ---
-	// When parameterizing the curve, we attempt to evenly distribute samples between each segment
-	// In the case where the sampleCount is not evenly divisible by the 2 segments, the first segments will have preference and receive the extra samples
-	// There are three constant points (start, tStable, end), from this we can determine the distribution:
-	unsigned int remainingCount = sampleCount - 3;
-	unsigned int segment0SampleCount = (unsigned)std::ceil(remainingCount / 2.0);
-	unsigned int segment1SampleCount = remainingCount - segment0SampleCount;
-	unsigned int stableIndex = segment0SampleCount + 1; // +1 for start point
-
-	// --- Segment0 ---
-	// Using the total arc-length of segment0, iterate over uniform increments and approximate values of t for (0.0, tStable)
-	double segment0ArcLength = naturalToArcLengthParameter(tStable, lengths) * lengths[sampleCount - 1];
-	double segment0Step = 1.0 / (segment0SampleCount + 1);
-	double segment0Percent = 0.0;
-
-	for (unsigned int i = 1; i < stableIndex; ++i)
-	{
-		segment0Percent += segment0Step;
-		double targetLength = segment0Percent * segment0ArcLength;
-
-		// Complete a binary search to find the closest tLength which is smaller than the targetLength
-		// We then just need to retrieve the t value which was used to calulate the tLength
-		unsigned int low = 0;
-		unsigned int high = isMinimumLate ? closestIndex + 1 : closestIndex;
-		unsigned int index;
-		double tLength;
-
-		while (low < high)
-		{
-			index = low + (high - low) / 2;
-			tLength = lengths[index];
-
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
-		}
-
-		// The last iteration of the search may cause the index to increase due to the low value increasing on the second last iteration
-		// In this case, the tLength at the current index may be larger than the targetLength
-		// We must complete one final check and decrement the index if this was the case
-		if (tLength > targetLength)
-			index -= 1;
-
-		assert(lengths[index] <= targetLength);
-		assert(lengths[index + 1] > targetLength);
-
-		// To retrieve the t value for the tLength we can calculate, t = index / (sampleCount - 1)
-		// However, we can increase the accuracy by determining the skew of the target length in relation to the lengths before and after
-		double tLengthBefore = lengths[index];
-		double tLengthAfter = lengths[index + 1];
-		double t = ((double)index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / (double)(sampleCount - 1);
-		outParameters[i] = t;
-	}
-
-	outParameters[sampleCount / 2] = tStable;
-
-	// --- Segment1 ---
-	// Using the total arc-length of segment1, iterate over uniform increments and approximate values of t for (tStable, 1.0)
-	double segment1ArcLength = lengths[sampleCount - 1] - segment0ArcLength;
-	double segment1Step = 1.0 / (segment1SampleCount + 1);
-	double segment1Percent = 0.0;
-
-	for (unsigned int i = stableIndex + 1; i < sampleCount - 1; ++i)
-	{
-		segment1Percent += segment1Step;
-		double targetLength = segment0ArcLength + segment1Percent * segment1ArcLength;
-
-		unsigned int low = isMinimumEarly ? closestIndex - 1 : closestIndex;
-		unsigned int high = sampleCount;
-		unsigned int index;
-		double tLength;
-
-		while (low < high)
-		{
-			index = low + (high - low) / 2;
-			tLength = lengths[index];
-
-			if (tLength < targetLength)
-				low = index + 1;
-			else
-				high = index;
-		}
-
-		if (tLength > targetLength)
-			index -= 1;
-
-		assert(lengths[index] <= targetLength);
-		assert(lengths[index + 1] > targetLength);
-
-		double tLengthBefore = lengths[index];
-		double tLengthAfter = lengths[index + 1];
-		double t = ((double)index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / (double)(sampleCount - 1);
-		outParameters[i] = t;
-	}
-
-	outParameters[sampleCount - 1] = 1.0;
-}
-
-/*	Description
-	-----------
-	Calculates an equivalent natural parameter approximation for the given split-length parameter
-	We will calculate the stable parameter from which we can determine the arc-lengths of each segment
-	We can then determine the arc-length at the given parameter by determining its proportional position within the segment's parameterized range
-	From the arc-length we can determine the natural parameter
-
-	Args
-	----
-	splitLengthParameter = The split-length parameter from which to calculate the equivalent natural parameter, range = [0.0, 1.0]
-	controlPoints = The four positions used to define the shape of the curve
-	points = An array of positions sampled along the curve at uniform increments of its natural parameter
-	tangents = An array of tangents sampled along the curve at uniform increments of its natural parameter
-	lengths = An array of values containing the length of the curve at uniform increments of its natural parameter    */
-double CubicTBezier::splitLengthToNaturalParameter(double splitLengthParameter, double shape1, double shape2, 
-	const std::vector<MVector>& controlPoints, const std::vector<MVector>& points, const std::vector<double>& lengths)
-{
-	if (splitLengthParameter == 0.0 || splitLengthParameter == 1.0)
-		return splitLengthParameter;
-
-	unsigned int sampleCount = (int)lengths.size();
-	assert(sampleCount >= 2);
-	assert(sampleCount == points.size() == tangents.size());
-	
-	// --- Closest Point Joint0 ---
-	MPoint targetPoint = controlPoints[1] + (controlPoints[2] - controlPoints[1]) / 2;
-	// This will always be larger than 0 but may be equal to sampleCount-1
-	unsigned int closestIndex = sampleCount / 2;
-	MVector vDisplacement = targetPoint - points[closestIndex];
-	double closestMag = vDisplacement.length();
-	vDisplacement = targetPoint - points[closestIndex - 1];
-	double earlyMag = vDisplacement.length();
-	
-	double lateMag;
-	if (closestIndex == sampleCount - 1)
-		lateMag = closestMag;
-	else
-	{
-		vDisplacement = targetPoint - points[closestIndex + 1];
-		double lateMag = vDisplacement.length();
-	}
-
-	char direction = earlyMag < closestMag ? -1 : 0;
-	direction = lateMag < closestMag ? 1 : direction;
-
-	if (direction != 0)
-	{
-		double nextMag = direction == -1 ? earlyMag : lateMag;
-		while (nextMag < closestMag)
-		{
-			closestIndex += direction;
-			closestMag = nextMag;
-
-			// Check bounds
-			if (closestIndex == 0 && direction == -1)
-				break;
-			if (closestIndex == sampleCount - 1 && direction == 1)
-				break;
-
-			vDisplacement = targetPoint - points[closestIndex + direction];
-			nextMag = vDisplacement.length();
-		}
-	}
-
-	// Calculate the skew
-	double tStable = closestIndex / (double)(sampleCount - 1);
-
-	double earlyProduct;
-	double lateProduct;
-	vDisplacement = targetPoint - points[closestIndex]; vDisplacement.normalize();
-	MVector vTangent = sampleFirstDerivative(closestIndex / (double)(sampleCount - 1), shape1, shape2, controlPoints);
-	double closestProduct = vDisplacement * vTangent;
-
-	if (closestIndex == 0)
-		earlyProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - points[closestIndex - 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex - 1) / (double)(sampleCount - 1), shape1, shape2, controlPoints);
-		earlyProduct = vDisplacement * vTangent;
-	}
-
-	if (closestIndex == sampleCount - 1)
-		lateProduct = closestProduct;
-	else
-	{
-		vDisplacement = targetPoint - points[closestIndex + 1]; vDisplacement.normalize();
-		vTangent = sampleFirstDerivative((closestIndex + 1) / (double)(sampleCount - 1), shape1, shape2, controlPoints);
-		lateProduct = vDisplacement * vTangent;
-	}
-
-	bool isMinimumEarly = (earlyProduct < 0 && closestProduct > 0) || (earlyProduct > 0 && closestProduct < 0);
-	bool isMinimumLate = (lateProduct < 0 && closestProduct > 0) || (lateProduct > 0 && closestProduct < 0);
-
-	if (isMinimumEarly)
-	{
-		// The minimum occurs before tStable
-		double productDelta = std::abs(earlyProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = 1.0 / (double)(sampleCount - 1);
-		tStable = tStable - step * minimumRatio;
-	}
-	else if (isMinimumLate)
-	{
-		// The minimum occurs after tStable
-		double productDelta = std::abs(lateProduct) + std::abs(closestProduct);
-		double minimumRatio = std::abs(closestProduct) / productDelta;
-		double step = 1.0 / (double)(sampleCount - 1);
-		tStable = tStable + step * minimumRatio;
-	}
-
-	// --- Parameterization ---
-	double segment0ArcLength = naturalToArcLengthParameter(tStable, lengths) * lengths[sampleCount - 1];
-	double segment1ArcLength = lengths[sampleCount - 1] - segment0ArcLength;
-	double segmentParamSize = 0.5;
-
-	double targetLength;
-	if (splitLengthParameter >= 0.0 && splitLengthParameter < segmentParamSize)
-	{
-		double segmentRatio = splitLengthParameter / segmentParamSize;
-		targetLength = segment0ArcLength * segmentRatio;
-	}
-	else
-	{
-		double segmentRatio = (splitLengthParameter - segmentParamSize) / segmentParamSize;
-		targetLength = segment0ArcLength + segment1ArcLength * segmentRatio;
-	}
-
-	double tLength = 0.0;
-
-	unsigned int low = 0;
-	unsigned int high = sampleCount;
-	unsigned int index;
-
-	while (low < high)
-	{
-		index = low + (high - low) / 2;
-		tLength = lengths[index];
-
-		if (tLength < targetLength)
-			low = index + 1;
-		else
-			high = index;
-	}
+	MVector vSecondDerivative = sampleDerivative(2, t, controlPoints);
+	double firstLength = vFirstDerivative.length();
 
-	if (tLength > targetLength)
-		index -= 1;
+	return (vFirstDerivative ^ vSecondDerivative).length() / (firstLength * firstLength * firstLength);
+}
 
-	assert(lengths[index] <= targetLength);
-	assert(lengths[index + 1] > targetLength);
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-	double tLengthBefore = lengths[index];
-	double tLengthAfter = lengths[index + 1];
-	double t = ((double)index + (targetLength - tLengthBefore) / (tLengthAfter - tLengthBefore)) / (double)(sampleCount - 1);
-	return t;
-}
+/*	Resources
+	---------
+	Trigonometric Bezier equations
+	https://www.sciencedirect.com/science/article/pii/S0893965908001262
+	Closest point on curve
+	https://hal.inria.fr/file/index/docid/518379/filename/Xiao-DiaoChen2007c.pdf
+*/
+
+CubicTBezier::CubicTBezier() {}
+CubicTBezier::~CubicTBezier() {}
 
 // ------ Sample ------
 
@@ -1144,19 +878,12 @@ std::vector<double> BSpline::computeUnclampedKnotVector(unsigned int n, unsigned
 	knots = Increasing value knot vector which contains the given value t    */
 unsigned int BSpline::getKnotInterval(double t, unsigned int degree, const std::vector<double>& knots)
 {
-	// If the loop never breaks, the value of t is on the far boundary of the last internal interval
-	unsigned int interval = (int)knots.size() - degree - 2;
-
-	for (unsigned int i = degree; i <= interval; i++)
-	{
-		if (t >= knots[i] && t < knots[i + 1])
-		{
-			interval = i;
-			break;
-		}
-	}
+	// If the value of t is on the far boundary of the last internal interval, it will be assigned to the last internal interval
+	unsigned int lastInterval = (int)knots.size() - degree - 2;
 
-	return interval;
+	// Binary search for the first internal knot which is greater than t, the interval begins at the preceding knot
+	auto knotIter = std::upper_bound(knots.begin() + degree + 1, knots.begin() + lastInterval + 1, t);
+	return (unsigned)std::distance(knots.begin(), knotIter) - 1;
 }
 
 // ------ Sample ------
@@ -1333,6 +1060,90 @@ MVector BSpline::sampleDerivative(unsigned int order, double t, unsigned int deg
 	return controlPointsTemporary[0];
 }
 
+/*	Description
+	-----------
+	Evaluates the position and first derivative of the curve for an array of parameters
+	This is considerably faster than calling sampleCurve() and sampleDerivative() for each parameter
+	- No memory is allocated, the knot interval of each parameter is resolved by incrementally walking the knot vector
+	- The Carl de Boor recurrence is then evaluated for multiple samples at once using the widest instruction set supported at runtime (AVX2, SSE2 or scalar)
+
+	Considerations
+	--------------
+	The parameters are expected to be mostly increasing (eg. uniform samples), this is what allows the knot intervals to be walked incrementally
+	- If a parameter is less than its predecessor, its interval is found via binary search, therefore an array which wraps due to an offset is still efficient
+	Curves whose degree exceeds kBatchMaxDegree are evaluated using the per-sample functions
+
+	Args
+	----
+	degree = Degree of piecewise polynomials which constitute the B-spline
+	knots = Increasing value knot vector which contains the given parameters and corresponds to the given control points
+	controlPoints = Control points used to define the curve
+	parameters = Array of natural parameters to sample, must contain at least count elements
+	count = Number of parameters to sample
+	outPoints = Array which will receive the sampled points, must contain at least count elements
+	outFirstDerivatives = Optional array which will receive the non-normalized first derivatives, must contain at least count elements    */
+void BSpline::sampleBatch(unsigned int degree, const std::vector<double>& knots, const std::vector<MVector>& controlPoints,
+	const double* parameters, unsigned int count, MVector* outPoints, MVector* outFirstDerivatives)
+{
+	if (count == 0)
+		return;
+
+	if (degree > kBatchMaxDegree)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			outPoints[i] = sampleCurve(parameters[i], degree, knots, controlPoints);
+			if (outFirstDerivatives)
+				outFirstDerivatives[i] = sampleDerivative(1, parameters[i], degree, knots, controlPoints);
+		}
+
+		return;
+	}
+
+	static const bool isAVX2Enabled = getSimdLevel() == kSimdAVX2 && isSampleBatchAVX2Compiled();
+	
+	unsigned int intervals[kBatchBlockSize];
+	unsigned int lastInterval = (int)knots.size() - degree - 2;
+	unsigned int interval = getKnotInterval(parameters[0], degree, knots);
+
+	// The kernel receives the points as arrays of doubles (see spline_utils_batch.h)
+	static_assert(sizeof(MVector) == 3 * sizeof(double), "BSpline::sampleBatch : MVector must hold 3 consecutive doubles");
+
+	BSplineBatchBlock block;
+	block.degree = degree;
+	block.knots = knots.data();
+	block.controlPoints = &controlPoints[0].x;
+	block.intervals = intervals;
+
+	for (unsigned int first = 0; first < count; first += kBatchBlockSize)
+	{
+		block.count = std::min(kBatchBlockSize, count - first);
+		block.parameters = parameters + first;
+		block.outPoints = &outPoints[first].x;
+		block.outFirstDerivatives = outFirstDerivatives ? &outFirstDerivatives[first].x : nullptr;
+
+		for (unsigned int i = 0; i < block.count; ++i)
+		{
+			double t = block.parameters[i];
+
+			if (t < knots[interval])
+				interval = getKnotInterval(t, degree, knots);
+			else
+			{
+				while (interval < lastInterval && t >= knots[interval + 1])
+					interval++;
+			}
+
+			intervals[i] = interval;
+		}
+
+		if (isAVX2Enabled)
+			sampleBatchAVX2(block);
+		else
+			sampleBatchKernel<BasePack>(block);
+	}
+}
+
 /*	Description
 	-----------
 	Provides a value for the curvature at a given value of the natural parameter t
@@ -1359,6 +1170,448 @@ double BSpline::sampleCurvature(double t, unsigned int degree, const std::vector
 	return (vFirstDerivative ^ vSecondDerivative).length() / (firstLength * firstLength * firstLength);
 }
 
+// ------ RMF ------
+
+/*	Description
+	-----------
+	Propagates a normal along the curve from the lower bound parameter to the upper bound parameter using the double reflection method
+	Steps never cross a knot as the curve is only guaranteed to be smooth within each knot interval, see Spline::propagateNormalRMF
+
+	Args
+	----
+	degree = Degree of piecewise polynomials which constitute the B-spline
+	knots = Increasing value knot vector which corresponds to the given control points
+	controlPoints = Control points used to define the curve
+	lowerBound = Natural parameter at which the given normal is defined
+	upperBound = Natural parameter at which the normal will be returned, must be greater or equal to the lower bound
+	vNormalStart = Normalized vector perpendicular to the tangent of the curve at the lower bound parameter
+	angularTolerance = Maximum accumulated angular error in radians, must be greater than zero    */
+MVector BSpline::propagateNormalRMF(unsigned int degree, const std::vector<double>& knots, const std::vector<MVector>& controlPoints,
+	double lowerBound, double upperBound, const MVector& vNormalStart, double angularTolerance)
+{
+	auto sample = [&](double t, MVector& outPoint, MVector& outFirstDerivative)
+	{
+		outPoint = sampleCurve(t, degree, knots, controlPoints);
+		outFirstDerivative = sampleDerivative(1, t, degree, knots, controlPoints);
+	};
+
+	return Spline::propagateNormalRMF(sample, knots, lowerBound, upperBound, vNormalStart, angularTolerance);
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Resources
+	---------
+	Gauss-Legendre quadrature
+	https://en.wikipedia.org/wiki/Gaussian_quadrature
+	https://pomax.github.io/bezierinfo/legendre-gauss.html
+	Arc-length parameterization via Newton's method
+	https://www.geometrictools.com/Documentation/MovingAlongCurveSpecifiedSpeed.pdf    */
+
+namespace {
+
+// Five point Gauss-Legendre quadrature over the interval [-1, 1]
+// Polynomials of up to degree 9 are integrated exactly, the speed of a polynomial curve is the square root of a polynomial and is approximated very closely
+const unsigned int kGaussLegendreCount = 5;
+const double kGaussLegendreNodes[kGaussLegendreCount] = { -0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640 };
+const double kGaussLegendreWeights[kGaussLegendreCount] = { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891 };
+
+// Newton's method will terminate once the error is within this fraction of the total length
+const double kArcLengthTolerance = 1e-10;
+const unsigned int kArcLengthMaxIterations = 8;
+
+} // anonymous
+
+ArcLengthTable::ArcLengthTable() :
+	m_curveType{ kNone },
+	m_degree{ 0 },
+	m_spanSubdivisions{ 1 },
+	m_lowerBound{ 0.0 },
+	m_upperBound{ 1.0 }
+{}
+
+ArcLengthTable::~ArcLengthTable() {}
+
+// ------ Build ------
+
+/*	Description
+	-----------
+	Builds the table for a Bezier curve whose single span will be divided into the given number of uniform segments
+
+	Args
+	----
+	controlPoints = Control points used to define the curve, these will be copied into the table
+	segmentCount = Number of segments to integrate, must be greater than zero    */
+void ArcLengthTable::build(const std::vector<MVector>& controlPoints, unsigned int segmentCount)
+{
+	assert(controlPoints.size() >= 2);
+	assert(segmentCount >= 1);
+
+	m_curveType = kBezier;
+	m_controlPoints = controlPoints;
+	m_lowerBound = 0.0;
+	m_upperBound = 1.0;
+
+	initializeSegments(segmentCount);
+	computeSegmentLengths(0, segmentCount - 1);
+}
+
+/*	Description
+	-----------
+	Builds the table for a cubic trigonometric Bezier curve whose single span will be divided into the given number of uniform segments
+
+	Args
+	----
+	shape1 = The first parameter used to adjust the shape of the curve, range = [-1, 1]
+	shape2 = The second parameter used to adjust the shape of the curve, range = [-1, 1]
+	controlPoints = Control points used to define the curve, these will be copied into the table
+	segmentCount = Number of segments to integrate, must be greater than zero    */
+void ArcLengthTable::build(double shape1, double shape2, const std::vector<MVector>& controlPoints, unsigned int segmentCount)
+{
+	build({ shape1, shape2 }, { controlPoints }, segmentCount);
+}
+
+/*	Description
+	-----------
+	Builds the table for a chain of cubic trigonometric Bezier curves, span i is defined over the natural parameters [i, i + 1]
+	Each span will be divided into the given number of uniform segments, segment boundaries therefore coincide with the span boundaries
+
+	Args
+	----
+	shapes = The two shaping parameters of each span stored consecutively, range = [-1, 1]
+	spanControlPoints = The four control points of each span, these will be copied into the table
+	spanSegmentCount = Number of segments to integrate per span, must be greater than zero    */
+void ArcLengthTable::build(const std::vector<double>& shapes, const std::vector<std::vector<MVector>>& spanControlPoints, unsigned int spanSegmentCount)
+{
+	unsigned int spanCount = (unsigned)spanControlPoints.size();
+	assert(spanCount >= 1);
+	assert(shapes.size() == 2 * spanCount);
+	assert(spanSegmentCount >= 1);
+
+	m_curveType = kCubicTBezier;
+	m_shapes = shapes;
+	m_spanControlPoints = spanControlPoints;
+	m_lowerBound = 0.0;
+	m_upperBound = (double)spanCount;
+
+	initializeSegments(spanCount * spanSegmentCount);
+	computeSegmentLengths(0, spanCount * spanSegmentCount - 1);
+}
+
+/*	Description
+	-----------
+	Builds the table for a B-spline, each knot span will be divided into the given number of uniform segments
+	If the curve is unclamped, the table will only cover its restricted domain [knots[degree], knots[n + 1]]
+
+	Args
+	----
+	degree = Degree of piecewise polynomials which constitute the B-spline
+	knots = Increasing value knot vector corresponding to the given control points, this will be copied into the table
+	controlPoints = Control points used to define the curve, these will be copied into the table
+	spanSubdivisions = Number of segments to integrate per knot span, must be greater than zero    */
+void ArcLengthTable::build(unsigned int degree, const std::vector<double>& knots, const std::vector<MVector>& controlPoints, unsigned int spanSubdivisions)
+{
+	assert(controlPoints.size() > degree);
+	assert(knots.size() == controlPoints.size() + degree + 1);
+	assert(spanSubdivisions >= 1);
+
+	unsigned int n = (unsigned)controlPoints.size() - 1;
+	unsigned int spanCount = n - degree + 1;
+
+	m_curveType = kBSpline;
+	m_degree = degree;
+	m_spanSubdivisions = spanSubdivisions;
+	m_knots = knots;
+	m_controlPoints = controlPoints;
+	m_lowerBound = knots[degree];
+	m_upperBound = knots[n + 1];
+
+	initializeSegments(spanCount * spanSubdivisions);
+	computeSegmentLengths(0, spanCount * spanSubdivisions - 1);
+}
+
+/*	Description
+	-----------
+	Updates a B-spline table after a contiguous range of its control points has been modified
+	Only the segments contained by the knot spans within the support of the modified control points will be integrated
+	The number of control points and the knot vector must not have changed since the table was built
+
+	Args
+	----
+	controlPoints = Control points used to define the curve
+	lowerControlPointIndex, upperControlPointIndex = Inclusive range of control points which have been modified since the table was built or updated    */
+void ArcLengthTable::update(const std::vector<MVector>& controlPoints, unsigned int lowerControlPointIndex, unsigned int upperControlPointIndex)
+{
+	assert(m_curveType == kBSpline);
+	assert(controlPoints.size() == m_controlPoints.size());
+	assert(lowerControlPointIndex <= upperControlPointIndex && upperControlPointIndex < controlPoints.size());
+
+	for (unsigned int i = lowerControlPointIndex; i <= upperControlPointIndex; ++i)
+		m_controlPoints[i] = controlPoints[i];
+
+	// The basis function of control point i is non-zero over the knot intervals [i, i + degree], the curve is defined over the intervals [degree, n]
+	unsigned int n = (unsigned)m_controlPoints.size() - 1;
+	unsigned int lowerInterval = std::max(lowerControlPointIndex, m_degree);
+	unsigned int upperInterval = std::min(upperControlPointIndex + m_degree, n);
+
+	computeSegmentLengths((lowerInterval - m_degree) * m_spanSubdivisions, (upperInterval - m_degree + 1) * m_spanSubdivisions - 1);
+}
+
+void ArcLengthTable::clear()
+{
+	m_curveType = kNone;
+	m_knots.clear();
+	m_controlPoints.clear();
+	m_shapes.clear();
+	m_spanControlPoints.clear();
+	m_segmentParameters.clear();
+	m_segmentLengths.clear();
+	m_cumulativeLengths.clear();
+}
+
+// ------ Query ------
+
+bool ArcLengthTable::isValid() const
+{
+	return m_curveType != kNone;
+}
+
+/*	Description
+	-----------
+	Returns the total arc-length of the curve    */
+double ArcLengthTable::getLength() const
+{
+	assert(isValid());
+
+	return m_cumulativeLengths.back();
+}
+
+/*	Description
+	-----------
+	Returns the arc-length of the curve from the start of its domain to the given natural parameter
+	
+	Args
+	----
+	naturalParameter = Natural parameter normalized over the domain of the curve, range = [0, 1]    */
+double ArcLengthTable::getLength(double naturalParameter) const
+{
+	assert(isValid());
+
+	double t = m_lowerBound + std::min(std::max(naturalParameter, 0.0), 1.0) * (m_upperBound - m_lowerBound);
+	unsigned int segmentIndex = getSegmentIndex(t);
+
+	return m_cumulativeLengths[segmentIndex] + integrateSpeed(m_segmentParameters[segmentIndex], t);
+}
+
+/*	Description
+	-----------
+	Calculates the natural parameter at which the given fraction of the total arc-length is reached
+	- The segment containing the target length is found using a binary search over the cumulative lengths
+	- An initial guess is made by linearly interpolating the segment, this is then refined using Newton's method
+	- The derivative of the arc-length with respect to the natural parameter is simply the parametric speed
+	- If an iteration would leave the bracketing interval, the iteration will bisect the interval instead (guarantees convergence)
+
+	Args
+	----
+	arcLengthParameter = Arc-length parameter normalized over the total length of the curve, range = [0, 1]
+
+	Returns
+	-------
+	Natural parameter normalized over the domain of the curve, range = [0, 1]    */
+double ArcLengthTable::arcLengthToNaturalParameter(double arcLengthParameter) const
+{
+	assert(isValid());
+
+	if (arcLengthParameter <= 0.0 || arcLengthParameter >= 1.0)
+		return std::min(std::max(arcLengthParameter, 0.0), 1.0);
+
+	double totalLength = getLength();
+	if (totalLength <= 0.0)
+		return arcLengthParameter;
+
+	double targetLength = arcLengthParameter * totalLength;
+
+	// Find the first segment whose upper cumulative length is greater than the target length
+	auto lengthIter = std::upper_bound(m_cumulativeLengths.begin() + 1, m_cumulativeLengths.end() - 1, targetLength);
+	unsigned int segmentIndex = (unsigned)std::distance(m_cumulativeLengths.begin() + 1, lengthIter);
+
+	double segmentLowerParameter = m_segmentParameters[segmentIndex];
+	double segmentUpperParameter = m_segmentParameters[segmentIndex + 1];
+	double segmentLength = m_segmentLengths[segmentIndex];
+	double segmentTargetLength = targetLength - m_cumulativeLengths[segmentIndex];
+
+	double lowerBracket = segmentLowerParameter;
+	double upperBracket = segmentUpperParameter;
+	double t = segmentLength > 0.0 ? segmentLowerParameter + (segmentUpperParameter - segmentLowerParameter) * segmentTargetLength / segmentLength
+		: segmentLowerParameter;
+	double tolerance = kArcLengthTolerance * totalLength;
+
+	for (unsigned int i = 0; i < kArcLengthMaxIterations; ++i)
+	{
+		double error = integrateSpeed(segmentLowerParameter, t) - segmentTargetLength;
+		if (std::abs(error) <= tolerance)
+			break;
+
+		if (error > 0.0)
+			upperBracket = t;
+		else
+			lowerBracket = t;
+
+		double speed;
+		computeSpeeds(&t, 1, &speed);
+		double tNext = speed > 0.0 ? t - error / speed : lowerBracket;
+
+		if (tNext <= lowerBracket || tNext >= upperBracket)
+			tNext = 0.5 * (lowerBracket + upperBracket);
+
+		t = tNext;
+	}
+
+	return (t - m_lowerBound) / (m_upperBound - m_lowerBound);
+}
+
+/*	Description
+	-----------
+	Calculates the fraction of the total arc-length which is reached at the given natural parameter
+
+	Args
+	----
+	naturalParameter = Natural parameter normalized over the domain of the curve, range = [0, 1]
+
+	Returns
+	-------
+	Arc-length parameter normalized over the total length of the curve, range = [0, 1]    */
+double ArcLengthTable::naturalToArcLengthParameter(double naturalParameter) const
+{
+	assert(isValid());
+
+	if (naturalParameter <= 0.0 || naturalParameter >= 1.0)
+		return std::min(std::max(naturalParameter, 0.0), 1.0);
+
+	double totalLength = getLength();
+	return totalLength > 0.0 ? getLength(naturalParameter) / totalLength : naturalParameter;
+}
+
+// ------ Helpers ------
+
+void ArcLengthTable::initializeSegments(unsigned int segmentCount)
+{
+	m_segmentParameters.resize(segmentCount + 1);
+	m_segmentLengths.resize(segmentCount);
+	m_cumulativeLengths.resize(segmentCount + 1);
+
+	if (m_curveType == kBSpline)
+	{
+		// Segment boundaries must coincide with the knots so that the integrand is smooth within each segment
+		for (unsigned int i = 0; i < segmentCount; ++i)
+		{
+			unsigned int interval = m_degree + i / m_spanSubdivisions;
+			double spanFraction = (double)(i % m_spanSubdivisions) / (double)m_spanSubdivisions;
+			m_segmentParameters[i] = m_knots[interval] + (m_knots[interval + 1] - m_knots[interval]) * spanFraction;
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < segmentCount; ++i)
+			m_segmentParameters[i] = m_lowerBound + (m_upperBound - m_lowerBound) * (double)i / (double)segmentCount;
+	}
+
+	// Ensure precision error does not interfere with boundary conditions
+	m_segmentParameters[segmentCount] = m_upperBound;
+	m_cumulativeLengths[0] = 0.0;
+}
+
+/*	Description
+	-----------
+	Integrates the inclusive range of segments, the cumulative lengths are then updated from the first segment onwards    */
+void ArcLengthTable::computeSegmentLengths(unsigned int firstSegmentIndex, unsigned int lastSegmentIndex)
+{
+	unsigned int segmentCount = (unsigned)m_segmentLengths.size();
+	assert(firstSegmentIndex <= lastSegmentIndex && lastSegmentIndex < segmentCount);
+
+	for (unsigned int i = firstSegmentIndex; i <= lastSegmentIndex; ++i)
+		m_segmentLengths[i] = integrateSpeed(m_segmentParameters[i], m_segmentParameters[i + 1]);
+
+	for (unsigned int i = firstSegmentIndex; i < segmentCount; ++i)
+		m_cumulativeLengths[i + 1] = m_cumulativeLengths[i] + m_segmentLengths[i];
+}
+
+/*	Description
+	-----------
+	Computes the parametric speed (ie. the magnitude of the first derivative) for an array of at most kGaussLegendreCount natural parameters    */
+void ArcLengthTable::computeSpeeds(const double* parameters, unsigned int count, double* outSpeeds) const
+{
+	assert(count <= kGaussLegendreCount);
+
+	MVector derivatives[kGaussLegendreCount];
+
+	switch (m_curveType)
+	{
+		case kBSpline:
+		{
+			MVector points[kGaussLegendreCount];
+			BSpline::sampleBatch(m_degree, m_knots, m_controlPoints, parameters, count, points, derivatives);
+			break;
+		}
+		case kBezier:
+		{
+			for (unsigned int i = 0; i < count; ++i)
+				derivatives[i] = Bezier::sampleDerivative(1, parameters[i], m_controlPoints);
+			break;
+		}
+		case kCubicTBezier:
+		{
+			// Quadrature nodes lie strictly within a segment, therefore each parameter maps to the span which contains its segment
+			unsigned int spanCount = (unsigned)m_spanControlPoints.size();
+			for (unsigned int i = 0; i < count; ++i)
+			{
+				unsigned int spanIndex = std::min((unsigned)std::max(parameters[i], 0.0), spanCount - 1);
+				double t = std::min(std::max(parameters[i] - spanIndex, 0.0), 1.0);
+				derivatives[i] = CubicTBezier::sampleFirstDerivative(t, m_shapes[2 * spanIndex], m_shapes[2 * spanIndex + 1], 
+					m_spanControlPoints[spanIndex]);
+			}
+			break;
+		}
+		default:
+			assert(false);
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+		outSpeeds[i] = derivatives[i].length();
+}
+
+/*	Description
+	-----------
+	Integrates the parametric speed over the given range of natural parameters using Gauss-Legendre quadrature
+	The range should not cross a knot as the integrand is only piecewise smooth    */
+double ArcLengthTable::integrateSpeed(double lowerParameter, double upperParameter) const
+{
+	double halfRange = 0.5 * (upperParameter - lowerParameter);
+	double midpoint = 0.5 * (upperParameter + lowerParameter);
+
+	double parameters[kGaussLegendreCount];
+	double speeds[kGaussLegendreCount];
+	for (unsigned int i = 0; i < kGaussLegendreCount; ++i)
+		parameters[i] = midpoint + halfRange * kGaussLegendreNodes[i];
+
+	computeSpeeds(parameters, kGaussLegendreCount, speeds);
+
+	double length = 0.0;
+	for (unsigned int i = 0; i < kGaussLegendreCount; ++i)
+		length += kGaussLegendreWeights[i] * speeds[i];
+
+	return length * halfRange;
+}
+
+/*	Description
+	-----------
+	Returns the index of the segment which contains the given natural parameter    */
+unsigned int ArcLengthTable::getSegmentIndex(double t) const
+{
+	auto parameterIter = std::upper_bound(m_segmentParameters.begin() + 1, m_segmentParameters.end() - 1, t);
+	return (unsigned)std::distance(m_segmentParameters.begin() + 1, parameterIter);
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 } // MRS
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include <maya/MEulerRotation.h>
@@ -22,6 +24,10 @@ namespace MRS {
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+class ArcLengthTable;
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 // Base class which implements general curve functionality
 class Spline
 {
@@ -37,6 +43,18 @@ public:
 	static double arcLengthToNaturalParameter(double arcLengthParameter, const std::vector<double>& lengths);
 
 	static double naturalToArcLengthParameter(double naturalParameter, const std::vector<double>& lengths);
+
+	static void computeArcLengthParameters(const ArcLengthTable& table, std::vector<double>& outParameters);
+
+	static double arcLengthToNaturalParameter(double arcLengthParameter, const ArcLengthTable& table);
+
+	static double naturalToArcLengthParameter(double naturalParameter, const ArcLengthTable& table);
+
+	static void computeSplitLengthParameters(const ArcLengthTable& table, const std::vector<double>& stableParameters, 
+		std::vector<double>& outParameters);
+
+	static double splitLengthToNaturalParameter(double splitLengthParameter, const ArcLengthTable& table, 
+		const std::vector<double>& stableParameters);
 	
 	// ------ RMF ------
 	static MVector computeProjectedNormalRMF(const MVector& vNormalPrevious, const MVector& vTangentCurrent);
@@ -44,11 +62,235 @@ public:
 	static MQuaternion computeDoubleReflectionRMF(const MVector& vPointPrevious, const MVector& vPointCurrent, 
 		const MVector& vTangentPrevious, const MVector& vTangentCurrent);
 
+	template<typename TSampler>
+	static MVector propagateNormalRMF(const TSampler& sample, const std::vector<double>& breakpoints, double lowerBound, double upperBound, 
+		const MVector& vNormalStart, double angularTolerance);
+
+	// ------ Projection ------
+	template<typename TSampler>
+	static double closestParameterToLine(const TSampler& sample, double lowerBound, double upperBound, const MVector& pLineOrigin, 
+		const MVector& vLineDirection, unsigned int subdivisions = 64, unsigned int maxIterations = 8);
+
+	template<typename TSampler>
+	static double closestParameterToPoint(const TSampler& sample, double lowerBound, double upperBound, const MVector& pTarget, 
+		unsigned int subdivisions = 64, unsigned int maxIterations = 8);
+
+	static bool closestParameterOnLineToLine(const MVector& pOrigin, const MVector& vDirection, const MVector& pLineOrigin, 
+		const MVector& vLineDirection, double& outParameter);
+
 protected:
 	Spline();
 	~Spline();
+
+private:
+	template<typename TSampler, typename TReject>
+	static double closestParameter(const TSampler& sample, double lowerBound, double upperBound, const MVector& pTarget, 
+		const TReject& reject, unsigned int subdivisions, unsigned int maxIterations);
 };
 
+/*	Description
+	-----------
+	Finds the parameter of the point on a curve which is closest to an infinite line, the result is restricted to the domain [lowerBound, upperBound]
+	The sampler is any callable which returns the point at a given parameter, this allows a curve to be solved in terms of any parameterization
+	- The domain is subdivided uniformly and the sample closest to the line is used to bracket the solution
+	- The solution is refined using Newton's method on the derivative of the squared distance, derivatives are approximated with central differences
+	- A step which leaves the bracket is replaced by a bisection step, the bracket shrinks on every iteration
+
+	The sampler must be defined within a small neighbourhood of the domain as the central differences may sample slightly beyond its bounds    */
+template<typename TSampler>
+double Spline::closestParameterToLine(const TSampler& sample, double lowerBound, double upperBound, const MVector& pLineOrigin,
+	const MVector& vLineDirection, unsigned int subdivisions, unsigned int maxIterations)
+{
+	MVector vLineAxis = vLineDirection.normal();
+	// Removes the component of a vector which is parallel to the line
+	auto reject = [&vLineAxis](const MVector& vector) -> MVector { return vector - (vector * vLineAxis) * vLineAxis; };
+
+	return closestParameter(sample, lowerBound, upperBound, pLineOrigin, reject, subdivisions, maxIterations);
+}
+
+/*	Description
+	-----------
+	Finds the parameter of the point on a curve which is closest to the target point, the result is restricted to the domain [lowerBound, upperBound]
+	The solution is bracketed and refined in the same way as closestParameterToLine, the same requirements apply to the sampler    */
+template<typename TSampler>
+double Spline::closestParameterToPoint(const TSampler& sample, double lowerBound, double upperBound, const MVector& pTarget,
+	unsigned int subdivisions, unsigned int maxIterations)
+{
+	auto reject = [](const MVector& vector) -> MVector { return vector; };
+
+	return closestParameter(sample, lowerBound, upperBound, pTarget, reject, subdivisions, maxIterations);
+}
+
+// Minimizes the squared distance between the curve and the target after each offset has been passed through the reject function
+template<typename TSampler, typename TReject>
+double Spline::closestParameter(const TSampler& sample, double lowerBound, double upperBound, const MVector& pTarget,
+	const TReject& reject, unsigned int subdivisions, unsigned int maxIterations)
+{
+	subdivisions = std::max(subdivisions, 1u);
+	double step = (upperBound - lowerBound) / subdivisions;
+	
+	double closestParam = lowerBound;
+	double closestDistanceSquared = std::numeric_limits<double>::max();
+	for (unsigned int i = 0; i <= subdivisions; ++i)
+	{
+		double param = i == subdivisions ? upperBound : lowerBound + i * step;
+		MVector vOffset = reject(MVector(sample(param)) - pTarget);
+		double distanceSquared = vOffset * vOffset;
+		if (distanceSquared < closestDistanceSquared)
+		{
+			closestParam = param;
+			closestDistanceSquared = distanceSquared;
+		}
+	}
+
+	double lower = std::max(lowerBound, closestParam - step);
+	double upper = std::min(upperBound, closestParam + step);
+	double delta = step * 1e-4;
+	double tolerance = (upperBound - lowerBound) * 1e-10;
+	double param = closestParam;
+
+	for (unsigned int i = 0; i < maxIterations; ++i)
+	{
+		MVector pPrevious = MVector(sample(param - delta));
+		MVector pCurrent = MVector(sample(param));
+		MVector pNext = MVector(sample(param + delta));
+
+		MVector vOffset = reject(pCurrent - pTarget);
+		MVector vFirstDerivative = reject((pNext - pPrevious) / (2.0 * delta));
+		MVector vSecondDerivative = reject((pNext - 2.0 * pCurrent + pPrevious) / (delta * delta));
+
+		// Half the first and second derivatives of the squared distance
+		double gradient = vOffset * vFirstDerivative;
+		double curvature = vFirstDerivative * vFirstDerivative + vOffset * vSecondDerivative;
+
+		if (gradient > 0.0)
+			upper = param;
+		else
+			lower = param;
+
+		double nextParam = curvature > 0.0 ? param - gradient / curvature : 0.5 * (lower + upper);
+		if (nextParam < lower || nextParam > upper)
+			nextParam = 0.5 * (lower + upper);
+
+		bool isConverged = std::abs(nextParam - param) <= tolerance;
+		param = nextParam;
+		if (isConverged)
+			break;
+	}
+
+	// Guard against a refinement which has failed to improve on the closest sample
+	MVector vOffset = reject(MVector(sample(param)) - pTarget);
+	return vOffset * vOffset <= closestDistanceSquared ? param : closestParam;
+}
+
+/*	Description
+	-----------
+	Propagates a normal along the curve from the lower bound parameter to the upper bound parameter using the double reflection method
+	The result is the normal of the rotation minimizing frame at the upper bound parameter
+
+	The step size is controlled by the error of each step and therefore does not depend on any external sampling of the curve
+	- Each step is compared against two half steps, the angle between the two resulting normals is used as the error estimate
+	- The double reflection method has a local error of order five, the step size is scaled accordingly after each attempt
+	- The allowed error of each step is proportional to its size, such that the accumulated error is bounded by the given tolerance
+	- Steps never cross a breakpoint as the curve is only guaranteed to be smooth between its breakpoints (eg. knots, span boundaries)
+
+	Considerations
+	--------------
+	The result will closely match the normal produced by composing a dense set of sample reflections, although it will not match exactly
+	A minimum step size is enforced so that refinement cannot stall in degenerate regions (eg. where the first derivative vanishes)
+
+	Args
+	----
+	sample = Callable with the signature (double t, MVector& outPoint, MVector& outFirstDerivative), the derivative does not need to be normalized
+	breakpoints = Increasing natural parameters at which the curve may not be smooth, may be empty
+	lowerBound = Natural parameter at which the given normal is defined
+	upperBound = Natural parameter at which the normal will be returned, must be greater or equal to the lower bound
+	vNormalStart = Normalized vector perpendicular to the tangent of the curve at the lower bound parameter
+	angularTolerance = Maximum accumulated angular error in radians, must be greater than zero    */
+template<typename TSampler>
+MVector Spline::propagateNormalRMF(const TSampler& sample, const std::vector<double>& breakpoints, double lowerBound, double upperBound, 
+	const MVector& vNormalStart, double angularTolerance)
+{
+	assert(upperBound >= lowerBound);
+	assert(angularTolerance > 0.0);
+
+	const double kMinStepRatio = 1e-6;
+	const double kSafetyFactor = 0.9;
+	const double kMinScale = 0.2;
+	const double kMaxScale = 2.0;
+
+	double range = upperBound - lowerBound;
+	if (range <= 0.0)
+		return vNormalStart;
+
+	double minStep = range * kMinStepRatio;
+
+	// Applies the rotation produced by a double reflection to a normal
+	auto reflectNormal = [](const MQuaternion& qReflectionComposition, const MVector& vNormal)
+	{
+		MQuaternion qNormal{ vNormal.x, vNormal.y, vNormal.z, 0.0 };
+		MQuaternion qNormalProjected = quaternionMultiply(qReflectionComposition, qNormal);
+		MQuaternion qNormalReflected = quaternionMultiply(qNormalProjected, qReflectionComposition.conjugate());
+		return MVector{ qNormalReflected.x, qNormalReflected.y, qNormalReflected.z }.normal();
+	};
+
+	// Returns the first breakpoint after the given parameter, or the upper bound if it occurs first
+	auto getIntervalEnd = [&breakpoints, upperBound](double t)
+	{
+		auto breakpointIter = std::upper_bound(breakpoints.begin(), breakpoints.end(), t);
+		return breakpointIter != breakpoints.end() ? std::min(*breakpointIter, upperBound) : upperBound;
+	};
+
+	double t = lowerBound;
+	MVector vPoint, vTangent;
+	sample(t, vPoint, vTangent);
+	vTangent.normalize();
+	MVector vNormal = vNormalStart;
+
+	// The initial step spans the first interval, it will be refined by the first attempt
+	double step = getIntervalEnd(t) - t;
+
+	while (t < upperBound)
+	{
+		double intervalEnd = getIntervalEnd(t);
+		bool isIntervalEnd = t + step >= intervalEnd;
+		double h = isIntervalEnd ? intervalEnd - t : step;
+		double tMid = t + 0.5 * h;
+		double tEnd = isIntervalEnd ? intervalEnd : t + h;
+
+		MVector vPointMid, vTangentMid, vPointEnd, vTangentEnd;
+		sample(tMid, vPointMid, vTangentMid);
+		vTangentMid.normalize();
+		sample(tEnd, vPointEnd, vTangentEnd);
+		vTangentEnd.normalize();
+
+		// Full step and two half steps
+		MVector vNormalFull = reflectNormal(computeDoubleReflectionRMF(vPoint, vPointEnd, vTangent, vTangentEnd), vNormal);
+		MVector vNormalHalf = reflectNormal(computeDoubleReflectionRMF(vPoint, vPointMid, vTangent, vTangentMid), vNormal);
+		vNormalHalf = reflectNormal(computeDoubleReflectionRMF(vPointMid, vPointEnd, vTangentMid, vTangentEnd), vNormalHalf);
+
+		double error = std::atan2((vNormalFull ^ vNormalHalf).length(), vNormalFull * vNormalHalf);
+		double allowedError = angularTolerance * h / range;
+		double scale = error > 0.0 ? kSafetyFactor * std::pow(allowedError / error, 0.2) : kMaxScale;
+		scale = std::max(kMinScale, std::min(kMaxScale, scale));
+
+		if (error <= allowedError || h <= minStep)
+		{
+			// The two half steps are the more accurate result
+			t = tEnd;
+			vPoint = vPointEnd;
+			vTangent = vTangentEnd;
+			vNormal = vNormalHalf;
+			// A truncated step at the end of an interval does not indicate the size of the next step
+			step = isIntervalEnd ? std::max(step, h * scale) : h * scale;
+		}
+		else
+			step = std::max(minStep, h * std::min(scale, 0.5));
+	}
+
+	return vNormal;
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 // Derived class for non-rational Bezier curves of any degree (all basis weights are equal to 1)
@@ -84,16 +326,6 @@ public:
 	CubicTBezier();
 	~CubicTBezier();
 
-	// ------ Parameterization ------
-	static void computeLengths(double shape1, double shape2, const std::vector<MVector>& controlPoints, 
-		std::vector<double>& outlengths, std::vector<MVector>* outPoints = nullptr);
-
-	static void computeSplitLengthParameters(double shape1, double shape2, const std::vector<MVector>& controlPoints,
-		const std::vector<MVector>& points, const std::vector<double>& lengths, std::vector<double>& outParameters);
-
-	static double splitLengthToNaturalParameter(double splitLengthParameter, double shape1, double shape2,
-		const std::vector<MVector>& controlPoints, const std::vector<MVector>& points, const std::vector<double>& lengths);
-
 	// ------ Sample ------
 	static MVector sampleCurve(double t, double shape1, double shape2, const std::vector<MVector>& controlPoints);
 
@@ -130,8 +362,86 @@ public:
 	static MVector sampleDerivative(unsigned int order, double t, unsigned int degree,
 		const std::vector<double>& knots, const std::vector<MVector>& controlPoints);
 
+	static void sampleBatch(unsigned int degree, const std::vector<double>& knots, const std::vector<MVector>& controlPoints,
+		const double* parameters, unsigned int count, MVector* outPoints, MVector* outFirstDerivatives = nullptr);
+
 	static double sampleCurvature(double t, unsigned int degree,
 		const std::vector<double>& knots, const std::vector<MVector>& controlPoints);
+
+	// ------ RMF ------
+	static MVector propagateNormalRMF(unsigned int degree, const std::vector<double>& knots, const std::vector<MVector>& controlPoints,
+		double lowerBound, double upperBound, const MVector& vNormalStart, double angularTolerance);
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Caches the arc-length of a curve at the boundaries of a set of segments, the length of each segment is integrated using Gauss-Legendre quadrature
+// - A B-spline is segmented at its knots so that modifying a control point will only invalidate the spans within its support
+// - Bezier curves consist of a single span which is divided into a fixed number of uniform segments
+// - Cubic T-Bezier chains consist of one or more unit spans, each of which is divided into a fixed number of uniform segments
+// The size of the table is independent of the number of samples taken from the curve, lookups are O(log n) and are refined using Newton's method
+// All parameters used by the public interface are normalized over the domain of the curve (ie. consistent with the sample based functions in Spline)
+class ArcLengthTable
+{
+public:
+	ArcLengthTable();
+	~ArcLengthTable();
+
+	// ------ Build ------
+	void build(const std::vector<MVector>& controlPoints, unsigned int segmentCount = 16);
+
+	void build(double shape1, double shape2, const std::vector<MVector>& controlPoints, unsigned int segmentCount = 16);
+
+	void build(const std::vector<double>& shapes, const std::vector<std::vector<MVector>>& spanControlPoints, unsigned int spanSegmentCount = 16);
+
+	void build(unsigned int degree, const std::vector<double>& knots, const std::vector<MVector>& controlPoints, unsigned int spanSubdivisions = 4);
+
+	void update(const std::vector<MVector>& controlPoints, unsigned int lowerControlPointIndex, unsigned int upperControlPointIndex);
+
+	void clear();
+
+	// ------ Query ------
+	bool isValid() const;
+
+	double getLength() const;
+
+	double getLength(double naturalParameter) const;
+
+	double arcLengthToNaturalParameter(double arcLengthParameter) const;
+
+	double naturalToArcLengthParameter(double naturalParameter) const;
+
+private:
+	enum CurveType : short
+	{
+		kNone = 0,
+		kBezier = 1,
+		kCubicTBezier = 2,
+		kBSpline = 3,
+	};
+
+	void initializeSegments(unsigned int segmentCount);
+	void computeSegmentLengths(unsigned int firstSegmentIndex, unsigned int lastSegmentIndex);
+	void computeSpeeds(const double* parameters, unsigned int count, double* outSpeeds) const;
+	double integrateSpeed(double lowerParameter, double upperParameter) const;
+	unsigned int getSegmentIndex(double t) const;
+
+	CurveType m_curveType;
+	unsigned int m_degree;
+	unsigned int m_spanSubdivisions;
+	double m_lowerBound;
+	double m_upperBound;
+	std::vector<double> m_knots;
+	std::vector<MVector> m_controlPoints;
+	// Cubic T-Bezier chains store two shaping parameters and four control points for each unit span
+	std::vector<double> m_shapes;
+	std::vector<std::vector<MVector>> m_spanControlPoints;
+
+	// Each segment i spans the natural parameters [m_segmentParameters[i], m_segmentParameters[i + 1]]
+	// The cumulative lengths hold the arc-length at the start of each segment, the final element holds the total length
+	std::vector<double> m_segmentParameters;
+	std::vector<double> m_segmentLengths;
+	std::vector<double> m_cumulativeLengths;
 };
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,45 @@
+// This translation unit is compiled with AVX2 and FMA enabled (see CMakeLists.txt)
+// Nothing defined here may be called unless getSimdLevel() has returned kSimdAVX2
+
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+#include "spline_utils_batch.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if defined(MRS_SIMD_X86) && defined(__AVX2__)
+
+void sampleBatchAVX2(const BSplineBatchBlock& block)
+{
+	sampleBatchKernel<AVX2Pack>(block);
+}
+
+bool isSampleBatchAVX2Compiled()
+{
+	return true;
+}
+
+#else
+
+// The compiler has not been configured for AVX2, the dispatcher will never select this path
+void sampleBatchAVX2(const BSplineBatchBlock& /*block*/)
+{
+	assert(false);
+}
+
+bool isSampleBatchAVX2Compiled()
+{
+	return false;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,168 @@
+// Contains the batch evaluation kernel used by BSpline::sampleBatch()
+// This header is internal to the utils library, each translation unit instantiates the kernel with its own vector type
+// The vector types must be declared within an anonymous namespace so that instantiations compiled with different instruction sets never merge at link time
+// The kernel is restricted to raw arrays and the helpers of simd_utils_packs.h, see the considerations of that header
+
+#pragma once
+
+#include <cassert>
+
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// The kernel uses fixed size storage, curves of a higher degree will be evaluated using the per-sample functions
+const unsigned int kBatchMaxDegree = 7;
+// The number of samples whose knot intervals are resolved before they are passed to the kernel
+const unsigned int kBatchBlockSize = 256;
+
+// Describes a block of samples whose knot intervals have already been resolved, points and derivatives are held as consecutive (x, y, z) values
+struct BSplineBatchBlock
+{
+	unsigned int degree;
+	unsigned int count;
+	const double* knots;
+	const double* controlPoints;
+	const double* parameters;
+	const unsigned int* intervals;
+	double* outPoints;
+	double* outFirstDerivatives;
+};
+
+// Defined by a translation unit compiled with AVX2 and FMA enabled, must only be called if getSimdLevel() returns kSimdAVX2
+void sampleBatchAVX2(const BSplineBatchBlock& block);
+// Returns false if the above translation unit was built without AVX2 enabled (eg. an unsupported compiler configuration)
+bool isSampleBatchAVX2Compiled();
+
+/*	Description
+	-----------
+	Evaluates the Carl de Boor recurrence for the position and first derivative of each sample in the block
+	Samples are processed in groups, each lane of the vector type holds the data for a single sample (structure of arrays)
+	- Every sample in a group is processed by the same sequence of operations regardless of its knot interval, the recurrence is therefore branch free
+	- The knots and control points of each sample's interval are gathered into lane-major storage so that each row can be loaded directly into a register
+	- If the number of samples is not a multiple of the width, the surplus lanes duplicate the last sample and their results are discarded
+
+	The recurrences match those of BSpline::sampleCurve() and BSpline::sampleDerivative(), however all indexing is relative to (interval - degree)
+	- Knots are therefore accessed over the local range [1, 2 * degree] and control points over [0, degree]
+
+	The vector types are declared in simd_utils_packs.h, the kernel only requires load(), set1(), store(), the arithmetic operators and fmadd()    */
+template <typename Pack>
+static void sampleBatchKernel(const BSplineBatchBlock& block)
+{
+	const unsigned int width = Pack::width;
+	const unsigned int degree = block.degree;
+	const bool isDerivativeRequired = block.outFirstDerivatives != nullptr;
+	assert(degree <= kBatchMaxDegree);
+	assert(degree >= 1 || !isDerivativeRequired);
+
+	double parameterLanes[width];
+	double knotLanes[2 * kBatchMaxDegree + 1][width];
+	double pointLanes[3][kBatchMaxDegree + 1][width];
+	double outLanes[3][width];
+
+	Pack knots[2 * kBatchMaxDegree + 1];
+	Pack qx[kBatchMaxDegree + 1];
+	Pack qy[kBatchMaxDegree + 1];
+	Pack qz[kBatchMaxDegree + 1];
+
+	for (unsigned int first = 0; first < block.count; first += width)
+	{
+		unsigned int laneCount = minCount(width, block.count - first);
+
+		// --- Gather ---
+		for (unsigned int lane = 0; lane < width; ++lane)
+		{
+			unsigned int sampleIndex = first + minCount(lane, laneCount - 1);
+			unsigned int base = block.intervals[sampleIndex] - degree;
+			parameterLanes[lane] = block.parameters[sampleIndex];
+
+			for (unsigned int j = 1; j <= 2 * degree; ++j)
+				knotLanes[j][lane] = block.knots[base + j];
+
+			for (unsigned int j = 0; j <= degree; ++j)
+			{
+				const double* controlPoint = block.controlPoints + (base + j) * 3;
+				pointLanes[0][j][lane] = controlPoint[0];
+				pointLanes[1][j][lane] = controlPoint[1];
+				pointLanes[2][j][lane] = controlPoint[2];
+			}
+		}
+
+		Pack t = Pack::load(parameterLanes);
+		for (unsigned int j = 1; j <= 2 * degree; ++j)
+			knots[j] = Pack::load(knotLanes[j]);
+
+		// --- Position ---
+		for (unsigned int j = 0; j <= degree; ++j)
+		{
+			qx[j] = Pack::load(pointLanes[0][j]);
+			qy[j] = Pack::load(pointLanes[1][j]);
+			qz[j] = Pack::load(pointLanes[2][j]);
+		}
+
+		for (unsigned int r = 1; r <= degree; ++r)
+		{
+			for (unsigned int c = 0; c <= degree - r; ++c)
+			{
+				Pack lower = knots[r + c];
+				Pack alpha = (t - lower) / (knots[c + 1 + degree] - lower);
+				qx[c] = fmadd(alpha, qx[c + 1] - qx[c], qx[c]);
+				qy[c] = fmadd(alpha, qy[c + 1] - qy[c], qy[c]);
+				qz[c] = fmadd(alpha, qz[c + 1] - qz[c], qz[c]);
+			}
+		}
+
+		qx[0].store(outLanes[0]);
+		qy[0].store(outLanes[1]);
+		qz[0].store(outLanes[2]);
+
+		for (unsigned int lane = 0; lane < laneCount; ++lane)
+			for (unsigned int axis = 0; axis < 3; ++axis)
+				block.outPoints[(first + lane) * 3 + axis] = outLanes[axis][lane];
+
+		if (!isDerivativeRequired)
+			continue;
+
+		// --- First Derivative ---
+		// The difference equation produces the control points of the derivative curve whose degree is one less
+		Pack scale = Pack::set1((double)degree);
+
+		for (unsigned int c = 0; c < degree; ++c)
+		{
+			Pack factor = scale / (knots[c + degree + 1] - knots[c + 1]);
+			qx[c] = factor * (Pack::load(pointLanes[0][c + 1]) - Pack::load(pointLanes[0][c]));
+			qy[c] = factor * (Pack::load(pointLanes[1][c + 1]) - Pack::load(pointLanes[1][c]));
+			qz[c] = factor * (Pack::load(pointLanes[2][c + 1]) - Pack::load(pointLanes[2][c]));
+		}
+
+		for (unsigned int r = 1; r < degree; ++r)
+		{
+			for (unsigned int c = 0; c < degree - r; ++c)
+			{
+				Pack lower = knots[r + c + 1];
+				Pack alpha = (t - lower) / (knots[c + 1 + degree] - lower);
+				qx[c] = fmadd(alpha, qx[c + 1] - qx[c], qx[c]);
+				qy[c] = fmadd(alpha, qy[c + 1] - qy[c], qy[c]);
+				qz[c] = fmadd(alpha, qz[c + 1] - qz[c], qz[c]);
+			}
+		}
+
+		qx[0].store(outLanes[0]);
+		qy[0].store(outLanes[1]);
+		qz[0].store(outLanes[2]);
+
+		for (unsigned int lane = 0; lane < laneCount; ++lane)
+			for (unsigned int axis = 0; axis < 3; ++axis)
+				block.outFirstDerivatives[(first + lane) * 3 + axis] = outLanes[axis][lane];
+	}
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "thread_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <maya/MThreadPool.h>
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ------ Helpers -------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+struct ParallelForTask
+{
+	unsigned int begin;
+	unsigned int end;
+	ParallelRangeFunc func;
+	void* data;
+};
+
+MThreadRetVal executeParallelForTask(void* data)
+{
+	ParallelForTask* task = static_cast<ParallelForTask*>(data);
+	task->func(task->begin, task->end, task->data);
+	return (MThreadRetVal)0;
+}
+
+void executeParallelForRegion(void* data, MThreadRootTask* root)
+{
+	std::vector<ParallelForTask>& tasks = *static_cast<std::vector<ParallelForTask>*>(data);
+
+	for (ParallelForTask& task : tasks)
+		MThreadPool::createTask(executeParallelForTask, &task, root);
+
+	MThreadPool::executeAndJoin(root);
+}
+
+} // anonymous
+
+/*	Description
+	-----------
+	Creates a task for each chunk of the range and executes them within a new parallel region
+	If the thread pool cannot be initialized, the chunks are executed in order on the calling thread    */
+void parallelForRange(unsigned int begin, unsigned int end, unsigned int grainSize, ParallelRangeFunc func, void* data)
+{
+	if (end <= begin)
+		return;
+
+	unsigned int count = end - begin;
+	grainSize = std::max(grainSize, 1u);
+
+	if (count <= grainSize)
+	{
+		func(begin, end, data);
+		return;
+	}
+
+	unsigned int chunkCount = (count - 1) / grainSize + 1;
+	std::vector<ParallelForTask> tasks(chunkCount);
+
+	for (unsigned int i = 0; i < chunkCount; ++i)
+	{
+		tasks[i].begin = begin + i * grainSize;
+		tasks[i].end = i == chunkCount - 1 ? end : tasks[i].begin + grainSize;
+		tasks[i].func = func;
+		tasks[i].data = data;
+	}
+
+	// The thread pool is reference counted, initialization is only expensive the first time it occurs
+	if (!MThreadPool::init())
+	{
+		for (ParallelForTask& task : tasks)
+			task.func(task.begin, task.end, task.data);
+
+		return;
+	}
+
+	MThreadPool::newParallelRegion(executeParallelForRegion, &tasks);
+	MThreadPool::release();
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,54 @@
+// Contains a set of helpers for distributing independent loop iterations over Maya's thread pool
+// Work is divided into contiguous chunks whose boundaries depend only on the range and grain size, never on the number of threads
+// Each iteration must therefore only write to its own elements so that the results are identical to those of a serial loop
+
+#pragma once
+
+#include <limits>
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// The default number of iterations processed by a single task, large enough to amortize the cost of scheduling a task for light per-sample work
+const unsigned int kDefaultGrainSize = 128;
+// Passing this grain size will cause every loop to run on the calling thread (ie. can be used to force serial evaluation for debugging)
+const unsigned int kSerialGrainSize = std::numeric_limits<unsigned int>::max();
+
+// Invoked with the half-open range of iterations [begin, end) belonging to a single chunk
+typedef void (*ParallelRangeFunc)(unsigned int begin, unsigned int end, void* data);
+
+// Type erased implementation, see parallelFor()
+void parallelForRange(unsigned int begin, unsigned int end, unsigned int grainSize, ParallelRangeFunc func, void* data);
+
+/*	Description
+	-----------
+	Splits the half-open range [begin, end) into chunks of at most grainSize iterations and invokes func(chunkBegin, chunkEnd) for each chunk
+	- Chunks are executed as tasks of a parallel region in Maya's thread pool and this function returns once every chunk has completed
+	- If the range does not exceed the grain size, func is invoked once on the calling thread and no task is created
+	- Nested calls are supported, Maya's thread pool will schedule the inner region on the threads which are available
+
+	Args
+	----
+	func = Callable object with the signature void(unsigned int begin, unsigned int end) const, must be safe to invoke concurrently for disjoint ranges    */
+template <typename Function>
+void parallelFor(unsigned int begin, unsigned int end, unsigned int grainSize, const Function& func)
+{
+	struct Invoker
+	{
+		static void invoke(unsigned int chunkBegin, unsigned int chunkEnd, void* data)
+		{
+			(*static_cast<const Function*>(data))(chunkBegin, chunkEnd);
+		}
+	};
+
+	parallelForRange(begin, end, grainSize, &Invoker::invoke, const_cast<Function*>(&func));
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "vector_array_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+#include "vector_array_utils_kernels.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+/*	Returns the kernels for the highest instruction set supported by the current machine
+	The selection is made once, the function pointers are then shared by every call    */
+const VectorArrayKernels& getVectorArrayKernels()
+{
+	static const VectorArrayKernels baseKernels = makeVectorArrayKernels<BasePack>();
+	static const bool isAVX2Enabled = getSimdLevel() == kSimdAVX2 && isVectorArrayAVX2Compiled();
+
+	return isAVX2Enabled ? getVectorArrayKernelsAVX2() : baseKernels;
+}
+
+// Number of doubles which span the alignment, the capacity of each lane is a multiple of this value so that every lane begins on an aligned address
+const unsigned int kLaneStep = kVectorArrayAlignment / sizeof(double);
+
+} // anonymous
+
+// ------ VectorArray ------
+
+VectorArray::VectorArray() :
+	m_storage{ nullptr },
+	m_lanes{ nullptr },
+	m_size{ 0 },
+	m_capacity{ 0 }
+{}
+
+VectorArray::VectorArray(const VectorArray& other) :
+	VectorArray()
+{
+	*this = other;
+}
+
+VectorArray::VectorArray(VectorArray&& other) :
+	VectorArray()
+{
+	*this = std::move(other);
+}
+
+VectorArray::~VectorArray() {}
+
+VectorArray& VectorArray::operator=(const VectorArray& other)
+{
+	if (this == &other)
+		return *this;
+
+	m_size = 0;
+	resize(other.m_size);
+	copy(other, 0, 0, other.m_size);
+
+	return *this;
+}
+
+VectorArray& VectorArray::operator=(VectorArray&& other)
+{
+	if (this == &other)
+		return *this;
+
+	m_storage = std::move(other.m_storage);
+	m_lanes = other.m_lanes;
+	m_size = other.m_size;
+	m_capacity = other.m_capacity;
+
+	other.m_lanes = nullptr;
+	other.m_size = 0;
+	other.m_capacity = 0;
+
+	return *this;
+}
+
+void VectorArray::resize(unsigned int size)
+{
+	if (size > m_capacity)
+		reserve(std::max(size, m_capacity + m_capacity / 2));
+
+	m_size = size;
+}
+
+void VectorArray::copy(const VectorArray& source, unsigned int sourceIndex, unsigned int index, unsigned int count)
+{
+	assert(sourceIndex + count <= source.m_size && index + count <= m_size);
+
+	ConstVectorLanes sourceLanes = source.lanes();
+	VectorLanes destLanes = lanes();
+	std::copy(sourceLanes.x + sourceIndex, sourceLanes.x + sourceIndex + count, destLanes.x + index);
+	std::copy(sourceLanes.y + sourceIndex, sourceLanes.y + sourceIndex + count, destLanes.y + index);
+	std::copy(sourceLanes.z + sourceIndex, sourceLanes.z + sourceIndex + count, destLanes.z + index);
+}
+
+void VectorArray::gather(unsigned int index, unsigned int stride, unsigned int count, VectorLanes outLanes) const
+{
+	assert(count == 0 || index + (count - 1) * stride < m_size);
+
+	ConstVectorLanes sourceLanes = lanes();
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		unsigned int sourceIndex = index + i * stride;
+		outLanes.x[i] = sourceLanes.x[sourceIndex];
+		outLanes.y[i] = sourceLanes.y[sourceIndex];
+		outLanes.z[i] = sourceLanes.z[sourceIndex];
+	}
+}
+
+void VectorArray::scatter(ConstVectorLanes lanes, unsigned int index, unsigned int stride, unsigned int count)
+{
+	assert(count == 0 || index + (count - 1) * stride < m_size);
+
+	VectorLanes destLanes = this->lanes();
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		unsigned int destIndex = index + i * stride;
+		destLanes.x[destIndex] = lanes.x[i];
+		destLanes.y[destIndex] = lanes.y[i];
+		destLanes.z[destIndex] = lanes.z[i];
+	}
+}
+
+/*	Reallocates the lanes such that each can hold at least the given number of elements, the existing elements are moved to the new lanes
+	The allocation is over-sized by the alignment so that the first lane can be placed on an aligned address within it    */
+void VectorArray::reserve(unsigned int capacity)
+{
+	unsigned int alignedCapacity = (capacity + kLaneStep - 1) / kLaneStep * kLaneStep;
+	std::unique_ptr<char[]> storage{ new char[3 * alignedCapacity * sizeof(double) + kVectorArrayAlignment] };
+
+	std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.get());
+	std::uintptr_t alignedAddress = (address + kVectorArrayAlignment - 1) & ~(std::uintptr_t)(kVectorArrayAlignment - 1);
+	double* lanes = reinterpret_cast<double*>(alignedAddress);
+
+	for (unsigned int lane = 0; lane < 3; ++lane)
+		std::copy(m_lanes + lane * m_capacity, m_lanes + lane * m_capacity + m_size, lanes + lane * alignedCapacity);
+
+	m_storage = std::move(storage);
+	m_lanes = lanes;
+	m_capacity = alignedCapacity;
+}
+
+// ------ Frames ------
+
+void rotateVectorPairs(const double* angles, unsigned int count, VectorLanes inOutU, VectorLanes inOutV)
+{
+	double* const uLanes[3] = { inOutU.x, inOutU.y, inOutU.z };
+	double* const vLanes[3] = { inOutV.x, inOutV.y, inOutV.z };
+	getVectorArrayKernels().rotatePairs(angles, count, uLanes, vLanes);
+}
+
+void scaleVectors(const double* factors, unsigned int count, VectorLanes inOutVectors)
+{
+	double* const lanes[3] = { inOutVectors.x, inOutVectors.y, inOutVectors.z };
+	getVectorArrayKernels().scale(factors, count, lanes);
+}
+
+void addScaledVectors(const double* factors, ConstVectorLanes directions, unsigned int count, VectorLanes inOutVectors)
+{
+	const double* const directionLanes[3] = { directions.x, directions.y, directions.z };
+	double* const lanes[3] = { inOutVectors.x, inOutVectors.y, inOutVectors.z };
+	getVectorArrayKernels().addScaled(factors, directionLanes, count, lanes);
+}
+
+// ------ Conversion ------
+
+/*	Each component is read from a contiguous lane, the interleaved writes are the only strided access
+	The conversion is simple enough for the compiler to vectorize at the baseline instruction set, it therefore has no dispatched kernel    */
+unsigned int convertVectorsToFloat(ConstVectorLanes vectors, unsigned int count, float* dest)
+{
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		dest[i * 3] = (float)vectors.x[i];
+		dest[i * 3 + 1] = (float)vectors.y[i];
+		dest[i * 3 + 2] = (float)vectors.z[i];
+	}
+
+	return count * 3;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,138 @@
+// Contains an aligned structure of arrays container for vectors along with a set of vectorized functions which are applied to its lanes
+// Each function selects a kernel for the highest instruction set supported by the current machine (see simd_utils.h)
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+
+#include <maya/MVector.h>
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Lanes begin on a cache line, which also satisfies the alignment of every vector type declared in simd_utils_packs.h
+const unsigned int kVectorArrayAlignment = 64;
+
+// Callers which stage data for the functions below should pass at most this many vectors per call, allowing inputs to be staged in a fixed size buffer
+const unsigned int kVectorArrayGrainSize = 128;
+
+// Pointers to the first element of each lane of a structure of arrays, the lanes may belong to a VectorArray or to a caller's staging buffer
+struct VectorLanes
+{
+	double* x;
+	double* y;
+	double* z;
+
+	VectorLanes offset(unsigned int index) const { return VectorLanes{ x + index, y + index, z + index }; }
+};
+
+struct ConstVectorLanes
+{
+	const double* x;
+	const double* y;
+	const double* z;
+
+	ConstVectorLanes(const double* x, const double* y, const double* z) : x{ x }, y{ y }, z{ z } {}
+	ConstVectorLanes(const VectorLanes& lanes) : x{ lanes.x }, y{ lanes.y }, z{ lanes.z } {}
+	// Views a single vector as lanes of one element
+	explicit ConstVectorLanes(const MVector& vector) : x{ &vector.x }, y{ &vector.y }, z{ &vector.z } {}
+
+	ConstVectorLanes offset(unsigned int index) const { return ConstVectorLanes{ x + index, y + index, z + index }; }
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Holds an array of vectors as three contiguous lanes of components (x, y, z), each lane is aligned to kVectorArrayAlignment bytes
+	Functions which process many vectors can therefore load the same component of several consecutive vectors with a single instruction
+
+	Considerations
+	--------------
+	The components of a vector are not contiguous, elements are read by value and written with set() as there is no MVector to reference
+	- The lanes are stored in a single allocation, the capacity of each lane is padded to a multiple of the alignment
+	- Resizing preserves the existing elements, new elements are not initialized
+	- Distinct elements may be written concurrently, the lanes are only reallocated by resize() and assignment    */
+class VectorArray
+{
+public:
+	VectorArray();
+	VectorArray(const VectorArray& other);
+	VectorArray(VectorArray&& other);
+	~VectorArray();
+
+	VectorArray& operator=(const VectorArray& other);
+	VectorArray& operator=(VectorArray&& other);
+
+	void resize(unsigned int size);
+	void clear() { m_size = 0; }
+
+	unsigned int size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+
+	MVector operator[](unsigned int index) const
+	{
+		assert(index < m_size);
+		return MVector{ m_lanes[index], m_lanes[m_capacity + index], m_lanes[2 * m_capacity + index] };
+	}
+
+	void set(unsigned int index, const MVector& vector)
+	{
+		assert(index < m_size);
+		m_lanes[index] = vector.x;
+		m_lanes[m_capacity + index] = vector.y;
+		m_lanes[2 * m_capacity + index] = vector.z;
+	}
+
+	// Copies count elements of the source, beginning from the given index of each array
+	void copy(const VectorArray& source, unsigned int sourceIndex, unsigned int index, unsigned int count);
+	// Copies count elements at every stride'th index beginning from the given index into contiguous lanes (gather) or from contiguous lanes (scatter)
+	void gather(unsigned int index, unsigned int stride, unsigned int count, VectorLanes outLanes) const;
+	void scatter(ConstVectorLanes lanes, unsigned int index, unsigned int stride, unsigned int count);
+
+	VectorLanes lanes() { return VectorLanes{ m_lanes, m_lanes + m_capacity, m_lanes + 2 * m_capacity }; }
+	ConstVectorLanes lanes() const { return ConstVectorLanes{ m_lanes, m_lanes + m_capacity, m_lanes + 2 * m_capacity }; }
+
+private:
+	void reserve(unsigned int capacity);
+
+	std::unique_ptr<char[]> m_storage;
+	double* m_lanes;
+	unsigned int m_size;
+	unsigned int m_capacity;
+};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	The functions below process count vectors of the given lanes, several vectors are processed per instruction
+	- Input and output lanes must contain at least count elements, an output may alias the input it is computed from
+	- Results are deterministic for a given machine but may differ in the last bit between machines, as the AVX2 kernels use fused multiply-add
+	- The sine and cosine of each angle are evaluated by the vectorized trigonometry of simd_math_utils.h    */
+
+// ------ Frames ------
+
+// Rotates each pair of vectors about their common perpendicular, ie. u' = u * cos(angle) + v * sin(angle) and v' = v * cos(angle) - u * sin(angle)
+void rotateVectorPairs(const double* angles, unsigned int count, VectorLanes inOutU, VectorLanes inOutV);
+
+// Computes inOutVectors[i] = inOutVectors[i] * factors[i]
+void scaleVectors(const double* factors, unsigned int count, VectorLanes inOutVectors);
+
+// Computes inOutVectors[i] = inOutVectors[i] + directions[i] * factors[i]
+void addScaledVectors(const double* factors, ConstVectorLanes directions, unsigned int count, VectorLanes inOutVectors);
+
+// ------ Conversion ------
+
+// Writes the components of each vector in single precision (x, y, z), returns the number of floats written
+unsigned int convertVectorsToFloat(ConstVectorLanes vectors, unsigned int count, float* dest);
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,48 @@
+// This translation unit is compiled with AVX2 and FMA enabled (see CMakeLists.txt)
+// Nothing defined here may be called unless getSimdLevel() has returned kSimdAVX2
+
+#include "simd_utils.h"
+#include "simd_utils_packs.h"
+#include "vector_array_utils_kernels.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if defined(MRS_SIMD_X86) && defined(__AVX2__)
+
+const VectorArrayKernels& getVectorArrayKernelsAVX2()
+{
+	static const VectorArrayKernels kernels = makeVectorArrayKernels<AVX2Pack>();
+	return kernels;
+}
+
+bool isVectorArrayAVX2Compiled()
+{
+	return true;
+}
+
+#else
+
+// The compiler has not been configured for AVX2, the dispatcher will never select this path
+const VectorArrayKernels& getVectorArrayKernelsAVX2()
+{
+	assert(false);
+	static const VectorArrayKernels kernels = VectorArrayKernels();
+	return kernels;
+}
+
+bool isVectorArrayAVX2Compiled()
+{
+	return false;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
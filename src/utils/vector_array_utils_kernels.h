@@ -0,0 +1,196 @@
+// Contains the vectorized kernels used by the functions of vector_array_utils.h
+// This header is internal to the utils library, each translation unit instantiates the kernels with its own vector type
+// The vector types must be declared within an anonymous namespace so that instantiations compiled with different instruction sets never merge at link time
+// The kernels are restricted to raw arrays and the helpers of simd_utils_packs.h, see the considerations of that header
+
+#pragma once
+
+#include <cassert>
+
+#include "simd_math_utils_kernels.h"
+#include "simd_utils_packs.h"
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MRS {
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Functions which are instantiated by each translation unit, see vector_array_utils.h for a description of each function
+	Each set of lanes is passed as three pointers to the (x, y, z) lanes, the baseline translation unit unpacks VectorLanes and ConstVectorLanes    */
+struct VectorArrayKernels
+{
+	void (*rotatePairs)(const double* angles, unsigned int count, double* const* inOutU, double* const* inOutV);
+	void (*scale)(const double* factors, unsigned int count, double* const* inOutVectors);
+	void (*addScaled)(const double* factors, const double* const* directions, unsigned int count, double* const* inOutVectors);
+};
+
+// Defined by a translation unit compiled with AVX2 and FMA enabled, must only be used if getSimdLevel() returns kSimdAVX2
+const VectorArrayKernels& getVectorArrayKernelsAVX2();
+// Returns false if the above translation unit was built without AVX2 enabled (eg. an unsupported compiler configuration)
+bool isVectorArrayAVX2Compiled();
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*	Description
+	-----------
+	Each lane of the vector type holds the same component of consecutive vectors, the components are loaded directly from the lanes of the arrays
+	If the number of vectors is not a multiple of the width, the remaining vectors are staged in a buffer which duplicates the last vector and the surplus results are discarded
+
+	The vector types are declared in simd_utils_packs.h, which describes the operations each type must provide    */
+
+// ------ Helpers ------
+
+// Copies the tail of a lane into a full width buffer, surplus lanes duplicate the last element
+template <unsigned int Width>
+static void stageTail(const double* lane, unsigned int laneCount, double (&outLanes)[Width])
+{
+	for (unsigned int i = 0; i < Width; ++i)
+		outLanes[i] = lane[minCount(i, laneCount - 1)];
+}
+
+// ------ Kernels ------
+
+template <typename Pack>
+static void rotatePairsPack(const Pack& angle, Pack (&u)[3], Pack (&v)[3])
+{
+	Pack s, c;
+	sinCosPack(angle, s, c);
+
+	for (unsigned int axis = 0; axis < 3; ++axis)
+	{
+		Pack rotatedU = fmadd(u[axis], c, v[axis] * s);
+		Pack rotatedV = v[axis] * c - u[axis] * s;
+		u[axis] = rotatedU;
+		v[axis] = rotatedV;
+	}
+}
+
+template <typename Pack>
+static void rotatePairsKernel(const double* angles, unsigned int count, double* const* uLanes, double* const* vLanes)
+{
+	const unsigned int width = Pack::width;
+	unsigned int first = 0;
+	Pack u[3], v[3];
+
+	for (; first + width <= count; first += width)
+	{
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			u[axis] = Pack::load(uLanes[axis] + first);
+			v[axis] = Pack::load(vLanes[axis] + first);
+		}
+
+		rotatePairsPack(Pack::load(angles + first), u, v);
+
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			u[axis].store(uLanes[axis] + first);
+			v[axis].store(vLanes[axis] + first);
+		}
+	}
+
+	if (first < count)
+	{
+		unsigned int laneCount = count - first;
+		double angleLanes[width];
+		double tailLanes[6][width];
+		stageTail(angles + first, laneCount, angleLanes);
+
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			stageTail(uLanes[axis] + first, laneCount, tailLanes[axis]);
+			stageTail(vLanes[axis] + first, laneCount, tailLanes[axis + 3]);
+			u[axis] = Pack::load(tailLanes[axis]);
+			v[axis] = Pack::load(tailLanes[axis + 3]);
+		}
+
+		rotatePairsPack(Pack::load(angleLanes), u, v);
+
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			u[axis].store(tailLanes[axis]);
+			v[axis].store(tailLanes[axis + 3]);
+			copyValues(tailLanes[axis], laneCount, uLanes[axis] + first);
+			copyValues(tailLanes[axis + 3], laneCount, vLanes[axis] + first);
+		}
+	}
+}
+
+template <typename Pack>
+static void scaleKernel(const double* factors, unsigned int count, double* const* lanes)
+{
+	const unsigned int width = Pack::width;
+	unsigned int first = 0;
+
+	for (; first + width <= count; first += width)
+	{
+		Pack factor = Pack::load(factors + first);
+		for (unsigned int axis = 0; axis < 3; ++axis)
+			(Pack::load(lanes[axis] + first) * factor).store(lanes[axis] + first);
+	}
+
+	if (first < count)
+	{
+		unsigned int laneCount = count - first;
+		double factorLanes[width];
+		double tailLanes[width];
+		stageTail(factors + first, laneCount, factorLanes);
+
+		Pack factor = Pack::load(factorLanes);
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			stageTail(lanes[axis] + first, laneCount, tailLanes);
+			(Pack::load(tailLanes) * factor).store(tailLanes);
+			copyValues(tailLanes, laneCount, lanes[axis] + first);
+		}
+	}
+}
+
+template <typename Pack>
+static void addScaledKernel(const double* factors, const double* const* directionLanes, unsigned int count, double* const* lanes)
+{
+	const unsigned int width = Pack::width;
+	unsigned int first = 0;
+
+	for (; first + width <= count; first += width)
+	{
+		Pack factor = Pack::load(factors + first);
+		for (unsigned int axis = 0; axis < 3; ++axis)
+			fmadd(Pack::load(directionLanes[axis] + first), factor, Pack::load(lanes[axis] + first)).store(lanes[axis] + first);
+	}
+
+	if (first < count)
+	{
+		unsigned int laneCount = count - first;
+		double factorLanes[width];
+		double directionTailLanes[width];
+		double tailLanes[width];
+		stageTail(factors + first, laneCount, factorLanes);
+
+		Pack factor = Pack::load(factorLanes);
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			stageTail(directionLanes[axis] + first, laneCount, directionTailLanes);
+			stageTail(lanes[axis] + first, laneCount, tailLanes);
+			fmadd(Pack::load(directionTailLanes), factor, Pack::load(tailLanes)).store(tailLanes);
+			copyValues(tailLanes, laneCount, lanes[axis] + first);
+		}
+	}
+}
+
+template <typename Pack>
+static VectorArrayKernels makeVectorArrayKernels()
+{
+	VectorArrayKernels kernels;
+	kernels.rotatePairs = &rotatePairsKernel<Pack>;
+	kernels.scale = &scaleKernel<Pack>;
+	kernels.addScaled = &addScaledKernel<Pack>;
+	return kernels;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+} // MRS
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
\ No newline at end of file